@@ -15,6 +15,7 @@
 #include "TweenManagerComponent.h"
 #include "Utils/Utility.h"
 #include "Tweens/BaseTween.h"
+#include "Utils/TweenRecorder.h"
 
 // public ----------------------------------------------------------------------
 UTweenContainer::UTweenContainer(const FObjectInitializer& ObjectInitializer)
@@ -33,6 +34,9 @@ UTweenContainer::UTweenContainer(const FObjectInitializer& ObjectInitializer)
     , bIsTweenContainerPendingDeletion(false)
     , bHasStartedTweening(false)
     , bShouldTweenWhileGamePaused(false)
+    , mLastUpdateCost(0.0f)
+    , mNumEventsAtLastUpdate(0)
+    , mNumSweepsAtLastUpdate(0)
 {
 
 }
@@ -108,7 +112,9 @@ void UTweenContainer::AddParallelTween(UBaseTween* pNewTween, int32 pSequenceId)
 // public ----------------------------------------------------------------------
 bool UTweenContainer::UpdateTweens(float pDeltaTime)
 {
-    bHasStartedTweening = true;
+    bHasStartedTweening    = true;
+    mNumEventsAtLastUpdate = 0;
+    mNumSweepsAtLastUpdate = 0;
 
     bool areSequencesDone = false;
 
@@ -188,6 +194,8 @@ bool UTweenContainer::UpdateTweens(float pDeltaTime)
                 }
 
                 // In any case, whether it's looping or not, call the container's end delegate(s), if bound
+                mNumEventsAtLastUpdate++;
+
                 if (OnTweenContainerEnd.IsBound())
                 {
                     OnTweenContainerEnd.Broadcast(this);
@@ -213,6 +221,24 @@ bool UTweenContainer::IsEmpty() const
     return mSequences.Num() == 0;
 }
 
+// public ----------------------------------------------------------------------
+float UTweenContainer::GetLastUpdateCost() const
+{
+    return mLastUpdateCost;
+}
+
+// public ----------------------------------------------------------------------
+int32 UTweenContainer::GetNumEventsAtLastUpdate() const
+{
+    return mNumEventsAtLastUpdate;
+}
+
+// public ----------------------------------------------------------------------
+int32 UTweenContainer::GetNumSweepsAtLastUpdate() const
+{
+    return mNumSweepsAtLastUpdate;
+}
+
 // public ----------------------------------------------------------------------
 int32 UTweenContainer::GetSequencesNum() const
 {
@@ -240,6 +266,8 @@ void UTweenContainer::BeginDestroy()
 // public ----------------------------------------------------------------------
 void UTweenContainer::SetTimeScale(float pNewTimeScale)
 {
+    TWEEN_RECORD(this, RecordContainerOp(ETweenRecordOp::ContainerTimeScale, this, pNewTimeScale));
+
     // If one of them is negative, the result will be negative, meaning that there
     // is a sign difference and the Tweens should be inverted
     if (pNewTimeScale * mTimeScale < 0)
@@ -256,6 +284,8 @@ void UTweenContainer::SetTimeScale(float pNewTimeScale)
 // public ----------------------------------------------------------------------
 void UTweenContainer::SetLoop(int pNumLoops, ETweenLoopType pLoopType)
 {
+    TWEEN_RECORD(this, RecordContainerLoop(this, pNumLoops, pLoopType));
+
     mNumLoops = pNumLoops;
     mLoopType = pLoopType;
 }
@@ -263,12 +293,16 @@ void UTweenContainer::SetLoop(int pNumLoops, ETweenLoopType pLoopType)
 // public ----------------------------------------------------------------------
 void UTweenContainer::SetPersistent(bool pPersistent)
 {
+    TWEEN_RECORD(this, RecordContainerOp(ETweenRecordOp::ContainerPersistent, this, 0.0f, pPersistent ? 1 : 0));
+
     bIsPersistent = pPersistent;
 }
 
 // public ----------------------------------------------------------------------
 void UTweenContainer::PauseTweenContainer()
 {
+    TWEEN_RECORD(this, RecordContainerOp(ETweenRecordOp::ContainerPause, this));
+
     bIsTweenContainerPaused = true;
 }
 
@@ -281,18 +315,24 @@ bool UTweenContainer::IsPaused() const
 // public ----------------------------------------------------------------------
 void UTweenContainer::TogglePauseTweenContainer()
 {
+    TWEEN_RECORD(this, RecordContainerOp(ETweenRecordOp::ContainerTogglePause, this));
+
     bIsTweenContainerPaused = !bIsTweenContainerPaused;
 }
 
 // public ----------------------------------------------------------------------
 void UTweenContainer::ResumeTweenContainer()
 {
+    TWEEN_RECORD(this, RecordContainerOp(ETweenRecordOp::ContainerResume, this));
+
     bIsTweenContainerPaused = false;
 }
 
 // public ----------------------------------------------------------------------
 void UTweenContainer::RestartTweenContainer()
 {
+    TWEEN_RECORD(this, RecordContainerOp(ETweenRecordOp::ContainerRestart, this));
+
     bIsTweenContainerPaused = false;
     bAreSequencesDone = false;
 
@@ -341,6 +381,8 @@ void UTweenContainer::RestartTweenContainer()
 // public ----------------------------------------------------------------------
 void UTweenContainer::DeleteTweenContainer()
 {
+    TWEEN_RECORD(this, RecordContainerOp(ETweenRecordOp::ContainerDelete, this));
+
     bIsTweenContainerPendingDeletion = true;
 }
 
@@ -706,6 +748,110 @@ UTweenVector* UTweenContainer::AppendTweenCustomVector(UObject* pTweenTarget,
                                                                    pTweenWhileGameIsPaused);
 }
 
+// public ----------------------------------------------------------------------
+UTweenVector* UTweenContainer::AppendTweenMoveInstanceTo(UInstancedStaticMeshComponent* pTweenTarget,
+                                                         int32 pInstanceIndex,
+                                                         const FVector& pTo,
+                                                         float pDuration,
+                                                         ETweenEaseType pEaseType,
+                                                         ETweenSpace pTweenSpace,
+                                                         int32 pNumLoops,
+                                                         ETweenLoopType pLoopType,
+                                                         float pDelay,
+                                                         float pTimeScale,
+                                                         bool pTweenWhileGameIsPaused)
+{
+    return UTweenVectorStandardFactory::BP_AppendTweenMoveInstanceTo(this,
+                                                                     pTweenTarget,
+                                                                     pInstanceIndex,
+                                                                     pTo,
+                                                                     pDuration,
+                                                                     pEaseType,
+                                                                     pTweenSpace,
+                                                                     pNumLoops,
+                                                                     pLoopType,
+                                                                     pDelay,
+                                                                     pTimeScale,
+                                                                     pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenVector* UTweenContainer::AppendTweenMoveInstanceBy(UInstancedStaticMeshComponent* pTweenTarget,
+                                                         int32 pInstanceIndex,
+                                                         const FVector& pBy,
+                                                         float pDuration,
+                                                         ETweenEaseType pEaseType,
+                                                         int32 pNumLoops,
+                                                         ETweenLoopType pLoopType,
+                                                         float pDelay,
+                                                         float pTimeScale,
+                                                         bool pTweenWhileGameIsPaused)
+{
+    return UTweenVectorStandardFactory::BP_AppendTweenMoveInstanceBy(this,
+                                                                     pTweenTarget,
+                                                                     pInstanceIndex,
+                                                                     pBy,
+                                                                     pDuration,
+                                                                     pEaseType,
+                                                                     pNumLoops,
+                                                                     pLoopType,
+                                                                     pDelay,
+                                                                     pTimeScale,
+                                                                     pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenVector* UTweenContainer::AppendTweenScaleInstanceTo(UInstancedStaticMeshComponent* pTweenTarget,
+                                                          int32 pInstanceIndex,
+                                                          const FVector& pTo,
+                                                          float pDuration,
+                                                          ETweenEaseType pEaseType,
+                                                          ETweenSpace pTweenSpace,
+                                                          int32 pNumLoops,
+                                                          ETweenLoopType pLoopType,
+                                                          float pDelay,
+                                                          float pTimeScale,
+                                                          bool pTweenWhileGameIsPaused)
+{
+    return UTweenVectorStandardFactory::BP_AppendTweenScaleInstanceTo(this,
+                                                                      pTweenTarget,
+                                                                      pInstanceIndex,
+                                                                      pTo,
+                                                                      pDuration,
+                                                                      pEaseType,
+                                                                      pTweenSpace,
+                                                                      pNumLoops,
+                                                                      pLoopType,
+                                                                      pDelay,
+                                                                      pTimeScale,
+                                                                      pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenVector* UTweenContainer::AppendTweenScaleInstanceBy(UInstancedStaticMeshComponent* pTweenTarget,
+                                                          int32 pInstanceIndex,
+                                                          const FVector& pBy,
+                                                          float pDuration,
+                                                          ETweenEaseType pEaseType,
+                                                          int32 pNumLoops,
+                                                          ETweenLoopType pLoopType,
+                                                          float pDelay,
+                                                          float pTimeScale,
+                                                          bool pTweenWhileGameIsPaused)
+{
+    return UTweenVectorStandardFactory::BP_AppendTweenScaleInstanceBy(this,
+                                                                      pTweenTarget,
+                                                                      pInstanceIndex,
+                                                                      pBy,
+                                                                      pDuration,
+                                                                      pEaseType,
+                                                                      pNumLoops,
+                                                                      pLoopType,
+                                                                      pDelay,
+                                                                      pTimeScale,
+                                                                      pTweenWhileGameIsPaused);
+}
+
 // public ----------------------------------------------------------------------
 UTweenRotator* UTweenContainer::AppendTweenRotateActorTo(AActor* pTweenTarget,
                                                          const FRotator& pTo,
@@ -826,6 +972,62 @@ UTweenRotator* UTweenContainer::AppendTweenRotateSceneComponentBy(USceneComponen
                                                                               pTweenWhileGameIsPaused);
 }
 
+// public ----------------------------------------------------------------------
+UTweenRotator* UTweenContainer::AppendTweenRotateInstanceTo(UInstancedStaticMeshComponent* pTweenTarget,
+                                                            int32 pInstanceIndex,
+                                                            const FRotator& pTo,
+                                                            float pDuration,
+                                                            ETweenEaseType pEaseType,
+                                                            ETweenSpace pTweenSpace,
+                                                            ETweenRotationMode pRotationMode,
+                                                            int32 pNumLoops,
+                                                            ETweenLoopType pLoopType,
+                                                            float pDelay,
+                                                            float pTimeScale,
+                                                            bool pTweenWhileGameIsPaused)
+{
+    return UTweenRotatorStandardFactory::BP_AppendTweenRotateInstanceTo(this,
+                                                                        pTweenTarget,
+                                                                        pInstanceIndex,
+                                                                        pTo,
+                                                                        pDuration,
+                                                                        pEaseType,
+                                                                        pTweenSpace,
+                                                                        pRotationMode,
+                                                                        pNumLoops,
+                                                                        pLoopType,
+                                                                        pDelay,
+                                                                        pTimeScale,
+                                                                        pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenRotator* UTweenContainer::AppendTweenRotateInstanceBy(UInstancedStaticMeshComponent* pTweenTarget,
+                                                            int32 pInstanceIndex,
+                                                            const FRotator& pBy,
+                                                            float pDuration,
+                                                            ETweenEaseType pEaseType,
+                                                            bool pLocalSpace,
+                                                            int32 pNumLoops,
+                                                            ETweenLoopType pLoopType,
+                                                            float pDelay,
+                                                            float pTimeScale,
+                                                            bool pTweenWhileGameIsPaused)
+{
+    return UTweenRotatorStandardFactory::BP_AppendTweenRotateInstanceBy(this,
+                                                                        pTweenTarget,
+                                                                        pInstanceIndex,
+                                                                        pBy,
+                                                                        pDuration,
+                                                                        pEaseType,
+                                                                        pLocalSpace,
+                                                                        pNumLoops,
+                                                                        pLoopType,
+                                                                        pDelay,
+                                                                        pTimeScale,
+                                                                        pTweenWhileGameIsPaused);
+}
+
 // public ----------------------------------------------------------------------
 UTweenLinearColor* UTweenContainer::AppendTweenMaterialVectorFromTo(UMaterialInstanceDynamic* pTweenTarget,
                                                                     const FName& pParameterName,
@@ -878,6 +1080,110 @@ UTweenLinearColor* UTweenContainer::AppendTweenMaterialVectorTo(UMaterialInstanc
                                                                             pTweenWhileGameIsPaused);
 }
 
+// public ----------------------------------------------------------------------
+UTweenLinearColor* UTweenContainer::AppendTweenCustomPrimitiveDataVectorFromTo(UPrimitiveComponent* pTweenTarget,
+                                                                               int32 pDataIndex,
+                                                                               const FLinearColor& pFrom,
+                                                                               const FLinearColor& pTo,
+                                                                               float pDuration,
+                                                                               ETweenEaseType pEaseType,
+                                                                               int32 pNumLoops,
+                                                                               ETweenLoopType pLoopType,
+                                                                               float pDelay,
+                                                                               float pTimeScale,
+                                                                               bool pTweenWhileGameIsPaused)
+{
+    return UTweenLinearColorStandardFactory::BP_AppendTweenCustomPrimitiveDataVectorFromTo(this,
+                                                                                           pTweenTarget,
+                                                                                           pDataIndex,
+                                                                                           pFrom,
+                                                                                           pTo,
+                                                                                           pDuration,
+                                                                                           pEaseType,
+                                                                                           pNumLoops,
+                                                                                           pLoopType,
+                                                                                           pDelay,
+                                                                                           pTimeScale,
+                                                                                           pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenLinearColor* UTweenContainer::AppendTweenCustomPrimitiveDataVectorTo(UPrimitiveComponent* pTweenTarget,
+                                                                           int32 pDataIndex,
+                                                                           const FLinearColor& pTo,
+                                                                           float pDuration,
+                                                                           ETweenEaseType pEaseType,
+                                                                           int32 pNumLoops,
+                                                                           ETweenLoopType pLoopType,
+                                                                           float pDelay,
+                                                                           float pTimeScale,
+                                                                           bool pTweenWhileGameIsPaused)
+{
+    return UTweenLinearColorStandardFactory::BP_AppendTweenCustomPrimitiveDataVectorTo(this,
+                                                                                       pTweenTarget,
+                                                                                       pDataIndex,
+                                                                                       pTo,
+                                                                                       pDuration,
+                                                                                       pEaseType,
+                                                                                       pNumLoops,
+                                                                                       pLoopType,
+                                                                                       pDelay,
+                                                                                       pTimeScale,
+                                                                                       pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenLinearColor* UTweenContainer::AppendTweenParameterCollectionVectorFromTo(UMaterialParameterCollection* pTweenTarget,
+                                                                               const FName& pParameterName,
+                                                                               const FLinearColor& pFrom,
+                                                                               const FLinearColor& pTo,
+                                                                               float pDuration,
+                                                                               ETweenEaseType pEaseType,
+                                                                               int32 pNumLoops,
+                                                                               ETweenLoopType pLoopType,
+                                                                               float pDelay,
+                                                                               float pTimeScale,
+                                                                               bool pTweenWhileGameIsPaused)
+{
+    return UTweenLinearColorStandardFactory::BP_AppendTweenParameterCollectionVectorFromTo(this,
+                                                                                           pTweenTarget,
+                                                                                           pParameterName,
+                                                                                           pFrom,
+                                                                                           pTo,
+                                                                                           pDuration,
+                                                                                           pEaseType,
+                                                                                           pNumLoops,
+                                                                                           pLoopType,
+                                                                                           pDelay,
+                                                                                           pTimeScale,
+                                                                                           pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenLinearColor* UTweenContainer::AppendTweenParameterCollectionVectorTo(UMaterialParameterCollection* pTweenTarget,
+                                                                           const FName& pParameterName,
+                                                                           const FLinearColor& pTo,
+                                                                           float pDuration,
+                                                                           ETweenEaseType pEaseType,
+                                                                           int32 pNumLoops,
+                                                                           ETweenLoopType pLoopType,
+                                                                           float pDelay,
+                                                                           float pTimeScale,
+                                                                           bool pTweenWhileGameIsPaused)
+{
+    return UTweenLinearColorStandardFactory::BP_AppendTweenParameterCollectionVectorTo(this,
+                                                                                       pTweenTarget,
+                                                                                       pParameterName,
+                                                                                       pTo,
+                                                                                       pDuration,
+                                                                                       pEaseType,
+                                                                                       pNumLoops,
+                                                                                       pLoopType,
+                                                                                       pDelay,
+                                                                                       pTimeScale,
+                                                                                       pTweenWhileGameIsPaused);
+}
+
 // public ----------------------------------------------------------------------
 UTweenFloat* UTweenContainer::AppendTweenMaterialFloatFromTo(UMaterialInstanceDynamic* pTweenTarget,
                                                              const FName& pParameterName,
@@ -930,6 +1236,110 @@ UTweenFloat* UTweenContainer::AppendTweenMaterialFloatTo(UMaterialInstanceDynami
                                                                      pTweenWhileGameIsPaused);
 }
 
+// public ----------------------------------------------------------------------
+UTweenFloat* UTweenContainer::AppendTweenCustomPrimitiveDataFloatFromTo(UPrimitiveComponent* pTweenTarget,
+                                                                        int32 pDataIndex,
+                                                                        float pFrom,
+                                                                        float pTo,
+                                                                        float pDuration,
+                                                                        ETweenEaseType pEaseType,
+                                                                        int32 pNumLoops,
+                                                                        ETweenLoopType pLoopType,
+                                                                        float pDelay,
+                                                                        float pTimeScale,
+                                                                        bool pTweenWhileGameIsPaused)
+{
+    return UTweenFloatStandardFactory::BP_AppendTweenCustomPrimitiveDataFloatFromTo(this,
+                                                                                    pTweenTarget,
+                                                                                    pDataIndex,
+                                                                                    pFrom,
+                                                                                    pTo,
+                                                                                    pDuration,
+                                                                                    pEaseType,
+                                                                                    pNumLoops,
+                                                                                    pLoopType,
+                                                                                    pDelay,
+                                                                                    pTimeScale,
+                                                                                    pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenFloat* UTweenContainer::AppendTweenCustomPrimitiveDataFloatTo(UPrimitiveComponent* pTweenTarget,
+                                                                    int32 pDataIndex,
+                                                                    float pTo,
+                                                                    float pDuration,
+                                                                    ETweenEaseType pEaseType,
+                                                                    int32 pNumLoops,
+                                                                    ETweenLoopType pLoopType,
+                                                                    float pDelay,
+                                                                    float pTimeScale,
+                                                                    bool pTweenWhileGameIsPaused)
+{
+    return UTweenFloatStandardFactory::BP_AppendTweenCustomPrimitiveDataFloatTo(this,
+                                                                                pTweenTarget,
+                                                                                pDataIndex,
+                                                                                pTo,
+                                                                                pDuration,
+                                                                                pEaseType,
+                                                                                pNumLoops,
+                                                                                pLoopType,
+                                                                                pDelay,
+                                                                                pTimeScale,
+                                                                                pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenFloat* UTweenContainer::AppendTweenParameterCollectionFloatFromTo(UMaterialParameterCollection* pTweenTarget,
+                                                                        const FName& pParameterName,
+                                                                        float pFrom,
+                                                                        float pTo,
+                                                                        float pDuration,
+                                                                        ETweenEaseType pEaseType,
+                                                                        int32 pNumLoops,
+                                                                        ETweenLoopType pLoopType,
+                                                                        float pDelay,
+                                                                        float pTimeScale,
+                                                                        bool pTweenWhileGameIsPaused)
+{
+    return UTweenFloatStandardFactory::BP_AppendTweenParameterCollectionFloatFromTo(this,
+                                                                                    pTweenTarget,
+                                                                                    pParameterName,
+                                                                                    pFrom,
+                                                                                    pTo,
+                                                                                    pDuration,
+                                                                                    pEaseType,
+                                                                                    pNumLoops,
+                                                                                    pLoopType,
+                                                                                    pDelay,
+                                                                                    pTimeScale,
+                                                                                    pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenFloat* UTweenContainer::AppendTweenParameterCollectionFloatTo(UMaterialParameterCollection* pTweenTarget,
+                                                                    const FName& pParameterName,
+                                                                    float pTo,
+                                                                    float pDuration,
+                                                                    ETweenEaseType pEaseType,
+                                                                    int32 pNumLoops,
+                                                                    ETweenLoopType pLoopType,
+                                                                    float pDelay,
+                                                                    float pTimeScale,
+                                                                    bool pTweenWhileGameIsPaused)
+{
+    return UTweenFloatStandardFactory::BP_AppendTweenParameterCollectionFloatTo(this,
+                                                                                pTweenTarget,
+                                                                                pParameterName,
+                                                                                pTo,
+                                                                                pDuration,
+                                                                                pEaseType,
+                                                                                pNumLoops,
+                                                                                pLoopType,
+                                                                                pDelay,
+                                                                                pTimeScale,
+                                                                                pTweenWhileGameIsPaused);
+}
+
 // public ----------------------------------------------------------------------
 UTweenFloat* UTweenContainer::AppendTweenRotateActorAroundPoint(AActor* pTweenTarget,
                                                                 FVector pPivotPoint,
@@ -1560,6 +1970,94 @@ UTweenVector* UTweenContainer::JoinTweenCustomVector(UObject* pTweenTarget,
                                                                  pTweenWhileGameIsPaused);
 }
 
+// public ----------------------------------------------------------------------
+UTweenVector* UTweenContainer::JoinTweenMoveInstanceTo(UInstancedStaticMeshComponent* pTweenTarget,
+                                                       int32 pInstanceIndex,
+                                                       const FVector& pTo,
+                                                       float pDuration,
+                                                       ETweenEaseType pEaseType,
+                                                       ETweenSpace pTweenSpace,
+                                                       float pDelay,
+                                                       float pTimeScale,
+                                                       bool pTweenWhileGameIsPaused)
+{
+    return UTweenVectorStandardFactory::BP_JoinTweenMoveInstanceTo(this,
+                                                                   pTweenTarget,
+                                                                   pInstanceIndex,
+                                                                   pTo,
+                                                                   pDuration,
+                                                                   pEaseType,
+                                                                   pTweenSpace,
+                                                                   pDelay,
+                                                                   pTimeScale,
+                                                                   pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenVector* UTweenContainer::JoinTweenMoveInstanceBy(UInstancedStaticMeshComponent* pTweenTarget,
+                                                       int32 pInstanceIndex,
+                                                       const FVector& pBy,
+                                                       float pDuration,
+                                                       ETweenEaseType pEaseType,
+                                                       float pDelay,
+                                                       float pTimeScale,
+                                                       bool pTweenWhileGameIsPaused)
+{
+    return UTweenVectorStandardFactory::BP_JoinTweenMoveInstanceBy(this,
+                                                                   pTweenTarget,
+                                                                   pInstanceIndex,
+                                                                   pBy,
+                                                                   pDuration,
+                                                                   pEaseType,
+                                                                   pDelay,
+                                                                   pTimeScale,
+                                                                   pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenVector* UTweenContainer::JoinTweenScaleInstanceTo(UInstancedStaticMeshComponent* pTweenTarget,
+                                                        int32 pInstanceIndex,
+                                                        const FVector& pTo,
+                                                        float pDuration,
+                                                        ETweenEaseType pEaseType,
+                                                        ETweenSpace pTweenSpace,
+                                                        float pDelay,
+                                                        float pTimeScale,
+                                                        bool pTweenWhileGameIsPaused)
+{
+    return UTweenVectorStandardFactory::BP_JoinTweenScaleInstanceTo(this,
+                                                                    pTweenTarget,
+                                                                    pInstanceIndex,
+                                                                    pTo,
+                                                                    pDuration,
+                                                                    pEaseType,
+                                                                    pTweenSpace,
+                                                                    pDelay,
+                                                                    pTimeScale,
+                                                                    pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenVector* UTweenContainer::JoinTweenScaleInstanceBy(UInstancedStaticMeshComponent* pTweenTarget,
+                                                        int32 pInstanceIndex,
+                                                        const FVector& pBy,
+                                                        float pDuration,
+                                                        ETweenEaseType pEaseType,
+                                                        float pDelay,
+                                                        float pTimeScale,
+                                                        bool pTweenWhileGameIsPaused)
+{
+    return UTweenVectorStandardFactory::BP_JoinTweenScaleInstanceBy(this,
+                                                                    pTweenTarget,
+                                                                    pInstanceIndex,
+                                                                    pBy,
+                                                                    pDuration,
+                                                                    pEaseType,
+                                                                    pDelay,
+                                                                    pTimeScale,
+                                                                    pTweenWhileGameIsPaused);
+}
+
 // public ----------------------------------------------------------------------
 UTweenRotator* UTweenContainer::JoinTweenRotateActorTo(AActor* pTweenTarget,
                                                        const FRotator& pTo,
@@ -1664,6 +2162,54 @@ UTweenRotator* UTweenContainer::JoinTweenRotateSceneComponentBy(USceneComponent*
                                                                             pTweenWhileGameIsPaused);
 }
 
+// public ----------------------------------------------------------------------
+UTweenRotator* UTweenContainer::JoinTweenRotateInstanceTo(UInstancedStaticMeshComponent* pTweenTarget,
+                                                          int32 pInstanceIndex,
+                                                          const FRotator& pTo,
+                                                          float pDuration,
+                                                          ETweenEaseType pEaseType,
+                                                          ETweenSpace pTweenSpace,
+                                                          ETweenRotationMode pRotationMode,
+                                                          float pDelay,
+                                                          float pTimeScale,
+                                                          bool pTweenWhileGameIsPaused)
+{
+    return UTweenRotatorStandardFactory::BP_JoinTweenRotateInstanceTo(this,
+                                                                      pTweenTarget,
+                                                                      pInstanceIndex,
+                                                                      pTo,
+                                                                      pDuration,
+                                                                      pEaseType,
+                                                                      pTweenSpace,
+                                                                      pRotationMode,
+                                                                      pDelay,
+                                                                      pTimeScale,
+                                                                      pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenRotator* UTweenContainer::JoinTweenRotateInstanceBy(UInstancedStaticMeshComponent* pTweenTarget,
+                                                          int32 pInstanceIndex,
+                                                          const FRotator& pBy,
+                                                          float pDuration,
+                                                          ETweenEaseType pEaseType,
+                                                          bool pLocalSpace,
+                                                          float pDelay,
+                                                          float pTimeScale,
+                                                          bool pTweenWhileGameIsPaused)
+{
+    return UTweenRotatorStandardFactory::BP_JoinTweenRotateInstanceBy(this,
+                                                                      pTweenTarget,
+                                                                      pInstanceIndex,
+                                                                      pBy,
+                                                                      pDuration,
+                                                                      pEaseType,
+                                                                      pLocalSpace,
+                                                                      pDelay,
+                                                                      pTimeScale,
+                                                                      pTweenWhileGameIsPaused);
+}
+
 // public ----------------------------------------------------------------------
 UTweenLinearColor* UTweenContainer::JoinTweenMaterialVectorFromTo(UMaterialInstanceDynamic* pTweenTarget,
                                                                   const FName& pParameterName,
@@ -1708,6 +2254,94 @@ UTweenLinearColor* UTweenContainer::JoinTweenMaterialVectorTo(UMaterialInstanceD
                                                                           pTweenWhileGameIsPaused);
 }
 
+// public ----------------------------------------------------------------------
+UTweenLinearColor* UTweenContainer::JoinTweenCustomPrimitiveDataVectorFromTo(UPrimitiveComponent* pTweenTarget,
+                                                                             int32 pDataIndex,
+                                                                             const FLinearColor& pFrom,
+                                                                             const FLinearColor& pTo,
+                                                                             float pDuration,
+                                                                             ETweenEaseType pEaseType,
+                                                                             float pDelay,
+                                                                             float pTimeScale,
+                                                                             bool pTweenWhileGameIsPaused)
+{
+    return UTweenLinearColorStandardFactory::BP_JoinTweenCustomPrimitiveDataVectorFromTo(this,
+                                                                                         pTweenTarget,
+                                                                                         pDataIndex,
+                                                                                         pFrom,
+                                                                                         pTo,
+                                                                                         pDuration,
+                                                                                         pEaseType,
+                                                                                         pDelay,
+                                                                                         pTimeScale,
+                                                                                         pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenLinearColor* UTweenContainer::JoinTweenCustomPrimitiveDataVectorTo(UPrimitiveComponent* pTweenTarget,
+                                                                         int32 pDataIndex,
+                                                                         const FLinearColor& pTo,
+                                                                         float pDuration,
+                                                                         ETweenEaseType pEaseType,
+                                                                         float pDelay,
+                                                                         float pTimeScale,
+                                                                         bool pTweenWhileGameIsPaused)
+{
+    return UTweenLinearColorStandardFactory::BP_JoinTweenCustomPrimitiveDataVectorTo(this,
+                                                                                     pTweenTarget,
+                                                                                     pDataIndex,
+                                                                                     pTo,
+                                                                                     pDuration,
+                                                                                     pEaseType,
+                                                                                     pDelay,
+                                                                                     pTimeScale,
+                                                                                     pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenLinearColor* UTweenContainer::JoinTweenParameterCollectionVectorFromTo(UMaterialParameterCollection* pTweenTarget,
+                                                                             const FName& pParameterName,
+                                                                             const FLinearColor& pFrom,
+                                                                             const FLinearColor& pTo,
+                                                                             float pDuration,
+                                                                             ETweenEaseType pEaseType,
+                                                                             float pDelay,
+                                                                             float pTimeScale,
+                                                                             bool pTweenWhileGameIsPaused)
+{
+    return UTweenLinearColorStandardFactory::BP_JoinTweenParameterCollectionVectorFromTo(this,
+                                                                                         pTweenTarget,
+                                                                                         pParameterName,
+                                                                                         pFrom,
+                                                                                         pTo,
+                                                                                         pDuration,
+                                                                                         pEaseType,
+                                                                                         pDelay,
+                                                                                         pTimeScale,
+                                                                                         pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenLinearColor* UTweenContainer::JoinTweenParameterCollectionVectorTo(UMaterialParameterCollection* pTweenTarget,
+                                                                         const FName& pParameterName,
+                                                                         const FLinearColor& pTo,
+                                                                         float pDuration,
+                                                                         ETweenEaseType pEaseType,
+                                                                         float pDelay,
+                                                                         float pTimeScale,
+                                                                         bool pTweenWhileGameIsPaused)
+{
+    return UTweenLinearColorStandardFactory::BP_JoinTweenParameterCollectionVectorTo(this,
+                                                                                     pTweenTarget,
+                                                                                     pParameterName,
+                                                                                     pTo,
+                                                                                     pDuration,
+                                                                                     pEaseType,
+                                                                                     pDelay,
+                                                                                     pTimeScale,
+                                                                                     pTweenWhileGameIsPaused);
+}
+
 // public ----------------------------------------------------------------------
 UTweenFloat* UTweenContainer::JoinTweenMaterialFloatFromTo(UMaterialInstanceDynamic* pTweenTarget,
                                                            const FName& pParameterName,
@@ -1752,6 +2386,94 @@ UTweenFloat* UTweenContainer::JoinTweenMaterialFloatTo(UMaterialInstanceDynamic*
                                                                    pTweenWhileGameIsPaused);
 }
 
+// public ----------------------------------------------------------------------
+UTweenFloat* UTweenContainer::JoinTweenCustomPrimitiveDataFloatFromTo(UPrimitiveComponent* pTweenTarget,
+                                                                      int32 pDataIndex,
+                                                                      float pFrom,
+                                                                      float pTo,
+                                                                      float pDuration,
+                                                                      ETweenEaseType pEaseType,
+                                                                      float pDelay,
+                                                                      float pTimeScale,
+                                                                      bool pTweenWhileGameIsPaused)
+{
+    return UTweenFloatStandardFactory::BP_JoinTweenCustomPrimitiveDataFloatFromTo(this,
+                                                                                  pTweenTarget,
+                                                                                  pDataIndex,
+                                                                                  pFrom,
+                                                                                  pTo,
+                                                                                  pDuration,
+                                                                                  pEaseType,
+                                                                                  pDelay,
+                                                                                  pTimeScale,
+                                                                                  pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenFloat* UTweenContainer::JoinTweenCustomPrimitiveDataFloatTo(UPrimitiveComponent* pTweenTarget,
+                                                                  int32 pDataIndex,
+                                                                  float pTo,
+                                                                  float pDuration,
+                                                                  ETweenEaseType pEaseType,
+                                                                  float pDelay,
+                                                                  float pTimeScale,
+                                                                  bool pTweenWhileGameIsPaused)
+{
+    return UTweenFloatStandardFactory::BP_JoinTweenCustomPrimitiveDataFloatTo(this,
+                                                                              pTweenTarget,
+                                                                              pDataIndex,
+                                                                              pTo,
+                                                                              pDuration,
+                                                                              pEaseType,
+                                                                              pDelay,
+                                                                              pTimeScale,
+                                                                              pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenFloat* UTweenContainer::JoinTweenParameterCollectionFloatFromTo(UMaterialParameterCollection* pTweenTarget,
+                                                                      const FName& pParameterName,
+                                                                      float pFrom,
+                                                                      float pTo,
+                                                                      float pDuration,
+                                                                      ETweenEaseType pEaseType,
+                                                                      float pDelay,
+                                                                      float pTimeScale,
+                                                                      bool pTweenWhileGameIsPaused)
+{
+    return UTweenFloatStandardFactory::BP_JoinTweenParameterCollectionFloatFromTo(this,
+                                                                                  pTweenTarget,
+                                                                                  pParameterName,
+                                                                                  pFrom,
+                                                                                  pTo,
+                                                                                  pDuration,
+                                                                                  pEaseType,
+                                                                                  pDelay,
+                                                                                  pTimeScale,
+                                                                                  pTweenWhileGameIsPaused);
+}
+
+// public ----------------------------------------------------------------------
+UTweenFloat* UTweenContainer::JoinTweenParameterCollectionFloatTo(UMaterialParameterCollection* pTweenTarget,
+                                                                  const FName& pParameterName,
+                                                                  float pTo,
+                                                                  float pDuration,
+                                                                  ETweenEaseType pEaseType,
+                                                                  float pDelay,
+                                                                  float pTimeScale,
+                                                                  bool pTweenWhileGameIsPaused)
+{
+    return UTweenFloatStandardFactory::BP_JoinTweenParameterCollectionFloatTo(this,
+                                                                              pTweenTarget,
+                                                                              pParameterName,
+                                                                              pTo,
+                                                                              pDuration,
+                                                                              pEaseType,
+                                                                              pDelay,
+                                                                              pTimeScale,
+                                                                              pTweenWhileGameIsPaused);
+}
+
 // public ----------------------------------------------------------------------
 UTweenFloat* UTweenContainer::JoinTweenRotateActorAroundPoint(AActor* pTweenTarget,
                                                               FVector pPivotPoint,
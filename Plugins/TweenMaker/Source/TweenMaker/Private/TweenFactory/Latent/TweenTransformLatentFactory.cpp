@@ -0,0 +1,356 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "TweenFactory/Latent/TweenTransformLatentFactory.h"
+
+#include "GameFramework/Actor.h"
+#include "Tweens/TweenTransform.h"
+#include "TweenContainer.h"
+
+// public ----------------------------------------------------------------------
+UTweenTransformLatentFactory::UTweenTransformLatentFactory(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+
+}
+
+// static public ---------------------------------------------------------------
+UTweenTransformLatentFactory* UTweenTransformLatentFactory::BP_CreateLatentTweenActorTransformTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                                                 AActor* pTweenTarget,
+                                                                                                 UTweenContainer*& pOutTweenContainer,
+                                                                                                 UTweenTransform*& pOutTween,
+                                                                                                 FTransform pTo,
+                                                                                                 float pDuration,
+                                                                                                 ETweenEaseType pEaseType,
+                                                                                                 ETweenSpace pTweenSpace,
+                                                                                                 ETweenRotationMode pRotationMode,
+                                                                                                 bool pDeleteTweenOnHit,
+                                                                                                 bool pDeleteTweenOnOverlap,
+                                                                                                 int32 pNumLoops,
+                                                                                                 ETweenLoopType pLoopType,
+                                                                                                 float pDelay,
+                                                                                                 float pTimeScale,
+                                                                                                 bool pTweenWhileGameIsPaused)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    return BP_AppendLatentTweenActorTransformTo(pOutTweenContainer,
+                                                pOutTween,
+                                                pTweenTarget,
+                                                pTo,
+                                                pDuration,
+                                                pEaseType,
+                                                pTweenSpace,
+                                                pRotationMode,
+                                                pDeleteTweenOnHit,
+                                                pDeleteTweenOnOverlap,
+                                                pNumLoops,
+                                                pLoopType,
+                                                pDelay,
+                                                pTimeScale,
+                                                pTweenWhileGameIsPaused);
+}
+
+// static public ---------------------------------------------------------------
+UTweenTransformLatentFactory* UTweenTransformLatentFactory::BP_CreateLatentTweenSceneComponentTransformTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                                                          USceneComponent* pTweenTarget,
+                                                                                                          UTweenContainer*& pOutTweenContainer,
+                                                                                                          UTweenTransform*& pOutTween,
+                                                                                                          FTransform pTo,
+                                                                                                          float pDuration,
+                                                                                                          ETweenEaseType pEaseType,
+                                                                                                          ETweenSpace pTweenSpace,
+                                                                                                          ETweenRotationMode pRotationMode,
+                                                                                                          bool pDeleteTweenOnHit,
+                                                                                                          bool pDeleteTweenOnOverlap,
+                                                                                                          int32 pNumLoops,
+                                                                                                          ETweenLoopType pLoopType,
+                                                                                                          float pDelay,
+                                                                                                          float pTimeScale,
+                                                                                                          bool pTweenWhileGameIsPaused)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    return BP_AppendLatentTweenSceneComponentTransformTo(pOutTweenContainer,
+                                                         pOutTween,
+                                                         pTweenTarget,
+                                                         pTo,
+                                                         pDuration,
+                                                         pEaseType,
+                                                         pTweenSpace,
+                                                         pRotationMode,
+                                                         pDeleteTweenOnHit,
+                                                         pDeleteTweenOnOverlap,
+                                                         pNumLoops,
+                                                         pLoopType,
+                                                         pDelay,
+                                                         pTimeScale,
+                                                         pTweenWhileGameIsPaused);
+}
+
+// static public ---------------------------------------------------------------
+UTweenTransformLatentFactory* UTweenTransformLatentFactory::BP_AppendLatentTweenActorTransformTo(UTweenContainer* pTweenContainer,
+                                                                                                 UTweenTransform*& OutTween,
+                                                                                                 AActor* pTweenTarget,
+                                                                                                 FTransform pTo,
+                                                                                                 float pDuration,
+                                                                                                 ETweenEaseType pEaseType,
+                                                                                                 ETweenSpace pTweenSpace,
+                                                                                                 ETweenRotationMode pRotationMode,
+                                                                                                 bool pDeleteTweenOnHit,
+                                                                                                 bool pDeleteTweenOnOverlap,
+                                                                                                 int32 pNumLoops,
+                                                                                                 ETweenLoopType pLoopType,
+                                                                                                 float pDelay,
+                                                                                                 float pTimeScale,
+                                                                                                 bool pTweenWhileGameIsPaused)
+{
+    ETweenTargetType targetType   = ETweenTargetType::Actor;
+    ETweenTransformType tweenType = ETweenTransformType::TransformTo;
+
+    return CreateProxyForAppendTweenTransform(pTweenContainer,
+                                              tweenType,
+                                              pTweenTarget,
+                                              targetType,
+                                              pTo,
+                                              pDuration,
+                                              pEaseType,
+                                              pTweenSpace,
+                                              pRotationMode,
+                                              pDeleteTweenOnHit,
+                                              pDeleteTweenOnOverlap,
+                                              pNumLoops,
+                                              pLoopType,
+                                              pDelay,
+                                              pTimeScale,
+                                              pTweenWhileGameIsPaused,
+                                              OutTween);
+}
+
+// static public ---------------------------------------------------------------
+UTweenTransformLatentFactory* UTweenTransformLatentFactory::BP_AppendLatentTweenSceneComponentTransformTo(UTweenContainer* pTweenContainer,
+                                                                                                          UTweenTransform*& OutTween,
+                                                                                                          USceneComponent* pTweenTarget,
+                                                                                                          FTransform pTo,
+                                                                                                          float pDuration,
+                                                                                                          ETweenEaseType pEaseType,
+                                                                                                          ETweenSpace pTweenSpace,
+                                                                                                          ETweenRotationMode pRotationMode,
+                                                                                                          bool pDeleteTweenOnHit,
+                                                                                                          bool pDeleteTweenOnOverlap,
+                                                                                                          int32 pNumLoops,
+                                                                                                          ETweenLoopType pLoopType,
+                                                                                                          float pDelay,
+                                                                                                          float pTimeScale,
+                                                                                                          bool pTweenWhileGameIsPaused)
+{
+    ETweenTargetType targetType   = ETweenTargetType::SceneComponent;
+    ETweenTransformType tweenType = ETweenTransformType::TransformTo;
+
+    return CreateProxyForAppendTweenTransform(pTweenContainer,
+                                              tweenType,
+                                              pTweenTarget,
+                                              targetType,
+                                              pTo,
+                                              pDuration,
+                                              pEaseType,
+                                              pTweenSpace,
+                                              pRotationMode,
+                                              pDeleteTweenOnHit,
+                                              pDeleteTweenOnOverlap,
+                                              pNumLoops,
+                                              pLoopType,
+                                              pDelay,
+                                              pTimeScale,
+                                              pTweenWhileGameIsPaused,
+                                              OutTween);
+}
+
+// static public ---------------------------------------------------------------
+UTweenTransformLatentFactory* UTweenTransformLatentFactory::BP_JoinLatentTweenActorTransformTo(UTweenContainer* pTweenContainer,
+                                                                                               UTweenTransform*& OutTween,
+                                                                                               AActor* pTweenTarget,
+                                                                                               FTransform pTo,
+                                                                                               float pDuration,
+                                                                                               ETweenEaseType pEaseType,
+                                                                                               ETweenSpace pTweenSpace,
+                                                                                               ETweenRotationMode pRotationMode,
+                                                                                               bool pDeleteTweenOnHit,
+                                                                                               bool pDeleteTweenOnOverlap,
+                                                                                               float pDelay,
+                                                                                               float pTimeScale,
+                                                                                               bool pTweenWhileGameIsPaused)
+{
+    ETweenTargetType targetType   = ETweenTargetType::Actor;
+    ETweenTransformType tweenType = ETweenTransformType::TransformTo;
+
+    return CreateProxyForJoinTweenTransform(pTweenContainer,
+                                            tweenType,
+                                            pTweenTarget,
+                                            targetType,
+                                            pTo,
+                                            pDuration,
+                                            pEaseType,
+                                            pTweenSpace,
+                                            pRotationMode,
+                                            pDeleteTweenOnHit,
+                                            pDeleteTweenOnOverlap,
+                                            pDelay,
+                                            pTimeScale,
+                                            pTweenWhileGameIsPaused,
+                                            OutTween);
+}
+
+// static public ---------------------------------------------------------------
+UTweenTransformLatentFactory* UTweenTransformLatentFactory::BP_JoinLatentTweenSceneComponentTransformTo(UTweenContainer* pTweenContainer,
+                                                                                                        UTweenTransform*& OutTween,
+                                                                                                        USceneComponent* pTweenTarget,
+                                                                                                        FTransform pTo,
+                                                                                                        float pDuration,
+                                                                                                        ETweenEaseType pEaseType,
+                                                                                                        ETweenSpace pTweenSpace,
+                                                                                                        ETweenRotationMode pRotationMode,
+                                                                                                        bool pDeleteTweenOnHit,
+                                                                                                        bool pDeleteTweenOnOverlap,
+                                                                                                        float pDelay,
+                                                                                                        float pTimeScale,
+                                                                                                        bool pTweenWhileGameIsPaused)
+{
+    ETweenTargetType targetType   = ETweenTargetType::SceneComponent;
+    ETweenTransformType tweenType = ETweenTransformType::TransformTo;
+
+    return CreateProxyForJoinTweenTransform(pTweenContainer,
+                                            tweenType,
+                                            pTweenTarget,
+                                            targetType,
+                                            pTo,
+                                            pDuration,
+                                            pEaseType,
+                                            pTweenSpace,
+                                            pRotationMode,
+                                            pDeleteTweenOnHit,
+                                            pDeleteTweenOnOverlap,
+                                            pDelay,
+                                            pTimeScale,
+                                            pTweenWhileGameIsPaused,
+                                            OutTween);
+}
+
+// public ----------------------------------------------------------------------
+void UTweenTransformLatentFactory::Activate()
+{
+    Super::Activate();
+}
+
+// static private --------------------------------------------------------------
+UTweenTransformLatentFactory* UTweenTransformLatentFactory::CreateProxyForAppendTweenTransform(UTweenContainer* pTweenContainer,
+                                                                                               ETweenTransformType pTweenType,
+                                                                                               UObject* pTarget,
+                                                                                               ETweenTargetType pTargetType,
+                                                                                               const FTransform& pTo,
+                                                                                               float pDuration,
+                                                                                               ETweenEaseType pEaseType,
+                                                                                               ETweenSpace pTweenSpace,
+                                                                                               ETweenRotationMode pRotationMode,
+                                                                                               bool pDeleteTweenOnHit,
+                                                                                               bool pDeleteTweenOnOverlap,
+                                                                                               int32 pNumLoops,
+                                                                                               ETweenLoopType pLoopType,
+                                                                                               float pDelay,
+                                                                                               float pTimeScale,
+                                                                                               bool pTweenWhileGameIsPaused,
+                                                                                               UTweenTransform*& OutTween)
+{
+    UTweenTransformLatentFactory* proxy = NewObject<UTweenTransformLatentFactory>();
+
+    if (pTweenContainer != nullptr)
+    {
+        UTweenManagerComponent* instance = pTweenContainer->OwningTweenManager;
+
+        if (instance != nullptr)
+        {
+            int32 tweenIndex = pTweenContainer->GetSequencesNum();
+
+            OutTween = instance->AppendTweenTransform(pTweenContainer,
+                                                      tweenIndex,
+                                                      pTweenType,
+                                                      pTarget,
+                                                      pTargetType,
+                                                      pTo,
+                                                      pDuration,
+                                                      pEaseType,
+                                                      pTweenSpace,
+                                                      pRotationMode,
+                                                      pDeleteTweenOnHit,
+                                                      pDeleteTweenOnOverlap,
+                                                      pNumLoops,
+                                                      pLoopType,
+                                                      pDelay,
+                                                      pTimeScale,
+                                                      pTweenWhileGameIsPaused,
+                                                      proxy);
+        }
+    }
+    else
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenTransformLatentFactory::CreateProxyForAppendTweenTransform() -> the Tween that had as target the "
+                                            "object with name %s couldn't be added because the passed TweenContainer was null."), *pTarget->GetName());
+    }
+
+    return proxy;
+}
+
+// static private --------------------------------------------------------------
+UTweenTransformLatentFactory* UTweenTransformLatentFactory::CreateProxyForJoinTweenTransform(UTweenContainer* pTweenContainer,
+                                                                                             ETweenTransformType pTweenType,
+                                                                                             UObject* pTarget,
+                                                                                             ETweenTargetType pTargetType,
+                                                                                             const FTransform& pTo,
+                                                                                             float pDuration,
+                                                                                             ETweenEaseType pEaseType,
+                                                                                             ETweenSpace pTweenSpace,
+                                                                                             ETweenRotationMode pRotationMode,
+                                                                                             bool pDeleteTweenOnHit,
+                                                                                             bool pDeleteTweenOnOverlap,
+                                                                                             float pDelay,
+                                                                                             float pTimeScale,
+                                                                                             bool pTweenWhileGameIsPaused,
+                                                                                             UTweenTransform*& OutTween)
+{
+    UTweenTransformLatentFactory* proxy = NewObject<UTweenTransformLatentFactory>();
+
+    if (pTweenContainer != nullptr)
+    {
+        UTweenManagerComponent* instance = pTweenContainer->OwningTweenManager;
+
+        if (instance != nullptr)
+        {
+            int32 tweenIndex = pTweenContainer->GetSequencesNum() - 1;
+
+            OutTween = instance->JoinTweenTransform(pTweenContainer,
+                                                    tweenIndex,
+                                                    pTweenType,
+                                                    pTarget,
+                                                    pTargetType,
+                                                    pTo,
+                                                    pDuration,
+                                                    pEaseType,
+                                                    pTweenSpace,
+                                                    pRotationMode,
+                                                    pDeleteTweenOnHit,
+                                                    pDeleteTweenOnOverlap,
+                                                    pDelay,
+                                                    pTimeScale,
+                                                    pTweenWhileGameIsPaused,
+                                                    proxy);
+        }
+    }
+    else
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenTransformLatentFactory::CreateProxyForJoinTweenTransform() -> the Tween that had as target the "
+                                            "object with name %s couldn't be added because the passed TweenContainer was null."), *pTarget->GetName());
+    }
+
+    return proxy;
+}
@@ -0,0 +1,143 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "TweenFactory/Slate/TweenWidgetSlateFactory.h"
+
+#include "TweenMaker.h"
+#include "Utils/SlateTweenDriver.h"
+#include "Components/Widget.h"
+#include "Slate/WidgetTransform.h"
+
+// public ----------------------------------------------------------------------
+UTweenWidgetSlateFactory::UTweenWidgetSlateFactory(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+
+}
+
+// static public ---------------------------------------------------------------
+void UTweenWidgetSlateFactory::BP_SlateTweenMoveWidgetTo(UWidget* pTweenTarget,
+                                                         int32& pOutTweenId,
+                                                         FVector2D pTo,
+                                                         float pDuration,
+                                                         ETweenEaseType pEaseType,
+                                                         int32 pNumLoops,
+                                                         ETweenLoopType pLoopType,
+                                                         float pDelay)
+{
+    pOutTweenId = AddWidgetTween(pTweenTarget, ESlateTweenProperty::Translation, pTo, pDuration, pEaseType, pNumLoops, pLoopType, pDelay);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenWidgetSlateFactory::BP_SlateTweenScaleWidgetTo(UWidget* pTweenTarget,
+                                                          int32& pOutTweenId,
+                                                          FVector2D pTo,
+                                                          float pDuration,
+                                                          ETweenEaseType pEaseType,
+                                                          int32 pNumLoops,
+                                                          ETweenLoopType pLoopType,
+                                                          float pDelay)
+{
+    pOutTweenId = AddWidgetTween(pTweenTarget, ESlateTweenProperty::Scale, pTo, pDuration, pEaseType, pNumLoops, pLoopType, pDelay);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenWidgetSlateFactory::BP_SlateTweenShearWidgetTo(UWidget* pTweenTarget,
+                                                          int32& pOutTweenId,
+                                                          FVector2D pTo,
+                                                          float pDuration,
+                                                          ETweenEaseType pEaseType,
+                                                          int32 pNumLoops,
+                                                          ETweenLoopType pLoopType,
+                                                          float pDelay)
+{
+    pOutTweenId = AddWidgetTween(pTweenTarget, ESlateTweenProperty::Shear, pTo, pDuration, pEaseType, pNumLoops, pLoopType, pDelay);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenWidgetSlateFactory::BP_SlateTweenWidgetAngleTo(UWidget* pTweenTarget,
+                                                          int32& pOutTweenId,
+                                                          float pTo,
+                                                          float pDuration,
+                                                          ETweenEaseType pEaseType,
+                                                          int32 pNumLoops,
+                                                          ETweenLoopType pLoopType,
+                                                          float pDelay)
+{
+    pOutTweenId = AddWidgetTween(pTweenTarget, ESlateTweenProperty::Angle, FVector2D(pTo, 0.0f), pDuration, pEaseType, pNumLoops, pLoopType, pDelay);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenWidgetSlateFactory::BP_SlateTweenWidgetOpacityTo(UWidget* pTweenTarget,
+                                                            int32& pOutTweenId,
+                                                            float pTo,
+                                                            float pDuration,
+                                                            ETweenEaseType pEaseType,
+                                                            int32 pNumLoops,
+                                                            ETweenLoopType pLoopType,
+                                                            float pDelay)
+{
+    pOutTweenId = AddWidgetTween(pTweenTarget, ESlateTweenProperty::Opacity, FVector2D(pTo, 0.0f), pDuration, pEaseType, pNumLoops, pLoopType, pDelay);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenWidgetSlateFactory::BP_StopSlateTween(int32 pTweenId, bool pJumpToEnd)
+{
+    FSlateTweenDriver::Get().StopTween(pTweenId, pJumpToEnd);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenWidgetSlateFactory::BP_StopWidgetSlateTweens(UWidget* pTweenTarget, bool pJumpToEnd)
+{
+    TSharedPtr<SWidget> slateWidget = pTweenTarget != nullptr ? pTweenTarget->GetCachedWidget() : nullptr;
+
+    if (slateWidget.IsValid())
+    {
+        FSlateTweenDriver::Get().StopWidgetTweens(slateWidget.ToSharedRef(), pJumpToEnd);
+    }
+}
+
+// static private --------------------------------------------------------------
+int32 UTweenWidgetSlateFactory::AddWidgetTween(UWidget* pTweenTarget,
+                                               ESlateTweenProperty pProperty,
+                                               const FVector2D& pTo,
+                                               float pDuration,
+                                               ETweenEaseType pEaseType,
+                                               int32 pNumLoops,
+                                               ETweenLoopType pLoopType,
+                                               float pDelay)
+{
+    TSharedPtr<SWidget> slateWidget = pTweenTarget != nullptr ? pTweenTarget->GetCachedWidget() : nullptr;
+
+    if (!slateWidget.IsValid())
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenWidgetSlateFactory::AddWidgetTween -> the widget is null or hasn't been constructed yet."));
+        return -1;
+    }
+
+    FSlateTweenDriver& slateTweenDriver     = FSlateTweenDriver::Get();
+    const FWidgetTransform& renderTransform = pTweenTarget->GetRenderTransform();
+
+    slateTweenDriver.SetInitialRenderTransform(slateWidget.ToSharedRef(),
+                                               renderTransform.Translation,
+                                               renderTransform.Scale,
+                                               renderTransform.Shear,
+                                               renderTransform.Angle);
+
+    // Storing the final value in the UMG widget as well, otherwise it would be lost the next time the widget synchronizes its properties.
+    // The whole render transform is stored at once: the single-field setters would push the other fields of the UMG transform, which are
+    // stale while other driver Tweens animate the widget, and make it pop until the next tick.
+    FOnSlateTweenEnd onTweenEnd = FOnSlateTweenEnd::CreateWeakLambda(pTweenTarget, [pTweenTarget, pProperty](const FVector2D& pEndValue,
+                                                                                                             const FWidgetTransform& pRenderTransform)
+    {
+        if (pProperty == ESlateTweenProperty::Opacity)
+        {
+            pTweenTarget->SetRenderOpacity(pEndValue.X);
+        }
+        else
+        {
+            pTweenTarget->SetRenderTransform(pRenderTransform);
+        }
+    });
+
+    return slateTweenDriver.AddTween(slateWidget.ToSharedRef(), pProperty, pTo, pDuration, pEaseType, pNumLoops, pLoopType, pDelay, onTweenEnd);
+}
@@ -84,6 +84,142 @@ void UTweenFloatStandardFactory::BP_CreateTweenMaterialFloatTo(UTweenManagerComp
                                               pSequenceIndex);
 }
 
+// static public ---------------------------------------------------------------
+void UTweenFloatStandardFactory::BP_CreateTweenCustomPrimitiveDataFloatFromTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                              UPrimitiveComponent* pTweenTarget,
+                                                                              UTweenContainer*& pOutTweenContainer,
+                                                                              UTweenFloat*& pOutTween,
+                                                                              int32 pDataIndex,
+                                                                              float pFrom,
+                                                                              float pTo,
+                                                                              float pDuration,
+                                                                              ETweenEaseType pEaseType,
+                                                                              int32 pNumLoops,
+                                                                              ETweenLoopType pLoopType,
+                                                                              float pDelay,
+                                                                              float pTimeScale,
+                                                                              bool pTweenWhileGameIsPaused,
+                                                                              int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+    
+    pOutTween = BP_AppendTweenCustomPrimitiveDataFloatFromTo(pOutTweenContainer,
+                                                             pTweenTarget,
+                                                             pDataIndex,
+                                                             pFrom,
+                                                             pTo,
+                                                             pDuration,
+                                                             pEaseType,
+                                                             pNumLoops,
+                                                             pLoopType,
+                                                             pDelay,
+                                                             pTimeScale,
+                                                             pTweenWhileGameIsPaused,
+                                                             pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenFloatStandardFactory::BP_CreateTweenCustomPrimitiveDataFloatTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                          UPrimitiveComponent* pTweenTarget,
+                                                                          UTweenContainer*& pOutTweenContainer,
+                                                                          UTweenFloat*& pOutTween,
+                                                                          int32 pDataIndex,
+                                                                          float pTo,
+                                                                          float pDuration,
+                                                                          ETweenEaseType pEaseType,
+                                                                          int32 pNumLoops,
+                                                                          ETweenLoopType pLoopType,
+                                                                          float pDelay,
+                                                                          float pTimeScale,
+                                                                          bool pTweenWhileGameIsPaused,
+                                                                          int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+    
+    pOutTween = BP_AppendTweenCustomPrimitiveDataFloatTo(pOutTweenContainer,
+                                                         pTweenTarget,
+                                                         pDataIndex,
+                                                         pTo,
+                                                         pDuration,
+                                                         pEaseType,
+                                                         pNumLoops,
+                                                         pLoopType,
+                                                         pDelay,
+                                                         pTimeScale,
+                                                         pTweenWhileGameIsPaused,
+                                                         pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenFloatStandardFactory::BP_CreateTweenParameterCollectionFloatFromTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                              UMaterialParameterCollection* pTweenTarget,
+                                                                              UTweenContainer*& pOutTweenContainer,
+                                                                              UTweenFloat*& pOutTween,
+                                                                              FName pParameterName,
+                                                                              float pFrom,
+                                                                              float pTo,
+                                                                              float pDuration,
+                                                                              ETweenEaseType pEaseType,
+                                                                              int32 pNumLoops,
+                                                                              ETweenLoopType pLoopType,
+                                                                              float pDelay,
+                                                                              float pTimeScale,
+                                                                              bool pTweenWhileGameIsPaused,
+                                                                              int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+    
+    pOutTween = BP_AppendTweenParameterCollectionFloatFromTo(pOutTweenContainer,
+                                                             pTweenTarget,
+                                                             pParameterName,
+                                                             pFrom,
+                                                             pTo,
+                                                             pDuration,
+                                                             pEaseType,
+                                                             pNumLoops,
+                                                             pLoopType,
+                                                             pDelay,
+                                                             pTimeScale,
+                                                             pTweenWhileGameIsPaused,
+                                                             pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenFloatStandardFactory::BP_CreateTweenParameterCollectionFloatTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                          UMaterialParameterCollection* pTweenTarget,
+                                                                          UTweenContainer*& pOutTweenContainer,
+                                                                          UTweenFloat*& pOutTween,
+                                                                          FName pParameterName,
+                                                                          float pTo,
+                                                                          float pDuration,
+                                                                          ETweenEaseType pEaseType,
+                                                                          int32 pNumLoops,
+                                                                          ETweenLoopType pLoopType,
+                                                                          float pDelay,
+                                                                          float pTimeScale,
+                                                                          bool pTweenWhileGameIsPaused,
+                                                                          int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+    
+    pOutTween = BP_AppendTweenParameterCollectionFloatTo(pOutTweenContainer,
+                                                         pTweenTarget,
+                                                         pParameterName,
+                                                         pTo,
+                                                         pDuration,
+                                                         pEaseType,
+                                                         pNumLoops,
+                                                         pLoopType,
+                                                         pDelay,
+                                                         pTimeScale,
+                                                         pTweenWhileGameIsPaused,
+                                                         pSequenceIndex);
+}
+
 // static public ---------------------------------------------------------------
 void UTweenFloatStandardFactory::BP_CreateTweenRotateActorAroundPoint(UTweenManagerComponent* pTweenManagerComponent,
                                                                       AActor* pTweenTarget,
@@ -514,6 +650,158 @@ UTweenFloat* UTweenFloatStandardFactory::BP_AppendTweenMaterialFloatTo(UTweenCon
                                   pParameterName);
 }
 
+// static public ---------------------------------------------------------------
+UTweenFloat* UTweenFloatStandardFactory::BP_AppendTweenCustomPrimitiveDataFloatFromTo(UTweenContainer* pTweenContainer,
+                                                                                      UPrimitiveComponent* pTweenTarget,
+                                                                                      int32 pDataIndex,
+                                                                                      float pFrom,
+                                                                                      float pTo,
+                                                                                      float pDuration,
+                                                                                      ETweenEaseType pEaseType,
+                                                                                      int32 pNumLoops,
+                                                                                      ETweenLoopType pLoopType,
+                                                                                      float pDelay,
+                                                                                      float pTimeScale,
+                                                                                      bool pTweenWhileGameIsPaused,
+                                                                                      int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::CustomPrimitiveData;
+    ETweenFloatType tweenType   = ETweenFloatType::MaterialScalarFromTo;
+
+    UTweenFloat* outTween = CreateAppendTweenFloat(pTweenContainer,
+                                                   tweenType,
+                                                   pTweenTarget,
+                                                   targetType,
+                                                   pFrom,
+                                                   pTo,
+                                                   pDuration,
+                                                   pEaseType,
+                                                   pNumLoops,
+                                                   pLoopType,
+                                                   pDelay,
+                                                   pTimeScale,
+                                                   pTweenWhileGameIsPaused,
+                                                   pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetCustomPrimitiveDataIndex(pDataIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenFloat* UTweenFloatStandardFactory::BP_AppendTweenCustomPrimitiveDataFloatTo(UTweenContainer* pTweenContainer,
+                                                                                  UPrimitiveComponent* pTweenTarget,
+                                                                                  int32 pDataIndex,
+                                                                                  float pTo,
+                                                                                  float pDuration,
+                                                                                  ETweenEaseType pEaseType,
+                                                                                  int32 pNumLoops,
+                                                                                  ETweenLoopType pLoopType,
+                                                                                  float pDelay,
+                                                                                  float pTimeScale,
+                                                                                  bool pTweenWhileGameIsPaused,
+                                                                                  int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::CustomPrimitiveData;
+    ETweenFloatType tweenType   = ETweenFloatType::MaterialScalarTo;
+    float dummyFromFloat        = 0.0f;
+
+    UTweenFloat* outTween = CreateAppendTweenFloat(pTweenContainer,
+                                                   tweenType,
+                                                   pTweenTarget,
+                                                   targetType,
+                                                   dummyFromFloat,
+                                                   pTo,
+                                                   pDuration,
+                                                   pEaseType,
+                                                   pNumLoops,
+                                                   pLoopType,
+                                                   pDelay,
+                                                   pTimeScale,
+                                                   pTweenWhileGameIsPaused,
+                                                   pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetCustomPrimitiveDataIndex(pDataIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenFloat* UTweenFloatStandardFactory::BP_AppendTweenParameterCollectionFloatFromTo(UTweenContainer* pTweenContainer,
+                                                                                      UMaterialParameterCollection* pTweenTarget,
+                                                                                      FName pParameterName,
+                                                                                      float pFrom,
+                                                                                      float pTo,
+                                                                                      float pDuration,
+                                                                                      ETweenEaseType pEaseType,
+                                                                                      int32 pNumLoops,
+                                                                                      ETweenLoopType pLoopType,
+                                                                                      float pDelay,
+                                                                                      float pTimeScale,
+                                                                                      bool pTweenWhileGameIsPaused,
+                                                                                      int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::MaterialParameterCollection;
+    ETweenFloatType tweenType   = ETweenFloatType::MaterialScalarFromTo;
+
+    return CreateAppendTweenFloat(pTweenContainer,
+                                  tweenType,
+                                  pTweenTarget,
+                                  targetType,
+                                  pFrom,
+                                  pTo,
+                                  pDuration,
+                                  pEaseType,
+                                  pNumLoops,
+                                  pLoopType,
+                                  pDelay,
+                                  pTimeScale,
+                                  pTweenWhileGameIsPaused,
+                                  pSequenceIndex,
+                                  pParameterName);
+}
+
+// static public ---------------------------------------------------------------
+UTweenFloat* UTweenFloatStandardFactory::BP_AppendTweenParameterCollectionFloatTo(UTweenContainer* pTweenContainer,
+                                                                                  UMaterialParameterCollection* pTweenTarget,
+                                                                                  FName pParameterName,
+                                                                                  float pTo,
+                                                                                  float pDuration,
+                                                                                  ETweenEaseType pEaseType,
+                                                                                  int32 pNumLoops,
+                                                                                  ETweenLoopType pLoopType,
+                                                                                  float pDelay,
+                                                                                  float pTimeScale,
+                                                                                  bool pTweenWhileGameIsPaused,
+                                                                                  int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::MaterialParameterCollection;
+    ETweenFloatType tweenType   = ETweenFloatType::MaterialScalarTo;
+    float dummyFromFloat        = 0.0f;
+
+    return CreateAppendTweenFloat(pTweenContainer,
+                                  tweenType,
+                                  pTweenTarget,
+                                  targetType,
+                                  dummyFromFloat,
+                                  pTo,
+                                  pDuration,
+                                  pEaseType,
+                                  pNumLoops,
+                                  pLoopType,
+                                  pDelay,
+                                  pTimeScale,
+                                  pTweenWhileGameIsPaused,
+                                  pSequenceIndex,
+                                  pParameterName);
+}
+
 // static public ---------------------------------------------------------------
 UTweenFloat* UTweenFloatStandardFactory::BP_AppendTweenRotateActorAroundPoint(UTweenContainer* pTweenContainer,
                                                                               AActor* pTweenTarget,
@@ -933,6 +1221,142 @@ UTweenFloat* UTweenFloatStandardFactory::BP_JoinTweenMaterialFloatTo(UTweenConta
                                 pParameterName);
 }
 
+// static public ---------------------------------------------------------------
+UTweenFloat* UTweenFloatStandardFactory::BP_JoinTweenCustomPrimitiveDataFloatFromTo(UTweenContainer* pTweenContainer,
+                                                                                    UPrimitiveComponent* pTweenTarget,
+                                                                                    int32 pDataIndex,
+                                                                                    float pFrom,
+                                                                                    float pTo,
+                                                                                    float pDuration,
+                                                                                    ETweenEaseType pEaseType,
+                                                                                    float pDelay,
+                                                                                    float pTimeScale,
+                                                                                    bool pTweenWhileGameIsPaused,
+                                                                                    int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::CustomPrimitiveData;
+    ETweenFloatType tweenType   = ETweenFloatType::MaterialScalarFromTo;
+
+    UTweenFloat* outTween = CreateJoinTweenFloat(pTweenContainer,
+                                                 tweenType,
+                                                 pTweenTarget,
+                                                 targetType,
+                                                 pFrom,
+                                                 pTo,
+                                                 pDuration,
+                                                 pEaseType,
+                                                 pDelay,
+                                                 pTimeScale,
+                                                 pTweenWhileGameIsPaused,
+                                                 pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetCustomPrimitiveDataIndex(pDataIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenFloat* UTweenFloatStandardFactory::BP_JoinTweenCustomPrimitiveDataFloatTo(UTweenContainer* pTweenContainer,
+                                                                                UPrimitiveComponent* pTweenTarget,
+                                                                                int32 pDataIndex,
+                                                                                float pTo,
+                                                                                float pDuration,
+                                                                                ETweenEaseType pEaseType,
+                                                                                float pDelay,
+                                                                                float pTimeScale,
+                                                                                bool pTweenWhileGameIsPaused,
+                                                                                int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::CustomPrimitiveData;
+    ETweenFloatType tweenType   = ETweenFloatType::MaterialScalarTo;
+    float dummyFromFloat        = 0.0f;
+
+    UTweenFloat* outTween = CreateJoinTweenFloat(pTweenContainer,
+                                                 tweenType,
+                                                 pTweenTarget,
+                                                 targetType,
+                                                 dummyFromFloat,
+                                                 pTo,
+                                                 pDuration,
+                                                 pEaseType,
+                                                 pDelay,
+                                                 pTimeScale,
+                                                 pTweenWhileGameIsPaused,
+                                                 pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetCustomPrimitiveDataIndex(pDataIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenFloat* UTweenFloatStandardFactory::BP_JoinTweenParameterCollectionFloatFromTo(UTweenContainer* pTweenContainer,
+                                                                                    UMaterialParameterCollection* pTweenTarget,
+                                                                                    FName pParameterName,
+                                                                                    float pFrom,
+                                                                                    float pTo,
+                                                                                    float pDuration,
+                                                                                    ETweenEaseType pEaseType,
+                                                                                    float pDelay,
+                                                                                    float pTimeScale,
+                                                                                    bool pTweenWhileGameIsPaused,
+                                                                                    int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::MaterialParameterCollection;
+    ETweenFloatType tweenType   = ETweenFloatType::MaterialScalarFromTo;
+
+    return CreateJoinTweenFloat(pTweenContainer,
+                                tweenType,
+                                pTweenTarget,
+                                targetType,
+                                pFrom,
+                                pTo,
+                                pDuration,
+                                pEaseType,
+                                pDelay,
+                                pTimeScale,
+                                pTweenWhileGameIsPaused,
+                                pSequenceIndex,
+                                pParameterName);
+}
+
+// static public ---------------------------------------------------------------
+UTweenFloat* UTweenFloatStandardFactory::BP_JoinTweenParameterCollectionFloatTo(UTweenContainer* pTweenContainer,
+                                                                                UMaterialParameterCollection* pTweenTarget,
+                                                                                FName pParameterName,
+                                                                                float pTo,
+                                                                                float pDuration,
+                                                                                ETweenEaseType pEaseType,
+                                                                                float pDelay,
+                                                                                float pTimeScale,
+                                                                                bool pTweenWhileGameIsPaused,
+                                                                                int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::MaterialParameterCollection;
+    ETweenFloatType tweenType   = ETweenFloatType::MaterialScalarTo;
+    float dummyFromFloat        = 0.0f;
+
+    return CreateJoinTweenFloat(pTweenContainer,
+                                tweenType,
+                                pTweenTarget,
+                                targetType,
+                                dummyFromFloat,
+                                pTo,
+                                pDuration,
+                                pEaseType,
+                                pDelay,
+                                pTimeScale,
+                                pTweenWhileGameIsPaused,
+                                pSequenceIndex,
+                                pParameterName);
+}
+
 // static public ---------------------------------------------------------------
 UTweenFloat* UTweenFloatStandardFactory::BP_JoinTweenRotateActorAroundPoint(UTweenContainer* pTweenContainer,
                                                                             AActor* pTweenTarget,
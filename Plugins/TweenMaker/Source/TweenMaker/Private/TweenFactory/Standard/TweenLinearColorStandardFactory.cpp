@@ -79,6 +79,138 @@ void UTweenLinearColorStandardFactory::BP_CreateTweenMaterialVectorTo(UTweenMana
                                                pSequenceIndex);
 }
 
+// static public ---------------------------------------------------------------
+void UTweenLinearColorStandardFactory::BP_CreateTweenCustomPrimitiveDataVectorFromTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                                     UPrimitiveComponent* pTweenTarget,
+                                                                                     UTweenContainer*& pOutTweenContainer,
+                                                                                     UTweenLinearColor*& pOutTween,
+                                                                                     int32 pDataIndex,
+                                                                                     FLinearColor pFrom,
+                                                                                     FLinearColor pTo,
+                                                                                     float pDuration,
+                                                                                     ETweenEaseType pEaseType,
+                                                                                     int32 pNumLoops,
+                                                                                     ETweenLoopType pLoopType,
+                                                                                     float pDelay,
+                                                                                     float pTimeScale,
+                                                                                     bool pTweenWhileGameIsPaused,
+                                                                                     int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+    pOutTween = BP_AppendTweenCustomPrimitiveDataVectorFromTo(pOutTweenContainer,
+                                                              pTweenTarget,
+                                                              pDataIndex,
+                                                              pFrom,
+                                                              pTo,
+                                                              pDuration,
+                                                              pEaseType,
+                                                              pNumLoops,
+                                                              pLoopType,
+                                                              pDelay,
+                                                              pTimeScale,
+                                                              pTweenWhileGameIsPaused,
+                                                              pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenLinearColorStandardFactory::BP_CreateTweenCustomPrimitiveDataVectorTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                                 UPrimitiveComponent* pTweenTarget,
+                                                                                 UTweenContainer*& pOutTweenContainer,
+                                                                                 UTweenLinearColor*& pOutTween,
+                                                                                 int32 pDataIndex,
+                                                                                 FLinearColor pTo,
+                                                                                 float pDuration,
+                                                                                 ETweenEaseType pEaseType,
+                                                                                 int32 pNumLoops,
+                                                                                 ETweenLoopType pLoopType,
+                                                                                 float pDelay,
+                                                                                 float pTimeScale,
+                                                                                 bool pTweenWhileGameIsPaused,
+                                                                                 int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+    pOutTween = BP_AppendTweenCustomPrimitiveDataVectorTo(pOutTweenContainer,
+                                                          pTweenTarget,
+                                                          pDataIndex,
+                                                          pTo,
+                                                          pDuration,
+                                                          pEaseType,
+                                                          pNumLoops,
+                                                          pLoopType,
+                                                          pDelay,
+                                                          pTimeScale,
+                                                          pTweenWhileGameIsPaused,
+                                                          pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenLinearColorStandardFactory::BP_CreateTweenParameterCollectionVectorFromTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                                     UMaterialParameterCollection* pTweenTarget,
+                                                                                     UTweenContainer*& pOutTweenContainer,
+                                                                                     UTweenLinearColor*& pOutTween,
+                                                                                     FName pParameterName,
+                                                                                     FLinearColor pFrom,
+                                                                                     FLinearColor pTo,
+                                                                                     float pDuration,
+                                                                                     ETweenEaseType pEaseType,
+                                                                                     int32 pNumLoops,
+                                                                                     ETweenLoopType pLoopType,
+                                                                                     float pDelay,
+                                                                                     float pTimeScale,
+                                                                                     bool pTweenWhileGameIsPaused,
+                                                                                     int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+    pOutTween = BP_AppendTweenParameterCollectionVectorFromTo(pOutTweenContainer,
+                                                              pTweenTarget,
+                                                              pParameterName,
+                                                              pFrom,
+                                                              pTo,
+                                                              pDuration,
+                                                              pEaseType,
+                                                              pNumLoops,
+                                                              pLoopType,
+                                                              pDelay,
+                                                              pTimeScale,
+                                                              pTweenWhileGameIsPaused,
+                                                              pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenLinearColorStandardFactory::BP_CreateTweenParameterCollectionVectorTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                                 UMaterialParameterCollection* pTweenTarget,
+                                                                                 UTweenContainer*& pOutTweenContainer,
+                                                                                 UTweenLinearColor*& pOutTween,
+                                                                                 FName pParameterName,
+                                                                                 FLinearColor pTo,
+                                                                                 float pDuration,
+                                                                                 ETweenEaseType pEaseType,
+                                                                                 int32 pNumLoops,
+                                                                                 ETweenLoopType pLoopType,
+                                                                                 float pDelay,
+                                                                                 float pTimeScale,
+                                                                                 bool pTweenWhileGameIsPaused,
+                                                                                 int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+    pOutTween = BP_AppendTweenParameterCollectionVectorTo(pOutTweenContainer,
+                                                          pTweenTarget,
+                                                          pParameterName,
+                                                          pTo,
+                                                          pDuration,
+                                                          pEaseType,
+                                                          pNumLoops,
+                                                          pLoopType,
+                                                          pDelay,
+                                                          pTimeScale,
+                                                          pTweenWhileGameIsPaused,
+                                                          pSequenceIndex);
+}
+
 // static public ---------------------------------------------------------------
 UTweenLinearColor* UTweenLinearColorStandardFactory::BP_AppendTweenMaterialVectorFromTo(UTweenContainer* pTweenContainer,
                                                                                         UMaterialInstanceDynamic* pTweenTarget,
@@ -149,6 +281,160 @@ UTweenLinearColor* UTweenLinearColorStandardFactory::BP_AppendTweenMaterialVecto
                                            pSequenceIndex);
 }
 
+// static public ---------------------------------------------------------------
+UTweenLinearColor* UTweenLinearColorStandardFactory::BP_AppendTweenCustomPrimitiveDataVectorFromTo(UTweenContainer* pTweenContainer,
+                                                                                                   UPrimitiveComponent* pTweenTarget,
+                                                                                                   int32 pDataIndex,
+                                                                                                   FLinearColor pFrom,
+                                                                                                   FLinearColor pTo,
+                                                                                                   float pDuration,
+                                                                                                   ETweenEaseType pEaseType,
+                                                                                                   int32 pNumLoops,
+                                                                                                   ETweenLoopType pLoopType,
+                                                                                                   float pDelay,
+                                                                                                   float pTimeScale,
+                                                                                                   bool pTweenWhileGameIsPaused,
+                                                                                                   int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::CustomPrimitiveData;
+    ETweenLinearColorType tweenType = ETweenLinearColorType::CustomPrimitiveDataVectorFromTo;
+
+    UTweenLinearColor* outTween = CreateAppendTweenMaterialVector(pTweenContainer,
+                                                                  tweenType,
+                                                                  pTweenTarget,
+                                                                  NAME_None,
+                                                                  targetType,
+                                                                  pFrom,
+                                                                  pTo,
+                                                                  pDuration,
+                                                                  pEaseType,
+                                                                  pNumLoops,
+                                                                  pLoopType,
+                                                                  pDelay,
+                                                                  pTimeScale,
+                                                                  pTweenWhileGameIsPaused,
+                                                                  pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetCustomPrimitiveDataIndex(pDataIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenLinearColor* UTweenLinearColorStandardFactory::BP_AppendTweenCustomPrimitiveDataVectorTo(UTweenContainer* pTweenContainer,
+                                                                                               UPrimitiveComponent* pTweenTarget,
+                                                                                               int32 pDataIndex,
+                                                                                               FLinearColor pTo,
+                                                                                               float pDuration,
+                                                                                               ETweenEaseType pEaseType,
+                                                                                               int32 pNumLoops,
+                                                                                               ETweenLoopType pLoopType,
+                                                                                               float pDelay,
+                                                                                               float pTimeScale,
+                                                                                               bool pTweenWhileGameIsPaused,
+                                                                                               int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::CustomPrimitiveData;
+    ETweenLinearColorType tweenType = ETweenLinearColorType::CustomPrimitiveDataVectorTo;
+    FLinearColor dummyFromColor = FLinearColor();
+
+    UTweenLinearColor* outTween = CreateAppendTweenMaterialVector(pTweenContainer,
+                                                                  tweenType,
+                                                                  pTweenTarget,
+                                                                  NAME_None,
+                                                                  targetType,
+                                                                  dummyFromColor,
+                                                                  pTo,
+                                                                  pDuration,
+                                                                  pEaseType,
+                                                                  pNumLoops,
+                                                                  pLoopType,
+                                                                  pDelay,
+                                                                  pTimeScale,
+                                                                  pTweenWhileGameIsPaused,
+                                                                  pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetCustomPrimitiveDataIndex(pDataIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenLinearColor* UTweenLinearColorStandardFactory::BP_AppendTweenParameterCollectionVectorFromTo(UTweenContainer* pTweenContainer,
+                                                                                                   UMaterialParameterCollection* pTweenTarget,
+                                                                                                   FName pParameterName,
+                                                                                                   FLinearColor pFrom,
+                                                                                                   FLinearColor pTo,
+                                                                                                   float pDuration,
+                                                                                                   ETweenEaseType pEaseType,
+                                                                                                   int32 pNumLoops,
+                                                                                                   ETweenLoopType pLoopType,
+                                                                                                   float pDelay,
+                                                                                                   float pTimeScale,
+                                                                                                   bool pTweenWhileGameIsPaused,
+                                                                                                   int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::MaterialParameterCollection;
+    ETweenLinearColorType tweenType = ETweenLinearColorType::MaterialVectorFromTo;
+
+    return CreateAppendTweenMaterialVector(pTweenContainer,
+                                           tweenType,
+                                           pTweenTarget,
+                                           pParameterName,
+                                           targetType,
+                                           pFrom,
+                                           pTo,
+                                           pDuration,
+                                           pEaseType,
+                                           pNumLoops,
+                                           pLoopType,
+                                           pDelay,
+                                           pTimeScale,
+                                           pTweenWhileGameIsPaused,
+                                           pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+UTweenLinearColor* UTweenLinearColorStandardFactory::BP_AppendTweenParameterCollectionVectorTo(UTweenContainer* pTweenContainer,
+                                                                                               UMaterialParameterCollection* pTweenTarget,
+                                                                                               FName pParameterName,
+                                                                                               FLinearColor pTo,
+                                                                                               float pDuration,
+                                                                                               ETweenEaseType pEaseType,
+                                                                                               int32 pNumLoops,
+                                                                                               ETweenLoopType pLoopType,
+                                                                                               float pDelay,
+                                                                                               float pTimeScale,
+                                                                                               bool pTweenWhileGameIsPaused,
+                                                                                               int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::MaterialParameterCollection;
+    ETweenLinearColorType tweenType = ETweenLinearColorType::MaterialVectorTo;
+    FLinearColor dummyFromColor = FLinearColor();
+
+    return CreateAppendTweenMaterialVector(pTweenContainer,
+                                           tweenType,
+                                           pTweenTarget,
+                                           pParameterName,
+                                           targetType,
+                                           dummyFromColor,
+                                           pTo,
+                                           pDuration,
+                                           pEaseType,
+                                           pNumLoops,
+                                           pLoopType,
+                                           pDelay,
+                                           pTimeScale,
+                                           pTweenWhileGameIsPaused,
+                                           pSequenceIndex);
+}
+
 // static public ---------------------------------------------------------------
 UTweenLinearColor* UTweenLinearColorStandardFactory::BP_JoinTweenMaterialVectorFromTo(UTweenContainer* pTweenContainer,
                                                                                       UMaterialInstanceDynamic* pTweenTarget,
@@ -211,6 +497,144 @@ UTweenLinearColor* UTweenLinearColorStandardFactory::BP_JoinTweenMaterialVectorT
                                          pSequenceIndex);
 }
 
+// static public ---------------------------------------------------------------
+UTweenLinearColor* UTweenLinearColorStandardFactory::BP_JoinTweenCustomPrimitiveDataVectorFromTo(UTweenContainer* pTweenContainer,
+                                                                                                 UPrimitiveComponent* pTweenTarget,
+                                                                                                 int32 pDataIndex,
+                                                                                                 FLinearColor pFrom,
+                                                                                                 FLinearColor pTo,
+                                                                                                 float pDuration,
+                                                                                                 ETweenEaseType pEaseType,
+                                                                                                 float pDelay,
+                                                                                                 float pTimeScale,
+                                                                                                 bool pTweenWhileGameIsPaused,
+                                                                                                 int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::CustomPrimitiveData;
+    ETweenLinearColorType tweenType = ETweenLinearColorType::CustomPrimitiveDataVectorFromTo;
+
+    UTweenLinearColor* outTween = CreateJoinTweenMaterialVector(pTweenContainer,
+                                                                tweenType,
+                                                                pTweenTarget,
+                                                                NAME_None,
+                                                                targetType,
+                                                                pFrom,
+                                                                pTo,
+                                                                pDuration,
+                                                                pEaseType,
+                                                                pDelay,
+                                                                pTimeScale,
+                                                                pTweenWhileGameIsPaused,
+                                                                pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetCustomPrimitiveDataIndex(pDataIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenLinearColor* UTweenLinearColorStandardFactory::BP_JoinTweenCustomPrimitiveDataVectorTo(UTweenContainer* pTweenContainer,
+                                                                                             UPrimitiveComponent* pTweenTarget,
+                                                                                             int32 pDataIndex,
+                                                                                             FLinearColor pTo,
+                                                                                             float pDuration,
+                                                                                             ETweenEaseType pEaseType,
+                                                                                             float pDelay,
+                                                                                             float pTimeScale,
+                                                                                             bool pTweenWhileGameIsPaused,
+                                                                                             int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::CustomPrimitiveData;
+    ETweenLinearColorType tweenType = ETweenLinearColorType::CustomPrimitiveDataVectorTo;
+    FLinearColor dummyFromColor = FLinearColor();
+
+    UTweenLinearColor* outTween = CreateJoinTweenMaterialVector(pTweenContainer,
+                                                                tweenType,
+                                                                pTweenTarget,
+                                                                NAME_None,
+                                                                targetType,
+                                                                dummyFromColor,
+                                                                pTo,
+                                                                pDuration,
+                                                                pEaseType,
+                                                                pDelay,
+                                                                pTimeScale,
+                                                                pTweenWhileGameIsPaused,
+                                                                pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetCustomPrimitiveDataIndex(pDataIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenLinearColor* UTweenLinearColorStandardFactory::BP_JoinTweenParameterCollectionVectorFromTo(UTweenContainer* pTweenContainer,
+                                                                                                 UMaterialParameterCollection* pTweenTarget,
+                                                                                                 FName pParameterName,
+                                                                                                 FLinearColor pFrom,
+                                                                                                 FLinearColor pTo,
+                                                                                                 float pDuration,
+                                                                                                 ETweenEaseType pEaseType,
+                                                                                                 float pDelay,
+                                                                                                 float pTimeScale,
+                                                                                                 bool pTweenWhileGameIsPaused,
+                                                                                                 int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::MaterialParameterCollection;
+    ETweenLinearColorType tweenType = ETweenLinearColorType::MaterialVectorFromTo;
+
+    return CreateJoinTweenMaterialVector(pTweenContainer,
+                                         tweenType,
+                                         pTweenTarget,
+                                         pParameterName,
+                                         targetType,
+                                         pFrom,
+                                         pTo,
+                                         pDuration,
+                                         pEaseType,
+                                         pDelay,
+                                         pTimeScale,
+                                         pTweenWhileGameIsPaused,
+                                         pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+UTweenLinearColor* UTweenLinearColorStandardFactory::BP_JoinTweenParameterCollectionVectorTo(UTweenContainer* pTweenContainer,
+                                                                                             UMaterialParameterCollection* pTweenTarget,
+                                                                                             FName pParameterName,
+                                                                                             FLinearColor pTo,
+                                                                                             float pDuration,
+                                                                                             ETweenEaseType pEaseType,
+                                                                                             float pDelay,
+                                                                                             float pTimeScale,
+                                                                                             bool pTweenWhileGameIsPaused,
+                                                                                             int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::MaterialParameterCollection;
+    ETweenLinearColorType tweenType = ETweenLinearColorType::MaterialVectorTo;
+    FLinearColor dummyFromColor = FLinearColor();
+
+    return CreateJoinTweenMaterialVector(pTweenContainer,
+                                         tweenType,
+                                         pTweenTarget,
+                                         pParameterName,
+                                         targetType,
+                                         dummyFromColor,
+                                         pTo,
+                                         pDuration,
+                                         pEaseType,
+                                         pDelay,
+                                         pTimeScale,
+                                         pTweenWhileGameIsPaused,
+                                         pSequenceIndex);
+}
+
 // static private --------------------------------------------------------------
 UTweenLinearColor* UTweenLinearColorStandardFactory::CreateAppendTweenMaterialVector(UTweenContainer* pTweenContainer,
                                                                                      ETweenLinearColorType pTweenType,
@@ -161,6 +161,160 @@ void UTweenRotatorStandardFactory::BP_CreateTweenRotateSceneComponentBy(UTweenMa
                                                      pSequenceIndex);
 }
 
+// static public ---------------------------------------------------------------
+void UTweenRotatorStandardFactory::BP_CreateTweenRotateInstanceTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                  UInstancedStaticMeshComponent* pTweenTarget,
+                                                                  int32 pInstanceIndex,
+                                                                  UTweenContainer*& pOutTweenContainer,
+                                                                  UTweenRotator*& pOutTween,
+                                                                  FRotator pTo,
+                                                                  float pDuration,
+                                                                  ETweenEaseType pEaseType,
+                                                                  ETweenSpace pTweenSpace,
+                                                                  ETweenRotationMode pRotationMode,
+                                                                  int32 pNumLoops,
+                                                                  ETweenLoopType pLoopType,
+                                                                  float pDelay,
+                                                                  float pTimeScale,
+                                                                  bool pTweenWhileGameIsPaused,
+                                                                  int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    pOutTween = BP_AppendTweenRotateInstanceTo(pOutTweenContainer,
+                                               pTweenTarget,
+                                               pInstanceIndex,
+                                               pTo,
+                                               pDuration,
+                                               pEaseType,
+                                               pTweenSpace,
+                                               pRotationMode,
+                                               pNumLoops,
+                                               pLoopType,
+                                               pDelay,
+                                               pTimeScale,
+                                               pTweenWhileGameIsPaused,
+                                               pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenRotatorStandardFactory::BP_CreateTweenRotateInstanceBy(UTweenManagerComponent* pTweenManagerComponent,
+                                                                  UInstancedStaticMeshComponent* pTweenTarget,
+                                                                  int32 pInstanceIndex,
+                                                                  UTweenContainer*& pOutTweenContainer,
+                                                                  UTweenRotator*& pOutTween,
+                                                                  FRotator pBy,
+                                                                  float pDuration,
+                                                                  ETweenEaseType pEaseType,
+                                                                  bool pLocalSpace,
+                                                                  int32 pNumLoops,
+                                                                  ETweenLoopType pLoopType,
+                                                                  float pDelay,
+                                                                  float pTimeScale,
+                                                                  bool pTweenWhileGameIsPaused,
+                                                                  int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    pOutTween = BP_AppendTweenRotateInstanceBy(pOutTweenContainer,
+                                               pTweenTarget,
+                                               pInstanceIndex,
+                                               pBy,
+                                               pDuration,
+                                               pEaseType,
+                                               pLocalSpace,
+                                               pNumLoops,
+                                               pLoopType,
+                                               pDelay,
+                                               pTimeScale,
+                                               pTweenWhileGameIsPaused,
+                                               pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenRotatorStandardFactory::BP_CreateTweenRotateActorLookAtComponent(UTweenManagerComponent* pTweenManagerComponent,
+                                                                            AActor* pTweenTarget,
+                                                                            UTweenContainer*& pOutTweenContainer,
+                                                                            UTweenRotator*& pOutTween,
+                                                                            USceneComponent* pDestination,
+                                                                            FName pSocketName,
+                                                                            FVector pOffset,
+                                                                            float pDuration,
+                                                                            ETweenEaseType pEaseType,
+                                                                            ETweenRotationMode pRotationMode,
+                                                                            bool pDeleteTweenOnHit,
+                                                                            bool pDeleteTweenOnOverlap,
+                                                                            int32 pNumLoops,
+                                                                            ETweenLoopType pLoopType,
+                                                                            float pDelay,
+                                                                            float pTimeScale,
+                                                                            bool pTweenWhileGameIsPaused,
+                                                                            int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    pOutTween = BP_AppendTweenRotateActorLookAtComponent(pOutTweenContainer,
+                                                         pTweenTarget,
+                                                         pDestination,
+                                                         pSocketName,
+                                                         pOffset,
+                                                         pDuration,
+                                                         pEaseType,
+                                                         pRotationMode,
+                                                         pDeleteTweenOnHit,
+                                                         pDeleteTweenOnOverlap,
+                                                         pNumLoops,
+                                                         pLoopType,
+                                                         pDelay,
+                                                         pTimeScale,
+                                                         pTweenWhileGameIsPaused,
+                                                         pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenRotatorStandardFactory::BP_CreateTweenRotateSceneComponentLookAtComponent(UTweenManagerComponent* pTweenManagerComponent,
+                                                                                     USceneComponent* pTweenTarget,
+                                                                                     UTweenContainer*& pOutTweenContainer,
+                                                                                     UTweenRotator*& pOutTween,
+                                                                                     USceneComponent* pDestination,
+                                                                                     FName pSocketName,
+                                                                                     FVector pOffset,
+                                                                                     float pDuration,
+                                                                                     ETweenEaseType pEaseType,
+                                                                                     ETweenRotationMode pRotationMode,
+                                                                                     bool pDeleteTweenOnHit,
+                                                                                     bool pDeleteTweenOnOverlap,
+                                                                                     int32 pNumLoops,
+                                                                                     ETweenLoopType pLoopType,
+                                                                                     float pDelay,
+                                                                                     float pTimeScale,
+                                                                                     bool pTweenWhileGameIsPaused,
+                                                                                     int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    pOutTween = BP_AppendTweenRotateSceneComponentLookAtComponent(pOutTweenContainer,
+                                                                  pTweenTarget,
+                                                                  pDestination,
+                                                                  pSocketName,
+                                                                  pOffset,
+                                                                  pDuration,
+                                                                  pEaseType,
+                                                                  pRotationMode,
+                                                                  pDeleteTweenOnHit,
+                                                                  pDeleteTweenOnOverlap,
+                                                                  pNumLoops,
+                                                                  pLoopType,
+                                                                  pDelay,
+                                                                  pTimeScale,
+                                                                  pTweenWhileGameIsPaused,
+                                                                  pSequenceIndex);
+}
+
 // static public ---------------------------------------------------------------
 UTweenRotator* UTweenRotatorStandardFactory::BP_AppendTweenRotateActorTo(UTweenContainer* pTweenContainer,
                                                                          AActor* pTweenTarget,
@@ -333,6 +487,210 @@ UTweenRotator* UTweenRotatorStandardFactory::BP_AppendTweenRotateSceneComponentB
                                     pSequenceIndex);
 }
 
+// static public ---------------------------------------------------------------
+UTweenRotator* UTweenRotatorStandardFactory::BP_AppendTweenRotateInstanceTo(UTweenContainer* pTweenContainer,
+                                                                            UInstancedStaticMeshComponent* pTweenTarget,
+                                                                            int32 pInstanceIndex,
+                                                                            FRotator pTo,
+                                                                            float pDuration,
+                                                                            ETweenEaseType pEaseType,
+                                                                            ETweenSpace pTweenSpace,
+                                                                            ETweenRotationMode pRotationMode,
+                                                                            int32 pNumLoops,
+                                                                            ETweenLoopType pLoopType,
+                                                                            float pDelay,
+                                                                            float pTimeScale,
+                                                                            bool pTweenWhileGameIsPaused,
+                                                                            int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::InstancedStaticMesh;
+    ETweenRotatorType tweenType = ETweenRotatorType::RotateTo;
+    FRotator dummyFromRotator   = FRotator::ZeroRotator;
+    bool localSpace             = false;
+
+    UTweenRotator* outTween = CreateAppendTweenRotator(pTweenContainer,
+                                                       tweenType,
+                                                       pTweenTarget,
+                                                       targetType,
+                                                       dummyFromRotator,
+                                                       pTo,
+                                                       pDuration,
+                                                       pEaseType,
+                                                       pTweenSpace,
+                                                       pRotationMode,
+                                                       localSpace,
+                                                       false,
+                                                       false,
+                                                       pNumLoops,
+                                                       pLoopType,
+                                                       pDelay,
+                                                       pTimeScale,
+                                                       pTweenWhileGameIsPaused,
+                                                       pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetTweenTargetInstanceIndex(pInstanceIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenRotator* UTweenRotatorStandardFactory::BP_AppendTweenRotateInstanceBy(UTweenContainer* pTweenContainer,
+                                                                            UInstancedStaticMeshComponent* pTweenTarget,
+                                                                            int32 pInstanceIndex,
+                                                                            FRotator pBy,
+                                                                            float pDuration,
+                                                                            ETweenEaseType pEaseType,
+                                                                            bool pLocalSpace,
+                                                                            int32 pNumLoops,
+                                                                            ETweenLoopType pLoopType,
+                                                                            float pDelay,
+                                                                            float pTimeScale,
+                                                                            bool pTweenWhileGameIsPaused,
+                                                                            int32 pSequenceIndex)
+{
+    ETweenTargetType targetType          = ETweenTargetType::InstancedStaticMesh;
+    ETweenRotatorType tweenType          = ETweenRotatorType::RotateBy;
+    FRotator dummyFromRotator            = FRotator::ZeroRotator;
+    ETweenSpace dummySpace               = ETweenSpace::World;
+    ETweenRotationMode dummyRotationMode = ETweenRotationMode::ShortestPath;
+
+    UTweenRotator* outTween = CreateAppendTweenRotator(pTweenContainer,
+                                                       tweenType,
+                                                       pTweenTarget,
+                                                       targetType,
+                                                       dummyFromRotator,
+                                                       pBy,
+                                                       pDuration,
+                                                       pEaseType,
+                                                       dummySpace,
+                                                       dummyRotationMode,
+                                                       pLocalSpace,
+                                                       false,
+                                                       false,
+                                                       pNumLoops,
+                                                       pLoopType,
+                                                       pDelay,
+                                                       pTimeScale,
+                                                       pTweenWhileGameIsPaused,
+                                                       pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetTweenTargetInstanceIndex(pInstanceIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenRotator* UTweenRotatorStandardFactory::BP_AppendTweenRotateActorLookAtComponent(UTweenContainer* pTweenContainer,
+                                                                                      AActor* pTweenTarget,
+                                                                                      USceneComponent* pDestination,
+                                                                                      FName pSocketName,
+                                                                                      FVector pOffset,
+                                                                                      float pDuration,
+                                                                                      ETweenEaseType pEaseType,
+                                                                                      ETweenRotationMode pRotationMode,
+                                                                                      bool pDeleteTweenOnHit,
+                                                                                      bool pDeleteTweenOnOverlap,
+                                                                                      int32 pNumLoops,
+                                                                                      ETweenLoopType pLoopType,
+                                                                                      float pDelay,
+                                                                                      float pTimeScale,
+                                                                                      bool pTweenWhileGameIsPaused,
+                                                                                      int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::Actor;
+    ETweenRotatorType tweenType = ETweenRotatorType::LookAtComponent;
+    FRotator dummyRotator       = FRotator::ZeroRotator;
+    ETweenSpace tweenSpace      = ETweenSpace::World;
+    bool localSpace             = false;
+
+    // The destination is tracked in world space
+    UTweenRotator* outTween = CreateAppendTweenRotator(pTweenContainer,
+                                                       tweenType,
+                                                       pTweenTarget,
+                                                       targetType,
+                                                       dummyRotator,
+                                                       dummyRotator,
+                                                       pDuration,
+                                                       pEaseType,
+                                                       tweenSpace,
+                                                       pRotationMode,
+                                                       localSpace,
+                                                       pDeleteTweenOnHit,
+                                                       pDeleteTweenOnOverlap,
+                                                       pNumLoops,
+                                                       pLoopType,
+                                                       pDelay,
+                                                       pTimeScale,
+                                                       pTweenWhileGameIsPaused,
+                                                       pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->InitDestination(pDestination, pSocketName, pOffset);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenRotator* UTweenRotatorStandardFactory::BP_AppendTweenRotateSceneComponentLookAtComponent(UTweenContainer* pTweenContainer,
+                                                                                               USceneComponent* pTweenTarget,
+                                                                                               USceneComponent* pDestination,
+                                                                                               FName pSocketName,
+                                                                                               FVector pOffset,
+                                                                                               float pDuration,
+                                                                                               ETweenEaseType pEaseType,
+                                                                                               ETweenRotationMode pRotationMode,
+                                                                                               bool pDeleteTweenOnHit,
+                                                                                               bool pDeleteTweenOnOverlap,
+                                                                                               int32 pNumLoops,
+                                                                                               ETweenLoopType pLoopType,
+                                                                                               float pDelay,
+                                                                                               float pTimeScale,
+                                                                                               bool pTweenWhileGameIsPaused,
+                                                                                               int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::SceneComponent;
+    ETweenRotatorType tweenType = ETweenRotatorType::LookAtComponent;
+    FRotator dummyRotator       = FRotator::ZeroRotator;
+    ETweenSpace tweenSpace      = ETweenSpace::World;
+    bool localSpace             = false;
+
+    // The destination is tracked in world space
+    UTweenRotator* outTween = CreateAppendTweenRotator(pTweenContainer,
+                                                       tweenType,
+                                                       pTweenTarget,
+                                                       targetType,
+                                                       dummyRotator,
+                                                       dummyRotator,
+                                                       pDuration,
+                                                       pEaseType,
+                                                       tweenSpace,
+                                                       pRotationMode,
+                                                       localSpace,
+                                                       pDeleteTweenOnHit,
+                                                       pDeleteTweenOnOverlap,
+                                                       pNumLoops,
+                                                       pLoopType,
+                                                       pDelay,
+                                                       pTimeScale,
+                                                       pTweenWhileGameIsPaused,
+                                                       pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->InitDestination(pDestination, pSocketName, pOffset);
+    }
+
+    return outTween;
+}
+
 // static public ---------------------------------------------------------------
 UTweenRotator* UTweenRotatorStandardFactory::BP_JoinTweenRotateActorTo(UTweenContainer* pTweenContainer,
                                                                        AActor* pTweenTarget,
@@ -450,6 +808,96 @@ UTweenRotator* UTweenRotatorStandardFactory::BP_JoinTweenRotateSceneComponentTo(
                                   pSequenceIndex);
 }
 
+// static public ---------------------------------------------------------------
+UTweenRotator* UTweenRotatorStandardFactory::BP_JoinTweenRotateInstanceTo(UTweenContainer* pTweenContainer,
+                                                                          UInstancedStaticMeshComponent* pTweenTarget,
+                                                                          int32 pInstanceIndex,
+                                                                          FRotator pTo,
+                                                                          float pDuration,
+                                                                          ETweenEaseType pEaseType,
+                                                                          ETweenSpace pTweenSpace,
+                                                                          ETweenRotationMode pRotationMode,
+                                                                          float pDelay,
+                                                                          float pTimeScale,
+                                                                          bool pTweenWhileGameIsPaused,
+                                                                          int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::InstancedStaticMesh;
+    ETweenRotatorType tweenType = ETweenRotatorType::RotateTo;
+    FRotator dummyFromRotator   = FRotator::ZeroRotator;
+    bool localSpace             = false;
+
+    UTweenRotator* outTween = CreateJoinTweenRotator(pTweenContainer,
+                                                     tweenType,
+                                                     pTweenTarget,
+                                                     targetType,
+                                                     dummyFromRotator,
+                                                     pTo,
+                                                     pDuration,
+                                                     pEaseType,
+                                                     pTweenSpace,
+                                                     pRotationMode,
+                                                     localSpace,
+                                                     false,
+                                                     false,
+                                                     pDelay,
+                                                     pTimeScale,
+                                                     pTweenWhileGameIsPaused,
+                                                     pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetTweenTargetInstanceIndex(pInstanceIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenRotator* UTweenRotatorStandardFactory::BP_JoinTweenRotateInstanceBy(UTweenContainer* pTweenContainer,
+                                                                          UInstancedStaticMeshComponent* pTweenTarget,
+                                                                          int32 pInstanceIndex,
+                                                                          FRotator pBy,
+                                                                          float pDuration,
+                                                                          ETweenEaseType pEaseType,
+                                                                          bool pLocalSpace,
+                                                                          float pDelay,
+                                                                          float pTimeScale,
+                                                                          bool pTweenWhileGameIsPaused,
+                                                                          int32 pSequenceIndex)
+{
+    ETweenTargetType targetType          = ETweenTargetType::InstancedStaticMesh;
+    ETweenRotatorType tweenType          = ETweenRotatorType::RotateBy;
+    FRotator dummyFromRotator            = FRotator::ZeroRotator;
+    ETweenSpace dummySpace               = ETweenSpace::World;
+    ETweenRotationMode dummyRotationMode = ETweenRotationMode::ShortestPath;
+
+    UTweenRotator* outTween = CreateJoinTweenRotator(pTweenContainer,
+                                                     tweenType,
+                                                     pTweenTarget,
+                                                     targetType,
+                                                     dummyFromRotator,
+                                                     pBy,
+                                                     pDuration,
+                                                     pEaseType,
+                                                     dummySpace,
+                                                     dummyRotationMode,
+                                                     pLocalSpace,
+                                                     false,
+                                                     false,
+                                                     pDelay,
+                                                     pTimeScale,
+                                                     pTweenWhileGameIsPaused,
+                                                     pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetTweenTargetInstanceIndex(pInstanceIndex);
+    }
+
+    return outTween;
+}
+
 // static public ---------------------------------------------------------------
 UTweenRotator* UTweenRotatorStandardFactory::BP_JoinTweenRotateSceneComponentBy(UTweenContainer* pTweenContainer,
                                                                                 USceneComponent* pTweenTarget,
@@ -489,6 +937,104 @@ UTweenRotator* UTweenRotatorStandardFactory::BP_JoinTweenRotateSceneComponentBy(
                                   pSequenceIndex);
 }
 
+// static public ---------------------------------------------------------------
+UTweenRotator* UTweenRotatorStandardFactory::BP_JoinTweenRotateActorLookAtComponent(UTweenContainer* pTweenContainer,
+                                                                                    AActor* pTweenTarget,
+                                                                                    USceneComponent* pDestination,
+                                                                                    FName pSocketName,
+                                                                                    FVector pOffset,
+                                                                                    float pDuration,
+                                                                                    ETweenEaseType pEaseType,
+                                                                                    ETweenRotationMode pRotationMode,
+                                                                                    bool pDeleteTweenOnHit,
+                                                                                    bool pDeleteTweenOnOverlap,
+                                                                                    float pDelay,
+                                                                                    float pTimeScale,
+                                                                                    bool pTweenWhileGameIsPaused,
+                                                                                    int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::Actor;
+    ETweenRotatorType tweenType = ETweenRotatorType::LookAtComponent;
+    FRotator dummyRotator       = FRotator::ZeroRotator;
+    ETweenSpace tweenSpace      = ETweenSpace::World;
+    bool localSpace             = false;
+
+    // The destination is tracked in world space
+    UTweenRotator* outTween = CreateJoinTweenRotator(pTweenContainer,
+                                                     tweenType,
+                                                     pTweenTarget,
+                                                     targetType,
+                                                     dummyRotator,
+                                                     dummyRotator,
+                                                     pDuration,
+                                                     pEaseType,
+                                                     tweenSpace,
+                                                     pRotationMode,
+                                                     localSpace,
+                                                     pDeleteTweenOnHit,
+                                                     pDeleteTweenOnOverlap,
+                                                     pDelay,
+                                                     pTimeScale,
+                                                     pTweenWhileGameIsPaused,
+                                                     pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->InitDestination(pDestination, pSocketName, pOffset);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenRotator* UTweenRotatorStandardFactory::BP_JoinTweenRotateSceneComponentLookAtComponent(UTweenContainer* pTweenContainer,
+                                                                                             USceneComponent* pTweenTarget,
+                                                                                             USceneComponent* pDestination,
+                                                                                             FName pSocketName,
+                                                                                             FVector pOffset,
+                                                                                             float pDuration,
+                                                                                             ETweenEaseType pEaseType,
+                                                                                             ETweenRotationMode pRotationMode,
+                                                                                             bool pDeleteTweenOnHit,
+                                                                                             bool pDeleteTweenOnOverlap,
+                                                                                             float pDelay,
+                                                                                             float pTimeScale,
+                                                                                             bool pTweenWhileGameIsPaused,
+                                                                                             int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::SceneComponent;
+    ETweenRotatorType tweenType = ETweenRotatorType::LookAtComponent;
+    FRotator dummyRotator       = FRotator::ZeroRotator;
+    ETweenSpace tweenSpace      = ETweenSpace::World;
+    bool localSpace             = false;
+
+    // The destination is tracked in world space
+    UTweenRotator* outTween = CreateJoinTweenRotator(pTweenContainer,
+                                                     tweenType,
+                                                     pTweenTarget,
+                                                     targetType,
+                                                     dummyRotator,
+                                                     dummyRotator,
+                                                     pDuration,
+                                                     pEaseType,
+                                                     tweenSpace,
+                                                     pRotationMode,
+                                                     localSpace,
+                                                     pDeleteTweenOnHit,
+                                                     pDeleteTweenOnOverlap,
+                                                     pDelay,
+                                                     pTimeScale,
+                                                     pTweenWhileGameIsPaused,
+                                                     pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->InitDestination(pDestination, pSocketName, pOffset);
+    }
+
+    return outTween;
+}
+
 /*
  **************************************************************************
  * Helper methods that create the actual Tweens
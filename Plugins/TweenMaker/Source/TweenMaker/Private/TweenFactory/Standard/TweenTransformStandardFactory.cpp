@@ -0,0 +1,354 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "TweenFactory/Standard/TweenTransformStandardFactory.h"
+
+#include "GameFramework/Actor.h"
+#include "Tweens/TweenTransform.h"
+#include "TweenContainer.h"
+
+// public ----------------------------------------------------------------------
+UTweenTransformStandardFactory::UTweenTransformStandardFactory(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+
+}
+
+// static public ---------------------------------------------------------------
+void UTweenTransformStandardFactory::BP_CreateTweenActorTransformTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                    AActor* pTweenTarget,
+                                                                    UTweenContainer*& pOutTweenContainer,
+                                                                    UTweenTransform*& pOutTween,
+                                                                    FTransform pTo,
+                                                                    float pDuration,
+                                                                    ETweenEaseType pEaseType,
+                                                                    ETweenSpace pTweenSpace,
+                                                                    ETweenRotationMode pRotationMode,
+                                                                    bool pDeleteTweenOnHit,
+                                                                    bool pDeleteTweenOnOverlap,
+                                                                    int32 pNumLoops,
+                                                                    ETweenLoopType pLoopType,
+                                                                    float pDelay,
+                                                                    float pTimeScale,
+                                                                    bool pTweenWhileGameIsPaused,
+                                                                    int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+    pOutTween = BP_AppendTweenActorTransformTo(pOutTweenContainer,
+                                               pTweenTarget,
+                                               pTo,
+                                               pDuration,
+                                               pEaseType,
+                                               pTweenSpace,
+                                               pRotationMode,
+                                               pDeleteTweenOnHit,
+                                               pDeleteTweenOnOverlap,
+                                               pNumLoops,
+                                               pLoopType,
+                                               pDelay,
+                                               pTimeScale,
+                                               pTweenWhileGameIsPaused,
+                                               pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenTransformStandardFactory::BP_CreateTweenSceneComponentTransformTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                             USceneComponent* pTweenTarget,
+                                                                             UTweenContainer*& pOutTweenContainer,
+                                                                             UTweenTransform*& pOutTween,
+                                                                             FTransform pTo,
+                                                                             float pDuration,
+                                                                             ETweenEaseType pEaseType,
+                                                                             ETweenSpace pTweenSpace,
+                                                                             ETweenRotationMode pRotationMode,
+                                                                             bool pDeleteTweenOnHit,
+                                                                             bool pDeleteTweenOnOverlap,
+                                                                             int32 pNumLoops,
+                                                                             ETweenLoopType pLoopType,
+                                                                             float pDelay,
+                                                                             float pTimeScale,
+                                                                             bool pTweenWhileGameIsPaused,
+                                                                             int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+    pOutTween = BP_AppendTweenSceneComponentTransformTo(pOutTweenContainer,
+                                                        pTweenTarget,
+                                                        pTo,
+                                                        pDuration,
+                                                        pEaseType,
+                                                        pTweenSpace,
+                                                        pRotationMode,
+                                                        pDeleteTweenOnHit,
+                                                        pDeleteTweenOnOverlap,
+                                                        pNumLoops,
+                                                        pLoopType,
+                                                        pDelay,
+                                                        pTimeScale,
+                                                        pTweenWhileGameIsPaused,
+                                                        pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+UTweenTransform* UTweenTransformStandardFactory::BP_AppendTweenActorTransformTo(UTweenContainer* pTweenContainer,
+                                                                                AActor* pTweenTarget,
+                                                                                FTransform pTo,
+                                                                                float pDuration,
+                                                                                ETweenEaseType pEaseType,
+                                                                                ETweenSpace pTweenSpace,
+                                                                                ETweenRotationMode pRotationMode,
+                                                                                bool pDeleteTweenOnHit,
+                                                                                bool pDeleteTweenOnOverlap,
+                                                                                int32 pNumLoops,
+                                                                                ETweenLoopType pLoopType,
+                                                                                float pDelay,
+                                                                                float pTimeScale,
+                                                                                bool pTweenWhileGameIsPaused,
+                                                                                int32 pSequenceIndex)
+{
+    ETweenTargetType targetType   = ETweenTargetType::Actor;
+    ETweenTransformType tweenType = ETweenTransformType::TransformTo;
+
+    return CreateAppendTweenTransform(pTweenContainer,
+                                      tweenType,
+                                      pTweenTarget,
+                                      targetType,
+                                      pTo,
+                                      pDuration,
+                                      pEaseType,
+                                      pTweenSpace,
+                                      pRotationMode,
+                                      pDeleteTweenOnHit,
+                                      pDeleteTweenOnOverlap,
+                                      pNumLoops,
+                                      pLoopType,
+                                      pDelay,
+                                      pTimeScale,
+                                      pTweenWhileGameIsPaused,
+                                      pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+UTweenTransform* UTweenTransformStandardFactory::BP_AppendTweenSceneComponentTransformTo(UTweenContainer* pTweenContainer,
+                                                                                         USceneComponent* pTweenTarget,
+                                                                                         FTransform pTo,
+                                                                                         float pDuration,
+                                                                                         ETweenEaseType pEaseType,
+                                                                                         ETweenSpace pTweenSpace,
+                                                                                         ETweenRotationMode pRotationMode,
+                                                                                         bool pDeleteTweenOnHit,
+                                                                                         bool pDeleteTweenOnOverlap,
+                                                                                         int32 pNumLoops,
+                                                                                         ETweenLoopType pLoopType,
+                                                                                         float pDelay,
+                                                                                         float pTimeScale,
+                                                                                         bool pTweenWhileGameIsPaused,
+                                                                                         int32 pSequenceIndex)
+{
+    ETweenTargetType targetType   = ETweenTargetType::SceneComponent;
+    ETweenTransformType tweenType = ETweenTransformType::TransformTo;
+
+    return CreateAppendTweenTransform(pTweenContainer,
+                                      tweenType,
+                                      pTweenTarget,
+                                      targetType,
+                                      pTo,
+                                      pDuration,
+                                      pEaseType,
+                                      pTweenSpace,
+                                      pRotationMode,
+                                      pDeleteTweenOnHit,
+                                      pDeleteTweenOnOverlap,
+                                      pNumLoops,
+                                      pLoopType,
+                                      pDelay,
+                                      pTimeScale,
+                                      pTweenWhileGameIsPaused,
+                                      pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+UTweenTransform* UTweenTransformStandardFactory::BP_JoinTweenActorTransformTo(UTweenContainer* pTweenContainer,
+                                                                              AActor* pTweenTarget,
+                                                                              FTransform pTo,
+                                                                              float pDuration,
+                                                                              ETweenEaseType pEaseType,
+                                                                              ETweenSpace pTweenSpace,
+                                                                              ETweenRotationMode pRotationMode,
+                                                                              bool pDeleteTweenOnHit,
+                                                                              bool pDeleteTweenOnOverlap,
+                                                                              float pDelay,
+                                                                              float pTimeScale,
+                                                                              bool pTweenWhileGameIsPaused,
+                                                                              int32 pSequenceIndex)
+{
+    ETweenTargetType targetType   = ETweenTargetType::Actor;
+    ETweenTransformType tweenType = ETweenTransformType::TransformTo;
+
+    return CreateJoinTweenTransform(pTweenContainer,
+                                    tweenType,
+                                    pTweenTarget,
+                                    targetType,
+                                    pTo,
+                                    pDuration,
+                                    pEaseType,
+                                    pTweenSpace,
+                                    pRotationMode,
+                                    pDeleteTweenOnHit,
+                                    pDeleteTweenOnOverlap,
+                                    pDelay,
+                                    pTimeScale,
+                                    pTweenWhileGameIsPaused,
+                                    pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+UTweenTransform* UTweenTransformStandardFactory::BP_JoinTweenSceneComponentTransformTo(UTweenContainer* pTweenContainer,
+                                                                                       USceneComponent* pTweenTarget,
+                                                                                       FTransform pTo,
+                                                                                       float pDuration,
+                                                                                       ETweenEaseType pEaseType,
+                                                                                       ETweenSpace pTweenSpace,
+                                                                                       ETweenRotationMode pRotationMode,
+                                                                                       bool pDeleteTweenOnHit,
+                                                                                       bool pDeleteTweenOnOverlap,
+                                                                                       float pDelay,
+                                                                                       float pTimeScale,
+                                                                                       bool pTweenWhileGameIsPaused,
+                                                                                       int32 pSequenceIndex)
+{
+    ETweenTargetType targetType   = ETweenTargetType::SceneComponent;
+    ETweenTransformType tweenType = ETweenTransformType::TransformTo;
+
+    return CreateJoinTweenTransform(pTweenContainer,
+                                    tweenType,
+                                    pTweenTarget,
+                                    targetType,
+                                    pTo,
+                                    pDuration,
+                                    pEaseType,
+                                    pTweenSpace,
+                                    pRotationMode,
+                                    pDeleteTweenOnHit,
+                                    pDeleteTweenOnOverlap,
+                                    pDelay,
+                                    pTimeScale,
+                                    pTweenWhileGameIsPaused,
+                                    pSequenceIndex);
+}
+
+/*
+ **************************************************************************
+ * Helper methods that create the actual Tweens
+ **************************************************************************
+ */
+
+// static private --------------------------------------------------------------
+UTweenTransform* UTweenTransformStandardFactory::CreateAppendTweenTransform(UTweenContainer* pTweenContainer,
+                                                                            ETweenTransformType pTweenType,
+                                                                            UObject* pTarget,
+                                                                            ETweenTargetType pTargetType,
+                                                                            const FTransform& pTo,
+                                                                            float pDuration,
+                                                                            ETweenEaseType pEaseType,
+                                                                            ETweenSpace pTweenSpace,
+                                                                            ETweenRotationMode pRotationMode,
+                                                                            bool pDeleteTweenOnHit,
+                                                                            bool pDeleteTweenOnOverlap,
+                                                                            int32 pNumLoops,
+                                                                            ETweenLoopType pLoopType,
+                                                                            float pDelay,
+                                                                            float pTimeScale,
+                                                                            bool pTweenWhileGameIsPaused,
+                                                                            int32 pSequenceIndex)
+{
+    UTweenTransform *outTween = nullptr;
+
+    if (pTweenContainer != nullptr)
+    {
+        UTweenManagerComponent *tweenManagerInstance = pTweenContainer->OwningTweenManager;
+
+        if (tweenManagerInstance != nullptr)
+        {
+            int32 tweenIndex = pSequenceIndex > -1 ? pSequenceIndex : pTweenContainer->GetSequencesNum();
+
+            outTween = tweenManagerInstance->AppendTweenTransform(pTweenContainer,
+                                                                  tweenIndex,
+                                                                  pTweenType,
+                                                                  pTarget,
+                                                                  pTargetType,
+                                                                  pTo,
+                                                                  pDuration,
+                                                                  pEaseType,
+                                                                  pTweenSpace,
+                                                                  pRotationMode,
+                                                                  pDeleteTweenOnHit,
+                                                                  pDeleteTweenOnOverlap,
+                                                                  pNumLoops,
+                                                                  pLoopType,
+                                                                  pDelay,
+                                                                  pTimeScale,
+                                                                  pTweenWhileGameIsPaused);
+        }
+    }
+    else
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenTransformStandardFactory::CreateAppendTweenTransform() -> the Tween that had as target the "
+                                            "object with name %s couldn't be added because the passed TweenContainer was null."), *pTarget->GetName());
+    }
+
+    return outTween;
+}
+
+// static private --------------------------------------------------------------
+UTweenTransform* UTweenTransformStandardFactory::CreateJoinTweenTransform(UTweenContainer* pTweenContainer,
+                                                                          ETweenTransformType pTweenType,
+                                                                          UObject* pTarget,
+                                                                          ETweenTargetType pTargetType,
+                                                                          const FTransform& pTo,
+                                                                          float pDuration,
+                                                                          ETweenEaseType pEaseType,
+                                                                          ETweenSpace pTweenSpace,
+                                                                          ETweenRotationMode pRotationMode,
+                                                                          bool pDeleteTweenOnHit,
+                                                                          bool pDeleteTweenOnOverlap,
+                                                                          float pDelay,
+                                                                          float pTimeScale,
+                                                                          bool pTweenWhileGameIsPaused,
+                                                                          int32 pSequenceIndex)
+{
+    UTweenTransform *outTween = nullptr;
+
+    if (pTweenContainer != nullptr)
+    {
+        UTweenManagerComponent *tweenManagerInstance = pTweenContainer->OwningTweenManager;
+
+        if (tweenManagerInstance != nullptr)
+        {
+            int32 tweenIndex = pSequenceIndex > -1 ? pSequenceIndex : pTweenContainer->GetSequencesNum() - 1;
+
+            outTween = tweenManagerInstance->JoinTweenTransform(pTweenContainer,
+                                                                tweenIndex,
+                                                                pTweenType,
+                                                                pTarget,
+                                                                pTargetType,
+                                                                pTo,
+                                                                pDuration,
+                                                                pEaseType,
+                                                                pTweenSpace,
+                                                                pRotationMode,
+                                                                pDeleteTweenOnHit,
+                                                                pDeleteTweenOnOverlap,
+                                                                pDelay,
+                                                                pTimeScale,
+                                                                pTweenWhileGameIsPaused);
+        }
+    }
+    else
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenTransformStandardFactory::CreateJoinTweenTransform() -> the Tween that had as target the "
+                                            "object with name %s couldn't be added because the passed TweenContainer was null."), *pTarget->GetName());
+    }
+
+    return outTween;
+}
@@ -334,6 +334,302 @@ void UTweenVectorStandardFactory::BP_CreateTweenCustomVector(UTweenManagerCompon
                                            pSequenceIndex);
 }
 
+// static public ---------------------------------------------------------------
+void UTweenVectorStandardFactory::BP_CreateTweenMoveInstanceTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                               UInstancedStaticMeshComponent* pTweenTarget,
+                                                               int32 pInstanceIndex,
+                                                               UTweenContainer*& pOutTweenContainer,
+                                                               UTweenVector*& pOutTween,
+                                                               FVector pTo,
+                                                               float pDuration,
+                                                               ETweenEaseType pEaseType,
+                                                               ETweenSpace pTweenSpace,
+                                                               int32 pNumLoops,
+                                                               ETweenLoopType pLoopType,
+                                                               float pDelay,
+                                                               float pTimeScale,
+                                                               bool pTweenWhileGameIsPaused,
+                                                               int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    pOutTween = BP_AppendTweenMoveInstanceTo(pOutTweenContainer,
+                                             pTweenTarget,
+                                             pInstanceIndex,
+                                             pTo,
+                                             pDuration,
+                                             pEaseType,
+                                             pTweenSpace,
+                                             pNumLoops,
+                                             pLoopType,
+                                             pDelay,
+                                             pTimeScale,
+                                             pTweenWhileGameIsPaused,
+                                             pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenVectorStandardFactory::BP_CreateTweenMoveInstanceBy(UTweenManagerComponent* pTweenManagerComponent,
+                                                               UInstancedStaticMeshComponent* pTweenTarget,
+                                                               int32 pInstanceIndex,
+                                                               UTweenContainer*& pOutTweenContainer,
+                                                               UTweenVector*& pOutTween,
+                                                               FVector pBy,
+                                                               float pDuration,
+                                                               ETweenEaseType pEaseType,
+                                                               int32 pNumLoops,
+                                                               ETweenLoopType pLoopType,
+                                                               float pDelay,
+                                                               float pTimeScale,
+                                                               bool pTweenWhileGameIsPaused,
+                                                               int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    pOutTween = BP_AppendTweenMoveInstanceBy(pOutTweenContainer,
+                                             pTweenTarget,
+                                             pInstanceIndex,
+                                             pBy,
+                                             pDuration,
+                                             pEaseType,
+                                             pNumLoops,
+                                             pLoopType,
+                                             pDelay,
+                                             pTimeScale,
+                                             pTweenWhileGameIsPaused,
+                                             pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenVectorStandardFactory::BP_CreateTweenScaleInstanceTo(UTweenManagerComponent* pTweenManagerComponent,
+                                                                UInstancedStaticMeshComponent* pTweenTarget,
+                                                                int32 pInstanceIndex,
+                                                                UTweenContainer*& pOutTweenContainer,
+                                                                UTweenVector*& pOutTween,
+                                                                FVector pTo,
+                                                                float pDuration,
+                                                                ETweenEaseType pEaseType,
+                                                                ETweenSpace pTweenSpace,
+                                                                int32 pNumLoops,
+                                                                ETweenLoopType pLoopType,
+                                                                float pDelay,
+                                                                float pTimeScale,
+                                                                bool pTweenWhileGameIsPaused,
+                                                                int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    pOutTween = BP_AppendTweenScaleInstanceTo(pOutTweenContainer,
+                                              pTweenTarget,
+                                              pInstanceIndex,
+                                              pTo,
+                                              pDuration,
+                                              pEaseType,
+                                              pTweenSpace,
+                                              pNumLoops,
+                                              pLoopType,
+                                              pDelay,
+                                              pTimeScale,
+                                              pTweenWhileGameIsPaused,
+                                              pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenVectorStandardFactory::BP_CreateTweenScaleInstanceBy(UTweenManagerComponent* pTweenManagerComponent,
+                                                                UInstancedStaticMeshComponent* pTweenTarget,
+                                                                int32 pInstanceIndex,
+                                                                UTweenContainer*& pOutTweenContainer,
+                                                                UTweenVector*& pOutTween,
+                                                                FVector pBy,
+                                                                float pDuration,
+                                                                ETweenEaseType pEaseType,
+                                                                int32 pNumLoops,
+                                                                ETweenLoopType pLoopType,
+                                                                float pDelay,
+                                                                float pTimeScale,
+                                                                bool pTweenWhileGameIsPaused,
+                                                                int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    pOutTween = BP_AppendTweenScaleInstanceBy(pOutTweenContainer,
+                                              pTweenTarget,
+                                              pInstanceIndex,
+                                              pBy,
+                                              pDuration,
+                                              pEaseType,
+                                              pNumLoops,
+                                              pLoopType,
+                                              pDelay,
+                                              pTimeScale,
+                                              pTweenWhileGameIsPaused,
+                                              pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenVectorStandardFactory::BP_CreateTweenMoveActorAlongBezier(UTweenManagerComponent* pTweenManagerComponent,
+                                                                     AActor* pTweenTarget,
+                                                                     UTweenContainer*& pOutTweenContainer,
+                                                                     UTweenVector*& pOutTween,
+                                                                     FVector pTo,
+                                                                     const TArray<FVector>& pControlPoints,
+                                                                     bool pUseConstantSpeed,
+                                                                     float pDuration,
+                                                                     ETweenEaseType pEaseType,
+                                                                     ETweenSpace pTweenSpace,
+                                                                     bool pDeleteTweenOnHit,
+                                                                     bool pDeleteTweenOnOverlap,
+                                                                     int32 pNumLoops,
+                                                                     ETweenLoopType pLoopType,
+                                                                     float pDelay,
+                                                                     float pTimeScale,
+                                                                     bool pTweenWhileGameIsPaused,
+                                                                     int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    pOutTween = BP_AppendTweenMoveActorAlongBezier(pOutTweenContainer,
+                                                   pTweenTarget,
+                                                   pTo,
+                                                   pControlPoints,
+                                                   pUseConstantSpeed,
+                                                   pDuration,
+                                                   pEaseType,
+                                                   pTweenSpace,
+                                                   pDeleteTweenOnHit,
+                                                   pDeleteTweenOnOverlap,
+                                                   pNumLoops,
+                                                   pLoopType,
+                                                   pDelay,
+                                                   pTimeScale,
+                                                   pTweenWhileGameIsPaused,
+                                                   pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenVectorStandardFactory::BP_CreateTweenMoveSceneComponentAlongBezier(UTweenManagerComponent* pTweenManagerComponent,
+                                                                              USceneComponent* pTweenTarget,
+                                                                              UTweenContainer*& pOutTweenContainer,
+                                                                              UTweenVector*& pOutTween,
+                                                                              FVector pTo,
+                                                                              const TArray<FVector>& pControlPoints,
+                                                                              bool pUseConstantSpeed,
+                                                                              float pDuration,
+                                                                              ETweenEaseType pEaseType,
+                                                                              ETweenSpace pTweenSpace,
+                                                                              bool pDeleteTweenOnHit,
+                                                                              bool pDeleteTweenOnOverlap,
+                                                                              int32 pNumLoops,
+                                                                              ETweenLoopType pLoopType,
+                                                                              float pDelay,
+                                                                              float pTimeScale,
+                                                                              bool pTweenWhileGameIsPaused,
+                                                                              int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    pOutTween = BP_AppendTweenMoveSceneComponentAlongBezier(pOutTweenContainer,
+                                                            pTweenTarget,
+                                                            pTo,
+                                                            pControlPoints,
+                                                            pUseConstantSpeed,
+                                                            pDuration,
+                                                            pEaseType,
+                                                            pTweenSpace,
+                                                            pDeleteTweenOnHit,
+                                                            pDeleteTweenOnOverlap,
+                                                            pNumLoops,
+                                                            pLoopType,
+                                                            pDelay,
+                                                            pTimeScale,
+                                                            pTweenWhileGameIsPaused,
+                                                            pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenVectorStandardFactory::BP_CreateTweenMoveActorToComponent(UTweenManagerComponent* pTweenManagerComponent,
+                                                                     AActor* pTweenTarget,
+                                                                     UTweenContainer*& pOutTweenContainer,
+                                                                     UTweenVector*& pOutTween,
+                                                                     USceneComponent* pDestination,
+                                                                     FName pSocketName,
+                                                                     FVector pOffset,
+                                                                     float pDuration,
+                                                                     ETweenEaseType pEaseType,
+                                                                     bool pDeleteTweenOnHit,
+                                                                     bool pDeleteTweenOnOverlap,
+                                                                     int32 pNumLoops,
+                                                                     ETweenLoopType pLoopType,
+                                                                     float pDelay,
+                                                                     float pTimeScale,
+                                                                     bool pTweenWhileGameIsPaused,
+                                                                     int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    pOutTween = BP_AppendTweenMoveActorToComponent(pOutTweenContainer,
+                                                   pTweenTarget,
+                                                   pDestination,
+                                                   pSocketName,
+                                                   pOffset,
+                                                   pDuration,
+                                                   pEaseType,
+                                                   pDeleteTweenOnHit,
+                                                   pDeleteTweenOnOverlap,
+                                                   pNumLoops,
+                                                   pLoopType,
+                                                   pDelay,
+                                                   pTimeScale,
+                                                   pTweenWhileGameIsPaused,
+                                                   pSequenceIndex);
+}
+
+// static public ---------------------------------------------------------------
+void UTweenVectorStandardFactory::BP_CreateTweenMoveSceneComponentToComponent(UTweenManagerComponent* pTweenManagerComponent,
+                                                                              USceneComponent* pTweenTarget,
+                                                                              UTweenContainer*& pOutTweenContainer,
+                                                                              UTweenVector*& pOutTween,
+                                                                              USceneComponent* pDestination,
+                                                                              FName pSocketName,
+                                                                              FVector pOffset,
+                                                                              float pDuration,
+                                                                              ETweenEaseType pEaseType,
+                                                                              bool pDeleteTweenOnHit,
+                                                                              bool pDeleteTweenOnOverlap,
+                                                                              int32 pNumLoops,
+                                                                              ETweenLoopType pLoopType,
+                                                                              float pDelay,
+                                                                              float pTimeScale,
+                                                                              bool pTweenWhileGameIsPaused,
+                                                                              int32 pSequenceIndex)
+{
+    pOutTweenContainer = pTweenManagerComponent != nullptr ? pTweenManagerComponent->CreateTweenContainer()
+                                                           : UTweenManagerComponent::CreateTweenContainerStatic();
+
+    pOutTween = BP_AppendTweenMoveSceneComponentToComponent(pOutTweenContainer,
+                                                            pTweenTarget,
+                                                            pDestination,
+                                                            pSocketName,
+                                                            pOffset,
+                                                            pDuration,
+                                                            pEaseType,
+                                                            pDeleteTweenOnHit,
+                                                            pDeleteTweenOnOverlap,
+                                                            pNumLoops,
+                                                            pLoopType,
+                                                            pDelay,
+                                                            pTimeScale,
+                                                            pTweenWhileGameIsPaused,
+                                                            pSequenceIndex);
+}
+
 // static public ---------------------------------------------------------------
 UTweenVector* UTweenVectorStandardFactory::BP_AppendTweenMoveActorTo(UTweenContainer* pTweenContainer,
                                                                      AActor* pTweenTarget,
@@ -682,6 +978,368 @@ UTweenVector* UTweenVectorStandardFactory::BP_AppendTweenCustomVector(UTweenCont
                                    pSequenceIndex);
 }
 
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_AppendTweenMoveInstanceTo(UTweenContainer* pTweenContainer,
+                                                                        UInstancedStaticMeshComponent* pTweenTarget,
+                                                                        int32 pInstanceIndex,
+                                                                        FVector pTo,
+                                                                        float pDuration,
+                                                                        ETweenEaseType pEaseType,
+                                                                        ETweenSpace pTweenSpace,
+                                                                        int32 pNumLoops,
+                                                                        ETweenLoopType pLoopType,
+                                                                        float pDelay,
+                                                                        float pTimeScale,
+                                                                        bool pTweenWhileGameIsPaused,
+                                                                        int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::InstancedStaticMesh;
+    ETweenVectorType tweenType  = ETweenVectorType::MoveTo;
+    FVector dummyFromVec        = FVector(0, 0, 0);
+
+    UTweenVector* outTween = CreateAppendTweenVector(pTweenContainer,
+                                                     tweenType,
+                                                     pTweenTarget,
+                                                     targetType,
+                                                     dummyFromVec,
+                                                     pTo,
+                                                     pDuration,
+                                                     pEaseType,
+                                                     pTweenSpace,
+                                                     false,
+                                                     false,
+                                                     pNumLoops,
+                                                     pLoopType,
+                                                     pDelay,
+                                                     pTimeScale,
+                                                     pTweenWhileGameIsPaused,
+                                                     pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetTweenTargetInstanceIndex(pInstanceIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_AppendTweenMoveInstanceBy(UTweenContainer* pTweenContainer,
+                                                                        UInstancedStaticMeshComponent* pTweenTarget,
+                                                                        int32 pInstanceIndex,
+                                                                        FVector pBy,
+                                                                        float pDuration,
+                                                                        ETweenEaseType pEaseType,
+                                                                        int32 pNumLoops,
+                                                                        ETweenLoopType pLoopType,
+                                                                        float pDelay,
+                                                                        float pTimeScale,
+                                                                        bool pTweenWhileGameIsPaused,
+                                                                        int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::InstancedStaticMesh;
+    ETweenVectorType tweenType  = ETweenVectorType::MoveBy;
+    FVector dummyFromVec        = FVector(0, 0, 0);
+    ETweenSpace dummySpace      = ETweenSpace::World;
+
+    UTweenVector* outTween = CreateAppendTweenVector(pTweenContainer,
+                                                     tweenType,
+                                                     pTweenTarget,
+                                                     targetType,
+                                                     dummyFromVec,
+                                                     pBy,
+                                                     pDuration,
+                                                     pEaseType,
+                                                     dummySpace,
+                                                     false,
+                                                     false,
+                                                     pNumLoops,
+                                                     pLoopType,
+                                                     pDelay,
+                                                     pTimeScale,
+                                                     pTweenWhileGameIsPaused,
+                                                     pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetTweenTargetInstanceIndex(pInstanceIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_AppendTweenScaleInstanceTo(UTweenContainer* pTweenContainer,
+                                                                         UInstancedStaticMeshComponent* pTweenTarget,
+                                                                         int32 pInstanceIndex,
+                                                                         FVector pTo,
+                                                                         float pDuration,
+                                                                         ETweenEaseType pEaseType,
+                                                                         ETweenSpace pTweenSpace,
+                                                                         int32 pNumLoops,
+                                                                         ETweenLoopType pLoopType,
+                                                                         float pDelay,
+                                                                         float pTimeScale,
+                                                                         bool pTweenWhileGameIsPaused,
+                                                                         int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::InstancedStaticMesh;
+    ETweenVectorType tweenType  = ETweenVectorType::ScaleTo;
+    FVector dummyFromVec        = FVector(0, 0, 0);
+
+    UTweenVector* outTween = CreateAppendTweenVector(pTweenContainer,
+                                                     tweenType,
+                                                     pTweenTarget,
+                                                     targetType,
+                                                     dummyFromVec,
+                                                     pTo,
+                                                     pDuration,
+                                                     pEaseType,
+                                                     pTweenSpace,
+                                                     false,
+                                                     false,
+                                                     pNumLoops,
+                                                     pLoopType,
+                                                     pDelay,
+                                                     pTimeScale,
+                                                     pTweenWhileGameIsPaused,
+                                                     pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetTweenTargetInstanceIndex(pInstanceIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_AppendTweenScaleInstanceBy(UTweenContainer* pTweenContainer,
+                                                                         UInstancedStaticMeshComponent* pTweenTarget,
+                                                                         int32 pInstanceIndex,
+                                                                         FVector pBy,
+                                                                         float pDuration,
+                                                                         ETweenEaseType pEaseType,
+                                                                         int32 pNumLoops,
+                                                                         ETweenLoopType pLoopType,
+                                                                         float pDelay,
+                                                                         float pTimeScale,
+                                                                         bool pTweenWhileGameIsPaused,
+                                                                         int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::InstancedStaticMesh;
+    ETweenVectorType tweenType  = ETweenVectorType::ScaleBy;
+    FVector dummyFromVec        = FVector(0, 0, 0);
+    ETweenSpace dummySpace      = ETweenSpace::World;
+
+    UTweenVector* outTween = CreateAppendTweenVector(pTweenContainer,
+                                                     tweenType,
+                                                     pTweenTarget,
+                                                     targetType,
+                                                     dummyFromVec,
+                                                     pBy,
+                                                     pDuration,
+                                                     pEaseType,
+                                                     dummySpace,
+                                                     false,
+                                                     false,
+                                                     pNumLoops,
+                                                     pLoopType,
+                                                     pDelay,
+                                                     pTimeScale,
+                                                     pTweenWhileGameIsPaused,
+                                                     pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetTweenTargetInstanceIndex(pInstanceIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_AppendTweenMoveActorAlongBezier(UTweenContainer* pTweenContainer,
+                                                                              AActor* pTweenTarget,
+                                                                              FVector pTo,
+                                                                              const TArray<FVector>& pControlPoints,
+                                                                              bool pUseConstantSpeed,
+                                                                              float pDuration,
+                                                                              ETweenEaseType pEaseType,
+                                                                              ETweenSpace pTweenSpace,
+                                                                              bool pDeleteTweenOnHit,
+                                                                              bool pDeleteTweenOnOverlap,
+                                                                              int32 pNumLoops,
+                                                                              ETweenLoopType pLoopType,
+                                                                              float pDelay,
+                                                                              float pTimeScale,
+                                                                              bool pTweenWhileGameIsPaused,
+                                                                              int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::Actor;
+    ETweenVectorType tweenType  = ETweenVectorType::MoveAlongBezier;
+
+    return CreateAppendTweenVector(pTweenContainer,
+                                   tweenType,
+                                   pTweenTarget,
+                                   targetType,
+                                   FVector::ZeroVector,
+                                   pTo,
+                                   pDuration,
+                                   pEaseType,
+                                   pTweenSpace,
+                                   pDeleteTweenOnHit,
+                                   pDeleteTweenOnOverlap,
+                                   pNumLoops,
+                                   pLoopType,
+                                   pDelay,
+                                   pTimeScale,
+                                   pTweenWhileGameIsPaused,
+                                   pSequenceIndex,
+                                   &pControlPoints,
+                                   pUseConstantSpeed);
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_AppendTweenMoveSceneComponentAlongBezier(UTweenContainer* pTweenContainer,
+                                                                                       USceneComponent* pTweenTarget,
+                                                                                       FVector pTo,
+                                                                                       const TArray<FVector>& pControlPoints,
+                                                                                       bool pUseConstantSpeed,
+                                                                                       float pDuration,
+                                                                                       ETweenEaseType pEaseType,
+                                                                                       ETweenSpace pTweenSpace,
+                                                                                       bool pDeleteTweenOnHit,
+                                                                                       bool pDeleteTweenOnOverlap,
+                                                                                       int32 pNumLoops,
+                                                                                       ETweenLoopType pLoopType,
+                                                                                       float pDelay,
+                                                                                       float pTimeScale,
+                                                                                       bool pTweenWhileGameIsPaused,
+                                                                                       int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::SceneComponent;
+    ETweenVectorType tweenType  = ETweenVectorType::MoveAlongBezier;
+
+    return CreateAppendTweenVector(pTweenContainer,
+                                   tweenType,
+                                   pTweenTarget,
+                                   targetType,
+                                   FVector::ZeroVector,
+                                   pTo,
+                                   pDuration,
+                                   pEaseType,
+                                   pTweenSpace,
+                                   pDeleteTweenOnHit,
+                                   pDeleteTweenOnOverlap,
+                                   pNumLoops,
+                                   pLoopType,
+                                   pDelay,
+                                   pTimeScale,
+                                   pTweenWhileGameIsPaused,
+                                   pSequenceIndex,
+                                   &pControlPoints,
+                                   pUseConstantSpeed);
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_AppendTweenMoveActorToComponent(UTweenContainer* pTweenContainer,
+                                                                              AActor* pTweenTarget,
+                                                                              USceneComponent* pDestination,
+                                                                              FName pSocketName,
+                                                                              FVector pOffset,
+                                                                              float pDuration,
+                                                                              ETweenEaseType pEaseType,
+                                                                              bool pDeleteTweenOnHit,
+                                                                              bool pDeleteTweenOnOverlap,
+                                                                              int32 pNumLoops,
+                                                                              ETweenLoopType pLoopType,
+                                                                              float pDelay,
+                                                                              float pTimeScale,
+                                                                              bool pTweenWhileGameIsPaused,
+                                                                              int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::Actor;
+    ETweenVectorType tweenType  = ETweenVectorType::MoveToComponent;
+    FVector dummyVector         = FVector(0, 0, 0);
+    ETweenSpace tweenSpace      = ETweenSpace::World;
+
+    // The destination is tracked in world space
+    UTweenVector* outTween = CreateAppendTweenVector(pTweenContainer,
+                                                     tweenType,
+                                                     pTweenTarget,
+                                                     targetType,
+                                                     dummyVector,
+                                                     dummyVector,
+                                                     pDuration,
+                                                     pEaseType,
+                                                     tweenSpace,
+                                                     pDeleteTweenOnHit,
+                                                     pDeleteTweenOnOverlap,
+                                                     pNumLoops,
+                                                     pLoopType,
+                                                     pDelay,
+                                                     pTimeScale,
+                                                     pTweenWhileGameIsPaused,
+                                                     pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->InitDestination(pDestination, pSocketName, pOffset);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_AppendTweenMoveSceneComponentToComponent(UTweenContainer* pTweenContainer,
+                                                                                       USceneComponent* pTweenTarget,
+                                                                                       USceneComponent* pDestination,
+                                                                                       FName pSocketName,
+                                                                                       FVector pOffset,
+                                                                                       float pDuration,
+                                                                                       ETweenEaseType pEaseType,
+                                                                                       bool pDeleteTweenOnHit,
+                                                                                       bool pDeleteTweenOnOverlap,
+                                                                                       int32 pNumLoops,
+                                                                                       ETweenLoopType pLoopType,
+                                                                                       float pDelay,
+                                                                                       float pTimeScale,
+                                                                                       bool pTweenWhileGameIsPaused,
+                                                                                       int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::SceneComponent;
+    ETweenVectorType tweenType  = ETweenVectorType::MoveToComponent;
+    FVector dummyVector         = FVector(0, 0, 0);
+    ETweenSpace tweenSpace      = ETweenSpace::World;
+
+    // The destination is tracked in world space
+    UTweenVector* outTween = CreateAppendTweenVector(pTweenContainer,
+                                                     tweenType,
+                                                     pTweenTarget,
+                                                     targetType,
+                                                     dummyVector,
+                                                     dummyVector,
+                                                     pDuration,
+                                                     pEaseType,
+                                                     tweenSpace,
+                                                     pDeleteTweenOnHit,
+                                                     pDeleteTweenOnOverlap,
+                                                     pNumLoops,
+                                                     pLoopType,
+                                                     pDelay,
+                                                     pTimeScale,
+                                                     pTweenWhileGameIsPaused,
+                                                     pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->InitDestination(pDestination, pSocketName, pOffset);
+    }
+
+    return outTween;
+}
+
 // static public ---------------------------------------------------------------
 UTweenVector* UTweenVectorStandardFactory::BP_JoinTweenMoveActorTo(UTweenContainer* pTweenContainer,
                                                                    AActor* pTweenTarget,
@@ -995,6 +1653,336 @@ UTweenVector* UTweenVectorStandardFactory::BP_JoinTweenCustomVector(UTweenContai
                                  pSequenceIndex);
 }
 
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_JoinTweenMoveInstanceTo(UTweenContainer* pTweenContainer,
+                                                                      UInstancedStaticMeshComponent* pTweenTarget,
+                                                                      int32 pInstanceIndex,
+                                                                      FVector pTo,
+                                                                      float pDuration,
+                                                                      ETweenEaseType pEaseType,
+                                                                      ETweenSpace pTweenSpace,
+                                                                      float pDelay,
+                                                                      float pTimeScale,
+                                                                      bool pTweenWhileGameIsPaused,
+                                                                      int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::InstancedStaticMesh;
+    ETweenVectorType tweenType  = ETweenVectorType::MoveTo;
+    FVector dummyFromVec        = FVector(0, 0, 0);
+
+    UTweenVector* outTween = CreateJoinTweenVector(pTweenContainer,
+                                                   tweenType,
+                                                   pTweenTarget,
+                                                   targetType,
+                                                   dummyFromVec,
+                                                   pTo,
+                                                   pDuration,
+                                                   pEaseType,
+                                                   pTweenSpace,
+                                                   false,
+                                                   false,
+                                                   pDelay,
+                                                   pTimeScale,
+                                                   pTweenWhileGameIsPaused,
+                                                   pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetTweenTargetInstanceIndex(pInstanceIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_JoinTweenMoveInstanceBy(UTweenContainer* pTweenContainer,
+                                                                      UInstancedStaticMeshComponent* pTweenTarget,
+                                                                      int32 pInstanceIndex,
+                                                                      FVector pBy,
+                                                                      float pDuration,
+                                                                      ETweenEaseType pEaseType,
+                                                                      float pDelay,
+                                                                      float pTimeScale,
+                                                                      bool pTweenWhileGameIsPaused,
+                                                                      int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::InstancedStaticMesh;
+    ETweenVectorType tweenType  = ETweenVectorType::MoveBy;
+    FVector dummyFromVec        = FVector(0, 0, 0);
+    ETweenSpace dummySpace      = ETweenSpace::World;
+
+    UTweenVector* outTween = CreateJoinTweenVector(pTweenContainer,
+                                                   tweenType,
+                                                   pTweenTarget,
+                                                   targetType,
+                                                   dummyFromVec,
+                                                   pBy,
+                                                   pDuration,
+                                                   pEaseType,
+                                                   dummySpace,
+                                                   false,
+                                                   false,
+                                                   pDelay,
+                                                   pTimeScale,
+                                                   pTweenWhileGameIsPaused,
+                                                   pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetTweenTargetInstanceIndex(pInstanceIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_JoinTweenScaleInstanceTo(UTweenContainer* pTweenContainer,
+                                                                       UInstancedStaticMeshComponent* pTweenTarget,
+                                                                       int32 pInstanceIndex,
+                                                                       FVector pTo,
+                                                                       float pDuration,
+                                                                       ETweenEaseType pEaseType,
+                                                                       ETweenSpace pTweenSpace,
+                                                                       float pDelay,
+                                                                       float pTimeScale,
+                                                                       bool pTweenWhileGameIsPaused,
+                                                                       int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::InstancedStaticMesh;
+    ETweenVectorType tweenType  = ETweenVectorType::ScaleTo;
+    FVector dummyFromVec        = FVector(0, 0, 0);
+
+    UTweenVector* outTween = CreateJoinTweenVector(pTweenContainer,
+                                                   tweenType,
+                                                   pTweenTarget,
+                                                   targetType,
+                                                   dummyFromVec,
+                                                   pTo,
+                                                   pDuration,
+                                                   pEaseType,
+                                                   pTweenSpace,
+                                                   false,
+                                                   false,
+                                                   pDelay,
+                                                   pTimeScale,
+                                                   pTweenWhileGameIsPaused,
+                                                   pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetTweenTargetInstanceIndex(pInstanceIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_JoinTweenScaleInstanceBy(UTweenContainer* pTweenContainer,
+                                                                       UInstancedStaticMeshComponent* pTweenTarget,
+                                                                       int32 pInstanceIndex,
+                                                                       FVector pBy,
+                                                                       float pDuration,
+                                                                       ETweenEaseType pEaseType,
+                                                                       float pDelay,
+                                                                       float pTimeScale,
+                                                                       bool pTweenWhileGameIsPaused,
+                                                                       int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::InstancedStaticMesh;
+    ETweenVectorType tweenType  = ETweenVectorType::ScaleBy;
+    FVector dummyFromVec        = FVector(0, 0, 0);
+    ETweenSpace dummySpace      = ETweenSpace::World;
+
+    UTweenVector* outTween = CreateJoinTweenVector(pTweenContainer,
+                                                   tweenType,
+                                                   pTweenTarget,
+                                                   targetType,
+                                                   dummyFromVec,
+                                                   pBy,
+                                                   pDuration,
+                                                   pEaseType,
+                                                   dummySpace,
+                                                   false,
+                                                   false,
+                                                   pDelay,
+                                                   pTimeScale,
+                                                   pTweenWhileGameIsPaused,
+                                                   pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->SetTweenTargetInstanceIndex(pInstanceIndex);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_JoinTweenMoveActorAlongBezier(UTweenContainer* pTweenContainer,
+                                                                            AActor* pTweenTarget,
+                                                                            FVector pTo,
+                                                                            const TArray<FVector>& pControlPoints,
+                                                                            bool pUseConstantSpeed,
+                                                                            float pDuration,
+                                                                            ETweenEaseType pEaseType,
+                                                                            ETweenSpace pTweenSpace,
+                                                                            bool pDeleteTweenOnHit,
+                                                                            bool pDeleteTweenOnOverlap,
+                                                                            float pDelay,
+                                                                            float pTimeScale,
+                                                                            bool pTweenWhileGameIsPaused,
+                                                                            int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::Actor;
+    ETweenVectorType tweenType  = ETweenVectorType::MoveAlongBezier;
+
+    return CreateJoinTweenVector(pTweenContainer,
+                                 tweenType,
+                                 pTweenTarget,
+                                 targetType,
+                                 FVector::ZeroVector,
+                                 pTo,
+                                 pDuration,
+                                 pEaseType,
+                                 pTweenSpace,
+                                 pDeleteTweenOnHit,
+                                 pDeleteTweenOnOverlap,
+                                 pDelay,
+                                 pTimeScale,
+                                 pTweenWhileGameIsPaused,
+                                 pSequenceIndex,
+                                 &pControlPoints,
+                                 pUseConstantSpeed);
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_JoinTweenMoveSceneComponentAlongBezier(UTweenContainer* pTweenContainer,
+                                                                                     USceneComponent* pTweenTarget,
+                                                                                     FVector pTo,
+                                                                                     const TArray<FVector>& pControlPoints,
+                                                                                     bool pUseConstantSpeed,
+                                                                                     float pDuration,
+                                                                                     ETweenEaseType pEaseType,
+                                                                                     ETweenSpace pTweenSpace,
+                                                                                     bool pDeleteTweenOnHit,
+                                                                                     bool pDeleteTweenOnOverlap,
+                                                                                     float pDelay,
+                                                                                     float pTimeScale,
+                                                                                     bool pTweenWhileGameIsPaused,
+                                                                                     int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::SceneComponent;
+    ETweenVectorType tweenType  = ETweenVectorType::MoveAlongBezier;
+
+    return CreateJoinTweenVector(pTweenContainer,
+                                 tweenType,
+                                 pTweenTarget,
+                                 targetType,
+                                 FVector::ZeroVector,
+                                 pTo,
+                                 pDuration,
+                                 pEaseType,
+                                 pTweenSpace,
+                                 pDeleteTweenOnHit,
+                                 pDeleteTweenOnOverlap,
+                                 pDelay,
+                                 pTimeScale,
+                                 pTweenWhileGameIsPaused,
+                                 pSequenceIndex,
+                                 &pControlPoints,
+                                 pUseConstantSpeed);
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_JoinTweenMoveActorToComponent(UTweenContainer* pTweenContainer,
+                                                                            AActor* pTweenTarget,
+                                                                            USceneComponent* pDestination,
+                                                                            FName pSocketName,
+                                                                            FVector pOffset,
+                                                                            float pDuration,
+                                                                            ETweenEaseType pEaseType,
+                                                                            bool pDeleteTweenOnHit,
+                                                                            bool pDeleteTweenOnOverlap,
+                                                                            float pDelay,
+                                                                            float pTimeScale,
+                                                                            bool pTweenWhileGameIsPaused,
+                                                                            int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::Actor;
+    ETweenVectorType tweenType  = ETweenVectorType::MoveToComponent;
+    FVector dummyVector         = FVector(0, 0, 0);
+    ETweenSpace tweenSpace      = ETweenSpace::World;
+
+    // The destination is tracked in world space
+    UTweenVector* outTween = CreateJoinTweenVector(pTweenContainer,
+                                                   tweenType,
+                                                   pTweenTarget,
+                                                   targetType,
+                                                   dummyVector,
+                                                   dummyVector,
+                                                   pDuration,
+                                                   pEaseType,
+                                                   tweenSpace,
+                                                   pDeleteTweenOnHit,
+                                                   pDeleteTweenOnOverlap,
+                                                   pDelay,
+                                                   pTimeScale,
+                                                   pTweenWhileGameIsPaused,
+                                                   pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->InitDestination(pDestination, pSocketName, pOffset);
+    }
+
+    return outTween;
+}
+
+// static public ---------------------------------------------------------------
+UTweenVector* UTweenVectorStandardFactory::BP_JoinTweenMoveSceneComponentToComponent(UTweenContainer* pTweenContainer,
+                                                                                     USceneComponent* pTweenTarget,
+                                                                                     USceneComponent* pDestination,
+                                                                                     FName pSocketName,
+                                                                                     FVector pOffset,
+                                                                                     float pDuration,
+                                                                                     ETweenEaseType pEaseType,
+                                                                                     bool pDeleteTweenOnHit,
+                                                                                     bool pDeleteTweenOnOverlap,
+                                                                                     float pDelay,
+                                                                                     float pTimeScale,
+                                                                                     bool pTweenWhileGameIsPaused,
+                                                                                     int32 pSequenceIndex)
+{
+    ETweenTargetType targetType = ETweenTargetType::SceneComponent;
+    ETweenVectorType tweenType  = ETweenVectorType::MoveToComponent;
+    FVector dummyVector         = FVector(0, 0, 0);
+    ETweenSpace tweenSpace      = ETweenSpace::World;
+
+    // The destination is tracked in world space
+    UTweenVector* outTween = CreateJoinTweenVector(pTweenContainer,
+                                                   tweenType,
+                                                   pTweenTarget,
+                                                   targetType,
+                                                   dummyVector,
+                                                   dummyVector,
+                                                   pDuration,
+                                                   pEaseType,
+                                                   tweenSpace,
+                                                   pDeleteTweenOnHit,
+                                                   pDeleteTweenOnOverlap,
+                                                   pDelay,
+                                                   pTimeScale,
+                                                   pTweenWhileGameIsPaused,
+                                                   pSequenceIndex);
+
+    if (outTween != nullptr)
+    {
+        outTween->InitDestination(pDestination, pSocketName, pOffset);
+    }
+
+    return outTween;
+}
+
 // static public ---------------------------------------------------------------
 UTweenVector* UTweenVectorStandardFactory::CreateAppendTweenVector(UTweenContainer* pTweenContainer,
                                                                    ETweenVectorType pTweenType,
@@ -1012,7 +2000,9 @@ UTweenVector* UTweenVectorStandardFactory::CreateAppendTweenVector(UTweenContain
                                                                    float pDelay,
                                                                    float pTimeScale,
                                                                    bool pTweenWhileGameIsPaused,
-                                                                   int32 pSequenceIndex)
+                                                                   int32 pSequenceIndex,
+                                                                   const TArray<FVector>* pBezierControlPoints,
+                                                                   bool pBezierConstantSpeed)
 {
     UTweenVector* outTween = nullptr;
 
@@ -1045,7 +2035,10 @@ UTweenVector* UTweenVectorStandardFactory::CreateAppendTweenVector(UTweenContain
                                                                pLoopType,
                                                                pDelay,
                                                                pTimeScale,
-                                                               pTweenWhileGameIsPaused);
+                                                               pTweenWhileGameIsPaused,
+                                                               nullptr,
+                                                               pBezierControlPoints,
+                                                               pBezierConstantSpeed);
         }
     }
     else
@@ -1072,7 +2065,9 @@ UTweenVector* UTweenVectorStandardFactory::CreateJoinTweenVector(UTweenContainer
                                                                  float pDelay,
                                                                  float pTimeScale,
                                                                  bool pTweenWhileGameIsPaused,
-                                                                 int32 pSequenceIndex)
+                                                                 int32 pSequenceIndex,
+                                                                 const TArray<FVector>* pBezierControlPoints,
+                                                                 bool pBezierConstantSpeed)
 {
     UTweenVector* outTween = nullptr;
 
@@ -1100,7 +2095,10 @@ UTweenVector* UTweenVectorStandardFactory::CreateJoinTweenVector(UTweenContainer
                                                              pDeleteTweenOnOverlap,
                                                              pDelay,
                                                              pTimeScale,
-                                                             pTweenWhileGameIsPaused);
+                                                             pTweenWhileGameIsPaused,
+                                                             nullptr,
+                                                             pBezierControlPoints,
+                                                             pBezierConstantSpeed);
         }
     }
     else
@@ -1,18 +1,59 @@
 // Copyright 2018 Francesco Desogus. All Rights Reserved.
 
 #include "TweenMaker.h"
+#include "Utils/SlateTweenDriver.h"
+#include "Utils/TweenDifferentialHarness.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+#include "GameplayDebugger.h"
+#include "Utils/GameplayDebuggerCategory_TweenMaker.h"
+#endif // WITH_GAMEPLAY_DEBUGGER
 
 #define LOCTEXT_NAMESPACE "FTweenMakerModule"
 
 void FTweenMakerModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+
+	// Alternate paths tested by default by the "TweenMaker.DiffTest" console command. The spline caches are enabled by default, so their
+	// backend compares them against the direct evaluation of the splines.
+	FTweenDifferentialHarness::RegisterBackend(FTweenHarnessBackend::FromConsoleVariable(TEXT("TweenMaker.SplineCacheSampleDistance"), TEXT("0")));
+
+	FTweenHarnessBackend shortestPathFastBackend;
+	shortestPathFastBackend.Name        = TEXT("ShortestPathFast");
+	shortestPathFastBackend.ModifyTween = [](FTweenHarnessTween& pTween)
+	{
+		if (pTween.RotationMode == ETweenRotationMode::ShortestPath)
+		{
+			pTween.RotationMode = ETweenRotationMode::ShortestPathFast;
+		}
+	};
+	FTweenDifferentialHarness::RegisterBackend(shortestPathFastBackend);
+
+#if WITH_GAMEPLAY_DEBUGGER
+	IGameplayDebugger& gameplayDebuggerModule = IGameplayDebugger::Get();
+	gameplayDebuggerModule.RegisterCategory("TweenMaker",
+	                                        IGameplayDebugger::FOnGetCategory::CreateStatic(&FGameplayDebuggerCategory_TweenMaker::MakeInstance),
+	                                        EGameplayDebuggerCategoryState::EnabledInGameAndSimulate);
+	gameplayDebuggerModule.NotifyCategoriesChanged();
+#endif // WITH_GAMEPLAY_DEBUGGER
 }
 
 void FTweenMakerModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+#if WITH_GAMEPLAY_DEBUGGER
+	if (IGameplayDebugger::IsAvailable())
+	{
+		IGameplayDebugger& gameplayDebuggerModule = IGameplayDebugger::Get();
+		gameplayDebuggerModule.UnregisterCategory("TweenMaker");
+		gameplayDebuggerModule.NotifyCategoriesChanged();
+	}
+#endif // WITH_GAMEPLAY_DEBUGGER
+
+	FSlateTweenDriver::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -6,15 +6,75 @@
 #include "Tweens/TweenVector.h"
 #include "Tweens/TweenVector2D.h"
 #include "Tweens/TweenRotator.h"
+#include "Tweens/TweenTransform.h"
 #include "Tweens/TweenLinearColor.h"
 #include "Tweens/TweenFloat.h"
 #include "Utils/Utility.h"
 #include "Utils/TweenEnums.h"
 #include "TweenContainer.h"
 #include "Kismet/GameplayStatics.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Components/Widget.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+    TAutoConsoleVariable<int32> CVarHitchWatchdog(TEXT("TweenMaker.HitchWatchdog"),
+                                                  0,
+                                                  TEXT("If 1, the hitch watchdog is enabled on every TweenManager, regardless of their bEnableHitchWatchdog property."));
+
+    /// @brief Number of TweenContainers reported when a frame exceeds the total threshold but none exceeds the per-container one.
+    const int32 HitchMostExpensiveContainers = 3;
+}
+
+// public ----------------------------------------------------------------------
+FTweenHitchContainerInfo::FTweenHitchContainerInfo()
+    : TweenContainer(nullptr)
+    , CostMs(0.0f)
+    , NumTweens(0)
+    , NumSweeps(0)
+    , NumEventsFired(0)
+{
+
+}
+
+// public ----------------------------------------------------------------------
+FTweenHitchReport::FTweenHitchReport()
+    : TotalCostMs(0.0f)
+    , FlushCostMs(0.0f)
+{
+
+}
+
+// public ----------------------------------------------------------------------
+FTweenPendingWidgetState::FTweenPendingWidgetState()
+    : Translation(FVector2D::ZeroVector)
+    , Scale(FVector2D::UnitVector)
+    , Shear(FVector2D::ZeroVector)
+    , Angle(0.0f)
+    , Opacity(1.0f)
+    , bTranslationChanged(false)
+    , bScaleChanged(false)
+    , bShearChanged(false)
+    , bAngleChanged(false)
+    , bOpacityChanged(false)
+{
+
+}
 
 // public ----------------------------------------------------------------------
 UTweenManagerComponent::UTweenManagerComponent()
+    : bEnableHitchWatchdog(false)
+    , HitchThresholdMs(2.0f)
+    , ContainerHitchThresholdMs(1.0f)
+    , HitchLogInterval(5.0f)
+    , mCostTrackingFramesLeft(0)
+    , mLastUpdateCost(0.0f)
+    , mLastFlushCost(0.0f)
+    , mLastHitchLogTime(0.0)
+    , mNumHitchesNotLogged(0)
+    , bIsUpdatingTweenContainers(false)
 {
     PrimaryComponentTick.bCanEverTick = true;
 }
@@ -27,33 +87,38 @@ void UTweenManagerComponent::BeginPlay()
     SetTickableWhenPaused(true);
 }
 
+// public ----------------------------------------------------------------------
+void UTweenManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    StopRecording();
+
+    Super::EndPlay(EndPlayReason);
+}
+
 // public ----------------------------------------------------------------------
 void UTweenManagerComponent::TickComponent(float pDeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(pDeltaTime, TickType, ThisTickFunction);
 
-    // Iterating all TweenContainers backward, so that they can be removed in the for itself if needed
-    for (int i = mTweenContainers.Num() - 1; i >= 0; --i)
+    bool isGamePaused = UGameplayStatics::IsGamePaused(GetWorld());
+
+    if (mTweenRecorder.IsValid())
     {
-        UTweenContainer* tweenContainer = mTweenContainers[i];
+        mTweenRecorder->RecordFrame(pDeltaTime, isGamePaused);
+    }
 
-        // If the container is empty (it was probably created and never used) or is pending a deletion, remove it
-        if (tweenContainer->IsEmpty() || tweenContainer->IsPendingDeletion())
-        {
-            DestroyTweenContainer(tweenContainer, i);
-        }
-        // Updating the TweenContainer, but only if it's not paused
-        else if (!tweenContainer->IsPaused() && (!UGameplayStatics::IsGamePaused(GetWorld()) || tweenContainer->bShouldTweenWhileGamePaused))
-        {
-            bool bIsDone = tweenContainer->UpdateTweens(pDeltaTime);
+    bool isHitchWatchdogEnabled = bEnableHitchWatchdog || CVarHitchWatchdog.GetValueOnGameThread() != 0;
 
-            // It can be "done" ONLY if all tweens associated to the object are done (i.e. if there is an infinite loop,
-            // it will always be false). In that case, the TweenContainer is no longer needed
-            if (bIsDone)
-            {
-                DestroyTweenContainer(tweenContainer, i);
-            }
-        }
+    if (isHitchWatchdogEnabled)
+    {
+        RequestCostTracking();
+    }
+
+    UpdateTweenContainers(pDeltaTime, isGamePaused);
+
+    if (isHitchWatchdogEnabled)
+    {
+        CheckForHitches();
     }
 }
 
@@ -66,9 +131,50 @@ void UTweenManagerComponent::BP_CreateTweenContainer(UTweenContainer*& pOutTween
     pOutTweenContainer = pOutTweenContainer = CreateTweenContainer(pNumLoops, pLoopType, pTimeScale);
 }
 
+// public ----------------------------------------------------------------------
+bool UTweenManagerComponent::StartRecording(const FString& pFileName)
+{
+    StopRecording();
+
+    FString filePath = FTweenRecorder::MakeRecordingPath(pFileName);
+    mTweenRecorder   = MakeUnique<FTweenRecorder>(filePath);
+
+    if (!mTweenRecorder->IsValid())
+    {
+        mTweenRecorder.Reset();
+        return false;
+    }
+
+    UE_LOG(LogTweenMaker, Log, TEXT("UTweenManagerComponent::StartRecording -> recording Tweens to %s."), *filePath);
+
+    return true;
+}
+
+// public ----------------------------------------------------------------------
+void UTweenManagerComponent::StopRecording()
+{
+    if (mTweenRecorder.IsValid())
+    {
+        UE_LOG(LogTweenMaker, Log, TEXT("UTweenManagerComponent::StopRecording -> Tweens recorded to %s."), *mTweenRecorder->GetFilePath());
+
+        mTweenRecorder.Reset();
+    }
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenManagerComponent::IsRecording() const
+{
+    return mTweenRecorder.IsValid();
+}
+
 // public ----------------------------------------------------------------------
 int32 UTweenManagerComponent::DeleteAllTweens()
 {
+    if (mTweenRecorder.IsValid())
+    {
+        mTweenRecorder->RecordDeleteAllTweens();
+    }
+
     int32 tweensDeleted = mTweenContainers.Num();
 
     for (int i = mTweenContainers.Num() - 1; i >= 0; --i)
@@ -233,6 +339,11 @@ UTweenContainer* UTweenManagerComponent::CreateTweenContainer(int32 pNumLoops, E
 
     mTweenContainers.Add(newTweenContainer);
 
+    if (mTweenRecorder.IsValid())
+    {
+        mTweenRecorder->RecordCreateContainer(newTweenContainer, pNumLoops, pLoopType, pTimeScale);
+    }
+
     return newTweenContainer;
 }
 
@@ -250,6 +361,219 @@ UTweenContainer* UTweenManagerComponent::CreateTweenContainerStatic(int32 pNumLo
     return outTweenContainer;
 }
 
+// public ----------------------------------------------------------------------
+void UTweenManagerComponent::RequestCostTracking()
+{
+    mCostTrackingFramesLeft = TWEEN_COST_TRACKING_FRAMES;
+}
+
+// public ----------------------------------------------------------------------
+FTransform UTweenManagerComponent::GetInstanceTransform(UInstancedStaticMeshComponent* pComponent, int32 pInstanceIndex, bool pWorldSpace) const
+{
+    FTransform instanceTransform;
+
+    const TMap<int32, FTransform>* pendingTransforms = mPendingInstanceTransforms.Find(pComponent);
+    const FTransform* pendingTransform               = pendingTransforms != nullptr ? pendingTransforms->Find(pInstanceIndex) : nullptr;
+
+    if (pendingTransform != nullptr)
+    {
+        instanceTransform = *pendingTransform;
+    }
+    else
+    {
+        pComponent->GetInstanceTransform(pInstanceIndex, instanceTransform, false);
+    }
+
+    return pWorldSpace ? instanceTransform * pComponent->GetComponentTransform() : instanceTransform;
+}
+
+// public ----------------------------------------------------------------------
+void UTweenManagerComponent::SetInstanceTransform(UInstancedStaticMeshComponent* pComponent, int32 pInstanceIndex, const FTransform& pTransform, bool pWorldSpace)
+{
+    // Pending transforms are always kept relative to the component, which is what the batched update expects
+    FTransform relativeTransform = pWorldSpace ? pTransform.GetRelativeTransform(pComponent->GetComponentTransform()) : pTransform;
+
+    // Outside of the update nothing would flush the change before the next one
+    if (!bIsUpdatingTweenContainers)
+    {
+        if (pComponent->IsValidInstance(pInstanceIndex))
+        {
+            pComponent->UpdateInstanceTransform(pInstanceIndex, relativeTransform, false, true, false);
+        }
+
+        return;
+    }
+
+    mPendingInstanceTransforms.FindOrAdd(pComponent).Add(pInstanceIndex, relativeTransform);
+}
+
+// public ----------------------------------------------------------------------
+void UTweenManagerComponent::SetMaterialScalarParameter(UMaterialInstanceDynamic* pMaterial, FName pParameterName, int32 pParameterIndex, float pValue)
+{
+    FTweenPendingMaterialParameter parameter;
+    parameter.Name      = pParameterName;
+    parameter.Index     = pParameterIndex;
+    parameter.bIsVector = false;
+    parameter.Value     = FLinearColor(pValue, 0.0f, 0.0f, 0.0f);
+
+    AddPendingMaterialParameter(pMaterial, parameter);
+}
+
+// public ----------------------------------------------------------------------
+void UTweenManagerComponent::SetMaterialVectorParameter(UMaterialInstanceDynamic* pMaterial, FName pParameterName, int32 pParameterIndex, const FLinearColor& pValue)
+{
+    FTweenPendingMaterialParameter parameter;
+    parameter.Name      = pParameterName;
+    parameter.Index     = pParameterIndex;
+    parameter.bIsVector = true;
+    parameter.Value     = pValue;
+
+    AddPendingMaterialParameter(pMaterial, parameter);
+}
+
+// public ----------------------------------------------------------------------
+FVector2D UTweenManagerComponent::GetWidgetProperty(UWidget* pWidget, ETweenWidgetProperty pProperty) const
+{
+    const FTweenPendingWidgetState* pendingState = mPendingWidgetStates.Find(pWidget);
+    const FWidgetTransform& renderTransform      = pWidget->GetRenderTransform();
+
+    switch (pProperty)
+    {
+        case ETweenWidgetProperty::Translation:
+        {
+            return pendingState != nullptr && pendingState->bTranslationChanged ? pendingState->Translation : renderTransform.Translation;
+        }
+        case ETweenWidgetProperty::Scale:
+        {
+            return pendingState != nullptr && pendingState->bScaleChanged ? pendingState->Scale : renderTransform.Scale;
+        }
+        case ETweenWidgetProperty::Shear:
+        {
+            return pendingState != nullptr && pendingState->bShearChanged ? pendingState->Shear : renderTransform.Shear;
+        }
+        case ETweenWidgetProperty::Angle:
+        {
+            return FVector2D(pendingState != nullptr && pendingState->bAngleChanged ? pendingState->Angle : renderTransform.Angle, 0.0f);
+        }
+        case ETweenWidgetProperty::Opacity:
+        {
+            return FVector2D(pendingState != nullptr && pendingState->bOpacityChanged ? pendingState->Opacity : pWidget->GetRenderOpacity(), 0.0f);
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    return FVector2D::ZeroVector;
+}
+
+// public ----------------------------------------------------------------------
+void UTweenManagerComponent::SetWidgetProperty(UWidget* pWidget, ETweenWidgetProperty pProperty, const FVector2D& pValue)
+{
+    // Outside of the update nothing would flush the change before the next one, where it would overwrite what the game set in between.
+    // The single property setters keep the rest of the render transform of the widget.
+    if (!bIsUpdatingTweenContainers)
+    {
+        switch (pProperty)
+        {
+            case ETweenWidgetProperty::Translation:
+            {
+                pWidget->SetRenderTranslation(pValue);
+                break;
+            }
+            case ETweenWidgetProperty::Scale:
+            {
+                pWidget->SetRenderScale(pValue);
+                break;
+            }
+            case ETweenWidgetProperty::Shear:
+            {
+                pWidget->SetRenderShear(pValue);
+                break;
+            }
+            case ETweenWidgetProperty::Angle:
+            {
+                pWidget->SetRenderTransformAngle(pValue.X);
+                break;
+            }
+            case ETweenWidgetProperty::Opacity:
+            {
+                pWidget->SetRenderOpacity(pValue.X);
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        return;
+    }
+
+    FTweenPendingWidgetState& pendingState = mPendingWidgetStates.FindOrAdd(pWidget);
+
+    switch (pProperty)
+    {
+        case ETweenWidgetProperty::Translation:
+        {
+            pendingState.Translation         = pValue;
+            pendingState.bTranslationChanged = true;
+            break;
+        }
+        case ETweenWidgetProperty::Scale:
+        {
+            pendingState.Scale         = pValue;
+            pendingState.bScaleChanged = true;
+            break;
+        }
+        case ETweenWidgetProperty::Shear:
+        {
+            pendingState.Shear         = pValue;
+            pendingState.bShearChanged = true;
+            break;
+        }
+        case ETweenWidgetProperty::Angle:
+        {
+            pendingState.Angle         = pValue.X;
+            pendingState.bAngleChanged = true;
+            break;
+        }
+        case ETweenWidgetProperty::Opacity:
+        {
+            pendingState.Opacity         = pValue.X;
+            pendingState.bOpacityChanged = true;
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// public ----------------------------------------------------------------------
+void UTweenManagerComponent::BeginScopedMovement(USceneComponent* pComponent)
+{
+    mMovedComponents.FindOrAdd(pComponent)++;
+
+    // Already deferred (by a previous Tween or by an outer scope), or not worth a scope
+    if (   pComponent->IsDeferringMovementUpdates()
+        || !mBatchedMovementComponents.Contains(pComponent))
+    {
+        return;
+    }
+
+    FTweenScopedMovement& scopedMovement = mScopedMovements.AddDefaulted_GetRef();
+    scopedMovement.AttachmentDepth       = 0;
+    scopedMovement.Scope                 = MakeUnique<FScopedMovementUpdate>(pComponent, EScopedUpdate::DeferredUpdates);
+
+    for (USceneComponent* parent = pComponent->GetAttachParent(); parent != nullptr; parent = parent->GetAttachParent())
+    {
+        scopedMovement.AttachmentDepth++;
+    }
+}
+
 // private ---------------------------------------------------------------------
 UTweenVector* UTweenManagerComponent::AppendTweenVector(UTweenContainer* pTweenContainer,
                                                         int32 pSequenceIndex,
@@ -268,7 +592,9 @@ UTweenVector* UTweenManagerComponent::AppendTweenVector(UTweenContainer* pTweenC
                                                         float pDelay,
                                                         float pTimeScale,
                                                         bool pTweenWhileGameIsPaused,
-                                                        UTweenVectorLatentFactory* pLatentProxy)
+                                                        UTweenVectorLatentFactory* pLatentProxy,
+                                                        const TArray<FVector>* pBezierControlPoints,
+                                                        bool pBezierConstantSpeed)
 {
     // Creating the Tween and saving the reference
     UTweenVector* newTween = NewObject<UTweenVector>(this);
@@ -279,6 +605,14 @@ UTweenVector* UTweenManagerComponent::AppendTweenVector(UTweenContainer* pTweenC
     newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pDuration, pDelay, pTimeScale, pTweenWhileGameIsPaused, pNumLoops, pLoopType);
     newTween->Init(pFrom, pTo, pTweenType, pTweenSpace, pDeleteTweenOnHit, pDeleteTweenOnOverlap, pLatentProxy);
 
+    // "MoveAlongBezier" Tweens also need their curve, before they're recorded
+    if (pBezierControlPoints != nullptr)
+    {
+        newTween->InitBezier(*pBezierControlPoints, pBezierConstantSpeed);
+    }
+
+    RecordTween(pTweenContainer, pSequenceIndex, false, newTween);
+
     // Actually adding the Tween to the TweenContainer
     pTweenContainer->AddSequenceTween(newTween, pSequenceIndex);
 
@@ -301,7 +635,9 @@ UTweenVector* UTweenManagerComponent::JoinTweenVector(UTweenContainer* pTweenCon
                                                       float pDelay,
                                                       float pTimeScale,
                                                       bool pTweenWhileGameIsPaused,
-                                                      UTweenVectorLatentFactory* pLatentProxy)
+                                                      UTweenVectorLatentFactory* pLatentProxy,
+                                                      const TArray<FVector>* pBezierControlPoints,
+                                                      bool pBezierConstantSpeed)
 {
     UTweenVector* newTween = NewObject<UTweenVector>(this);
     SaveTweenReference(pTarget, pTweenType, newTween);
@@ -309,6 +645,12 @@ UTweenVector* UTweenManagerComponent::JoinTweenVector(UTweenContainer* pTweenCon
     newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pDuration, pDelay, pTimeScale, pTweenWhileGameIsPaused);
     newTween->Init(pFrom, pTo, pTweenType, pTweenSpace, pDeleteTweenOnHit, pDeleteTweenOnOverlap, pLatentProxy);
 
+    if (pBezierControlPoints != nullptr)
+    {
+        newTween->InitBezier(*pBezierControlPoints, pBezierConstantSpeed);
+    }
+
+    RecordTween(pTweenContainer, pSequenceIndex, true, newTween);
     pTweenContainer->AddParallelTween(newTween, pSequenceIndex);
 
     return newTween;
@@ -337,6 +679,7 @@ UTweenVector2D* UTweenManagerComponent::AppendTweenVector2D(UTweenContainer* pTw
     newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pDuration, pDelay, pTimeScale, pTweenWhileGameIsPaused, pNumLoops, pLoopType);
     newTween->Init(pFrom, pTo, pTweenType, pLatentProxy);
 
+    RecordTween(pTweenContainer, pSequenceIndex, false, newTween);
     pTweenContainer->AddSequenceTween(newTween, pSequenceIndex);
 
     return newTween;
@@ -363,6 +706,7 @@ UTweenVector2D* UTweenManagerComponent::JoinTweenVector2D(UTweenContainer* pTwee
     newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pDuration, pDelay, pTimeScale, pTweenWhileGameIsPaused);
     newTween->Init(pFrom, pTo, pTweenType, pLatentProxy);
 
+    RecordTween(pTweenContainer, pSequenceIndex, true, newTween);
     pTweenContainer->AddParallelTween(newTween, pSequenceIndex);
 
     return newTween;
@@ -396,6 +740,7 @@ UTweenRotator* UTweenManagerComponent::AppendTweenRotator(UTweenContainer* pTwee
     newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pDuration, pDelay, pTimeScale, pTweenWhileGameIsPaused, pNumLoops, pLoopType);
     newTween->Init(pFrom, pTo, pTweenType, pTweenSpace, pRotationMode, pLocalSpace, pDeleteTweenOnHit, pDeleteTweenOnOverlap, pLatentProxy);
 
+    RecordTween(pTweenContainer, pSequenceIndex, false, newTween);
     pTweenContainer->AddSequenceTween(newTween, pSequenceIndex);
 
     return newTween;
@@ -427,6 +772,69 @@ UTweenRotator* UTweenManagerComponent::JoinTweenRotator(UTweenContainer* pTweenC
     newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pDuration, pDelay, pTimeScale, pTweenWhileGameIsPaused);
     newTween->Init(pFrom, pTo, pTweenType, pTweenSpace, pRotationMode, pLocalSpace, pDeleteTweenOnHit, pDeleteTweenOnOverlap, pLatentProxy);
 
+    RecordTween(pTweenContainer, pSequenceIndex, true, newTween);
+    pTweenContainer->AddParallelTween(newTween, pSequenceIndex);
+
+    return newTween;
+}
+
+// private ---------------------------------------------------------------------
+UTweenTransform* UTweenManagerComponent::AppendTweenTransform(UTweenContainer* pTweenContainer,
+                                                              int32 pSequenceIndex,
+                                                              ETweenTransformType pTweenType,
+                                                              UObject* pTarget,
+                                                              ETweenTargetType pTargetType,
+                                                              const FTransform& pTo,
+                                                              float pDuration,
+                                                              ETweenEaseType pEaseType,
+                                                              ETweenSpace pTweenSpace,
+                                                              ETweenRotationMode pRotationMode,
+                                                              bool pDeleteTweenOnHit,
+                                                              bool pDeleteTweenOnOverlap,
+                                                              int32 pNumLoops,
+                                                              ETweenLoopType pLoopType,
+                                                              float pDelay,
+                                                              float pTimeScale,
+                                                              bool pTweenWhileGameIsPaused,
+                                                              UTweenTransformLatentFactory* pLatentProxy)
+{
+    UTweenTransform* newTween = NewObject<UTweenTransform>(this);
+    SaveTweenReference(pTarget, pTweenType, newTween);
+
+    newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pDuration, pDelay, pTimeScale, pTweenWhileGameIsPaused, pNumLoops, pLoopType);
+    newTween->Init(pTo, pTweenType, pTweenSpace, pRotationMode, pDeleteTweenOnHit, pDeleteTweenOnOverlap, pLatentProxy);
+
+    RecordTween(pTweenContainer, pSequenceIndex, false, newTween);
+    pTweenContainer->AddSequenceTween(newTween, pSequenceIndex);
+
+    return newTween;
+}
+
+// private ---------------------------------------------------------------------
+UTweenTransform* UTweenManagerComponent::JoinTweenTransform(UTweenContainer* pTweenContainer,
+                                                            int32 pSequenceIndex,
+                                                            ETweenTransformType pTweenType,
+                                                            UObject* pTarget,
+                                                            ETweenTargetType pTargetType,
+                                                            const FTransform& pTo,
+                                                            float pDuration,
+                                                            ETweenEaseType pEaseType,
+                                                            ETweenSpace pTweenSpace,
+                                                            ETweenRotationMode pRotationMode,
+                                                            bool pDeleteTweenOnHit,
+                                                            bool pDeleteTweenOnOverlap,
+                                                            float pDelay,
+                                                            float pTimeScale,
+                                                            bool pTweenWhileGameIsPaused,
+                                                            UTweenTransformLatentFactory* pLatentProxy)
+{
+    UTweenTransform* newTween = NewObject<UTweenTransform>(this);
+    SaveTweenReference(pTarget, pTweenType, newTween);
+
+    newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pDuration, pDelay, pTimeScale, pTweenWhileGameIsPaused);
+    newTween->Init(pTo, pTweenType, pTweenSpace, pRotationMode, pDeleteTweenOnHit, pDeleteTweenOnOverlap, pLatentProxy);
+
+    RecordTween(pTweenContainer, pSequenceIndex, true, newTween);
     pTweenContainer->AddParallelTween(newTween, pSequenceIndex);
 
     return newTween;
@@ -455,6 +863,7 @@ UTweenLinearColor* UTweenManagerComponent::AppendTweenLinearColor(UTweenContaine
     newTween->Init(pParameterName, pFrom, pTo, pTweenType, pLatentProxy);
 
 
+    RecordTween(pTweenContainer, pSequenceIndex, false, newTween);
     pTweenContainer->AddSequenceTween(newTween, pSequenceIndex);
 
     return newTween;
@@ -482,6 +891,7 @@ UTweenLinearColor* UTweenManagerComponent::JoinTweenLinearColor(UTweenContainer*
     newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pDuration, pDelay, pTimeScale, pTweenWhileGameIsPaused);
     newTween->Init(pParameterName, pFrom, pTo, pTweenType, pLatentProxy);
 
+    RecordTween(pTweenContainer, pSequenceIndex, true, newTween);
     pTweenContainer->AddParallelTween(newTween, pSequenceIndex);
 
     return newTween;
@@ -512,6 +922,7 @@ UTweenFloat* UTweenManagerComponent::AppendTweenFloat(UTweenContainer* pTweenCon
     newTween->Init(pFrom, pTo, pTweenType, pParameterName, pLatentProxy);
 
 
+    RecordTween(pTweenContainer, pSequenceIndex, false, newTween);
     pTweenContainer->AddSequenceTween(newTween, pSequenceIndex);
 
     return newTween;
@@ -539,6 +950,7 @@ UTweenFloat* UTweenManagerComponent::JoinTweenFloat(UTweenContainer* pTweenConta
     newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pDuration, pDelay, pTimeScale, pTweenWhileGameIsPaused);
     newTween->Init(pFrom, pTo, pTweenType, pParameterName, pLatentProxy);
 
+    RecordTween(pTweenContainer, pSequenceIndex, true, newTween);
     pTweenContainer->AddParallelTween(newTween, pSequenceIndex);
 
     return newTween;
@@ -573,6 +985,7 @@ UTweenFloat* UTweenManagerComponent::AppendTweenRotateAroundFloat(UTweenContaine
     newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pPeriod, pDelay, pTimeScale, pTweenWhileGameIsPaused, pNumLoops, pLoopType);
     newTween->InitRotateAround(pPoint, pStartingAngle, pEndingAngle, pRadius, pAxis, pTweenSpace, pTweenType, pDeleteTweenOnHit, pDeleteTweenOnOverlap, pLatentProxy);
 
+    RecordTween(pTweenContainer, pSequenceIndex, false, newTween);
     pTweenContainer->AddSequenceTween(newTween, pSequenceIndex);
 
     return newTween;
@@ -605,6 +1018,7 @@ UTweenFloat* UTweenManagerComponent::JoinTweenRotateAroundFloat(UTweenContainer*
     newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pPeriod, pDelay, pTimeScale, pTweenWhileGameIsPaused);
     newTween->InitRotateAround(pPoint, pStartingAngle, pEndingAngle, pRadius, pAxis, pTweenSpace, pTweenType, pDeleteTweenOnHit, pDeleteTweenOnOverlap, pLatentProxy);
 
+    RecordTween(pTweenContainer, pSequenceIndex, true, newTween);
     pTweenContainer->AddParallelTween(newTween, pSequenceIndex);
 
     return newTween;
@@ -637,6 +1051,7 @@ UTweenFloat* UTweenManagerComponent::AppendTweenFollowSplineFloat(UTweenContaine
     newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pDuration, pDelay, pTimeScale, pTweenWhileGameIsPaused, pNumLoops, pLoopType);
     newTween->InitFollowSpline(pSpline, pApplyRotation, pApplyScale, pTweenType, pDeleteTweenOnHit, pDeleteTweenOnOverlap, pUseConstantSpeed, pLatentProxy);
 
+    RecordTween(pTweenContainer, pSequenceIndex, false, newTween);
     pTweenContainer->AddSequenceTween(newTween, pSequenceIndex);
 
     return newTween;
@@ -667,14 +1082,497 @@ UTweenFloat* UTweenManagerComponent::JoinTweenFollowSplineFloat(UTweenContainer*
     newTween->InitBase(pTweenContainer, pSequenceIndex, pTarget, pTargetType, pEaseType, pDuration, pDelay, pTimeScale, pTweenWhileGameIsPaused);
     newTween->InitFollowSpline(pSpline, pApplyRotation, pApplyScale, pTweenType, pDeleteTweenOnHit, pDeleteTweenOnOverlap, pUseConstantSpeed, pLatentProxy);
 
+    RecordTween(pTweenContainer, pSequenceIndex, true, newTween);
     pTweenContainer->AddParallelTween(newTween, pSequenceIndex);
 
     return newTween;
 }
 
+// public ----------------------------------------------------------------------
+void UTweenManagerComponent::EndParentScopedMovements(USceneComponent* pComponent, bool pShouldIncludeComponent)
+{
+    if (   mScopedMovements.Num() == 0
+        || pComponent == nullptr
+        || (pComponent->GetAttachParent() == nullptr && !pShouldIncludeComponent))
+    {
+        return;
+    }
+
+    TArray<FTweenScopedMovement, TInlineAllocator<4>> parentScopedMovements;
+
+    for (int32 i = mScopedMovements.Num() - 1; i >= 0; --i)
+    {
+        USceneComponent* scopedComponent = mScopedMovements[i].Scope->GetOwner();
+
+        if (pComponent->IsAttachedTo(scopedComponent) || (pShouldIncludeComponent && scopedComponent == pComponent))
+        {
+            parentScopedMovements.Add(MoveTemp(mScopedMovements[i]));
+            mScopedMovements.RemoveAtSwap(i, 1, false);
+        }
+    }
+
+    // Parents first, like in EndScopedMovements(), so that each of them propagates its final transform down to the component
+    parentScopedMovements.StableSort([](const FTweenScopedMovement& pA, const FTweenScopedMovement& pB)
+    {
+        return pA.AttachmentDepth < pB.AttachmentDepth;
+    });
+
+    for (FTweenScopedMovement& scopedMovement : parentScopedMovements)
+    {
+        scopedMovement.Scope.Reset();
+    }
+}
+
+// private ---------------------------------------------------------------------
+void UTweenManagerComponent::UpdateTweenContainers(float pDeltaTime, bool pIsGamePaused)
+{
+    bool shouldTrackCosts = mCostTrackingFramesLeft > 0;
+    double updateStartTime = shouldTrackCosts ? FPlatformTime::Seconds() : 0.0;
+
+    bIsUpdatingTweenContainers = true;
+
+    // Iterating all TweenContainers backward, so that they can be removed in the for itself if needed
+    for (int i = mTweenContainers.Num() - 1; i >= 0; --i)
+    {
+        UTweenContainer* tweenContainer = mTweenContainers[i];
+
+        // Containers that won't be updated in this frame don't cost anything
+        if (shouldTrackCosts)
+        {
+            tweenContainer->mLastUpdateCost        = 0.0f;
+            tweenContainer->mNumEventsAtLastUpdate = 0;
+        }
+
+        // If the container is empty (it was probably created and never used) or is pending a deletion, remove it
+        if (tweenContainer->IsEmpty() || tweenContainer->IsPendingDeletion())
+        {
+            DestroyTweenContainer(tweenContainer, i);
+        }
+        // Updating the TweenContainer, but only if it's not paused
+        else if (!tweenContainer->IsPaused() && (!pIsGamePaused || tweenContainer->bShouldTweenWhileGamePaused))
+        {
+            double containerStartTime = shouldTrackCosts ? FPlatformTime::Seconds() : 0.0;
+
+            bool bIsDone = tweenContainer->UpdateTweens(pDeltaTime);
+
+            if (shouldTrackCosts)
+            {
+                tweenContainer->mLastUpdateCost = static_cast<float>(FPlatformTime::Seconds() - containerStartTime);
+            }
+
+            // It can be "done" ONLY if all tweens associated to the object are done (i.e. if there is an infinite loop,
+            // it will always be false). In that case, the TweenContainer is no longer needed
+            if (bIsDone)
+            {
+                DestroyTweenContainer(tweenContainer, i);
+            }
+        }
+    }
+
+    bIsUpdatingTweenContainers = false;
+
+    // The deferred writes are applied for all TweenContainers at once, so their cost is measured on its own
+    double flushStartTime = shouldTrackCosts ? FPlatformTime::Seconds() : 0.0;
+
+    EndScopedMovements();
+    UpdateBatchedMovements();
+    FlushInstanceTransforms();
+    FlushMaterialParameters();
+    FlushWidgetStates();
+
+    if (shouldTrackCosts)
+    {
+        double updateEndTime = FPlatformTime::Seconds();
+
+        mLastFlushCost  = static_cast<float>(updateEndTime - flushStartTime);
+        mLastUpdateCost = static_cast<float>(updateEndTime - updateStartTime);
+        mCostTrackingFramesLeft--;
+    }
+}
+
+// protected -------------------------------------------------------------------
+void UTweenManagerComponent::FlushInstanceTransforms()
+{
+    if (mPendingInstanceTransforms.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<FTransform> batchTransforms;
+
+    for (TPair<TWeakObjectPtr<UInstancedStaticMeshComponent>, TMap<int32, FTransform>>& pendingTransforms : mPendingInstanceTransforms)
+    {
+        UInstancedStaticMeshComponent* component = pendingTransforms.Key.Get();
+
+        if (component == nullptr)
+        {
+            continue;
+        }
+
+        // Sorting the instances, so that the contiguous ones are written with a single batched update
+        pendingTransforms.Value.KeySort(TLess<int32>());
+
+        int32 batchStartIndex = INDEX_NONE;
+
+        for (const TPair<int32, FTransform>& instanceTransform : pendingTransforms.Value)
+        {
+            // The instance might have been removed after the Tween changed it
+            if (!component->IsValidInstance(instanceTransform.Key))
+            {
+                continue;
+            }
+
+            if (batchTransforms.Num() > 0 && instanceTransform.Key != batchStartIndex + batchTransforms.Num())
+            {
+                component->BatchUpdateInstancesTransforms(batchStartIndex, batchTransforms, false, false, false);
+                batchTransforms.Reset();
+            }
+
+            if (batchTransforms.Num() == 0)
+            {
+                batchStartIndex = instanceTransform.Key;
+            }
+
+            batchTransforms.Add(instanceTransform.Value);
+        }
+
+        if (batchTransforms.Num() > 0)
+        {
+            component->BatchUpdateInstancesTransforms(batchStartIndex, batchTransforms, false, false, false);
+            batchTransforms.Reset();
+        }
+
+        component->MarkRenderStateDirty();
+    }
+
+    mPendingInstanceTransforms.Reset();
+}
+
+// protected -------------------------------------------------------------------
+void UTweenManagerComponent::FlushMaterialParameters()
+{
+    if (mPendingMaterialParameters.Num() == 0)
+    {
+        return;
+    }
+
+    for (const TPair<TWeakObjectPtr<UMaterialInstanceDynamic>, TArray<FTweenPendingMaterialParameter>>& pendingParameters : mPendingMaterialParameters)
+    {
+        UMaterialInstanceDynamic* material = pendingParameters.Key.Get();
+
+        if (material == nullptr)
+        {
+            continue;
+        }
+
+        for (const FTweenPendingMaterialParameter& parameter : pendingParameters.Value)
+        {
+            WriteMaterialParameter(material, parameter);
+        }
+    }
+
+    mPendingMaterialParameters.Reset();
+}
+
+// protected -------------------------------------------------------------------
+void UTweenManagerComponent::EndScopedMovements()
+{
+    if (mScopedMovements.Num() == 0)
+    {
+        return;
+    }
+
+    // Parents first: when a parent's scope ends, it recomputes its children's transforms with its final one, while the children still defer
+    // their own propagation (render state, physics, overlaps) until their scopes end. Each component is scoped once, so the order is free.
+    mScopedMovements.StableSort([](const FTweenScopedMovement& pA, const FTweenScopedMovement& pB)
+    {
+        return pA.AttachmentDepth < pB.AttachmentDepth;
+    });
+
+    for (FTweenScopedMovement& scopedMovement : mScopedMovements)
+    {
+        scopedMovement.Scope.Reset();
+    }
+
+    mScopedMovements.Reset();
+}
+
+// protected -------------------------------------------------------------------
+void UTweenManagerComponent::UpdateBatchedMovements()
+{
+    mBatchedMovementComponents.Reset();
+
+    for (const TPair<TWeakObjectPtr<USceneComponent>, int32>& movedComponent : mMovedComponents)
+    {
+        USceneComponent* component = movedComponent.Key.Get();
+
+        if (component == nullptr)
+        {
+            continue;
+        }
+
+        // Moved by several Tweens: its children and overlaps are updated once instead of once per Tween
+        if (movedComponent.Value > 1)
+        {
+            mBatchedMovementComponents.Add(component);
+        }
+
+        // Moved together with some of its parents: it's updated once, after their final transforms
+        for (USceneComponent* parent = component->GetAttachParent(); parent != nullptr; parent = parent->GetAttachParent())
+        {
+            if (mMovedComponents.Contains(parent))
+            {
+                mBatchedMovementComponents.Add(component);
+                mBatchedMovementComponents.Add(parent);
+            }
+        }
+    }
+
+    mMovedComponents.Reset();
+}
+
+// protected -------------------------------------------------------------------
+void UTweenManagerComponent::FlushWidgetStates()
+{
+    if (mPendingWidgetStates.Num() == 0)
+    {
+        return;
+    }
+
+    for (const TPair<TWeakObjectPtr<UWidget>, FTweenPendingWidgetState>& pendingState : mPendingWidgetStates)
+    {
+        UWidget* widget                          = pendingState.Key.Get();
+        const FTweenPendingWidgetState& newState = pendingState.Value;
+
+        if (widget == nullptr)
+        {
+            continue;
+        }
+
+        // The UWidget setters invalidate the Slate widget with the narrowest reason that fits: "RenderTransform" for the transform
+        // (no layout or prepass) and "Paint" for the opacity. The changes are merged with the current render transform of the widget,
+        // so that the properties changed by the game in the meantime are kept, and values that didn't actually change aren't written at all.
+        FWidgetTransform renderTransform = widget->GetRenderTransform();
+        bool isTransformChanged          = false;
+
+        if (newState.bTranslationChanged && renderTransform.Translation != newState.Translation)
+        {
+            renderTransform.Translation = newState.Translation;
+            isTransformChanged          = true;
+        }
+
+        if (newState.bScaleChanged && renderTransform.Scale != newState.Scale)
+        {
+            renderTransform.Scale = newState.Scale;
+            isTransformChanged    = true;
+        }
+
+        if (newState.bShearChanged && renderTransform.Shear != newState.Shear)
+        {
+            renderTransform.Shear = newState.Shear;
+            isTransformChanged    = true;
+        }
+
+        if (newState.bAngleChanged && renderTransform.Angle != newState.Angle)
+        {
+            renderTransform.Angle = newState.Angle;
+            isTransformChanged    = true;
+        }
+
+        if (isTransformChanged)
+        {
+            widget->SetRenderTransform(renderTransform);
+        }
+
+        if (newState.bOpacityChanged && newState.Opacity != widget->GetRenderOpacity())
+        {
+            widget->SetRenderOpacity(newState.Opacity);
+        }
+    }
+
+    mPendingWidgetStates.Reset();
+}
+
+// protected -------------------------------------------------------------------
+void UTweenManagerComponent::AddPendingMaterialParameter(UMaterialInstanceDynamic* pMaterial, const FTweenPendingMaterialParameter& pParameter)
+{
+    // Outside of the update nothing would flush the change before the next one
+    if (!bIsUpdatingTweenContainers)
+    {
+        WriteMaterialParameter(pMaterial, pParameter);
+        return;
+    }
+
+    TArray<FTweenPendingMaterialParameter>& pendingParameters = mPendingMaterialParameters.FindOrAdd(pMaterial);
+
+    // Only the last value written in this update is applied (a material has few parameters, so a linear search is fine)
+    for (FTweenPendingMaterialParameter& parameter : pendingParameters)
+    {
+        if (parameter.bIsVector == pParameter.bIsVector && parameter.Name == pParameter.Name)
+        {
+            parameter = pParameter;
+            return;
+        }
+    }
+
+    pendingParameters.Add(pParameter);
+}
+
+// static protected ------------------------------------------------------------
+void UTweenManagerComponent::WriteMaterialParameter(UMaterialInstanceDynamic* pMaterial, const FTweenPendingMaterialParameter& pParameter)
+{
+    // Writing by index skips the lookup by name. It fails if the parameters of the material were cleared after the index was cached
+    if (pParameter.bIsVector)
+    {
+        if (pParameter.Index == INDEX_NONE || !pMaterial->SetVectorParameterByIndex(pParameter.Index, pParameter.Value))
+        {
+            pMaterial->SetVectorParameterValue(pParameter.Name, pParameter.Value);
+        }
+    }
+    else
+    {
+        if (pParameter.Index == INDEX_NONE || !pMaterial->SetScalarParameterByIndex(pParameter.Index, pParameter.Value.R))
+        {
+            pMaterial->SetScalarParameterValue(pParameter.Name, pParameter.Value.R);
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+void UTweenManagerComponent::CheckForHitches()
+{
+    FTweenHitchReport report;
+    report.TotalCostMs = mLastUpdateCost * 1000.0f;
+    report.FlushCostMs = mLastFlushCost * 1000.0f;
+
+    for (UTweenContainer* tweenContainer : mTweenContainers)
+    {
+        if (tweenContainer->GetLastUpdateCost() * 1000.0f > ContainerHitchThresholdMs)
+        {
+            report.Containers.Add(MakeHitchContainerInfo(tweenContainer));
+        }
+    }
+
+    if (report.Containers.Num() == 0)
+    {
+        if (report.TotalCostMs <= HitchThresholdMs)
+        {
+            return;
+        }
+
+        // No single TweenContainer is over its threshold, so the cost is spread: reporting the most expensive ones
+        TArray<UTweenContainer*> sortedContainers = mTweenContainers;
+        sortedContainers.Sort([](const UTweenContainer& pA, const UTweenContainer& pB)
+        {
+            return pA.GetLastUpdateCost() > pB.GetLastUpdateCost();
+        });
+
+        for (int32 i = 0; i < FMath::Min(HitchMostExpensiveContainers, sortedContainers.Num()); ++i)
+        {
+            report.Containers.Add(MakeHitchContainerInfo(sortedContainers[i]));
+        }
+    }
+
+    report.Containers.Sort([](const FTweenHitchContainerInfo& pA, const FTweenHitchContainerInfo& pB)
+    {
+        return pA.CostMs > pB.CostMs;
+    });
+
+    if (OnTweenHitch.IsBound())
+    {
+        OnTweenHitch.Broadcast(report);
+    }
+
+    OnTweenHitchDelegate.ExecuteIfBound(report);
+
+    // Rate limiting the log, since a hitch tends to happen in several consecutive frames
+    double currentTime = FPlatformTime::Seconds();
+
+    if (currentTime - mLastHitchLogTime < HitchLogInterval)
+    {
+        mNumHitchesNotLogged++;
+        return;
+    }
+
+    UE_LOG(LogTweenMaker, Warning, TEXT("UTweenManagerComponent::CheckForHitches -> %s: updating %d TweenContainers took %.3f ms (%d more hitches since the last report)."),
+           *GetNameSafe(GetOwner()),
+           mTweenContainers.Num(),
+           report.TotalCostMs,
+           mNumHitchesNotLogged);
+
+    for (const FTweenHitchContainerInfo& containerInfo : report.Containers)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("    %.3f ms | %d tweens, %d sweeps, %d events fired | %s"),
+               containerInfo.CostMs,
+               containerInfo.NumTweens,
+               containerInfo.NumSweeps,
+               containerInfo.NumEventsFired,
+               *containerInfo.Description);
+    }
+
+    UE_LOG(LogTweenMaker, Warning, TEXT("    %.3f ms | deferred movement flush (children transforms and overlaps, instance transforms, material parameters, widgets)"),
+           report.FlushCostMs);
+
+    mLastHitchLogTime    = currentTime;
+    mNumHitchesNotLogged = 0;
+}
+
+// private ---------------------------------------------------------------------
+FTweenHitchContainerInfo UTweenManagerComponent::MakeHitchContainerInfo(UTweenContainer* pTweenContainer) const
+{
+    FTweenHitchContainerInfo containerInfo;
+    containerInfo.TweenContainer = pTweenContainer;
+    containerInfo.CostMs         = pTweenContainer->GetLastUpdateCost() * 1000.0f;
+    containerInfo.NumSweeps      = pTweenContainer->GetNumSweepsAtLastUpdate();
+    containerInfo.NumEventsFired = pTweenContainer->GetNumEventsAtLastUpdate();
+
+    FString tweensDescription;
+
+    if (pTweenContainer->mSequences.IsValidIndex(pTweenContainer->mCurrentIndex))
+    {
+        for (const UBaseTween* tween : pTweenContainer->mSequences[pTweenContainer->mCurrentIndex].ParallelTweens)
+        {
+            if (tween == nullptr)
+            {
+                continue;
+            }
+
+            containerInfo.NumTweens++;
+
+            // The actor owning the target is the one to look for in the level, rather than the owner of this TweenManager
+            UObject* target     = tween->GetTweenTarget();
+            AActor* targetActor = Cast<AActor>(target);
+
+            if (targetActor == nullptr && target != nullptr)
+            {
+                UActorComponent* targetComponent = Cast<UActorComponent>(target);
+                targetActor                      = targetComponent != nullptr ? targetComponent->GetOwner() : target->GetTypedOuter<AActor>();
+            }
+
+            tweensDescription += FString::Printf(TEXT("%s%s -> %s (actor %s)"),
+                                                 tweensDescription.IsEmpty() ? TEXT("") : TEXT(", "),
+                                                 *Utility::GetTweenTypeName(tween),
+                                                 *GetNameSafe(target),
+                                                 *GetNameSafe(targetActor));
+        }
+    }
+
+    containerInfo.Description = FString::Printf(TEXT("sequence %d/%d | %s"),
+                                                pTweenContainer->mCurrentIndex + 1,
+                                                pTweenContainer->mSequences.Num(),
+                                                *tweensDescription);
+
+    return containerInfo;
+}
+
 // private ---------------------------------------------------------------------
 void UTweenManagerComponent::DestroyTweenContainer(UTweenContainer* pTweenContainer, int32 pIndex)
 {
+    if (mTweenRecorder.IsValid())
+    {
+        mTweenRecorder->ForgetContainer(pTweenContainer);
+    }
+
     // Making the TweenContainer remove its own Tweens's references from the reference map
     pTweenContainer->RemoveTweensReferences(mTweensByObjectMap);
 
@@ -684,6 +1582,15 @@ void UTweenManagerComponent::DestroyTweenContainer(UTweenContainer* pTweenContai
     Utility::DestroyUObject(pTweenContainer);
 }
 
+// private ---------------------------------------------------------------------
+void UTweenManagerComponent::RecordTween(UTweenContainer* pTweenContainer, int32 pSequenceIndex, bool pIsJoin, UBaseTween* pTween)
+{
+    if (mTweenRecorder.IsValid())
+    {
+        mTweenRecorder->RecordTween(pTweenContainer, pSequenceIndex, pIsJoin, pTween);
+    }
+}
+
 // private ---------------------------------------------------------------------
 
 void UTweenManagerComponent::SaveTweenReference(UObject* pTweenTarget, ETweenGenericType pTweenType, UBaseTween* pTween)
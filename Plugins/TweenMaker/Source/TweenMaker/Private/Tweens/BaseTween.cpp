@@ -3,12 +3,67 @@
 #include "Tweens/BaseTween.h"
 #include "Tweens/TweenVector.h"
 #include "TweenContainer.h"
+#include "TweenManagerComponent.h"
 #include "TweenFactory/Standard/TweenVectorStandardFactory.h"
 #include "TweenFactory/Standard/TweenVector2DStandardFactory.h"
 #include "TweenFactory/Standard/TweenRotatorStandardFactory.h"
 #include "TweenFactory/Standard/TweenLinearColorStandardFactory.h"
 #include "TweenFactory/Standard/TweenFloatStandardFactory.h"
 #include "Curves/CurveFloat.h"
+#include "Utils/TweenRecorder.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "Engine/World.h"
+#include "Utils/Utility.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+#include "WorldCollision.h"
+
+namespace
+{
+    /**
+     * Converts a world transform in the relative transform of the given component, as USceneComponent::SetWorldTransform() does.
+     */
+    FTransform GetRelativeFromWorld(USceneComponent* pComponent, const FTransform& pWorldTransform)
+    {
+        USceneComponent* attachParent = pComponent->GetAttachParent();
+
+        if (attachParent == nullptr)
+        {
+            return pWorldTransform;
+        }
+
+        FTransform parentToWorld     = attachParent->GetSocketTransform(pComponent->GetAttachSocketName());
+        FTransform relativeTransform = pWorldTransform.GetRelativeTransform(parentToWorld);
+
+        if (pComponent->IsUsingAbsoluteLocation())
+        {
+            relativeTransform.CopyTranslation(pWorldTransform);
+        }
+
+        if (pComponent->IsUsingAbsoluteRotation())
+        {
+            relativeTransform.CopyRotation(pWorldTransform);
+        }
+
+        if (pComponent->IsUsingAbsoluteScale())
+        {
+            relativeTransform.CopyScale3D(pWorldTransform);
+        }
+
+        return relativeTransform;
+    }
+
+    /**
+     * Updates the transform of the given component (and of its children) after its relative values were written directly, as a teleport.
+     * Unlike the USceneComponent setters it doesn't go through MoveComponent, so neither the physics velocity nor the overlaps are updated.
+     */
+    void UpdateDirectTransform(USceneComponent* pComponent)
+    {
+        pComponent->UpdateComponentToWorld(EUpdateTransformFlags::None, ETeleportType::TeleportPhysics);
+    }
+}
 
 // public ----------------------------------------------------------------------
 UBaseTween::UBaseTween(const FObjectInitializer& ObjectInitializer)
@@ -18,13 +73,27 @@ UBaseTween::UBaseTween(const FObjectInitializer& ObjectInitializer)
     , mElapsedTime(0.0f)
     , mTargetObject(nullptr)
     , mTargetType(ETweenTargetType::Custom)
+    , mTargetInstanceIndex(INDEX_NONE)
+    , mCustomPrimitiveDataIndex(INDEX_NONE)
     , mEaseType(ETweenEaseType::Linear)
     , mNumLoops(1)
     , mLoopType(ETweenLoopType::Yoyo)
     , mTimeScale(1.0f)
     , mCurveFloat(nullptr)
     , bTweenWhileGameIsPaused(false)
+    , bIsVisualOnly(false)
+    , mCollisionMode(ETweenCollisionMode::FullSweep)
+    , mSweepInterval(1)
+    , mSweepDistance(0.0f)
+    , mMovesSinceLastSweep(INDEX_NONE)
+    , mLastSweepLocation(FVector::ZeroVector)
+    , bHasSweptInUpdate(false)
+    , mAsyncSweepComponent(nullptr)
+    , mAsyncSweepStart(FVector::ZeroVector)
     , bHasPreparedTween(false)
+    , bHasBeenRetargeted(false)
+    , bIsLoopRetargeted(false)
+    , mLoopDuration(0.0f)
     , mTweenGenericType(ETweenGenericType::Any)
     , mDelay(0.0f)
     , mDelayElapsedTime(0.0f)
@@ -73,6 +142,17 @@ void UBaseTween::InitBase(UTweenContainer* pTweenContainer,
     mTweenGenericType       = ETweenGenericType::Any;
     bTweenWhileGameIsPaused = pTweenWhileGameIsPaused;
 
+    mTargetInstanceIndex      = INDEX_NONE;
+    mCustomPrimitiveDataIndex = INDEX_NONE;
+
+    bIsVisualOnly        = false;
+    mCollisionMode       = ETweenCollisionMode::FullSweep;
+    mSweepInterval       = 1;
+    mSweepDistance       = 0.0f;
+    mMovesSinceLastSweep = INDEX_NONE;
+    bHasSweptInUpdate    = false;
+    mAsyncSweepComponent = nullptr;
+
     mElapsedTime      = 0.0f;
     mDelayElapsedTime = 0.0f;
 
@@ -81,10 +161,29 @@ void UBaseTween::InitBase(UTweenContainer* pTweenContainer,
     bShouldSkipTween            = false,
     bIsPendingDeletion          = false;
     bHasPreparedTween           = false;
+    bHasBeenRetargeted          = false;
+    bIsLoopRetargeted           = false;
     bHasCalledPreDelay          = false;
     bShouldInvertTweenFromStart = false;
 }
 
+// public ----------------------------------------------------------------------
+void UBaseTween::SetTweenTargetInstanceIndex(int32 pInstanceIndex)
+{
+    // Set after the Tween was recorded, so it's recorded on its own
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenOp(ETweenRecordOp::TweenInstanceIndex, this, 0.0f, pInstanceIndex));
+
+    mTargetInstanceIndex = pInstanceIndex;
+}
+
+// public ----------------------------------------------------------------------
+void UBaseTween::SetCustomPrimitiveDataIndex(int32 pDataIndex)
+{
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenOp(ETweenRecordOp::TweenCustomPrimitiveDataIndex, this, 0.0f, pDataIndex));
+
+    mCustomPrimitiveDataIndex = pDataIndex;
+}
+
 // public ----------------------------------------------------------------------
 bool UBaseTween::UpdateTween(float pDeltaTime, float pTimeScale)
 {
@@ -112,14 +211,34 @@ bool UBaseTween::UpdateTween(float pDeltaTime, float pTimeScale)
             return true;
         }
 
-        // If this is the elapsed time is 0, the Tween is starting. Need to broadcast the event and prepare the tween.
-        if (mElapsedTime <= 0)
+        // The component actually moved when the target is an Actor or a SceneComponent
+        USceneComponent* targetComponent = nullptr;
+
+        if (mTargetType == ETweenTargetType::Actor || mTargetType == ETweenTargetType::SceneComponent)
+        {
+            targetComponent = Cast<USceneComponent>(mTargetObject.Get());
+
+            if (AActor* actor = Cast<AActor>(mTargetObject.Get()))
+            {
+                targetComponent = actor->GetRootComponent();
+            }
+        }
+
+        // If this is the elapsed time is 0, the Tween is starting (unless it was just retargeted). Need to broadcast the event and prepare the tween.
+        if (mElapsedTime <= 0 && !bHasBeenRetargeted)
         {
             BroadcastOnTweenStart();
+            mOwningTweenContainer->mNumEventsAtLastUpdate++;
 
             // I only prepare the Tween once in its lifetime (so it's not executed again if it loops)
             if (!bHasPreparedTween)
             {
+                // The values in world space are computed from the current transform of the target, which its deferred parents haven't updated yet
+                if (targetComponent != nullptr)
+                {
+                    mOwningTweenContainer->OwningTweenManager->EndParentScopedMovements(targetComponent);
+                }
+
                 PrepareTween();
                 bHasPreparedTween = true;
 
@@ -130,16 +249,62 @@ bool UBaseTween::UpdateTween(float pDeltaTime, float pTimeScale)
             }
         }
 
+        bHasBeenRetargeted = false;
+
+        // Tweens that don't sweep may defer the movement of their target until the end of the TweenManager's update, where the deferred
+        // updates are applied parents first. Sweeping Tweens keep moving it right away, so that hits are reported during their update,
+        // and the sweeps must start from where the target really is: its deferred parents are updated first. Visual only Tweens never
+        // defer it either, since ending a deferred update updates the overlaps: they write the target directly, from its up to date parents.
+        if (targetComponent != nullptr)
+        {
+            if (!bIsVisualOnly && !IsSweeping())
+            {
+                mOwningTweenContainer->OwningTweenManager->BeginScopedMovement(targetComponent);
+            }
+            else
+            {
+                mOwningTweenContainer->OwningTweenManager->EndParentScopedMovements(targetComponent);
+            }
+        }
+
         // Handling the actual update
         hasEnded = Update(pDeltaTime, pTimeScale);
 
+        if (mAsyncSweepComponent.IsValid())
+        {
+            RequestAsyncSweep();
+        }
+
+        // A blocked sweep stops the target before the location it was moved to: the next sweep starts from there
+        if (bHasSweptInUpdate)
+        {
+            if (UPrimitiveComponent* sweptComponent = GetTargetPrimitiveComponent())
+            {
+                mLastSweepLocation = sweptComponent->GetComponentLocation();
+            }
+
+            bHasSweptInUpdate = false;
+        }
+
+        // The callbacks must see the target (and its children and sockets) where it was moved, with its overlaps up to date
+        if (targetComponent != nullptr && (IsUpdateEventBound() || (hasEnded && IsEndEventBound())))
+        {
+            mOwningTweenContainer->OwningTweenManager->EndParentScopedMovements(targetComponent, true);
+        }
+
         // Always broadcast the "update" event, even if the Tween is ending. This way the user 
         // can receive "one last" update event before ending
         BroadcastOnTweenUpdate();
 
+        if (IsUpdateEventBound())
+        {
+            mOwningTweenContainer->mNumEventsAtLastUpdate++;
+        }
+
         if (hasEnded)
         {
             BroadcastOnTweenEnd();
+            mOwningTweenContainer->mNumEventsAtLastUpdate++;
             bIsTweenDone = true;
         }
     }
@@ -147,6 +312,18 @@ bool UBaseTween::UpdateTween(float pDeltaTime, float pTimeScale)
     return hasEnded;
 }
 
+// private ---------------------------------------------------------------------
+void UBaseTween::EndRetargetedLoop()
+{
+    if (bIsLoopRetargeted)
+    {
+        mTweenDuration    = mLoopDuration;
+        bIsLoopRetargeted = false;
+
+        RestoreLoopStart();
+    }
+}
+
 // private ---------------------------------------------------------------------
 void UBaseTween::PreDestroy()
 {
@@ -155,6 +332,395 @@ void UBaseTween::PreDestroy()
     {
         OnTweenDestroyed.Broadcast(this);
     }
+
+    TWEEN_RECORD(mOwningTweenContainer, ForgetTween(this));
+}
+
+// protected -------------------------------------------------------------------
+bool UBaseTween::RetargetClock(const FVector4f& pNewTo, float pDuration)
+{
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenRetarget(this, pNewTo, pDuration));
+
+    // A spring just heads to the new ending value. One that is at rest wakes up on its own, since it's pulled away from it
+    if (mSpring.IsEnabled())
+    {
+        if (bIsTweenDone)
+        {
+            UE_LOG(LogTweenMaker, Warning, TEXT("UBaseTween::RetargetClock -> the spring of the Tween %s already settled and ended (see "
+                                                "the EndWhenSettled parameter of SetSpring), it won't move again."), *GetName());
+        }
+
+        return false;
+    }
+
+    bool isRunning = bHasPreparedTween && mElapsedTime > 0.0f;
+
+    if (isRunning)
+    {
+        // Only the first retarget of a loop saves it, the following ones only shorten the retargeted part again
+        if (!bIsLoopRetargeted)
+        {
+            mLoopDuration     = mTweenDuration;
+            bIsLoopRetargeted = true;
+
+            SaveLoopStart();
+        }
+
+        mTweenDuration     = pDuration >= 0.0f ? pDuration : FMath::Max(mTweenDuration - mElapsedTime, 0.0f);
+        mElapsedTime       = 0.0f;
+        bHasBeenRetargeted = true;
+    }
+    else if (pDuration >= 0.0f)
+    {
+        mTweenDuration = pDuration;
+    }
+
+    return isRunning;
+}
+
+// protected -------------------------------------------------------------------
+FTransform UBaseTween::GetTargetInstanceTransform(bool pWorldSpace) const
+{
+    UInstancedStaticMeshComponent* component = Cast<UInstancedStaticMeshComponent>(mTargetObject.Get());
+
+    if (component == nullptr || !component->IsValidInstance(mTargetInstanceIndex))
+    {
+        return FTransform::Identity;
+    }
+
+    return mOwningTweenContainer->OwningTweenManager->GetInstanceTransform(component, mTargetInstanceIndex, pWorldSpace);
+}
+
+// protected -------------------------------------------------------------------
+void UBaseTween::SetTargetInstanceTransform(const FTransform& pTransform, bool pWorldSpace)
+{
+    UInstancedStaticMeshComponent* component = Cast<UInstancedStaticMeshComponent>(mTargetObject.Get());
+
+    // The instance might have been removed from the component while the Tween was running
+    if (component == nullptr || !component->IsValidInstance(mTargetInstanceIndex))
+    {
+        return;
+    }
+
+    mOwningTweenContainer->OwningTweenManager->SetInstanceTransform(component, mTargetInstanceIndex, pTransform, pWorldSpace);
+}
+
+// protected -------------------------------------------------------------------
+UMaterialParameterCollectionInstance* UBaseTween::GetTargetParameterCollectionInstance() const
+{
+    UMaterialParameterCollection* collection = Cast<UMaterialParameterCollection>(mTargetObject.Get());
+    UWorld* world                            = mOwningTweenContainer->OwningTweenManager->GetWorld();
+
+    if (collection == nullptr || world == nullptr)
+    {
+        return nullptr;
+    }
+
+    // The world keeps one instance per collection: writing on it updates every material that references the collection
+    return world->GetParameterCollectionInstance(collection);
+}
+
+// protected -------------------------------------------------------------------
+void UBaseTween::SetComponentLocation(USceneComponent* pComponent, ETweenSpace pTweenSpace, const FVector& pLocation, bool pShouldSweep)
+{
+    if (bIsVisualOnly)
+    {
+        FVector relativeLocation = pLocation;
+
+        if (pTweenSpace == ETweenSpace::World)
+        {
+            FTransform worldTransform = pComponent->GetComponentTransform();
+            worldTransform.SetLocation(pLocation);
+
+            relativeLocation = GetRelativeFromWorld(pComponent, worldTransform).GetLocation();
+        }
+
+        pComponent->SetRelativeLocation_Direct(relativeLocation);
+        UpdateDirectTransform(pComponent);
+        return;
+    }
+
+    switch (pTweenSpace)
+    {
+        case ETweenSpace::World:
+        {
+            pComponent->SetWorldLocation(pLocation, pShouldSweep, nullptr, GetTeleportType());
+            break;
+        }
+        case ETweenSpace::Relative:
+        {
+            pComponent->SetRelativeLocation(pLocation, pShouldSweep, nullptr, GetTeleportType());
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// protected -------------------------------------------------------------------
+void UBaseTween::SetComponentRotation(USceneComponent* pComponent, ETweenSpace pTweenSpace, const FQuat& pRotation)
+{
+    if (bIsVisualOnly)
+    {
+        FQuat relativeRotation = pRotation;
+
+        if (pTweenSpace == ETweenSpace::World)
+        {
+            FTransform worldTransform = pComponent->GetComponentTransform();
+            worldTransform.SetRotation(pRotation);
+
+            relativeRotation = GetRelativeFromWorld(pComponent, worldTransform).GetRotation();
+        }
+
+        pComponent->SetRelativeRotation_Direct(relativeRotation.Rotator());
+        UpdateDirectTransform(pComponent);
+        return;
+    }
+
+    switch (pTweenSpace)
+    {
+        case ETweenSpace::World:
+        {
+            pComponent->SetWorldRotation(pRotation, false, nullptr, GetTeleportType());
+            break;
+        }
+        case ETweenSpace::Relative:
+        {
+            pComponent->SetRelativeRotation(pRotation, false, nullptr, GetTeleportType());
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// protected -------------------------------------------------------------------
+void UBaseTween::SetComponentScale(USceneComponent* pComponent, ETweenSpace pTweenSpace, const FVector& pScale)
+{
+    if (bIsVisualOnly)
+    {
+        FVector relativeScale = pScale;
+
+        if (pTweenSpace == ETweenSpace::World)
+        {
+            FTransform worldTransform = pComponent->GetComponentTransform();
+            worldTransform.SetScale3D(pScale);
+
+            relativeScale = GetRelativeFromWorld(pComponent, worldTransform).GetScale3D();
+        }
+
+        pComponent->SetRelativeScale3D_Direct(relativeScale);
+        UpdateDirectTransform(pComponent);
+        return;
+    }
+
+    switch (pTweenSpace)
+    {
+        case ETweenSpace::World:
+        {
+            pComponent->SetWorldScale3D(pScale);
+            break;
+        }
+        case ETweenSpace::Relative:
+        {
+            pComponent->SetRelativeScale3D(pScale);
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// protected -------------------------------------------------------------------
+void UBaseTween::SetComponentTransform(USceneComponent* pComponent, ETweenSpace pTweenSpace, const FTransform& pTransform, bool pShouldSweep)
+{
+    if (bIsVisualOnly)
+    {
+        FTransform relativeTransform = pTweenSpace == ETweenSpace::World ? GetRelativeFromWorld(pComponent, pTransform) : pTransform;
+
+        pComponent->SetRelativeLocation_Direct(relativeTransform.GetLocation());
+        pComponent->SetRelativeRotation_Direct(relativeTransform.Rotator());
+        pComponent->SetRelativeScale3D_Direct(relativeTransform.GetScale3D());
+        UpdateDirectTransform(pComponent);
+        return;
+    }
+
+    switch (pTweenSpace)
+    {
+        case ETweenSpace::World:
+        {
+            pComponent->SetWorldTransform(pTransform, pShouldSweep, nullptr, GetTeleportType());
+            break;
+        }
+        case ETweenSpace::Relative:
+        {
+            pComponent->SetRelativeTransform(pTransform, pShouldSweep, nullptr, GetTeleportType());
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// protected -------------------------------------------------------------------
+UPrimitiveComponent* UBaseTween::GetTargetPrimitiveComponent() const
+{
+    // Actors are moved (and swept) through their root component
+    if (AActor* actor = Cast<AActor>(mTargetObject.Get()))
+    {
+        return Cast<UPrimitiveComponent>(actor->GetRootComponent());
+    }
+
+    return Cast<UPrimitiveComponent>(mTargetObject.Get());
+}
+
+// protected -------------------------------------------------------------------
+bool UBaseTween::ShouldSweep()
+{
+    bool shouldSweep               = true;
+    UPrimitiveComponent* component = GetTargetPrimitiveComponent();
+
+    // Asynchronous sweeps only report hits, while the overlaps are updated synchronously by each move anyway
+    if (mCollisionMode == ETweenCollisionMode::AsyncSweep && !IsHitEventBound())
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UBaseTween::ShouldSweep -> the Tween %s uses the AsyncSweep collision mode, but only overlap events are bound: "
+                                            "overlaps are always updated synchronously, so OverlapOnly is used instead."), *GetName());
+
+        mCollisionMode = ETweenCollisionMode::OverlapOnly;
+    }
+
+    if (mCollisionMode == ETweenCollisionMode::AsyncSweep)
+    {
+        // The query is issued once the move is done, from the location the target had before it
+        if (component != nullptr)
+        {
+            mAsyncSweepComponent = component;
+            mAsyncSweepStart     = component->GetComponentLocation();
+        }
+
+        return false;
+    }
+
+    // The first move always sweeps, so that the other modes start from a checked location
+    if (mMovesSinceLastSweep != INDEX_NONE)
+    {
+        switch (mCollisionMode)
+        {
+            case ETweenCollisionMode::SweepEveryNFrames:
+            {
+                shouldSweep = mMovesSinceLastSweep + 1 >= mSweepInterval;
+                break;
+            }
+            case ETweenCollisionMode::SweepOnDistance:
+            {
+                // The distance is the one travelled up to this move: the sweep then covers this move as well
+                shouldSweep =    component == nullptr
+                              || FVector::DistSquared(component->GetComponentLocation(), mLastSweepLocation) >= FMath::Square(mSweepDistance);
+                break;
+            }
+            case ETweenCollisionMode::OverlapOnly:
+            {
+                shouldSweep = false;
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+    else if (mCollisionMode == ETweenCollisionMode::OverlapOnly)
+    {
+        shouldSweep = false;
+    }
+
+    if (shouldSweep)
+    {
+        // The skipped moves teleported the target: bringing it back where the last sweep stopped makes this sweep cover them too,
+        // so an obstacle crossed in between is still hit
+        if (mMovesSinceLastSweep > 0 && component != nullptr)
+        {
+            component->SetWorldLocation(mLastSweepLocation, false, nullptr, ETeleportType::TeleportPhysics);
+        }
+
+        mMovesSinceLastSweep = 0;
+        bHasSweptInUpdate    = true;
+
+        mOwningTweenContainer->mNumSweepsAtLastUpdate++;
+        INC_DWORD_STAT(STAT_TweenMakerSweeps);
+    }
+    else
+    {
+        ++mMovesSinceLastSweep;
+    }
+
+    return shouldSweep;
+}
+
+// protected -------------------------------------------------------------------
+void UBaseTween::RequestAsyncSweep()
+{
+    UPrimitiveComponent* component = mAsyncSweepComponent.Get();
+    UWorld* world                  = component->GetWorld();
+    FVector sweepEnd               = component->GetComponentLocation();
+
+    mAsyncSweepComponent = nullptr;
+
+    if (world == nullptr || sweepEnd.Equals(mAsyncSweepStart))
+    {
+        return;
+    }
+
+    FCollisionQueryParams queryParams(SCENE_QUERY_STAT(TweenAsyncSweep), false, component->GetOwner());
+    FCollisionResponseParams responseParams(component->GetCollisionResponseToChannels());
+    FTraceDelegate onSweepDone = FTraceDelegate::CreateUObject(this, &UBaseTween::OnAsyncSweepDone);
+
+    world->AsyncSweepByChannel(EAsyncTraceType::Single,
+                               mAsyncSweepStart,
+                               sweepEnd,
+                               component->GetComponentQuat(),
+                               component->GetCollisionObjectType(),
+                               component->GetCollisionShape(),
+                               queryParams,
+                               responseParams,
+                               &onSweepDone);
+
+    mOwningTweenContainer->mNumSweepsAtLastUpdate++;
+    INC_DWORD_STAT(STAT_TweenMakerSweeps);
+}
+
+// protected -------------------------------------------------------------------
+void UBaseTween::OnAsyncSweepDone(const FTraceHandle& pTraceHandle, FTraceDatum& pTraceDatum)
+{
+    // The Tween might have ended (or its target changed) while the query was running
+    if (!IsTweening() || pTraceDatum.OutHits.Num() == 0)
+    {
+        return;
+    }
+
+    UPrimitiveComponent* component = GetTargetPrimitiveComponent();
+
+    if (component == nullptr || component->GetOwner() == nullptr)
+    {
+        return;
+    }
+
+    for (const FHitResult& hit : pTraceDatum.OutHits)
+    {
+        if (hit.bBlockingHit)
+        {
+            component->DispatchBlockingHit(*component->GetOwner(), hit);
+            break;
+        }
+    }
 }
 
 // public ----------------------------------------------------------------------
@@ -167,6 +733,8 @@ void UBaseTween::SetTweenName(FName pTweenName)
 // public ----------------------------------------------------------------------
 void UBaseTween::DeleteTween(bool pFireEndEvent, ESnapMode pSnapMode)
 {
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenOp(ETweenRecordOp::TweenDelete, this, 0.0f, (pFireEndEvent ? 1 : 0) | (static_cast<int32>(pSnapMode) << 1)));
+
     bIsPendingDeletion = true;
 
     switch (pSnapMode)
@@ -199,6 +767,8 @@ void UBaseTween::DeleteTween(bool pFireEndEvent, ESnapMode pSnapMode)
 // public ----------------------------------------------------------------------
 void UBaseTween::PauseTween(bool pSkipTween)
 {
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenOp(ETweenRecordOp::TweenPause, this, 0.0f, pSkipTween ? 1 : 0));
+
     bIsTweenPaused = true;
     bShouldSkipTween = pSkipTween;
 
@@ -208,6 +778,8 @@ void UBaseTween::PauseTween(bool pSkipTween)
 // public ----------------------------------------------------------------------
 void UBaseTween::TogglePauseTween(bool pSkipTween)
 {
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenOp(ETweenRecordOp::TweenTogglePause, this, 0.0f, pSkipTween ? 1 : 0));
+
     bIsTweenPaused = !bIsTweenPaused;
 
     if (bIsTweenPaused)
@@ -224,14 +796,20 @@ void UBaseTween::TogglePauseTween(bool pSkipTween)
 // public ----------------------------------------------------------------------
 void UBaseTween::RestartTween()
 {
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenOp(ETweenRecordOp::TweenRestart, this));
+
     bIsTweenPaused = false;
     mElapsedTime = 0.0f;
     bIsTweenDone = false;
+
+    EndRetargetedLoop();
 }
 
 // public ----------------------------------------------------------------------
 void UBaseTween::ResumeTween()
 {
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenOp(ETweenRecordOp::TweenResume, this));
+
     bIsTweenPaused = false;
     bShouldSkipTween = false;
 
@@ -241,12 +819,16 @@ void UBaseTween::ResumeTween()
 // public ----------------------------------------------------------------------
 void UBaseTween::SetDelay(float NewDelay)
 {
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenOp(ETweenRecordOp::TweenDelay, this, NewDelay));
+
     mDelay = NewDelay;
 }
 
 // public ----------------------------------------------------------------------
 void UBaseTween::SetTimeScale(float pNewTimeScale)
 {
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenOp(ETweenRecordOp::TweenTimeScale, this, pNewTimeScale));
+
     // If one of them is negative, the result will be negative, meaning that there is a sign difference:
     // in that case we need to invert the Tween
     if (pNewTimeScale * mTimeScale < 0)
@@ -264,6 +846,37 @@ void UBaseTween::SetCustomEasisng(UCurveFloat *Curve)
     mCurveFloat = Curve;
 }
 
+// public ----------------------------------------------------------------------
+void UBaseTween::SetVisualOnly(bool pVisualOnly)
+{
+    bIsVisualOnly = pVisualOnly;
+}
+
+// public ----------------------------------------------------------------------
+void UBaseTween::SetCollisionMode(ETweenCollisionMode pCollisionMode, int32 pSweepInterval, float pSweepDistance)
+{
+    mCollisionMode       = pCollisionMode;
+    mSweepInterval       = FMath::Max(pSweepInterval, 1);
+    mSweepDistance       = FMath::Max(pSweepDistance, 0.0f);
+    mMovesSinceLastSweep = INDEX_NONE;
+}
+
+// public ----------------------------------------------------------------------
+void UBaseTween::SetSpring(float pFrequency, float pDampingRatio, float pSettleThreshold, bool pEndWhenSettled)
+{
+    if (!SupportsSpring())
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UBaseTween::SetSpring -> the Tween %s can't be driven by a spring, it will keep its duration and easing."), *GetName());
+        return;
+    }
+
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenSpring(this, pFrequency, pDampingRatio, pSettleThreshold, pEndWhenSettled));
+
+    float settleThreshold = pSettleThreshold > 0.0f ? pSettleThreshold : GetDefaultSpringSettleThreshold();
+
+    mSpring.Init(pFrequency, pDampingRatio, settleThreshold, pEndWhenSettled);
+}
+
 // public ----------------------------------------------------------------------
 UTweenVector* UBaseTween::AppendTweenMoveActorTo(AActor* pTweenTarget,
                                                  FVector pTo,
@@ -6,7 +6,11 @@
 #include "GameFramework/Actor.h"
 #include "Utils/Utility.h"
 #include "Utils/EaseEquations.h"
+#include "Utils/TweenSplineCache.h"
+#include "TweenContainer.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "Components/PrimitiveComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Components/SplineComponent.h"
 #include "Components/Widget.h"
@@ -39,55 +43,39 @@ namespace
         }
     }
 
-    void SetLocationFromSpace(AActor* pActor, ETweenSpace pTweenSpace, const FVector& pNewLocation, bool pDoSweep)
+    void SetLocationFromSpace(AActor* pActor, ETweenSpace pTweenSpace, const FVector& pNewLocation, bool pDoSweep, ETeleportType pTeleportType)
     {
         switch (pTweenSpace)
         {
             case ETweenSpace::World:
-                pActor->SetActorLocation(pNewLocation, pDoSweep);
+                pActor->SetActorLocation(pNewLocation, pDoSweep, nullptr, pTeleportType);
                 break;
             case ETweenSpace::Relative:
-                pActor->SetActorRelativeLocation(pNewLocation, pDoSweep);
+                pActor->SetActorRelativeLocation(pNewLocation, pDoSweep, nullptr, pTeleportType);
                 break;
             default:
                 break;
         }
     }
 
-    void SetLocationFromSpace(USceneComponent* pSceneComponent, ETweenSpace pTweenSpace, const FVector& pNewLocation, bool pDoSweep)
+    void ComputeAroundPointBasis(const FVector& pLocation,
+                                 const FVector& pPivotPoint,
+                                 const FVector& pAxis,
+                                 float pRadius,
+                                 FVector& pOutCenter,
+                                 FVector& pOutAxisU,
+                                 FVector& pOutAxisV)
     {
-        switch (pTweenSpace)
-        {
-            case ETweenSpace::World:
-                pSceneComponent->SetWorldLocation(pNewLocation, pDoSweep);
-            break;
-            case ETweenSpace::Relative:
-                pSceneComponent->SetRelativeLocation(pNewLocation, pDoSweep);
-            break;
-            default:
-                break;
-        }
-    }
-
-    FVector ComputeArountPointUpdate(
-        float pCurrentValue,
-        float pPreviousValue,
-        const FVector& pPivotPoint,
-        const FVector& pAxis,
-        float pRadius,
-        FVector& outOffsetVector)
-    {
-        // Computing the delta angle
-        float angle = pCurrentValue - pPreviousValue;
-
-        // Rotating the offset vector by the angle delta. This basically rotates the vector around pivot point. The offset vector
-        // starts at the direction from the pivot point to the initial location of the target,
-        // and it rotates while still pointing towards the pivot point
-        outOffsetVector = outOffsetVector.RotateAngleAxis(angle, pAxis);
-
-        // Applying the offset vector to the target. Since the offset vector rotates around the origin,
-        // I add the rotation point to position the actor in the correct place
-        return pPivotPoint + outOffsetVector * pRadius;
+        // The target starts in the direction going from the pivot point to its initial location, at the given radius. Splitting that offset
+        // into its part along the axis (which never changes) and its part on the rotation plane, the location at any angle is
+        // "Center + AxisU * cos(angle) + AxisV * sin(angle)", which is what FVector::RotateAngleAxis() computes, without accumulating errors
+        FVector axis       = pAxis.GetSafeNormal();
+        FVector offset     = (pLocation - pPivotPoint).GetSafeNormal() * pRadius;
+        FVector axisOffset = axis * FVector::DotProduct(offset, axis);
+
+        pOutCenter = pPivotPoint + axisOffset;
+        pOutAxisU  = offset - axisOffset;
+        pOutAxisV  = FVector::CrossProduct(axis, pOutAxisU);
     }
 }
 
@@ -97,11 +85,14 @@ UTweenFloat::UTweenFloat(const FObjectInitializer& ObjectInitializer)
     , TweenLatentProxy(nullptr)
     , mCurrentValue(0.0f)
     , mFrom(0.0f)
+    , mLoopFrom(0.0f)
     , mTo(0.0f)
+    , mSpringVelocity(0.0f)
     , bDeleteTweenOnHit(false)
     , bDeleteTweenOnOverlap(false)
     , bHasBoundedFunctions(false)
     , mParameterName(FName(""))
+    , mParameterIndex(INDEX_NONE)
 {
 
 }
@@ -122,6 +113,8 @@ void UTweenFloat::Init(float pFrom,
 
     mCurrentValue  = 0.0f;
     mPreviousValue = 0.0f;
+
+    mPropertyBinding.Reset();
 }
 
 // public ----------------------------------------------------------------------
@@ -151,6 +144,53 @@ void UTweenFloat::InitRotateAround(const FVector& pPoint,
     bDeleteTweenOnHit     = pDeleteTweenOnHit;
     bDeleteTweenOnOverlap = pDeleteTweenOnOverlap;
     bHasBoundedFunctions  = false;
+
+    mOrbiters.Reset();
+}
+
+// public ----------------------------------------------------------------------
+void UTweenFloat::AddOrbiters(const TArray<USceneComponent*>& pOrbiters)
+{
+    if (mTweenType != ETweenFloatType::RotateAroundPoint || bHasPreparedTween)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenFloat::AddOrbiters -> orbiters can only be added to a \"RotateAroundPoint\" Tween that hasn't started yet."));
+        return;
+    }
+
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenOrbiters(this, pOrbiters));
+
+    for (USceneComponent* orbiterComponent : pOrbiters)
+    {
+        if (orbiterComponent != nullptr && orbiterComponent != mTargetObject.Get())
+        {
+            FTweenOrbiter& orbiter = mOrbiters.AddDefaulted_GetRef();
+            orbiter.Component = orbiterComponent;
+        }
+    }
+}
+
+// public ----------------------------------------------------------------------
+void UTweenFloat::Retarget(float pNewTo, float pNewDuration)
+{
+    // A spring has no clock: it just heads to the new ending value, keeping its velocity
+    if (RetargetClock(FVector4f(pNewTo, 0.0f, 0.0f, 0.0f), pNewDuration))
+    {
+        mFrom = mCurrentValue;
+    }
+
+    mTo = pNewTo;
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenFloat::BindProperty(const FString& pPropertyPath)
+{
+    if (mTweenType != ETweenFloatType::Custom)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenFloat::BindProperty -> only Custom Tweens can be bound to a property."));
+        return false;
+    }
+
+    return mPropertyBinding.Bind(mTargetObject.Get(), pPropertyPath, FTweenPropertyBinding::EValueType::Float);
 }
 
 // public ----------------------------------------------------------------------
@@ -179,10 +219,8 @@ void UTweenFloat::InitFollowSpline(USplineComponent* pSpline,
     bSplineApplyRotation = pApplyRotation;
     bSplineApplyScale = pApplyScale;
 
-    // Note: if the time scale is negative, the Invert() function will be called, which forces the recomputation of the "next point index".
-    // So, to make things easier if we're in that case I make the next point in spline start one point beyond, since it will be subracted right away
-    mNextPointIndex = mTimeScale >= 0 ? 1 : mSpline->GetNumberOfSplinePoints();
-    mNextPointIndex = FMath::Clamp(mNextPointIndex, 0, mSpline->GetNumberOfSplinePoints());
+    // The first update only records where the Tween starts, since it hasn't crossed anything yet
+    mPreviousSplineInputKey = -1.0f;
 }
 
 // protected -------------------------------------------------------------------
@@ -196,8 +234,13 @@ bool UTweenFloat::Update(float pDeltaTime, float pTimeScale)
     // Checking if the Tween should end
     bool hasEnded = mElapsedTime >= mTweenDuration;
 
+    // A spring has no duration: it can only end when it settles on the ending value (see SetSpring)
+    if (mSpring.IsEnabled())
+    {
+        hasEnded = UpdateSpring(FMath::Abs(pDeltaTime * pTimeScale * mTimeScaleAbsolute)) && mSpring.EndsWhenSettled();
+    }
     // If the Tween is ending, I'll set the current value to the desired value
-    if (hasEnded)
+    else if (hasEnded)
     {
         mCurrentValue = mTo;
     }
@@ -223,6 +266,18 @@ bool UTweenFloat::Update(float pDeltaTime, float pTimeScale)
             UpdateForMaterial(material);
             break;
         }
+        case ETweenTargetType::MaterialParameterCollection:
+        {
+            UMaterialParameterCollectionInstance* collectionInstance = GetTargetParameterCollectionInstance();
+            UpdateForParameterCollection(collectionInstance);
+            break;
+        }
+        case ETweenTargetType::CustomPrimitiveData:
+        {
+            UPrimitiveComponent* primitiveComponent = Cast<UPrimitiveComponent>(mTargetObject);
+            UpdateForCustomPrimitiveData(primitiveComponent);
+            break;
+        }
         case ETweenTargetType::Actor:
         {
             AActor* actor = Cast<AActor>(mTargetObject);
@@ -243,6 +298,7 @@ bool UTweenFloat::Update(float pDeltaTime, float pTimeScale)
         }
         case ETweenTargetType::Custom:
         {
+            mPropertyBinding.Write(mTargetObject.Get(), mCurrentValue);
             break;
         }
     }
@@ -277,6 +333,26 @@ void UTweenFloat::PrepareTween()
                     material->GetScalarParameterValue(FMaterialParameterInfo(mParameterName), mFrom);
                     break;
                 }
+                case ETweenTargetType::MaterialParameterCollection:
+                {
+                    UMaterialParameterCollectionInstance* collectionInstance = GetTargetParameterCollectionInstance();
+
+                    if (collectionInstance != nullptr)
+                    {
+                        collectionInstance->GetScalarParameterValue(mParameterName, mFrom);
+                    }
+
+                    break;
+                }
+                case ETweenTargetType::CustomPrimitiveData:
+                {
+                    UPrimitiveComponent* primitiveComponent = Cast<UPrimitiveComponent>(mTargetObject);
+                    const TArray<float>& customData         = primitiveComponent->GetCustomPrimitiveData().Data;
+
+                    // Values that were never set are 0 on the render side too
+                    mFrom = customData.IsValidIndex(mCustomPrimitiveDataIndex) ? customData[mCustomPrimitiveDataIndex] : 0.0f;
+                    break;
+                }
             }
 
             break;
@@ -306,22 +382,37 @@ void UTweenFloat::PrepareTween()
                 }
             }
 
-            // The offset vector at start is just the direction vector
-            mOffsetVector = objectLocation - mPivotPoint;
-            mOffsetVector.Normalize();
+            // Positions are computed from the angle travelled since now, so they can't drift however long the Tween loops
+            mOrbitReferenceAngle = mPreviousValue;
+            ComputeAroundPointBasis(objectLocation, mPivotPoint, mAxis, mRadius, mOrbitCenter, mOrbitAxisU, mOrbitAxisV);
+
+            for (FTweenOrbiter& orbiter : mOrbiters)
+            {
+                if (USceneComponent* orbiterComponent = orbiter.Component.Get())
+                {
+                    ComputeAroundPointBasis(GetLocationFromSpace(orbiterComponent, mTweenSpace), mPivotPoint, mAxis, mRadius,
+                                            orbiter.Center, orbiter.AxisU, orbiter.AxisV);
+                }
+            }
 
             break;
         }
         case ETweenFloatType::WidgetAngleTo:
         {
             UWidget* widget = Cast<UWidget>(mTargetObject);
-            mFrom = widget->RenderTransform.Angle;
+            mFrom = mOwningTweenContainer->OwningTweenManager->GetWidgetProperty(widget, ETweenWidgetProperty::Angle).X;
             break;
         }
         case ETweenFloatType::WidgetOpacityTo:
         {
             UWidget* widget = Cast<UWidget>(mTargetObject);
-            mFrom = widget->RenderOpacity;
+            mFrom = mOwningTweenContainer->OwningTweenManager->GetWidgetProperty(widget, ETweenWidgetProperty::Opacity).X;
+            break;
+        }
+        case ETweenFloatType::FollowSpline:
+        {
+            // Sampling the spline once here, so that the updates only need to interpolate between the samples
+            mSplineCache = FTweenSplineCache::FindOrCreate(mSpline, bUseConstantSpeed);
             break;
         }
         default:
@@ -329,6 +420,24 @@ void UTweenFloat::PrepareTween()
             break;
         }
     }
+
+    // Resolving the material parameter only once, so that each update can write it by index instead of looking it up by name
+    if (mTargetType == ETweenTargetType::Material)
+    {
+        UMaterialInstanceDynamic* material = Cast<UMaterialInstanceDynamic>(mTargetObject);
+
+        if (!material->InitializeScalarParameterAndGetIndex(mParameterName, mFrom, mParameterIndex))
+        {
+            mParameterIndex = INDEX_NONE;
+        }
+    }
+
+    // A spring starts at rest on the starting value
+    if (mSpring.IsEnabled())
+    {
+        mCurrentValue   = mFrom;
+        mSpringVelocity = 0.0f;
+    }
 }
 
 // protected -------------------------------------------------------------------
@@ -349,6 +458,18 @@ void UTweenFloat::PositionAt(bool pBeginning)
                 UpdateForMaterial(material);
                 break;
             }
+            case ETweenTargetType::MaterialParameterCollection:
+            {
+                UMaterialParameterCollectionInstance* collectionInstance = GetTargetParameterCollectionInstance();
+                UpdateForParameterCollection(collectionInstance);
+                break;
+            }
+            case ETweenTargetType::CustomPrimitiveData:
+            {
+                UPrimitiveComponent* primitiveComponent = Cast<UPrimitiveComponent>(mTargetObject);
+                UpdateForCustomPrimitiveData(primitiveComponent);
+                break;
+            }
             case ETweenTargetType::Actor:
             {
                 AActor* actor = Cast<AActor>(mTargetObject);
@@ -369,6 +490,7 @@ void UTweenFloat::PositionAt(bool pBeginning)
             }
             case ETweenTargetType::Custom:
             {
+                mPropertyBinding.Write(mTargetObject.Get(), mCurrentValue);
                 break;
             }
             default:
@@ -409,31 +531,71 @@ void UTweenFloat::Restart(bool pRestartFromEnd)
         Swap(mFrom, mTo);
     }
 
-    // If this is a spline, update the "next point in spline" approprately
+    if (mSpring.IsEnabled())
+    {
+        mCurrentValue   = mFrom;
+        mSpringVelocity = 0.0f;
+    }
+
+    // If this is a spline, jumping back to the start mustn't be seen as crossing all the points in between
     if (mSpline)
     {
-        mNextPointIndex = mFrom == 0 ? 1 : mSpline->GetNumberOfSplinePoints() - 1;
-        mNextPointIndex = FMath::Clamp(mNextPointIndex, 0, mSpline->GetNumberOfSplinePoints() - 1);
+        mPreviousSplineInputKey = GetSplineInputKeyAtTime(mFrom);
     }
 
     mElapsedTime = 0.0f;
 }
 
+// protected -------------------------------------------------------------------
+void UTweenFloat::SaveLoopStart()
+{
+    mLoopFrom = mFrom;
+}
+
+// protected -------------------------------------------------------------------
+void UTweenFloat::RestoreLoopStart()
+{
+    mFrom = mLoopFrom;
+}
+
 // protected -------------------------------------------------------------------
 void UTweenFloat::Invert(bool pShouldInvertElapsedTime)
 {
     Super::Invert(pShouldInvertElapsedTime);
 
-    // If this is a spline, update the "next point in spline" approprately
-    if (mSpline)
+    Swap(mFrom, mTo);
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenFloat::IsUpdateEventBound() const
+{
+    if (TweenLatentProxy != nullptr)
     {
-        // Check if we're going from 0 to the end or backward and update accordingly (taking into account that we'll now switch)
-        mNextPointIndex = mFrom == 0 ? (mNextPointIndex - 1) % mSpline->GetNumberOfSplinePoints()
-                                     : (mNextPointIndex + 1) % mSpline->GetNumberOfSplinePoints();
-        mNextPointIndex = FMath::Clamp(mNextPointIndex, 0, mSpline->GetNumberOfSplinePoints() - 1);
+        return TweenLatentProxy->OnTweenUpdate.IsBound();
     }
 
-    Swap(mFrom, mTo);
+    return OnTweenUpdate.IsBound() || OnTweenUpdateDelegate.IsBound();
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenFloat::IsEndEventBound() const
+{
+    if (TweenLatentProxy != nullptr)
+    {
+        return TweenLatentProxy->OnTweenEnd.IsBound();
+    }
+
+    return OnTweenEnd.IsBound() || OnTweenEndDelegate.IsBound();
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenFloat::IsHitEventBound() const
+{
+    return    bDeleteTweenOnHit
+           || OnTweenActorHit.IsBound()
+           || OnTweenActorHitDelegate.IsBound()
+           || OnTweenPrimitiveComponentHit.IsBound()
+           || OnTweenPrimitiveComponentHitDelegate.IsBound();
 }
 
 // protected -------------------------------------------------------------------
@@ -500,9 +662,50 @@ void UTweenFloat::BroadcastOnTweenEnd()
     }
 }
 
+// private ---------------------------------------------------------------------
+bool UTweenFloat::UpdateSpring(float pDeltaTime)
+{
+    float displacement = mCurrentValue - mTo;
+
+    mSpring.ComputeCoefficients(pDeltaTime);
+    mSpring.Step(displacement, mSpringVelocity);
+
+    bool isSettled = mSpring.IsSettled(displacement, mSpringVelocity);
+
+    // Once settled, the value is snapped on the target so that the Tween ends exactly there
+    mCurrentValue = isSettled ? mTo : mTo + displacement;
+
+    return isSettled;
+}
+
 // private ---------------------------------------------------------------------
 void UTweenFloat::UpdateForMaterial(UMaterialInstanceDynamic* pTarget)
 {
+    switch (mTweenType)
+    {
+        case ETweenFloatType::MaterialScalarTo:
+        case ETweenFloatType::MaterialScalarFromTo:
+        {
+            // Written at the end of the update, together with the other parameters of the same material
+            mOwningTweenContainer->OwningTweenManager->SetMaterialScalarParameter(pTarget, mParameterName, mParameterIndex, mCurrentValue);
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+void UTweenFloat::UpdateForParameterCollection(UMaterialParameterCollectionInstance* pTarget)
+{
+    // Null when the TweenManager has no world (e.g. in the replayer)
+    if (pTarget == nullptr)
+    {
+        return;
+    }
+
     switch (mTweenType)
     {
         case ETweenFloatType::MaterialScalarTo:
@@ -518,37 +721,55 @@ void UTweenFloat::UpdateForMaterial(UMaterialInstanceDynamic* pTarget)
     }
 }
 
+// private ---------------------------------------------------------------------
+void UTweenFloat::UpdateForCustomPrimitiveData(UPrimitiveComponent* pTarget)
+{
+    switch (mTweenType)
+    {
+        case ETweenFloatType::MaterialScalarTo:
+        case ETweenFloatType::MaterialScalarFromTo:
+        {
+            pTarget->SetCustomPrimitiveDataFloat(mCustomPrimitiveDataIndex, mCurrentValue);
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
 // private ---------------------------------------------------------------------
 void UTweenFloat::UpdateForActor(AActor* pTarget)
 {
+    // Visual only Tweens write the root component directly (see SetComponentLocation())
+    if (bIsVisualOnly)
+    {
+        if (USceneComponent* rootComponent = pTarget->GetRootComponent())
+        {
+            UpdateForSceneComponent(rootComponent);
+        }
+
+        return;
+    }
+
     switch (mTweenType)
     {
         case ETweenFloatType::RotateAroundPoint:
         {
-            FVector newLocation = ComputeArountPointUpdate(mCurrentValue, mPreviousValue, mPivotPoint, mAxis, mRadius, mOffsetVector);
-            SetLocationFromSpace(pTarget, mTweenSpace, newLocation, bHasBoundedFunctions);
+            FVector newLocation = UpdateAroundPoint();
+            SetLocationFromSpace(pTarget, mTweenSpace, newLocation, bHasBoundedFunctions && ShouldSweep(), GetTeleportType());
             break;
         }
         case ETweenFloatType::FollowSpline:
         {
             if (mSpline != nullptr)
             {
-                FVector newLocation = mSpline->GetLocationAtTime(mCurrentValue, ESplineCoordinateSpace::World, bUseConstantSpeed);
-                pTarget->SetActorLocation(newLocation, bHasBoundedFunctions);
-
-                if (bSplineApplyRotation)
-                {
-                    FRotator newRotation = mSpline->GetRotationAtTime(mCurrentValue, ESplineCoordinateSpace::World, bUseConstantSpeed);
-                    pTarget->SetActorRotation(newRotation);
-                }
+                // Location, rotation and scale are evaluated and written all at once
+                FTransform newTransform = ComputeSplineTransform(pTarget->GetActorTransform());
+                pTarget->SetActorTransform(newTransform, bHasBoundedFunctions && ShouldSweep(), nullptr, GetTeleportType());
 
-                if (bSplineApplyScale)
-                {
-                    FVector newScale = mSpline->GetScaleAtTime(mCurrentValue, ESplineCoordinateSpace::World);
-                    pTarget->SetActorScale3D(newScale);
-                }
-
-                CheckSplinePointReached(newLocation);
+                CheckSplinePointReached();
             }
 
             break;
@@ -567,30 +788,19 @@ void UTweenFloat::UpdateForSceneComponent(USceneComponent* pTarget)
     {
         case ETweenFloatType::RotateAroundPoint:
         {
-            FVector newLocation = ComputeArountPointUpdate(mCurrentValue, mPreviousValue, mPivotPoint, mAxis, mRadius, mOffsetVector);
-            SetLocationFromSpace(pTarget, mTweenSpace, newLocation, bHasBoundedFunctions);
+            FVector newLocation = UpdateAroundPoint();
+            SetComponentLocation(pTarget, mTweenSpace, newLocation, bHasBoundedFunctions && ShouldSweep());
             break;
         }
         case ETweenFloatType::FollowSpline:
         {
             if (mSpline != nullptr)
             {
-                FVector newLocation = mSpline->GetLocationAtTime(mCurrentValue, ESplineCoordinateSpace::World, bUseConstantSpeed);
-                pTarget->SetWorldLocation(newLocation, bHasBoundedFunctions);
-
-                if (bSplineApplyRotation)
-                {
-                    FRotator newRotation = mSpline->GetRotationAtTime(mCurrentValue, ESplineCoordinateSpace::World, bUseConstantSpeed);
-                    pTarget->SetWorldRotation(newRotation);
-                }
-
-                if (bSplineApplyScale)
-                {
-                    FVector newScale = mSpline->GetScaleAtTime(mCurrentValue, ESplineCoordinateSpace::World);
-                    pTarget->SetWorldScale3D(newScale);
-                }
+                // Location, rotation and scale are evaluated and written all at once
+                FTransform newTransform = ComputeSplineTransform(pTarget->GetComponentTransform());
+                SetComponentTransform(pTarget, ETweenSpace::World, newTransform, bHasBoundedFunctions && ShouldSweep());
 
-                CheckSplinePointReached(newLocation);
+                CheckSplinePointReached();
             }
 
             break;
@@ -605,16 +815,19 @@ void UTweenFloat::UpdateForSceneComponent(USceneComponent* pTarget)
 // private ---------------------------------------------------------------------
 void UTweenFloat::UpdateForWidget(UWidget* pTarget)
 {
+    // The values are written in the widget at the end of the update, together with the changes of the other Tweens on it
+    UTweenManagerComponent* tweenManager = mOwningTweenContainer->OwningTweenManager;
+
     switch (mTweenType)
     {
         case ETweenFloatType::WidgetAngleTo:
         {
-            pTarget->SetRenderTransformAngle(mCurrentValue);
+            tweenManager->SetWidgetProperty(pTarget, ETweenWidgetProperty::Angle, FVector2D(mCurrentValue, 0.0f));
             break;
         }
         case ETweenFloatType::WidgetOpacityTo:
         {
-            pTarget->SetRenderOpacity(mCurrentValue);
+            tweenManager->SetWidgetProperty(pTarget, ETweenWidgetProperty::Opacity, FVector2D(mCurrentValue, 0.0f));
             break;
         }
         default:
@@ -625,63 +838,135 @@ void UTweenFloat::UpdateForWidget(UWidget* pTarget)
 }
 
 // private ---------------------------------------------------------------------
-void UTweenFloat::CheckSplinePointReached(const FVector& WorldPosition)
+FVector UTweenFloat::UpdateAroundPoint()
+{
+    // The angle is shared by the whole group, so the trigonometry is computed once for all of its members
+    float sine;
+    float cosine;
+    FMath::SinCos(&sine, &cosine, FMath::DegreesToRadians(mCurrentValue - mOrbitReferenceAngle));
+
+    for (const FTweenOrbiter& orbiter : mOrbiters)
+    {
+        if (USceneComponent* orbiterComponent = orbiter.Component.Get())
+        {
+            // Orbiters never sweep, so their transform updates can wait for the end of the TweenManager's update when that pays off.
+            // Visual only Tweens write them directly instead
+            if (!bIsVisualOnly)
+            {
+                mOwningTweenContainer->OwningTweenManager->BeginScopedMovement(orbiterComponent);
+            }
+
+            SetComponentLocation(orbiterComponent, mTweenSpace, orbiter.Center + orbiter.AxisU * cosine + orbiter.AxisV * sine, false);
+        }
+    }
+
+    return mOrbitCenter + mOrbitAxisU * cosine + mOrbitAxisV * sine;
+}
+
+// private ---------------------------------------------------------------------
+FTransform UTweenFloat::ComputeSplineTransform(const FTransform& pCurrentTransform)
+{
+    FTransform splineTransform;
+
+    // The spline may be attached to a component whose movement is still deferred
+    mOwningTweenContainer->OwningTweenManager->EndParentScopedMovements(mSpline);
+
+    // Refresh() rebuilds the samples if the spline points changed while the Tween was running
+    if (mSplineCache.IsValid() && mSplineCache->Refresh())
+    {
+        splineTransform = mSplineCache->GetTransformAtTime(mCurrentValue);
+    }
+    else
+    {
+        // Evaluating in local space keeps the scale of the spline points as it is, like the cache does
+        splineTransform = mSpline->GetTransformAtTime(mCurrentValue, ESplineCoordinateSpace::Local, bUseConstantSpeed, bSplineApplyScale);
+
+        const FTransform& componentTransform = mSpline->GetComponentTransform();
+        splineTransform.SetLocation(componentTransform.TransformPosition(splineTransform.GetLocation()));
+        splineTransform.SetRotation(componentTransform.GetRotation() * splineTransform.GetRotation());
+    }
+
+    return FTransform(bSplineApplyRotation ? splineTransform.GetRotation() : pCurrentTransform.GetRotation(),
+                      splineTransform.GetLocation(),
+                      bSplineApplyScale ? splineTransform.GetScale3D() : pCurrentTransform.GetScale3D());
+}
+
+// private ---------------------------------------------------------------------
+void UTweenFloat::CheckSplinePointReached()
 {
     bool isSomethingBound = OnTweenSplinePointReached.IsBound() || OnTweenSplinePointReachedDelegate.IsBound();
 
     if (isSomethingBound)
     {
-        int numPoints = mSpline->GetNumberOfSplinePoints();
-        bool found = false;
+        // Input keys are point indices (e.g. halfway between point 2 and point 3 the input key is 2.5), so the points crossed since the
+        // previous update are the integers between the previous key and the current one, whichever the direction and however large the step
+        float currentInputKey   = GetSplineInputKeyAtTime(mCurrentValue);
+        float previousInputKey  = mPreviousSplineInputKey;
+        mPreviousSplineInputKey = currentInputKey;
 
-        // Find the input key at this position. From what I understand, I can consider "input keys" as normalized point indices. For example,
-        // If I'm going from point 2 to point 3 and I'm currently in the middle, the resulting input index will be 2.5. If I'm at 3/4 towards 
-        // point 3, the input key will be 2.75 and so on.
-        // So, to determine the closest point index, I take the current input key and round it
-        float closestInputKey = mSpline->FindInputKeyClosestToWorldLocation(WorldPosition);
-        int point = FMath::RoundToInt(closestInputKey);
+        if (previousInputKey < 0.0f || currentInputKey == previousInputKey)
+        {
+            return;
+        }
 
-        // Several cases to consider, depending on whether the Tween is going backward and whether it's inverted.
-        // This "if" matches the standard case, meaning that it's going forward with a normal timescale. If that's the case,
-        // check if the closest point index matches the next one we expect to find. If so, if the input key is 
-        // greater or equal thatn the point index, it means that we've want past it, so we can consider it "reaching it"
-        if (   mFrom == 0
-            && mTimeScale >= 0
-            && point == mNextPointIndex
-            && closestInputKey >= mNextPointIndex)
+        int numPoints = mSpline->GetNumberOfSplinePoints();
+        int firstPoint;
+        int lastPoint;
+        int step;
+
+        if (currentInputKey > previousInputKey)
         {
-            // We're going forward, so increment the next expected point
-            mNextPointIndex = (mNextPointIndex + 1) % mSpline->GetNumberOfSplinePoints();
-            found = true;
+            firstPoint = FMath::FloorToInt(previousInputKey) + 1;
+            lastPoint  = FMath::FloorToInt(currentInputKey);
+            step       = 1;
         }
-        // Same thing as above, but this matches the "going backward" case
-        else if (   (mTo == 0 || mTimeScale < 0)
-                 && point == mNextPointIndex
-                 && closestInputKey <= mNextPointIndex)
+        else
         {
-            // Decrement the point
-            mNextPointIndex = (mNextPointIndex - 1) % mSpline->GetNumberOfSplinePoints();
-            found = true;
+            firstPoint = FMath::CeilToInt(previousInputKey) - 1;
+            lastPoint  = FMath::CeilToInt(currentInputKey);
+            step       = -1;
         }
 
-        if (found)
+        for (int point = firstPoint; (point - lastPoint) * step <= 0; point += step)
         {
+            // On closed loops the end of the spline is its first point again
+            int pointIndex = point % numPoints;
+
             if (OnTweenSplinePointReached.IsBound())
             {
-                OnTweenSplinePointReached.Broadcast(this, point);
+                OnTweenSplinePointReached.Broadcast(this, pointIndex);
             }
             else if (OnTweenSplinePointReachedDelegate.IsBound())
             {
-                OnTweenSplinePointReachedDelegate.Execute(this, point);
+                OnTweenSplinePointReachedDelegate.Execute(this, pointIndex);
             }
         }
     }
 }
 
+// private ---------------------------------------------------------------------
+float UTweenFloat::GetSplineInputKeyAtTime(float pTime) const
+{
+    if (mSpline->Duration <= 0.0f)
+    {
+        return 0.0f;
+    }
+
+    // Same mapping used by USplineComponent::GetLocationAtTime()
+    if (bUseConstantSpeed)
+    {
+        float distance = mSpline->GetSplineLength() * pTime / mSpline->Duration;
+        return mSpline->SplineCurves.ReparamTable.Eval(distance, 0.0f);
+    }
+
+    return mSpline->GetNumberOfSplineSegments() * pTime / mSpline->Duration;
+}
+
 // private ---------------------------------------------------------------------
 void UTweenFloat::BindDelegates()
 {
-    if (!bHasBoundedFunctions && mTargetObject.IsValid())
+    // Visual only Tweens ignore collisions altogether
+    if (!bHasBoundedFunctions && !bIsVisualOnly && mTargetObject.IsValid())
     {
         bool foundCorrectType = false;
 
@@ -4,16 +4,22 @@
 
 #include "TweenFactory/Latent/TweenLinearColorLatentFactory.h"
 #include "Utils/EaseEquations.h"
+#include "TweenContainer.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "Components/PrimitiveComponent.h"
 
 // public ----------------------------------------------------------------------
 UTweenLinearColor::UTweenLinearColor(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
     , TweenLatentProxy(nullptr)
     , mParameterName(FName(""))
+    , mParameterIndex(INDEX_NONE)
     , CurrentValue(FLinearColor())
     , From(FLinearColor())
+    , mLoopFrom(FLinearColor())
     , To(FLinearColor())
+    , mSpringVelocity(FLinearColor(0.0f, 0.0f, 0.0f, 0.0f))
 {
 
 }
@@ -39,6 +45,20 @@ void UTweenLinearColor::Init(const FName& pParameterName,
     CurrentValueVector = FVector(0, 0, 0);
 }
 
+// public ----------------------------------------------------------------------
+void UTweenLinearColor::Retarget(FLinearColor pNewTo, float pNewDuration)
+{
+    // A spring has no clock: it just heads to the new ending value, keeping its velocity
+    if (RetargetClock(FVector4f(pNewTo.R, pNewTo.G, pNewTo.B, pNewTo.A), pNewDuration))
+    {
+        From       = CurrentValue;
+        FromVector = FVector(From.R, From.G, From.B);
+    }
+
+    To       = pNewTo;
+    ToVector = FVector(To.R, To.G, To.B);
+}
+
 // public ----------------------------------------------------------------------
 bool UTweenLinearColor::Update(float pDeltaTime, float pTimeScale)
 {
@@ -48,7 +68,12 @@ bool UTweenLinearColor::Update(float pDeltaTime, float pTimeScale)
 
     bool hasEnded = mElapsedTime >= mTweenDuration;
 
-    if (hasEnded)
+    // A spring has no duration: it can only end when it settles on the ending value (see SetSpring)
+    if (mSpring.IsEnabled())
+    {
+        hasEnded = UpdateSpring(FMath::Abs(pDeltaTime * pTimeScale * mTimeScaleAbsolute)) && mSpring.EndsWhenSettled();
+    }
+    else if (hasEnded)
     {
         CurrentValue = To;
     }
@@ -79,6 +104,18 @@ bool UTweenLinearColor::Update(float pDeltaTime, float pTimeScale)
             UpdateForMaterial(material);
             break;
         }
+        case ETweenTargetType::MaterialParameterCollection:
+        {
+            UMaterialParameterCollectionInstance* collectionInstance = GetTargetParameterCollectionInstance();
+            UpdateForParameterCollection(collectionInstance);
+            break;
+        }
+        case ETweenTargetType::CustomPrimitiveData:
+        {
+            UPrimitiveComponent* primitiveComponent = Cast<UPrimitiveComponent>(mTargetObject);
+            UpdateForCustomPrimitiveData(primitiveComponent);
+            break;
+        }
         default:
         {
             break;
@@ -108,6 +145,35 @@ void UTweenLinearColor::PrepareTween()
                     ToVector   = FVector(To.R, To.G, To.B);
                     break;
                 }
+                case ETweenTargetType::MaterialParameterCollection:
+                {
+                    UMaterialParameterCollectionInstance* collectionInstance = GetTargetParameterCollectionInstance();
+
+                    if (collectionInstance != nullptr)
+                    {
+                        collectionInstance->GetVectorParameterValue(mParameterName, From);
+                    }
+
+                    FromVector = FVector(From.R, From.G, From.B);
+                    ToVector   = FVector(To.R, To.G, To.B);
+                    break;
+                }
+                case ETweenTargetType::CustomPrimitiveData:
+                {
+                    UPrimitiveComponent* primitiveComponent = Cast<UPrimitiveComponent>(mTargetObject);
+                    const TArray<float>& customData         = primitiveComponent->GetCustomPrimitiveData().Data;
+
+                    // Values that were never set are 0 on the render side too
+                    for (int32 channel = 0; channel < 4; ++channel)
+                    {
+                        int32 dataIndex = mCustomPrimitiveDataIndex + channel;
+                        From.Component(channel) = customData.IsValidIndex(dataIndex) ? customData[dataIndex] : 0.0f;
+                    }
+
+                    FromVector = FVector(From.R, From.G, From.B);
+                    ToVector   = FVector(To.R, To.G, To.B);
+                    break;
+                }
                 default:
                 {
                     break;
@@ -121,6 +187,24 @@ void UTweenLinearColor::PrepareTween()
             break;
         }
     }
+
+    // Resolving the material parameter only once, so that each update can write it by index instead of looking it up by name
+    if (mTargetType == ETweenTargetType::Material)
+    {
+        UMaterialInstanceDynamic* material = Cast<UMaterialInstanceDynamic>(mTargetObject);
+
+        if (!material->InitializeVectorParameterAndGetIndex(mParameterName, From, mParameterIndex))
+        {
+            mParameterIndex = INDEX_NONE;
+        }
+    }
+
+    // A spring starts at rest on the starting value
+    if (mSpring.IsEnabled())
+    {
+        CurrentValue    = From;
+        mSpringVelocity = FLinearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    }
 }
 
 // protected -------------------------------------------------------------------
@@ -140,6 +224,18 @@ void UTweenLinearColor::PositionAt(bool pBeginning)
                 UpdateForMaterial(material);
                 break;
             }
+            case ETweenTargetType::MaterialParameterCollection:
+            {
+                UMaterialParameterCollectionInstance* collectionInstance = GetTargetParameterCollectionInstance();
+                UpdateForParameterCollection(collectionInstance);
+                break;
+            }
+            case ETweenTargetType::CustomPrimitiveData:
+            {
+                UPrimitiveComponent* primitiveComponent = Cast<UPrimitiveComponent>(mTargetObject);
+                UpdateForCustomPrimitiveData(primitiveComponent);
+                break;
+            }
             default:
             {
                 break;
@@ -177,9 +273,28 @@ void UTweenLinearColor::Restart(bool pRestartFromEnd)
         Swap(FromVector, ToVector);
     }
 
+    if (mSpring.IsEnabled())
+    {
+        CurrentValue    = From;
+        mSpringVelocity = FLinearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    }
+
     mElapsedTime = 0.0f;
 }
 
+// protected -------------------------------------------------------------------
+void UTweenLinearColor::SaveLoopStart()
+{
+    mLoopFrom = From;
+}
+
+// protected -------------------------------------------------------------------
+void UTweenLinearColor::RestoreLoopStart()
+{
+    From       = mLoopFrom;
+    FromVector = FVector(From.R, From.G, From.B);
+}
+
 // protected -------------------------------------------------------------------
 void UTweenLinearColor::Invert(bool pShouldInvertElapsedTime)
 {
@@ -189,6 +304,28 @@ void UTweenLinearColor::Invert(bool pShouldInvertElapsedTime)
     Swap(FromVector, ToVector);
 }
 
+// public ----------------------------------------------------------------------
+bool UTweenLinearColor::IsUpdateEventBound() const
+{
+    if (TweenLatentProxy != nullptr)
+    {
+        return TweenLatentProxy->OnTweenUpdate.IsBound();
+    }
+
+    return OnTweenUpdate.IsBound() || OnTweenUpdateDelegate.IsBound();
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenLinearColor::IsEndEventBound() const
+{
+    if (TweenLatentProxy != nullptr)
+    {
+        return TweenLatentProxy->OnTweenEnd.IsBound();
+    }
+
+    return OnTweenEnd.IsBound() || OnTweenEndDelegate.IsBound();
+}
+
 // protected -------------------------------------------------------------------
 void UTweenLinearColor::BroadcastOnTweenStart()
 {
@@ -249,9 +386,49 @@ void UTweenLinearColor::BroadcastOnTweenEnd()
     }
 }
 
+// private ---------------------------------------------------------------------
+bool UTweenLinearColor::UpdateSpring(float pDeltaTime)
+{
+    FLinearColor displacement = CurrentValue - To;
+
+    mSpring.ComputeCoefficients(pDeltaTime);
+    mSpring.Step(displacement, mSpringVelocity);
+
+    bool isSettled = mSpring.IsSettled(displacement, mSpringVelocity);
+
+    CurrentValue = isSettled ? To : To + displacement;
+
+    return isSettled;
+}
+
 // private ---------------------------------------------------------------------
 void UTweenLinearColor::UpdateForMaterial(UMaterialInstanceDynamic* pTarget)
 {
+    switch (mTweenType)
+    {
+        case ETweenLinearColorType::MaterialVectorTo:
+        case ETweenLinearColorType::MaterialVectorFromTo:
+        {
+            // Written at the end of the update, together with the other parameters of the same material
+            mOwningTweenContainer->OwningTweenManager->SetMaterialVectorParameter(pTarget, mParameterName, mParameterIndex, CurrentValue);
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+void UTweenLinearColor::UpdateForParameterCollection(UMaterialParameterCollectionInstance* pTarget)
+{
+    // Null when the TweenManager has no world (e.g. in the replayer)
+    if (pTarget == nullptr)
+    {
+        return;
+    }
+
     switch (mTweenType)
     {
         case ETweenLinearColorType::MaterialVectorTo:
@@ -266,3 +443,21 @@ void UTweenLinearColor::UpdateForMaterial(UMaterialInstanceDynamic* pTarget)
         }
     }
 }
+
+// private ---------------------------------------------------------------------
+void UTweenLinearColor::UpdateForCustomPrimitiveData(UPrimitiveComponent* pTarget)
+{
+    switch (mTweenType)
+    {
+        case ETweenLinearColorType::MaterialVectorTo:
+        case ETweenLinearColorType::MaterialVectorFromTo:
+        {
+            pTarget->SetCustomPrimitiveDataVector4(mCustomPrimitiveDataIndex, FVector4(CurrentValue.R, CurrentValue.G, CurrentValue.B, CurrentValue.A));
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
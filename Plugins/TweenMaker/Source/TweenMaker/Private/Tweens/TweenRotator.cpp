@@ -7,6 +7,7 @@
 #include "Components/PrimitiveComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Utils/EaseEquations.h"
+#include "TweenContainer.h"
 
 namespace
 {
@@ -22,10 +23,20 @@ UTweenRotator::UTweenRotator(const FObjectInitializer& ObjectInitializer)
     , mTweenLatentProxy(nullptr)
     , mCurrentValue(FQuat::Identity)
     , mFrom(FQuat::Identity)
+    , mLoopFrom(FQuat::Identity)
+    , mLoopFromRotator(FRotator::ZeroRotator)
+    , bLoopGroupReversed(false)
     , mTo(FQuat::Identity)
     , mFromRotator(FRotator::ZeroRotator)
     , mToRotator(FRotator::ZeroRotator)
+    , mSpringVelocity(FVector::ZeroVector)
     , mBaseOffset(FQuat::Identity)
+    , mRotateByAxis(FVector::ZeroVector)
+    , mGroupTo(FQuat::Identity)
+    , bIsGroupReversed(false)
+    , mDestinationSocket(NAME_None)
+    , mDestinationOffset(FVector::ZeroVector)
+    , bIsDestinationReversed(false)
     , bDeleteTweenOnHit(false)
     , bDeleteTweenOnOverlap(false)
     , bHasBoundedFunctions(false)
@@ -59,6 +70,94 @@ void UTweenRotator::Init(const FRotator& pFrom,
 
     mCurrentValue = FQuat::Identity;
     mBaseOffset   = FQuat::Identity;
+
+    // A rotation around a single Euler axis is the same as an axis-angle rotation, which needs one sin/cos pair instead of three
+    mRotateByAxis = FVector::ZeroVector;
+
+    if (pTo.Pitch != 0.0f && pTo.Yaw == 0.0f && pTo.Roll == 0.0f)
+    {
+        mRotateByAxis = FVector(0.0f, -1.0f, 0.0f);
+    }
+    else if (pTo.Pitch == 0.0f && pTo.Yaw != 0.0f && pTo.Roll == 0.0f)
+    {
+        mRotateByAxis = FVector(0.0f, 0.0f, 1.0f);
+    }
+    else if (pTo.Pitch == 0.0f && pTo.Yaw == 0.0f && pTo.Roll != 0.0f)
+    {
+        mRotateByAxis = FVector(-1.0f, 0.0f, 0.0f);
+    }
+
+    mGroupMembers.Reset();
+    mGroupFrom.Reset();
+    mGroupCurrent.Reset();
+    bIsGroupReversed = false;
+
+    mDestination           = nullptr;
+    mDestinationSocket     = NAME_None;
+    mDestinationOffset     = FVector::ZeroVector;
+    bIsDestinationReversed = false;
+}
+
+// public ----------------------------------------------------------------------
+void UTweenRotator::InitDestination(USceneComponent* pDestination, FName pSocketName, const FVector& pOffset)
+{
+    if (pDestination == nullptr)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenRotator::InitDestination -> no destination was given, the target won't rotate."));
+    }
+
+    // The destination is given after the Tween was recorded, so it's recorded on its own
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenDestination(this, pDestination, pSocketName, pOffset));
+
+    mDestination       = pDestination;
+    mDestinationSocket = pSocketName;
+    mDestinationOffset = pOffset;
+}
+
+// public ----------------------------------------------------------------------
+void UTweenRotator::AddGroupMembers(const TArray<USceneComponent*>& pMembers)
+{
+    if (mTweenType != ETweenRotatorType::RotateTo || bHasPreparedTween)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenRotator::AddGroupMembers -> members can only be added to a \"RotateTo\" Tween that hasn't started yet."));
+        return;
+    }
+
+    for (USceneComponent* member : pMembers)
+    {
+        if (member != nullptr && member != mTargetObject.Get())
+        {
+            mGroupMembers.Add(member);
+        }
+    }
+}
+
+// public ----------------------------------------------------------------------
+void UTweenRotator::Retarget(FRotator pNewTo, float pNewDuration)
+{
+    if (mTweenType != ETweenRotatorType::RotateTo)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenRotator::Retarget -> only RotateTo Tweens can be retargeted, the ending value won't change."));
+        return;
+    }
+
+    // A spring has no clock: it just heads to the new ending value, keeping its velocity
+    if (RetargetClock(FVector4f(pNewTo.Pitch, pNewTo.Yaw, pNewTo.Roll, 0.0f), pNewDuration))
+    {
+        mFrom            = mCurrentValue;
+        mFromRotator     = mCurrentValue.Rotator();
+        mGroupFrom       = mGroupCurrent;
+        bIsGroupReversed = false;
+    }
+
+    mTo        = pNewTo.Quaternion();
+    mToRotator = pNewTo;
+
+    // Going backward the members head to their own rotation, so the shared one only changes going forward
+    if (!bIsGroupReversed)
+    {
+        mGroupTo = mTo;
+    }
 }
 
 // public ----------------------------------------------------------------------
@@ -68,11 +167,23 @@ bool UTweenRotator::Update(float pDeltaTime, float pTimeScale)
 
     mElapsedTime += pDeltaTime * pTimeScale * mTimeScaleAbsolute;
 
+    // The destination (or the target itself) may have moved since the last update
+    if (mTweenType == ETweenRotatorType::LookAtComponent)
+    {
+        UpdateDestination();
+    }
+
     bool hasEnded = mElapsedTime >= mTweenDuration;
 
-    if (hasEnded)
+    // A spring has no duration: it can only end when it settles on the ending value (see SetSpring)
+    if (mSpring.IsEnabled())
+    {
+        hasEnded = UpdateSpring(FMath::Abs(pDeltaTime * pTimeScale * mTimeScaleAbsolute)) && mSpring.EndsWhenSettled();
+    }
+    else if (hasEnded)
     {
         mCurrentValue = mTo;
+        UpdateGroupMembers(1.0f);
     }
     else
     {
@@ -88,7 +199,15 @@ bool UTweenRotator::Update(float pDeltaTime, float pTimeScale)
             alpha = EaseEquations::ComputeFloatEasing(mEaseType, mElapsedTime, 0, 1.0f, mTweenDuration);
         }
 
-        if (mTweenType == ETweenRotatorType::RotateBy)
+        if (mTweenType == ETweenRotatorType::RotateBy && !mRotateByAxis.IsZero())
+        {
+            // Only one of the angles is not zero, so their sum is that angle
+            float fromAngle = mFromRotator.Pitch + mFromRotator.Yaw + mFromRotator.Roll;
+            float toAngle   = mToRotator.Pitch + mToRotator.Yaw + mToRotator.Roll;
+
+            mCurrentValue = FQuat(mRotateByAxis, FMath::DegreesToRadians(FMath::Lerp(fromAngle, toAngle, alpha)));
+        }
+        else if (mTweenType == ETweenRotatorType::RotateBy)
         {
             float pitch = FMath::Lerp(mFromRotator.Pitch, mToRotator.Pitch, alpha);
             float yaw   = FMath::Lerp(mFromRotator.Yaw, mToRotator.Yaw, alpha);
@@ -112,8 +231,15 @@ bool UTweenRotator::Update(float pDeltaTime, float pTimeScale)
                     mCurrentValue = FQuat::SlerpFullPath(mFrom, mTo, alpha);
                     break;
                 }
+                case ETweenRotationMode::ShortestPathFast:
+                {
+                    mCurrentValue = Utility::FastSlerp(mFrom, mTo, alpha);
+                    break;
+                }
             }
         }
+
+        UpdateGroupMembers(alpha);
     }
 
     switch (mTargetType)
@@ -130,6 +256,11 @@ bool UTweenRotator::Update(float pDeltaTime, float pTimeScale)
             UpdateForSceneComponent(component);
             break;
         }
+        case ETweenTargetType::InstancedStaticMesh:
+        {
+            UpdateForInstance();
+            break;
+        }
         default:
         {
             break;
@@ -155,6 +286,7 @@ void UTweenRotator::PrepareTween()
     switch (mTweenType)
     {
         case ETweenRotatorType::RotateTo:
+        case ETweenRotatorType::LookAtComponent:
         {
             switch (mTargetType)
             {
@@ -204,12 +336,43 @@ void UTweenRotator::PrepareTween()
                     }
                     break;
                 }
+                case ETweenTargetType::InstancedStaticMesh:
+                {
+                    mFrom = GetTargetInstanceTransform(mTweenSpace == ETweenSpace::World).GetRotation();
+                    break;
+                }
                 default:
                 {
                     break;
                 }
             }
 
+            if (mTweenType == ETweenRotatorType::LookAtComponent)
+            {
+                // Without a valid destination the target keeps its rotation
+                mTo = mFrom;
+                UpdateDestination();
+            }
+
+            // Each member of the group starts from its own rotation
+            mGroupTo = mTo;
+            mGroupFrom.SetNum(mGroupMembers.Num());
+            mGroupCurrent.SetNum(mGroupMembers.Num());
+
+            for (int32 i = 0; i < mGroupMembers.Num(); ++i)
+            {
+                USceneComponent* member = mGroupMembers[i].Get();
+
+                if (member != nullptr)
+                {
+                    mGroupFrom[i] = mTweenSpace == ETweenSpace::World ? member->GetComponentQuat() : member->GetRelativeRotation().Quaternion();
+                }
+                else
+                {
+                    mGroupFrom[i] = FQuat::Identity;
+                }
+            }
+
             break;
         }
         case ETweenRotatorType::RotateBy:
@@ -231,6 +394,11 @@ void UTweenRotator::PrepareTween()
                     mBaseOffset = sceneComponent->GetRelativeTransform().GetRotation();
                     break;
                 }
+                case ETweenTargetType::InstancedStaticMesh:
+                {
+                    mBaseOffset = GetTargetInstanceTransform(false).GetRotation();
+                    break;
+                }
                 default:
                 {
                     break;
@@ -240,6 +408,13 @@ void UTweenRotator::PrepareTween()
             break;
         }
     }
+
+    // A spring starts at rest on the starting value
+    if (mSpring.IsEnabled())
+    {
+        mCurrentValue   = mFrom;
+        mSpringVelocity = FVector::ZeroVector;
+    }
 }
 
 // protected -------------------------------------------------------------------
@@ -248,8 +423,14 @@ void UTweenRotator::PositionAt(bool pBeginning)
     // Don't bother doing anything if the Tween has not even ever started
     if (bHasPreparedTween)
     {
+        if (mTweenType == ETweenRotatorType::LookAtComponent)
+        {
+            UpdateDestination();
+        }
+
         // Start again at the from!
         mCurrentValue = pBeginning ? mFrom : mTo;
+        UpdateGroupMembers(pBeginning ? 0.0f : 1.0f);
         
         switch (mTargetType)
         {
@@ -265,6 +446,11 @@ void UTweenRotator::PositionAt(bool pBeginning)
                 UpdateForSceneComponent(component);
                 break;
             }
+            case ETweenTargetType::InstancedStaticMesh:
+            {
+                UpdateForInstance();
+                break;
+            }
             default:
             {
                 break;
@@ -303,11 +489,37 @@ void UTweenRotator::Restart(bool pRestartFromEnd)
     {
         Swap(mFrom, mTo);
         Swap(mFromRotator, mToRotator);
+        bIsGroupReversed       = !bIsGroupReversed;
+        bIsDestinationReversed = !bIsDestinationReversed;
+    }
+
+    if (mSpring.IsEnabled())
+    {
+        mCurrentValue   = mFrom;
+        mSpringVelocity = FVector::ZeroVector;
     }
 
     mElapsedTime = 0.0f;
 }
 
+// protected -------------------------------------------------------------------
+void UTweenRotator::SaveLoopStart()
+{
+    mLoopFrom          = mFrom;
+    mLoopFromRotator   = mFromRotator;
+    mLoopGroupFrom     = mGroupFrom;
+    bLoopGroupReversed = bIsGroupReversed;
+}
+
+// protected -------------------------------------------------------------------
+void UTweenRotator::RestoreLoopStart()
+{
+    mFrom            = mLoopFrom;
+    mFromRotator     = mLoopFromRotator;
+    mGroupFrom       = mLoopGroupFrom;
+    bIsGroupReversed = bLoopGroupReversed;
+}
+
 // protected -------------------------------------------------------------------
 void UTweenRotator::Invert(bool pShouldInvertElapsedTime)
 {
@@ -315,6 +527,40 @@ void UTweenRotator::Invert(bool pShouldInvertElapsedTime)
 
     Swap(mFrom, mTo);
     Swap(mFromRotator, mToRotator);
+    bIsGroupReversed       = !bIsGroupReversed;
+    bIsDestinationReversed = !bIsDestinationReversed;
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenRotator::IsUpdateEventBound() const
+{
+    if (mTweenLatentProxy != nullptr)
+    {
+        return mTweenLatentProxy->OnTweenUpdate.IsBound();
+    }
+
+    return OnTweenUpdate.IsBound() || OnTweenUpdateDelegate.IsBound();
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenRotator::IsEndEventBound() const
+{
+    if (mTweenLatentProxy != nullptr)
+    {
+        return mTweenLatentProxy->OnTweenEnd.IsBound();
+    }
+
+    return OnTweenEnd.IsBound() || OnTweenEndDelegate.IsBound();
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenRotator::IsHitEventBound() const
+{
+    return    bDeleteTweenOnHit
+           || OnTweenActorHit.IsBound()
+           || OnTweenActorHitDelegate.IsBound()
+           || OnTweenPrimitiveComponentHit.IsBound()
+           || OnTweenPrimitiveComponentHitDelegate.IsBound();
 }
 
 // protected -------------------------------------------------------------------
@@ -383,20 +629,32 @@ void UTweenRotator::BroadcastOnTweenEnd()
 // private ---------------------------------------------------------------------
 void UTweenRotator::UpdateForActor(AActor* pTarget)
 {
+    // Visual only Tweens write the root component directly (see SetComponentRotation())
+    if (bIsVisualOnly)
+    {
+        if (USceneComponent* rootComponent = pTarget->GetRootComponent())
+        {
+            UpdateForSceneComponent(rootComponent);
+        }
+
+        return;
+    }
+
     switch (mTweenType)
     {
         case ETweenRotatorType::RotateTo:
+        case ETweenRotatorType::LookAtComponent:
         {
             switch (mTweenSpace)
             {
                 case ETweenSpace::World:
                 {
-                    pTarget->SetActorRotation(mCurrentValue.Rotator());
+                    pTarget->SetActorRotation(mCurrentValue.Rotator(), GetTeleportType());
                     break;
                 }
                 case ETweenSpace::Relative:
                 {
-                    pTarget->SetActorRelativeRotation(mCurrentValue.Rotator());
+                    pTarget->SetActorRelativeRotation(mCurrentValue.Rotator(), false, nullptr, GetTeleportType());
                     break;
                 }
                 default:
@@ -409,7 +667,7 @@ void UTweenRotator::UpdateForActor(AActor* pTarget)
         case ETweenRotatorType::RotateBy:
         {
             FQuat currentValue = mLocalSpace ? ComputeLocalSpaceQuat(mBaseOffset, mCurrentValue) : mCurrentValue;
-            pTarget->SetActorRelativeRotation(UKismetMathLibrary::ComposeRotators(mBaseOffset.Rotator(), currentValue.Rotator()));
+            pTarget->SetActorRelativeRotation(UKismetMathLibrary::ComposeRotators(mBaseOffset.Rotator(), currentValue.Rotator()), false, nullptr, GetTeleportType());
             break;
         }
         default:
@@ -425,30 +683,127 @@ void UTweenRotator::UpdateForSceneComponent(USceneComponent* pTarget)
     switch (mTweenType)
     {
         case ETweenRotatorType::RotateTo:
+        case ETweenRotatorType::LookAtComponent:
         {
-            switch (mTweenSpace)
-            {
-                case ETweenSpace::World:
-                {
-                    pTarget->SetWorldRotation(mCurrentValue.Rotator());
-                    break;
-                }
-                case ETweenSpace::Relative:
-                {
-                    pTarget->SetRelativeRotation(mCurrentValue.Rotator());
-                    break;
-                }
-                default:
-                {
-                    break;
-                }
-            }
+            SetComponentRotation(pTarget, mTweenSpace, mCurrentValue);
             break;
         }
         case ETweenRotatorType::RotateBy:
         {
             FQuat currentValue = mLocalSpace ? ComputeLocalSpaceQuat(mBaseOffset, mCurrentValue) : mCurrentValue;
-            pTarget->SetRelativeRotation(UKismetMathLibrary::ComposeRotators(mBaseOffset.Rotator(), currentValue.Rotator()));
+            SetComponentRotation(pTarget, ETweenSpace::Relative, UKismetMathLibrary::ComposeRotators(mBaseOffset.Rotator(), currentValue.Rotator()).Quaternion());
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+void UTweenRotator::UpdateForInstance()
+{
+    switch (mTweenType)
+    {
+        case ETweenRotatorType::RotateTo:
+        case ETweenRotatorType::LookAtComponent:
+        {
+            bool isWorldSpace = mTweenSpace == ETweenSpace::World;
+
+            FTransform instanceTransform = GetTargetInstanceTransform(isWorldSpace);
+            instanceTransform.SetRotation(mCurrentValue);
+            SetTargetInstanceTransform(instanceTransform, isWorldSpace);
+            break;
+        }
+        case ETweenRotatorType::RotateBy:
+        {
+            FQuat currentValue = mLocalSpace ? ComputeLocalSpaceQuat(mBaseOffset, mCurrentValue) : mCurrentValue;
+
+            FTransform instanceTransform = GetTargetInstanceTransform(false);
+            instanceTransform.SetRotation(UKismetMathLibrary::ComposeRotators(mBaseOffset.Rotator(), currentValue.Rotator()).Quaternion());
+            SetTargetInstanceTransform(instanceTransform, false);
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+bool UTweenRotator::UpdateSpring(float pDeltaTime)
+{
+    // The displacement is the rotation from the target to the current value, as its axis scaled by its angle
+    FQuat delta = mCurrentValue * mTo.Inverse();
+
+    // Both quaternions of a rotation are valid, the one with a positive W is the shortest way back to the target
+    if (delta.W < 0.0f)
+    {
+        delta = delta * -1.0f;
+    }
+
+    FVector displacement = delta.ToRotationVector();
+
+    mSpring.ComputeCoefficients(pDeltaTime);
+    mSpring.Step(displacement, mSpringVelocity);
+
+    bool isSettled = mSpring.IsSettled(displacement, mSpringVelocity);
+
+    mCurrentValue = isSettled ? mTo : FQuat::MakeFromRotationVector(displacement) * mTo;
+
+    return isSettled;
+}
+
+// private ---------------------------------------------------------------------
+void UTweenRotator::UpdateDestination()
+{
+    USceneComponent* destination = mDestination.Get();
+
+    if (destination == nullptr)
+    {
+        return;
+    }
+
+    // Both the destination and the target may be attached to components whose movement is still deferred
+    mOwningTweenContainer->OwningTweenManager->EndParentScopedMovements(destination);
+
+    switch (mTargetType)
+    {
+        case ETweenTargetType::Actor:
+        {
+            mOwningTweenContainer->OwningTweenManager->EndParentScopedMovements(Cast<AActor>(mTargetObject)->GetRootComponent());
+            break;
+        }
+        case ETweenTargetType::SceneComponent:
+        {
+            mOwningTweenContainer->OwningTweenManager->EndParentScopedMovements(Cast<USceneComponent>(mTargetObject));
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    FVector targetLocation = FVector::ZeroVector;
+
+    switch (mTargetType)
+    {
+        case ETweenTargetType::Actor:
+        {
+            targetLocation = Cast<AActor>(mTargetObject)->GetActorLocation();
+            break;
+        }
+        case ETweenTargetType::SceneComponent:
+        {
+            targetLocation = Cast<USceneComponent>(mTargetObject)->GetComponentLocation();
+            break;
+        }
+        case ETweenTargetType::InstancedStaticMesh:
+        {
+            targetLocation = GetTargetInstanceTransform(true).GetLocation();
             break;
         }
         default:
@@ -456,13 +811,97 @@ void UTweenRotator::UpdateForSceneComponent(USceneComponent* pTarget)
             break;
         }
     }
+
+    FVector direction = destination->GetSocketTransform(mDestinationSocket).TransformPosition(mDestinationOffset) - targetLocation;
+
+    // Too close to the destination to tell which way it is
+    if (direction.IsNearlyZero())
+    {
+        return;
+    }
+
+    FQuat lookAt = FRotationMatrix::MakeFromX(direction).ToQuat();
+
+    if (bIsDestinationReversed)
+    {
+        mFrom        = lookAt;
+        mFromRotator = lookAt.Rotator();
+    }
+    else
+    {
+        mTo        = lookAt;
+        mToRotator = lookAt.Rotator();
+    }
+
+    // The members of the group always head to the shared rotation
+    mGroupTo = lookAt;
+}
+
+// private ---------------------------------------------------------------------
+void UTweenRotator::UpdateGroupMembers(float pAlpha)
+{
+    if (mGroupMembers.Num() == 0)
+    {
+        return;
+    }
+
+    // The members always go from their own rotation to the shared one, so going backward just means using the opposite alpha
+    float alpha = bIsGroupReversed ? 1.0f - pAlpha : pAlpha;
+
+    switch (mRotationMode)
+    {
+        case ETweenRotationMode::ShortestPath:
+        {
+            for (int32 i = 0; i < mGroupFrom.Num(); ++i)
+            {
+                mGroupCurrent[i] = FQuat::Slerp(mGroupFrom[i], mGroupTo, alpha);
+            }
+            break;
+        }
+        case ETweenRotationMode::FullPath:
+        {
+            for (int32 i = 0; i < mGroupFrom.Num(); ++i)
+            {
+                mGroupCurrent[i] = FQuat::SlerpFullPath(mGroupFrom[i], mGroupTo, alpha);
+            }
+            break;
+        }
+        case ETweenRotationMode::ShortestPathFast:
+        {
+            Utility::FastSlerpBatch(mGroupFrom.GetData(), mGroupTo, alpha, mGroupCurrent.GetData(), mGroupFrom.Num());
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    for (int32 i = 0; i < mGroupMembers.Num(); ++i)
+    {
+        if (USceneComponent* member = mGroupMembers[i].Get())
+        {
+            // Members never sweep, so their transform updates can wait for the end of the TweenManager's update when that pays off.
+            // Visual only Tweens write them directly instead
+            if (!bIsVisualOnly)
+            {
+                mOwningTweenContainer->OwningTweenManager->BeginScopedMovement(member);
+            }
+
+            SetComponentRotation(member, mTweenSpace, mGroupCurrent[i]);
+        }
+    }
 }
 
 // private ---------------------------------------------------------------------
 void UTweenRotator::BindDelegates()
 {
-    // Proceed only if no functions were bounded yet
-    if (!bHasBoundedFunctions && mTargetObject.IsValid())
+    // Proceed only if no functions were bounded yet. Instances have no collision events of their own, and they're never swept.
+    // Visual only Tweens ignore collisions altogether
+    if (   !bHasBoundedFunctions
+        && !bIsVisualOnly
+        && mTargetObject.IsValid()
+        && mTargetType != ETweenTargetType::InstancedStaticMesh)
     {
         bool foundCorrectType = false;
 
@@ -470,6 +909,7 @@ void UTweenRotator::BindDelegates()
         {
             case ETweenRotatorType::RotateBy:
             case ETweenRotatorType::RotateTo:
+            case ETweenRotatorType::LookAtComponent:
             {
                 if (AActor* actor = Cast<AActor>(mTargetObject))
                 {
@@ -581,6 +1021,7 @@ void UTweenRotator::UnbindDelegates()
         {
             case ETweenRotatorType::RotateBy:
             case ETweenRotatorType::RotateTo:
+            case ETweenRotatorType::LookAtComponent:
             {
                 if (AActor* actor = Cast<AActor>(mTargetObject))
                 {
@@ -0,0 +1,547 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Tweens/TweenTransform.h"
+#include "TweenFactory/Latent/TweenTransformLatentFactory.h"
+#include "GameFramework/Actor.h"
+#include "Utils/Utility.h"
+#include "Components/PrimitiveComponent.h"
+#include "Utils/EaseEquations.h"
+
+// public ----------------------------------------------------------------------
+UTweenTransform::UTweenTransform(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+    , mTweenType(ETweenTransformType::TransformTo)
+    , mTweenLatentProxy(nullptr)
+    , mCurrentValue(FTransform::Identity)
+    , mFrom(FTransform::Identity)
+    , mTo(FTransform::Identity)
+    , mTweenSpace(ETweenSpace::World)
+    , mRotationMode(ETweenRotationMode::ShortestPath)
+    , bDeleteTweenOnHit(false)
+    , bDeleteTweenOnOverlap(false)
+    , bHasBoundedFunctions(false)
+{
+
+}
+
+// public ----------------------------------------------------------------------
+void UTweenTransform::Init(const FTransform& pTo,
+                           ETweenTransformType pTweenType,
+                           ETweenSpace pTweenSpace,
+                           ETweenRotationMode pRotationMode,
+                           bool pDeleteTweenOnHit,
+                           bool pDeleteTweenOnOverlap,
+                           UTweenTransformLatentFactory* pTweenLatentProxy)
+{
+    mTo                   = pTo;
+    mTweenType            = pTweenType;
+    mTweenLatentProxy     = pTweenLatentProxy;
+    mTweenSpace           = pTweenSpace;
+    mRotationMode         = pRotationMode;
+    bDeleteTweenOnHit     = pDeleteTweenOnHit;
+    bDeleteTweenOnOverlap = pDeleteTweenOnOverlap;
+    bHasBoundedFunctions  = false;
+
+    mTo.NormalizeRotation();
+
+    mFrom         = FTransform::Identity;
+    mCurrentValue = FTransform::Identity;
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenTransform::Update(float pDeltaTime, float pTimeScale)
+{
+    Super::Update(pDeltaTime, pTimeScale);
+
+    mElapsedTime += pDeltaTime * pTimeScale * mTimeScaleAbsolute;
+
+    bool hasEnded = mElapsedTime >= mTweenDuration;
+
+    if (hasEnded)
+    {
+        mCurrentValue = mTo;
+    }
+    else
+    {
+        // The easing is computed once and used for the location, the rotation and the scale
+        float alpha = 0;
+
+        if (mCurveFloat)
+        {
+            alpha = EaseEquations::ComputeCustomFloatEasing(mCurveFloat, mElapsedTime, 0, 1.0f, mTweenDuration);
+        }
+        else
+        {
+            alpha = EaseEquations::ComputeFloatEasing(mEaseType, mElapsedTime, 0, 1.0f, mTweenDuration);
+        }
+
+        FQuat rotation = FQuat::Identity;
+
+        switch (mRotationMode)
+        {
+            case ETweenRotationMode::ShortestPath:
+            {
+                rotation = FQuat::Slerp(mFrom.GetRotation(), mTo.GetRotation(), alpha);
+                break;
+            }
+            case ETweenRotationMode::FullPath:
+            {
+                rotation = FQuat::SlerpFullPath(mFrom.GetRotation(), mTo.GetRotation(), alpha);
+                break;
+            }
+            case ETweenRotationMode::ShortestPathFast:
+            {
+                rotation = Utility::FastSlerp(mFrom.GetRotation(), mTo.GetRotation(), alpha);
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        mCurrentValue.SetComponents(rotation,
+                                    FMath::Lerp(mFrom.GetLocation(), mTo.GetLocation(), alpha),
+                                    FMath::Lerp(mFrom.GetScale3D(), mTo.GetScale3D(), alpha));
+    }
+
+    ApplyCurrentValue();
+
+    return hasEnded;
+}
+
+// protected -------------------------------------------------------------------
+void UTweenTransform::PreDelay()
+{
+    Super::PreDelay();
+
+    BindDelegates();
+}
+
+// protected -------------------------------------------------------------------
+void UTweenTransform::PrepareTween()
+{
+    Super::PrepareTween();
+
+    switch (mTargetType)
+    {
+        case ETweenTargetType::Actor:
+        {
+            AActor* actor = Cast<AActor>(mTargetObject);
+
+            switch (mTweenSpace)
+            {
+                case ETweenSpace::World:
+                {
+                    mFrom = actor->GetActorTransform();
+                    break;
+                }
+                case ETweenSpace::Relative:
+                {
+                    mFrom = actor->GetRootComponent()->GetRelativeTransform();
+                    break;
+                }
+                default:
+                {
+                    break;
+                }
+            }
+            break;
+        }
+        case ETweenTargetType::SceneComponent:
+        {
+            USceneComponent* sceneComponent = Cast<USceneComponent>(mTargetObject);
+
+            switch (mTweenSpace)
+            {
+                case ETweenSpace::World:
+                {
+                    mFrom = sceneComponent->GetComponentTransform();
+                    break;
+                }
+                case ETweenSpace::Relative:
+                {
+                    mFrom = sceneComponent->GetRelativeTransform();
+                    break;
+                }
+                default:
+                {
+                    break;
+                }
+            }
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    mFrom.NormalizeRotation();
+    mCurrentValue = mFrom;
+}
+
+// protected -------------------------------------------------------------------
+void UTweenTransform::PositionAt(bool pBeginning)
+{
+    // Don't bother doing anything if the Tween has not even ever started
+    if (bHasPreparedTween)
+    {
+        mCurrentValue = pBeginning ? mFrom : mTo;
+        ApplyCurrentValue();
+    }
+}
+
+// protected -------------------------------------------------------------------
+void UTweenTransform::OnTweenDeletedInternal()
+{
+    Super::OnTweenDeletedInternal();
+
+    UnbindDelegates();
+}
+
+// protected -------------------------------------------------------------------
+void UTweenTransform::Restart(bool pRestartFromEnd)
+{
+    Super::Restart(pRestartFromEnd);
+
+    if (pRestartFromEnd)
+    {
+        Swap(mFrom, mTo);
+    }
+
+    mElapsedTime = 0.0f;
+}
+
+// protected -------------------------------------------------------------------
+void UTweenTransform::Invert(bool pShouldInvertElapsedTime)
+{
+    Super::Invert(pShouldInvertElapsedTime);
+
+    Swap(mFrom, mTo);
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenTransform::IsUpdateEventBound() const
+{
+    if (mTweenLatentProxy != nullptr)
+    {
+        return mTweenLatentProxy->OnTweenUpdate.IsBound();
+    }
+
+    return OnTweenUpdate.IsBound() || OnTweenUpdateDelegate.IsBound();
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenTransform::IsEndEventBound() const
+{
+    if (mTweenLatentProxy != nullptr)
+    {
+        return mTweenLatentProxy->OnTweenEnd.IsBound();
+    }
+
+    return OnTweenEnd.IsBound() || OnTweenEndDelegate.IsBound();
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenTransform::IsHitEventBound() const
+{
+    return    bDeleteTweenOnHit
+           || OnTweenActorHit.IsBound()
+           || OnTweenActorHitDelegate.IsBound()
+           || OnTweenPrimitiveComponentHit.IsBound()
+           || OnTweenPrimitiveComponentHitDelegate.IsBound();
+}
+
+// protected -------------------------------------------------------------------
+void UTweenTransform::BroadcastOnTweenStart()
+{
+    Super::BroadcastOnTweenStart();
+
+    if (mTweenLatentProxy != nullptr)
+    {
+        mTweenLatentProxy->OnTweenStart.Broadcast(this);
+    }
+    else
+    {
+        if (OnTweenStart.IsBound())
+        {
+            OnTweenStart.Broadcast(this);
+        }
+
+        OnTweenStartDelegate.ExecuteIfBound(this);
+    }
+
+    // Binding the OnHit/OnOverlap delegates if present
+    BindDelegates();
+}
+
+// protected -------------------------------------------------------------------
+void UTweenTransform::BroadcastOnTweenUpdate()
+{
+    Super::BroadcastOnTweenUpdate();
+
+    if (mTweenLatentProxy != nullptr)
+    {
+        mTweenLatentProxy->OnTweenUpdate.Broadcast(this);
+    }
+    else
+    {
+        if (OnTweenUpdate.IsBound())
+        {
+            OnTweenUpdate.Broadcast(this);
+        }
+
+        OnTweenUpdateDelegate.ExecuteIfBound(this);
+    }
+}
+
+// protected -------------------------------------------------------------------
+void UTweenTransform::BroadcastOnTweenEnd()
+{
+    Super::BroadcastOnTweenEnd();
+
+    if (mTweenLatentProxy != nullptr)
+    {
+        mTweenLatentProxy->OnTweenEnd.Broadcast(this);
+    }
+    else
+    {
+        if (OnTweenEnd.IsBound())
+        {
+            OnTweenEnd.Broadcast(this);
+        }
+
+        OnTweenEndDelegate.ExecuteIfBound(this);
+    }
+}
+
+// private ---------------------------------------------------------------------
+void UTweenTransform::ApplyCurrentValue()
+{
+    switch (mTargetType)
+    {
+        case ETweenTargetType::Actor:
+        {
+            AActor* actor = Cast<AActor>(mTargetObject);
+
+            // Visual only Tweens write the root component directly (see SetComponentTransform())
+            if (bIsVisualOnly)
+            {
+                if (USceneComponent* rootComponent = actor->GetRootComponent())
+                {
+                    SetComponentTransform(rootComponent, mTweenSpace, mCurrentValue, false);
+                }
+
+                break;
+            }
+
+            bool sweep = bHasBoundedFunctions && ShouldSweep();
+
+            switch (mTweenSpace)
+            {
+                case ETweenSpace::World:
+                {
+                    actor->SetActorTransform(mCurrentValue, sweep, nullptr, GetTeleportType());
+                    break;
+                }
+                case ETweenSpace::Relative:
+                {
+                    actor->SetActorRelativeTransform(mCurrentValue, sweep, nullptr, GetTeleportType());
+                    break;
+                }
+                default:
+                {
+                    break;
+                }
+            }
+            break;
+        }
+        case ETweenTargetType::SceneComponent:
+        {
+            USceneComponent* component = Cast<USceneComponent>(mTargetObject);
+            SetComponentTransform(component, mTweenSpace, mCurrentValue, bHasBoundedFunctions && ShouldSweep());
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+void UTweenTransform::BindDelegates()
+{
+    // Proceed only if no functions were bounded yet. Visual only Tweens ignore collisions altogether
+    if (   !bHasBoundedFunctions
+        && !bIsVisualOnly
+        && mTargetObject.IsValid())
+    {
+        bool foundCorrectType = false;
+
+        if (AActor* actor = Cast<AActor>(mTargetObject))
+        {
+            if (   bDeleteTweenOnOverlap
+                || OnTweenActorBeginOverlap.IsBound()
+                || OnTweenActorBeginOverlapDelegate.IsBound())
+            {
+                foundCorrectType = true;
+                actor->OnActorBeginOverlap.AddDynamic(this, &UTweenTransform::OnActorBeginOverlap);
+            }
+
+            if (   bDeleteTweenOnHit
+                || OnTweenActorHit.IsBound()
+                || OnTweenActorHitDelegate.IsBound())
+            {
+                foundCorrectType = true;
+                actor->OnActorHit.AddDynamic(this, &UTweenTransform::OnActorHit);
+            }
+        }
+        else if (UPrimitiveComponent* component = Cast<UPrimitiveComponent>(mTargetObject))
+        {
+            // I can only bind the event if the tween target is actually a UPrimitiveComponent, not just a USceneComponent
+            if (   bDeleteTweenOnOverlap
+                || OnTweenPrimitiveComponentBeginOverlap.IsBound()
+                || OnTweenPrimitiveComponentBeginOverlapDelegate.IsBound())
+            {
+                foundCorrectType = true;
+                component->OnComponentBeginOverlap.AddDynamic(this, &UTweenTransform::OnPrimitiveComponentBeginOverlap);
+            }
+
+            if (   bDeleteTweenOnHit
+                || OnTweenPrimitiveComponentHit.IsBound()
+                || OnTweenPrimitiveComponentHitDelegate.IsBound())
+            {
+                foundCorrectType = true;
+                component->OnComponentHit.AddDynamic(this, &UTweenTransform::OnPrimitiveComponentHit);
+            }
+        }
+
+        bHasBoundedFunctions = foundCorrectType;
+
+        if (   (bDeleteTweenOnOverlap || bDeleteTweenOnHit)
+            && !foundCorrectType)
+        {
+            UE_LOG(LogTweenMaker, Warning, TEXT("UTweenTransform::BindDelegates -> DeleteTweenOnHit or DeleteTweenOnOverlap was selected, but the TweenTarget "
+                                                "with name %s doesn't derive from an Actor nor a PrimitiveComponent. "
+                                                "Ignoring the selection."), *mTargetObject.Get()->GetName());
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+void UTweenTransform::UnbindDelegates()
+{
+    if (bHasBoundedFunctions)
+    {
+        if (AActor* actor = Cast<AActor>(mTargetObject))
+        {
+            actor->OnActorBeginOverlap.RemoveAll(this);
+            actor->OnActorHit.RemoveAll(this);
+        }
+        else if (UPrimitiveComponent* component = Cast<UPrimitiveComponent>(mTargetObject))
+        {
+            component->OnComponentBeginOverlap.RemoveAll(this);
+            component->OnComponentHit.RemoveAll(this);
+        }
+
+        bHasBoundedFunctions = false;
+    }
+}
+
+// private ---------------------------------------------------------------------
+void UTweenTransform::OnActorBeginOverlap(AActor* pThisActor, AActor* pOtherActor)
+{
+    if (IsTweening())
+    {
+        if (OnTweenActorBeginOverlap.IsBound())
+        {
+            OnTweenActorBeginOverlap.Broadcast(this, pThisActor, pOtherActor);
+        }
+        else if (OnTweenActorBeginOverlapDelegate.IsBound())
+        {
+            OnTweenActorBeginOverlapDelegate.Execute(this, pThisActor, pOtherActor);
+        }
+
+        if (bDeleteTweenOnOverlap)
+        {
+            DeleteTween();
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+void UTweenTransform::OnActorHit(AActor* pThisActor,
+                                 AActor* pOtherActor,
+                                 FVector pNormalImpulse,
+                                 const FHitResult& pHit)
+{
+    if (IsTweening())
+    {
+        if (OnTweenActorHit.IsBound())
+        {
+            OnTweenActorHit.Broadcast(this, pThisActor, pOtherActor, pNormalImpulse, pHit);
+        }
+        else if (OnTweenActorHitDelegate.IsBound())
+        {
+            OnTweenActorHitDelegate.Execute(this, pThisActor, pOtherActor, pNormalImpulse, pHit);
+        }
+
+        if (bDeleteTweenOnHit)
+        {
+            DeleteTween();
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+void UTweenTransform::OnPrimitiveComponentBeginOverlap(UPrimitiveComponent* pThisComponent,
+                                                       AActor* pOtherActor,
+                                                       UPrimitiveComponent* pOtherComp,
+                                                       int32 pOtherBodyIndex,
+                                                       bool bFromSweep,
+                                                       const FHitResult& pSweepResult)
+{
+    if (IsTweening())
+    {
+        if (OnTweenPrimitiveComponentBeginOverlap.IsBound())
+        {
+            OnTweenPrimitiveComponentBeginOverlap.Broadcast(this, pThisComponent, pOtherActor, pOtherComp, pSweepResult);
+        }
+        else if (OnTweenPrimitiveComponentBeginOverlapDelegate.IsBound())
+        {
+            OnTweenPrimitiveComponentBeginOverlapDelegate.Execute(this, pThisComponent, pOtherActor, pOtherComp, pSweepResult);
+        }
+
+        if (bDeleteTweenOnOverlap)
+        {
+            DeleteTween();
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+void UTweenTransform::OnPrimitiveComponentHit(UPrimitiveComponent* pThisComponent,
+                                              AActor* pOtherActor,
+                                              UPrimitiveComponent* pOtherComp,
+                                              FVector pNormalImpulse,
+                                              const FHitResult& pHitResult)
+{
+    if (IsTweening())
+    {
+        if (OnTweenPrimitiveComponentHit.IsBound())
+        {
+            OnTweenPrimitiveComponentHit.Broadcast(this, pThisComponent, pOtherActor, pOtherComp, pNormalImpulse, pHitResult);
+        }
+        else if (OnTweenPrimitiveComponentHitDelegate.IsBound())
+        {
+            OnTweenPrimitiveComponentHitDelegate.Execute(this, pThisComponent, pOtherActor, pOtherComp, pNormalImpulse, pHitResult);
+        }
+
+        if (bDeleteTweenOnHit)
+        {
+            DeleteTween();
+        }
+    }
+}
@@ -7,6 +7,14 @@
 #include "Components/PrimitiveComponent.h"
 #include "Utils/EaseEquations.h"
 #include "Curves/CurveFloat.h"
+#include "Algo/BinarySearch.h"
+#include "TweenContainer.h"
+
+namespace
+{
+    /// @brief Number of segments of the arc length table of the Bezier curves travelled at constant speed.
+    const int32 BezierArcLengthSegments = 32;
+}
 
 // public ----------------------------------------------------------------------
 UTweenVector::UTweenVector(const FObjectInitializer& ObjectInitializer)
@@ -14,7 +22,19 @@ UTweenVector::UTweenVector(const FObjectInitializer& ObjectInitializer)
     , mTweenLatentProxy(nullptr)
     , mCurrentValue(FVector(0, 0, 0))
     , mFrom(FVector(0, 0, 0))
+    , mLoopFrom(FVector(0, 0, 0))
     , mTo(FVector(0, 0, 0))
+    , mSpringVelocity(FVector(0, 0, 0))
+    , mBezierStart(FVector(0, 0, 0))
+    , mBezierControlPoint1(FVector(0, 0, 0))
+    , mBezierControlPoint2(FVector(0, 0, 0))
+    , mBezierEnd(FVector(0, 0, 0))
+    , bIsCubicBezier(false)
+    , bBezierConstantSpeed(false)
+    , bIsBezierReversed(false)
+    , mDestinationSocket(NAME_None)
+    , mDestinationOffset(FVector(0, 0, 0))
+    , bIsDestinationReversed(false)
     , bDeleteTweenOnHit(false)
     , bDeleteTweenOnOverlap(false)
     , bHasBoundedFunctions(false)
@@ -42,6 +62,86 @@ void UTweenVector::Init(const FVector& pFrom,
 
     mCurrentValue = FVector(0, 0, 0);
     mBaseOffset   = FVector(0, 0, 0);
+
+    mPropertyBinding.Reset();
+
+    bIsCubicBezier       = false;
+    bBezierConstantSpeed = false;
+    bIsBezierReversed    = false;
+    mBezierArcLengths.Reset();
+
+    mDestination           = nullptr;
+    mDestinationSocket     = NAME_None;
+    mDestinationOffset     = FVector(0, 0, 0);
+    bIsDestinationReversed = false;
+}
+
+// public ----------------------------------------------------------------------
+void UTweenVector::InitBezier(const TArray<FVector>& pControlPoints, bool pUseConstantSpeed)
+{
+    if (pControlPoints.Num() == 0)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenVector::InitBezier -> no control points were given, the Tween will move in a straight line."));
+        mTweenType = ETweenVectorType::MoveTo;
+        return;
+    }
+
+    if (pControlPoints.Num() > 2)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenVector::InitBezier -> only quadratic and cubic curves are supported, ignoring all control points after the second one."));
+    }
+
+    mBezierControlPoint1 = pControlPoints[0];
+    mBezierControlPoint2 = pControlPoints.Num() > 1 ? pControlPoints[1] : pControlPoints[0];
+    bIsCubicBezier       = pControlPoints.Num() > 1;
+    bBezierConstantSpeed = pUseConstantSpeed;
+}
+
+// public ----------------------------------------------------------------------
+void UTweenVector::InitDestination(USceneComponent* pDestination, FName pSocketName, const FVector& pOffset)
+{
+    if (pDestination == nullptr)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenVector::InitDestination -> no destination was given, the target won't move."));
+    }
+
+    // The destination is given after the Tween was recorded, so it's recorded on its own
+    TWEEN_RECORD(mOwningTweenContainer, RecordTweenDestination(this, pDestination, pSocketName, pOffset));
+
+    mDestination       = pDestination;
+    mDestinationSocket = pSocketName;
+    mDestinationOffset = pOffset;
+}
+
+// public ----------------------------------------------------------------------
+void UTweenVector::Retarget(FVector pNewTo, float pNewDuration)
+{
+    // A Bezier curve is fixed, while a destination is read again at each update anyway
+    if (mTweenType == ETweenVectorType::MoveAlongBezier || mTweenType == ETweenVectorType::MoveToComponent)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenVector::Retarget -> MoveAlongBezier and MoveToComponent Tweens can't be retargeted, the ending value won't change."));
+        return;
+    }
+
+    // A spring has no clock: it just heads to the new ending value, keeping its velocity
+    if (RetargetClock(FVector4f(FVector3f(pNewTo), 0.0f), pNewDuration))
+    {
+        mFrom = mCurrentValue;
+    }
+
+    mTo = pNewTo;
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenVector::BindProperty(const FString& pPropertyPath)
+{
+    if (mTweenType != ETweenVectorType::Custom)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenVector::BindProperty -> only Custom Tweens can be bound to a property."));
+        return false;
+    }
+
+    return mPropertyBinding.Bind(mTargetObject.Get(), pPropertyPath, FTweenPropertyBinding::EValueType::Vector);
 }
 
 // public ----------------------------------------------------------------------
@@ -51,12 +151,39 @@ bool UTweenVector::Update(float pDeltaTime, float pTimeScale)
 
     mElapsedTime += pDeltaTime * pTimeScale * mTimeScaleAbsolute;
 
+    // The destination may have moved since the last update
+    if (mTweenType == ETweenVectorType::MoveToComponent)
+    {
+        UpdateDestination();
+    }
+
     bool hasEnded = mElapsedTime >= mTweenDuration;
 
-    if (hasEnded)
+    // A spring has no duration: it can only end when it settles on the ending value (see SetSpring)
+    if (mSpring.IsEnabled())
+    {
+        hasEnded = UpdateSpring(FMath::Abs(pDeltaTime * pTimeScale * mTimeScaleAbsolute)) && mSpring.EndsWhenSettled();
+    }
+    else if (hasEnded)
     {
         mCurrentValue = mTo;
     }
+    else if (mTweenType == ETweenVectorType::MoveAlongBezier)
+    {
+        float alpha = 0;
+
+        if (mCurveFloat)
+        {
+            alpha = EaseEquations::ComputeCustomFloatEasing(mCurveFloat, mElapsedTime, 0, 1.0f, mTweenDuration);
+        }
+        else
+        {
+            alpha = EaseEquations::ComputeFloatEasing(mEaseType, mElapsedTime, 0, 1.0f, mTweenDuration);
+        }
+
+        // The curve is stored in its original direction, so going backward just means using the opposite position
+        mCurrentValue = EvaluateBezier(GetBezierParameter(bIsBezierReversed ? 1.0f - alpha : alpha));
+    }
     else
     {
         if (mCurveFloat)
@@ -83,6 +210,16 @@ bool UTweenVector::Update(float pDeltaTime, float pTimeScale)
             UpdateForSceneComponent(component);
             break;
         }
+        case ETweenTargetType::InstancedStaticMesh:
+        {
+            UpdateForInstance();
+            break;
+        }
+        case ETweenTargetType::Custom:
+        {
+            mPropertyBinding.Write(mTargetObject.Get(), mCurrentValue);
+            break;
+        }
         default:
         {
             break;
@@ -108,6 +245,8 @@ void UTweenVector::PrepareTween()
     switch (mTweenType)
     {
         case ETweenVectorType::MoveTo:
+        case ETweenVectorType::MoveAlongBezier:
+        case ETweenVectorType::MoveToComponent:
         {
             switch (mTargetType)
             {
@@ -157,12 +296,31 @@ void UTweenVector::PrepareTween()
                     }
                     break;
                 }
+                case ETweenTargetType::InstancedStaticMesh:
+                {
+                    mFrom = GetTargetInstanceTransform(mTweenSpace == ETweenSpace::World).GetLocation();
+                    break;
+                }
                 default:
                 {
                     break;
                 }
             }
 
+            if (mTweenType == ETweenVectorType::MoveAlongBezier)
+            {
+                mBezierStart      = mFrom;
+                mBezierEnd        = mTo;
+                bIsBezierReversed = false;
+                BuildBezierArcLengths();
+            }
+            else if (mTweenType == ETweenVectorType::MoveToComponent)
+            {
+                // Without a valid destination the target stays where it is
+                mTo = mFrom;
+                UpdateDestination();
+            }
+
             break;
         }
         case ETweenVectorType::MoveBy:
@@ -183,6 +341,12 @@ void UTweenVector::PrepareTween()
                     mBaseOffset = sceneComponent->GetRelativeTransform().GetLocation();
                     break;
                 }
+                case ETweenTargetType::InstancedStaticMesh:
+                {
+                    mFrom = FVector(0, 0, 0);
+                    mBaseOffset = GetTargetInstanceTransform(false).GetLocation();
+                    break;
+                }
                 default:
                 {
                     break;
@@ -241,6 +405,11 @@ void UTweenVector::PrepareTween()
                     }
                     break;
                 }
+                case ETweenTargetType::InstancedStaticMesh:
+                {
+                    mFrom = GetTargetInstanceTransform(mTweenSpace == ETweenSpace::World).GetScale3D();
+                    break;
+                }
                 default:
                 {
                     break;
@@ -267,6 +436,12 @@ void UTweenVector::PrepareTween()
                     mBaseOffset = sceneComponent->GetRelativeTransform().GetScale3D();
                     break;
                 }
+                case ETweenTargetType::InstancedStaticMesh:
+                {
+                    mFrom = FVector(0, 0, 0);
+                    mBaseOffset = GetTargetInstanceTransform(false).GetScale3D();
+                    break;
+                }
                 default:
                 {
                     break;
@@ -285,6 +460,13 @@ void UTweenVector::PrepareTween()
             break;
         }
     }
+
+    // A spring starts at rest on the starting value
+    if (mSpring.IsEnabled())
+    {
+        mCurrentValue   = mFrom;
+        mSpringVelocity = FVector(0, 0, 0);
+    }
 }
 
 // protected -------------------------------------------------------------------
@@ -293,6 +475,11 @@ void UTweenVector::PositionAt(bool pBeginning)
     // Don't bother doing anything if the Tween has not even ever started
     if (bHasPreparedTween)
     {
+        if (mTweenType == ETweenVectorType::MoveToComponent)
+        {
+            UpdateDestination();
+        }
+
         // Start again at the from!
         mCurrentValue = pBeginning ? mFrom : mTo;
 
@@ -310,6 +497,16 @@ void UTweenVector::PositionAt(bool pBeginning)
                 UpdateForSceneComponent(component);
                 break;
             }
+            case ETweenTargetType::InstancedStaticMesh:
+            {
+                UpdateForInstance();
+                break;
+            }
+            case ETweenTargetType::Custom:
+            {
+                mPropertyBinding.Write(mTargetObject.Get(), mCurrentValue);
+                break;
+            }
             default:
             {
                 break;
@@ -348,17 +545,71 @@ void UTweenVector::Restart(bool pRestartFromEnd)
     if (pRestartFromEnd)
     {
         Swap(mFrom, mTo);
+        bIsBezierReversed      = !bIsBezierReversed;
+        bIsDestinationReversed = !bIsDestinationReversed;
+    }
+
+    if (mSpring.IsEnabled())
+    {
+        mCurrentValue   = mFrom;
+        mSpringVelocity = FVector(0, 0, 0);
     }
 
     mElapsedTime = 0.0f;
 }
 
+// protected -------------------------------------------------------------------
+void UTweenVector::SaveLoopStart()
+{
+    mLoopFrom = mFrom;
+}
+
+// protected -------------------------------------------------------------------
+void UTweenVector::RestoreLoopStart()
+{
+    mFrom = mLoopFrom;
+}
+
 // protected -------------------------------------------------------------------
 void UTweenVector::Invert(bool pShouldInvertElapsedTime)
 {
     Super::Invert(pShouldInvertElapsedTime);
 
     Swap(mFrom, mTo);
+    bIsBezierReversed      = !bIsBezierReversed;
+    bIsDestinationReversed = !bIsDestinationReversed;
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenVector::IsUpdateEventBound() const
+{
+    if (mTweenLatentProxy != nullptr)
+    {
+        return mTweenLatentProxy->OnTweenUpdate.IsBound();
+    }
+
+    return OnTweenUpdate.IsBound() || OnTweenUpdateDelegate.IsBound();
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenVector::IsEndEventBound() const
+{
+    if (mTweenLatentProxy != nullptr)
+    {
+        return mTweenLatentProxy->OnTweenEnd.IsBound();
+    }
+
+    return OnTweenEnd.IsBound() || OnTweenEndDelegate.IsBound();
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenVector::IsHitEventBound() const
+{
+    return    bDeleteTweenOnHit
+           || OnTweenActorHit.IsBound()
+           || OnTweenActorHitDelegate.IsBound()
+           || OnTweenPrimitiveComponentHit.IsBound()
+           || OnTweenPrimitiveComponentHitDelegate.IsBound();
 }
 
 // protected -------------------------------------------------------------------
@@ -427,20 +678,33 @@ void UTweenVector::BroadcastOnTweenEnd()
 // private ---------------------------------------------------------------------
 void UTweenVector::UpdateForActor(AActor* pTarget)
 {
+    // Visual only Tweens write the root component directly (see SetComponentLocation())
+    if (bIsVisualOnly)
+    {
+        if (USceneComponent* rootComponent = pTarget->GetRootComponent())
+        {
+            UpdateForSceneComponent(rootComponent);
+        }
+
+        return;
+    }
+
     switch (mTweenType)
     {
         case ETweenVectorType::MoveTo:
+        case ETweenVectorType::MoveAlongBezier:
+        case ETweenVectorType::MoveToComponent:
         {
             switch (mTweenSpace)
             {
                 case ETweenSpace::World:
                 {
-                    pTarget->SetActorLocation(mCurrentValue, bHasBoundedFunctions);
+                    pTarget->SetActorLocation(mCurrentValue, bHasBoundedFunctions && ShouldSweep(), nullptr, GetTeleportType());
                     break;
                 }
                 case ETweenSpace::Relative:
                 {
-                    pTarget->SetActorRelativeLocation(mCurrentValue, bHasBoundedFunctions);
+                    pTarget->SetActorRelativeLocation(mCurrentValue, bHasBoundedFunctions && ShouldSweep(), nullptr, GetTeleportType());
                     break;
                 }
                 default:
@@ -452,7 +716,7 @@ void UTweenVector::UpdateForActor(AActor* pTarget)
         }
         case ETweenVectorType::MoveBy:
         {
-            pTarget->SetActorRelativeLocation(mCurrentValue + mBaseOffset, bHasBoundedFunctions);
+            pTarget->SetActorRelativeLocation(mCurrentValue + mBaseOffset, bHasBoundedFunctions && ShouldSweep(), nullptr, GetTeleportType());
             break;
         }
         case ETweenVectorType::ScaleTo:
@@ -499,55 +763,25 @@ void UTweenVector::UpdateForSceneComponent(USceneComponent* pTarget)
     switch (mTweenType)
     {
         case ETweenVectorType::MoveTo:
+        case ETweenVectorType::MoveAlongBezier:
+        case ETweenVectorType::MoveToComponent:
         {
-            switch (mTweenSpace)
-            {
-                case ETweenSpace::World:
-                {
-                    pTarget->SetWorldLocation(mCurrentValue);
-                    break;
-                }
-                case ETweenSpace::Relative:
-                {
-                    pTarget->SetRelativeLocation(mCurrentValue);
-                    break;
-                }
-                default:
-                {
-                    break;
-                }
-            }
+            SetComponentLocation(pTarget, mTweenSpace, mCurrentValue, false);
             break;
         }
         case ETweenVectorType::MoveBy:
         {
-            pTarget->SetRelativeLocation(mCurrentValue + mBaseOffset/*, true*/);
+            SetComponentLocation(pTarget, ETweenSpace::Relative, mCurrentValue + mBaseOffset, false);
             break;
         }
         case ETweenVectorType::ScaleTo:
         {
-            switch (mTweenSpace)
-            {
-                case ETweenSpace::World:
-                {
-                    pTarget->SetWorldScale3D(mCurrentValue);
-                    break;
-                }
-                case ETweenSpace::Relative:
-                {
-                    pTarget->SetRelativeScale3D(mCurrentValue);
-                    break;
-                }
-                default:
-                {
-                    break;
-                }
-            }
+            SetComponentScale(pTarget, mTweenSpace, mCurrentValue);
             break;
         }
         case ETweenVectorType::ScaleBy:
         {
-            pTarget->SetRelativeScale3D(mCurrentValue + mBaseOffset);
+            SetComponentScale(pTarget, ETweenSpace::Relative, mCurrentValue + mBaseOffset);
             break;
         }
         case ETweenVectorType::Custom:
@@ -562,10 +796,181 @@ void UTweenVector::UpdateForSceneComponent(USceneComponent* pTarget)
     }
 }
 
+// private ---------------------------------------------------------------------
+void UTweenVector::UpdateForInstance()
+{
+    switch (mTweenType)
+    {
+        case ETweenVectorType::MoveTo:
+        case ETweenVectorType::MoveToComponent:
+        {
+            bool isWorldSpace = mTweenSpace == ETweenSpace::World;
+
+            FTransform instanceTransform = GetTargetInstanceTransform(isWorldSpace);
+            instanceTransform.SetLocation(mCurrentValue);
+            SetTargetInstanceTransform(instanceTransform, isWorldSpace);
+            break;
+        }
+        case ETweenVectorType::MoveBy:
+        {
+            FTransform instanceTransform = GetTargetInstanceTransform(false);
+            instanceTransform.SetLocation(mCurrentValue + mBaseOffset);
+            SetTargetInstanceTransform(instanceTransform, false);
+            break;
+        }
+        case ETweenVectorType::ScaleTo:
+        {
+            bool isWorldSpace = mTweenSpace == ETweenSpace::World;
+
+            FTransform instanceTransform = GetTargetInstanceTransform(isWorldSpace);
+            instanceTransform.SetScale3D(mCurrentValue);
+            SetTargetInstanceTransform(instanceTransform, isWorldSpace);
+            break;
+        }
+        case ETweenVectorType::ScaleBy:
+        {
+            FTransform instanceTransform = GetTargetInstanceTransform(false);
+            instanceTransform.SetScale3D(mCurrentValue + mBaseOffset);
+            SetTargetInstanceTransform(instanceTransform, false);
+            break;
+        }
+        case ETweenVectorType::Custom:
+        {
+            // Does nothing
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+bool UTweenVector::UpdateSpring(float pDeltaTime)
+{
+    FVector displacement = mCurrentValue - mTo;
+
+    // The coefficients are computed once and shared by the three components
+    mSpring.ComputeCoefficients(pDeltaTime);
+    mSpring.Step(displacement, mSpringVelocity);
+
+    bool isSettled = mSpring.IsSettled(displacement, mSpringVelocity);
+
+    mCurrentValue = isSettled ? mTo : mTo + displacement;
+
+    return isSettled;
+}
+
+// private ---------------------------------------------------------------------
+void UTweenVector::UpdateDestination()
+{
+    USceneComponent* destination = mDestination.Get();
+
+    if (destination == nullptr)
+    {
+        return;
+    }
+
+    // The destination (or its socket) may be attached to a component whose movement is still deferred
+    mOwningTweenContainer->OwningTweenManager->EndParentScopedMovements(destination);
+
+    FVector destinationLocation = destination->GetSocketTransform(mDestinationSocket).TransformPosition(mDestinationOffset);
+
+    if (bIsDestinationReversed)
+    {
+        mFrom = destinationLocation;
+    }
+    else
+    {
+        mTo = destinationLocation;
+    }
+}
+
+// private ---------------------------------------------------------------------
+FVector UTweenVector::EvaluateBezier(float pParameter) const
+{
+    float t = pParameter;
+    float u = 1.0f - t;
+
+    if (bIsCubicBezier)
+    {
+        return          u * u * u * mBezierStart
+               + 3.0f * u * u * t * mBezierControlPoint1
+               + 3.0f * u * t * t * mBezierControlPoint2
+               +        t * t * t * mBezierEnd;
+    }
+
+    return        u * u * mBezierStart
+           + 2.0f * u * t * mBezierControlPoint1
+           +        t * t * mBezierEnd;
+}
+
+// private ---------------------------------------------------------------------
+float UTweenVector::GetBezierParameter(float pPosition) const
+{
+    if (mBezierArcLengths.Num() == 0)
+    {
+        return pPosition;
+    }
+
+    // Finding the segment of the table that contains the position, then interpolating inside it. Like in the other mode, a position
+    // outside [0, 1] (e.g. with the "Back" or "Elastic" eases) isn't clamped: it's extrapolated from the first or last segment
+    int32 numSegments = mBezierArcLengths.Num() - 1;
+    int32 index       = FMath::Clamp(Algo::UpperBound(mBezierArcLengths, pPosition) - 1, 0, numSegments - 1);
+
+    float segmentLength = mBezierArcLengths[index + 1] - mBezierArcLengths[index];
+    float segmentAlpha  = segmentLength > KINDA_SMALL_NUMBER ? (pPosition - mBezierArcLengths[index]) / segmentLength : 0.0f;
+
+    return (index + segmentAlpha) / numSegments;
+}
+
+// private ---------------------------------------------------------------------
+void UTweenVector::BuildBezierArcLengths()
+{
+    mBezierArcLengths.Reset();
+
+    if (!bBezierConstantSpeed)
+    {
+        return;
+    }
+
+    mBezierArcLengths.SetNumUninitialized(BezierArcLengthSegments + 1);
+    mBezierArcLengths[0] = 0.0f;
+
+    FVector previousPoint = mBezierStart;
+
+    for (int32 i = 1; i <= BezierArcLengthSegments; ++i)
+    {
+        FVector point = EvaluateBezier(static_cast<float>(i) / BezierArcLengthSegments);
+
+        mBezierArcLengths[i] = mBezierArcLengths[i - 1] + FVector::Dist(previousPoint, point);
+        previousPoint        = point;
+    }
+
+    float totalLength = mBezierArcLengths.Last();
+
+    // A curve with no length has nothing to reparameterize
+    if (totalLength <= KINDA_SMALL_NUMBER)
+    {
+        mBezierArcLengths.Reset();
+        return;
+    }
+
+    for (float& arcLength : mBezierArcLengths)
+    {
+        arcLength /= totalLength;
+    }
+}
+
 // private ---------------------------------------------------------------------
 void UTweenVector::BindDelegates()
 {
-    if (!bHasBoundedFunctions && mTargetObject.IsValid())
+    // Instances have no collision events of their own, and they're never swept. Visual only Tweens ignore collisions altogether
+    if (   !bHasBoundedFunctions
+        && !bIsVisualOnly
+        && mTargetObject.IsValid()
+        && mTargetType != ETweenTargetType::InstancedStaticMesh)
     {
         bool foundCorrectType = false;
 
@@ -573,6 +978,8 @@ void UTweenVector::BindDelegates()
         {
             case ETweenVectorType::MoveTo:
             case ETweenVectorType::MoveBy:
+            case ETweenVectorType::MoveAlongBezier:
+            case ETweenVectorType::MoveToComponent:
             case ETweenVectorType::ScaleTo:
             case ETweenVectorType::ScaleBy:
             case ETweenVectorType::Custom:
@@ -687,6 +1094,8 @@ void UTweenVector::UnbindDelegates()
         {
             case ETweenVectorType::MoveTo:
             case ETweenVectorType::MoveBy:
+            case ETweenVectorType::MoveAlongBezier:
+            case ETweenVectorType::MoveToComponent:
             case ETweenVectorType::ScaleTo:
             case ETweenVectorType::ScaleBy:
             case ETweenVectorType::Custom:
@@ -6,6 +6,7 @@
 #include "Utils/Utility.h"
 #include "Components/Widget.h"
 #include "Utils/EaseEquations.h"
+#include "TweenContainer.h"
 
 // public ----------------------------------------------------------------------
 UTweenVector2D::UTweenVector2D(const FObjectInitializer& ObjectInitializer)
@@ -13,6 +14,7 @@ UTweenVector2D::UTweenVector2D(const FObjectInitializer& ObjectInitializer)
     , mTweenLatentProxy(nullptr)
     , mCurrentValue(FVector2D(0, 0))
     , mFrom(FVector2D(0, 0))
+    , mLoopFrom(FVector2D(0, 0))
     , mTo(FVector2D(0, 0))
 {
 
@@ -31,6 +33,31 @@ void UTweenVector2D::Init(const FVector2D& pFrom,
 
     mCurrentValue = FVector2D(0, 0);
     mBaseOffset   = FVector2D(0, 0);
+
+    mPropertyBinding.Reset();
+}
+
+// public ----------------------------------------------------------------------
+void UTweenVector2D::Retarget(FVector2D pNewTo, float pNewDuration)
+{
+    if (RetargetClock(FVector4f(pNewTo.X, pNewTo.Y, 0.0f, 0.0f), pNewDuration))
+    {
+        mFrom = mCurrentValue;
+    }
+
+    mTo = pNewTo;
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenVector2D::BindProperty(const FString& pPropertyPath)
+{
+    if (mTweenType != ETweenVector2DType::Custom)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("UTweenVector2D::BindProperty -> only Custom Tweens can be bound to a property."));
+        return false;
+    }
+
+    return mPropertyBinding.Bind(mTargetObject.Get(), pPropertyPath, FTweenPropertyBinding::EValueType::Vector2D);
 }
 
 // public ----------------------------------------------------------------------
@@ -68,6 +95,7 @@ bool UTweenVector2D::Update(float pDeltaTime, float pTimeScale)
         }
         case ETweenTargetType::Custom:
         {
+            mPropertyBinding.Write(mTargetObject.Get(), mCurrentValue);
             break;
         }
         default:
@@ -93,7 +121,7 @@ void UTweenVector2D::PrepareTween()
                 case ETweenTargetType::UMG:
                 {
                     UWidget* widget = Cast<UWidget>(mTargetObject);
-                    mFrom = widget->RenderTransform.Translation;
+                    mFrom = mOwningTweenContainer->OwningTweenManager->GetWidgetProperty(widget, ETweenWidgetProperty::Translation);
                     break;
                 }
                 default:
@@ -112,7 +140,7 @@ void UTweenVector2D::PrepareTween()
                 {
                     UWidget* widget = Cast<UWidget>(mTargetObject);
                     mFrom = FVector2D(0, 0);
-                    mBaseOffset = widget->RenderTransform.Translation;;
+                    mBaseOffset = mOwningTweenContainer->OwningTweenManager->GetWidgetProperty(widget, ETweenWidgetProperty::Translation);
                     break;
                 }
                 default:
@@ -130,7 +158,7 @@ void UTweenVector2D::PrepareTween()
                 case ETweenTargetType::UMG:
                 {
                     UWidget* widget = Cast<UWidget>(mTargetObject);
-                    mFrom = widget->RenderTransform.Scale;
+                    mFrom = mOwningTweenContainer->OwningTweenManager->GetWidgetProperty(widget, ETweenWidgetProperty::Scale);
                     break;
                 }
                 default:
@@ -149,7 +177,7 @@ void UTweenVector2D::PrepareTween()
                 {
                     UWidget* widget = Cast<UWidget>(mTargetObject);
                     mFrom = FVector2D(0, 0);
-                    mBaseOffset = widget->RenderTransform.Scale;
+                    mBaseOffset = mOwningTweenContainer->OwningTweenManager->GetWidgetProperty(widget, ETweenWidgetProperty::Scale);
                     break;
                 }
                 default:
@@ -167,7 +195,7 @@ void UTweenVector2D::PrepareTween()
                 case ETweenTargetType::UMG:
                 {
                     UWidget* widget = Cast<UWidget>(mTargetObject);
-                    mFrom = widget->RenderTransform.Shear;
+                    mFrom = mOwningTweenContainer->OwningTweenManager->GetWidgetProperty(widget, ETweenWidgetProperty::Shear);
                     break;
                 }
                 default:
@@ -210,6 +238,7 @@ void UTweenVector2D::PositionAt(bool pBeginning)
             }
             case ETweenTargetType::Custom:
             {
+                mPropertyBinding.Write(mTargetObject.Get(), mCurrentValue);
                 break;
             }
             default:
@@ -251,6 +280,18 @@ void UTweenVector2D::Restart(bool pRestartFromEnd)
     mElapsedTime = 0.0f;
 }
 
+// protected -------------------------------------------------------------------
+void UTweenVector2D::SaveLoopStart()
+{
+    mLoopFrom = mFrom;
+}
+
+// protected -------------------------------------------------------------------
+void UTweenVector2D::RestoreLoopStart()
+{
+    mFrom = mLoopFrom;
+}
+
 // protected -------------------------------------------------------------------
 void UTweenVector2D::Invert(bool pShouldInvertElapsedTime)
 {
@@ -259,6 +300,28 @@ void UTweenVector2D::Invert(bool pShouldInvertElapsedTime)
     Swap(mFrom, mTo);
 }
 
+// public ----------------------------------------------------------------------
+bool UTweenVector2D::IsUpdateEventBound() const
+{
+    if (mTweenLatentProxy != nullptr)
+    {
+        return mTweenLatentProxy->OnTweenUpdate.IsBound();
+    }
+
+    return OnTweenUpdate.IsBound() || OnTweenUpdateDelegate.IsBound();
+}
+
+// public ----------------------------------------------------------------------
+bool UTweenVector2D::IsEndEventBound() const
+{
+    if (mTweenLatentProxy != nullptr)
+    {
+        return mTweenLatentProxy->OnTweenEnd.IsBound();
+    }
+
+    return OnTweenEnd.IsBound() || OnTweenEndDelegate.IsBound();
+}
+
 // protected -------------------------------------------------------------------
 void UTweenVector2D::BroadcastOnTweenStart()
 {
@@ -322,31 +385,34 @@ void UTweenVector2D::BroadcastOnTweenEnd()
 // private ---------------------------------------------------------------------
 void UTweenVector2D::UpdateForWidget(UWidget* pTarget)
 {
+    // The render transform is written in the widget at the end of the update, together with the changes of the other Tweens on it
+    UTweenManagerComponent* tweenManager = mOwningTweenContainer->OwningTweenManager;
+
     switch (mTweenType)
     {
         case ETweenVector2DType::MoveTo:
         {
-            pTarget->SetRenderTranslation(mCurrentValue);
+            tweenManager->SetWidgetProperty(pTarget, ETweenWidgetProperty::Translation, mCurrentValue);
             break;
         }
         case ETweenVector2DType::MoveBy:
         {
-            pTarget->SetRenderTranslation(mCurrentValue + mBaseOffset);
+            tweenManager->SetWidgetProperty(pTarget, ETweenWidgetProperty::Translation, mCurrentValue + mBaseOffset);
             break;
         }
         case ETweenVector2DType::ScaleTo:
         {
-            pTarget->SetRenderScale(mCurrentValue);
+            tweenManager->SetWidgetProperty(pTarget, ETweenWidgetProperty::Scale, mCurrentValue);
             break;
         }
         case ETweenVector2DType::ScaleBy:
         {
-            pTarget->SetRenderScale(mCurrentValue + mBaseOffset);
+            tweenManager->SetWidgetProperty(pTarget, ETweenWidgetProperty::Scale, mCurrentValue + mBaseOffset);
             break;
         }
         case ETweenVector2DType::ShearTo:
         {
-            pTarget->SetRenderShear(mCurrentValue);
+            tweenManager->SetWidgetProperty(pTarget, ETweenWidgetProperty::Shear, mCurrentValue);
             break;
         }
         case ETweenVector2DType::Custom:
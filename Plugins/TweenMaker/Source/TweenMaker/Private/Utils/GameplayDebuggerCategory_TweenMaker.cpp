@@ -0,0 +1,403 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Utils/GameplayDebuggerCategory_TweenMaker.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "Tweens/BaseTween.h"
+#include "Tweens/TweenFloat.h"
+#include "Utils/Utility.h"
+#include "TweenContainer.h"
+#include "TweenManagerComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/SplineComponent.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+    /// @brief Maximum number of TweenContainers listed in the global section (the ones of the selected actor are always listed).
+    const int32 MaxGlobalContainers = 10;
+
+    /// @brief Maximum number of Tween paths drawn in the world.
+    const int32 MaxPathShapes = 32;
+
+    template<typename EnumType>
+    FString GetEnumValueName(EnumType pValue)
+    {
+        return StaticEnum<EnumType>()->GetNameStringByValue(static_cast<int64>(pValue));
+    }
+
+    /**
+     * @brief Returns the component whose transform is used as reference by a Tween that works in relative space, if any.
+     */
+    const USceneComponent* GetRelativeSpaceParent(const UObject* pTarget)
+    {
+        const USceneComponent* sceneComponent = Cast<USceneComponent>(pTarget);
+
+        if (const AActor* actor = Cast<AActor>(pTarget))
+        {
+            sceneComponent = actor->GetRootComponent();
+        }
+
+        return sceneComponent != nullptr ? sceneComponent->GetAttachParent() : nullptr;
+    }
+}
+
+// public ----------------------------------------------------------------------
+FGameplayDebuggerCategory_TweenMaker::FRepData::FContainerData::FContainerData()
+    : CostMs(0.0f)
+    , bIsSelected(false)
+{
+
+}
+
+// public ----------------------------------------------------------------------
+FGameplayDebuggerCategory_TweenMaker::FRepData::FRepData()
+    : NumManagers(0)
+    , NumContainers(0)
+    , NumTweens(0)
+    , TotalCostMs(0.0f)
+    , FlushCostMs(0.0f)
+{
+
+}
+
+// public ----------------------------------------------------------------------
+void FGameplayDebuggerCategory_TweenMaker::FRepData::Serialize(FArchive& Ar)
+{
+    Ar << NumManagers << NumContainers << NumTweens << TotalCostMs << FlushCostMs;
+
+    int32 numContainers = Containers.Num();
+    Ar << numContainers;
+
+    if (Ar.IsLoading())
+    {
+        Containers.SetNum(numContainers);
+    }
+
+    for (FContainerData& containerData : Containers)
+    {
+        Ar << containerData.Description << containerData.CostMs << containerData.bIsSelected << containerData.Tweens;
+    }
+}
+
+// public ----------------------------------------------------------------------
+FGameplayDebuggerCategory_TweenMaker::FGameplayDebuggerCategory_TweenMaker()
+    : mNumPathShapes(0)
+{
+    bShowOnlyWithDebugActor = false;
+    CollectDataInterval     = 0.2f;
+
+    SetDataPackReplication<FRepData>(&DataPack);
+}
+
+// static public ---------------------------------------------------------------
+TSharedRef<FGameplayDebuggerCategory> FGameplayDebuggerCategory_TweenMaker::MakeInstance()
+{
+    return MakeShareable(new FGameplayDebuggerCategory_TweenMaker());
+}
+
+// public ----------------------------------------------------------------------
+void FGameplayDebuggerCategory_TweenMaker::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
+{
+    DataPack       = FRepData();
+    mNumPathShapes = 0;
+
+    UWorld* world = OwnerPC != nullptr ? OwnerPC->GetWorld() : nullptr;
+
+    if (world == nullptr)
+    {
+        return;
+    }
+
+    for (TObjectIterator<UTweenManagerComponent> it; it; ++it)
+    {
+        UTweenManagerComponent* tweenManager = *it;
+
+        if (!IsValid(tweenManager) || tweenManager->GetWorld() != world)
+        {
+            continue;
+        }
+
+        // The costs are measured only while someone is looking at them
+        tweenManager->RequestCostTracking();
+
+        DataPack.NumManagers++;
+        DataPack.TotalCostMs += tweenManager->GetLastUpdateCost() * 1000.0f;
+        DataPack.FlushCostMs += tweenManager->GetLastFlushCost() * 1000.0f;
+
+        for (const UTweenContainer* tweenContainer : tweenManager->mTweenContainers)
+        {
+            if (tweenContainer != nullptr && !tweenContainer->IsPendingDeletion())
+            {
+                CollectContainerData(tweenContainer, DebugActor);
+            }
+        }
+    }
+
+    // Selected TweenContainers first, then the most expensive ones
+    DataPack.Containers.Sort([](const FRepData::FContainerData& pA, const FRepData::FContainerData& pB)
+    {
+        if (pA.bIsSelected != pB.bIsSelected)
+        {
+            return pA.bIsSelected;
+        }
+
+        return pA.CostMs > pB.CostMs;
+    });
+
+    int32 numGlobalContainers = 0;
+
+    for (int32 i = 0; i < DataPack.Containers.Num(); ++i)
+    {
+        if (!DataPack.Containers[i].bIsSelected && ++numGlobalContainers > MaxGlobalContainers)
+        {
+            DataPack.Containers.SetNum(i);
+            break;
+        }
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FGameplayDebuggerCategory_TweenMaker::DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext)
+{
+    CanvasContext.Printf(TEXT("TweenManagers: {yellow}%d{white}  TweenContainers: {yellow}%d{white}  Tweens: {yellow}%d{white}  Update cost: {yellow}%.3f ms"),
+                         DataPack.NumManagers,
+                         DataPack.NumContainers,
+                         DataPack.NumTweens,
+                         DataPack.TotalCostMs);
+
+    // The deferred writes are applied for all TweenContainers at once, so they're not part of any of their costs
+    CanvasContext.Printf(TEXT("Deferred movement flush: {yellow}%.3f ms"), DataPack.FlushCostMs);
+
+    bool hasPrintedGlobalHeader = false;
+
+    if (DataPack.Containers.Num() > 0 && DataPack.Containers[0].bIsSelected)
+    {
+        CanvasContext.Printf(TEXT("{green}Selected actor:"));
+    }
+
+    for (const FRepData::FContainerData& containerData : DataPack.Containers)
+    {
+        if (!containerData.bIsSelected && !hasPrintedGlobalHeader)
+        {
+            CanvasContext.Printf(TEXT("{green}Most expensive TweenContainers:"));
+            hasPrintedGlobalHeader = true;
+        }
+
+        CanvasContext.Printf(TEXT("  {white}%s | %s%.3f ms"),
+                             *containerData.Description,
+                             containerData.CostMs >= 0.1f ? TEXT("{red}") : TEXT("{yellow}"),
+                             containerData.CostMs);
+
+        for (const FString& tweenDescription : containerData.Tweens)
+        {
+            CanvasContext.Printf(TEXT("    {grey}%s"), *tweenDescription);
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+void FGameplayDebuggerCategory_TweenMaker::CollectContainerData(const UTweenContainer* pTweenContainer, const AActor* pDebugActor)
+{
+    FRepData::FContainerData containerData;
+
+    const UTweenManagerComponent* tweenManager = pTweenContainer->OwningTweenManager;
+    containerData.bIsSelected                  = pDebugActor != nullptr && tweenManager != nullptr && tweenManager->GetOwner() == pDebugActor;
+
+    int32 numTweens = 0;
+
+    for (int32 sequenceIndex = 0; sequenceIndex < pTweenContainer->mSequences.Num(); ++sequenceIndex)
+    {
+        for (const UBaseTween* tween : pTweenContainer->mSequences[sequenceIndex].ParallelTweens)
+        {
+            if (tween == nullptr)
+            {
+                continue;
+            }
+
+            numTweens++;
+
+            if (pDebugActor != nullptr && IsTweenTargetingActor(tween, pDebugActor))
+            {
+                containerData.bIsSelected = true;
+            }
+
+            if (sequenceIndex == pTweenContainer->mCurrentIndex && tween->IsTweening())
+            {
+                AddTweenPathShapes(tween);
+            }
+        }
+    }
+
+    if (containerData.bIsSelected)
+    {
+        for (int32 sequenceIndex = 0; sequenceIndex < pTweenContainer->mSequences.Num(); ++sequenceIndex)
+        {
+            for (const UBaseTween* tween : pTweenContainer->mSequences[sequenceIndex].ParallelTweens)
+            {
+                if (tween != nullptr)
+                {
+                    containerData.Tweens.Add(FString::Printf(TEXT("%s[%d] %s"),
+                                                             sequenceIndex == pTweenContainer->mCurrentIndex ? TEXT("> ") : TEXT("  "),
+                                                             sequenceIndex,
+                                                             *DescribeTween(tween)));
+                }
+            }
+        }
+    }
+
+    FString loopsDescription = pTweenContainer->mNumLoops <= 0 ? FString(TEXT("inf")) : FString::FromInt(pTweenContainer->mNumLoops);
+
+    containerData.CostMs      = pTweenContainer->GetLastUpdateCost() * 1000.0f;
+    containerData.Description = FString::Printf(TEXT("%s | seq %d/%d | loop %d/%s %s | x%.2f%s%s"),
+                                                tweenManager != nullptr ? *GetNameSafe(tweenManager->GetOwner()) : TEXT("None"),
+                                                pTweenContainer->mCurrentIndex + 1,
+                                                pTweenContainer->mSequences.Num(),
+                                                pTweenContainer->mLoopCounter + 1,
+                                                *loopsDescription,
+                                                *GetEnumValueName(pTweenContainer->mLoopType),
+                                                pTweenContainer->mTimeScale,
+                                                pTweenContainer->IsPaused() ? TEXT(" | paused") : TEXT(""),
+                                                pTweenContainer->bIsPersistent ? TEXT(" | persistent") : TEXT(""));
+
+    DataPack.NumContainers++;
+    DataPack.NumTweens += numTweens;
+    DataPack.Containers.Add(containerData);
+}
+
+// private ---------------------------------------------------------------------
+void FGameplayDebuggerCategory_TweenMaker::AddTweenPathShapes(const UBaseTween* pTween)
+{
+    const UTweenFloat* tweenFloat = Cast<UTweenFloat>(pTween);
+
+    if (tweenFloat == nullptr || !tweenFloat->bHasPreparedTween || mNumPathShapes >= MaxPathShapes)
+    {
+        return;
+    }
+
+    switch (tweenFloat->mTweenType)
+    {
+        case ETweenFloatType::RotateAroundPoint:
+        {
+            // The arc is drawn with the same closed form the Tween evaluates, from the angle travelled since the reference angle
+            FTransform spaceTransform     = FTransform::Identity;
+            const USceneComponent* parent = GetRelativeSpaceParent(tweenFloat->GetTweenTarget());
+
+            if (tweenFloat->mTweenSpace == ETweenSpace::Relative && parent != nullptr)
+            {
+                spaceTransform = parent->GetComponentTransform();
+            }
+
+            float arcAngle  = tweenFloat->mTo - tweenFloat->mFrom;
+            int32 numPoints = FMath::Clamp(FMath::CeilToInt(FMath::Abs(arcAngle) / 10.0f), 4, 72);
+
+            FVector pivotPoint = spaceTransform.TransformPosition(tweenFloat->mPivotPoint);
+            FVector previousPoint;
+
+            for (int32 i = 0; i <= numPoints; ++i)
+            {
+                float angle  = tweenFloat->mFrom + arcAngle * i / numPoints - tweenFloat->mOrbitReferenceAngle;
+                float sine   = 0.0f;
+                float cosine = 0.0f;
+                FMath::SinCos(&sine, &cosine, FMath::DegreesToRadians(angle));
+
+                FVector point = spaceTransform.TransformPosition(tweenFloat->mOrbitCenter + tweenFloat->mOrbitAxisU * cosine + tweenFloat->mOrbitAxisV * sine);
+
+                if (i > 0)
+                {
+                    AddShape(FGameplayDebuggerShape::MakeSegment(previousPoint, point, 2.0f, FColor::Cyan));
+                }
+
+                previousPoint = point;
+            }
+
+            AddShape(FGameplayDebuggerShape::MakePoint(pivotPoint, 8.0f, FColor::Cyan, GetNameSafe(tweenFloat->GetTweenTarget())));
+            mNumPathShapes++;
+            break;
+        }
+        case ETweenFloatType::FollowSpline:
+        {
+            const USplineComponent* spline = tweenFloat->mSpline;
+
+            if (spline != nullptr)
+            {
+                float splineLength = spline->GetSplineLength();
+                int32 numPoints    = FMath::Clamp(FMath::CeilToInt(splineLength / 50.0f), 8, 128);
+                FVector previousPoint;
+
+                for (int32 i = 0; i <= numPoints; ++i)
+                {
+                    FVector point = spline->GetLocationAtDistanceAlongSpline(splineLength * i / numPoints, ESplineCoordinateSpace::World);
+
+                    if (i > 0)
+                    {
+                        AddShape(FGameplayDebuggerShape::MakeSegment(previousPoint, point, 2.0f, FColor::Orange));
+                    }
+
+                    previousPoint = point;
+                }
+
+                FVector currentLocation = spline->GetLocationAtTime(tweenFloat->mCurrentValue, ESplineCoordinateSpace::World, tweenFloat->bUseConstantSpeed);
+                AddShape(FGameplayDebuggerShape::MakePoint(currentLocation, 8.0f, FColor::Orange, GetNameSafe(tweenFloat->GetTweenTarget())));
+                mNumPathShapes++;
+            }
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// static private --------------------------------------------------------------
+FString FGameplayDebuggerCategory_TweenMaker::DescribeTween(const UBaseTween* pTween)
+{
+    float progress = pTween->mTweenDuration > 0.0f ? FMath::Clamp(pTween->mElapsedTime / pTween->mTweenDuration, 0.0f, 1.0f) : 1.0f;
+
+    FString state;
+
+    if (pTween->bIsTweenDone)
+    {
+        state = TEXT("done");
+    }
+    else if (pTween->bIsTweenPaused)
+    {
+        state = TEXT("paused");
+    }
+    else if (pTween->mDelayElapsedTime < pTween->mDelay)
+    {
+        state = FString::Printf(TEXT("delay %.2fs"), pTween->mDelay - pTween->mDelayElapsedTime);
+    }
+    else
+    {
+        state = FString::Printf(TEXT("%3.0f%%"), progress * 100.0f);
+    }
+
+    return FString::Printf(TEXT("%s | %s %s | %s | %s%s"),
+                           *Utility::GetTweenTypeName(pTween),
+                           *GetEnumValueName(pTween->mTargetType),
+                           *GetNameSafe(pTween->GetTweenTarget()),
+                           *state,
+                           *GetEnumValueName(pTween->mEaseType),
+                           pTween->IsSweeping() ? TEXT(" | sweep") : TEXT(""));
+}
+
+// static private --------------------------------------------------------------
+bool FGameplayDebuggerCategory_TweenMaker::IsTweenTargetingActor(const UBaseTween* pTween, const AActor* pActor)
+{
+    const UObject* target = pTween->GetTweenTarget();
+
+    if (target == pActor)
+    {
+        return true;
+    }
+
+    const UActorComponent* actorComponent = Cast<UActorComponent>(target);
+    return actorComponent != nullptr && actorComponent->GetOwner() == pActor;
+}
+
+#endif // WITH_GAMEPLAY_DEBUGGER
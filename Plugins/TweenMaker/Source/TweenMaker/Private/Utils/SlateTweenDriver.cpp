@@ -0,0 +1,417 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Utils/SlateTweenDriver.h"
+#include "Utils/EaseEquations.h"
+#include "Widgets/SWidget.h"
+#include "Slate/WidgetTransform.h"
+
+TUniquePtr<FSlateTweenDriver> FSlateTweenDriver::sInstance;
+
+namespace
+{
+    /**
+     * Splits a render transform into the properties of a FWidgetTransform, which builds its matrix as Scale * Shear * Rotation.
+     * The matrix has one degree of freedom less than those properties, so the shear is all put on the X axis: the result may differ
+     * from the properties the widget was given, but it always rebuilds the same render transform.
+     */
+    FWidgetTransform DecomposeRenderTransform(const FSlateRenderTransform& pRenderTransform)
+    {
+        float a, b, c, d;
+        pRenderTransform.GetMatrix().GetMatrix(a, b, c, d);
+
+        const float scaleX   = FMath::Sqrt(a * a + b * b);
+        const float angle    = scaleX > UE_SMALL_NUMBER ? FMath::Atan2(b, a) : 0.0f;
+        const float cosAngle = FMath::Cos(angle);
+        const float sinAngle = FMath::Sin(angle);
+        const float scaleY   = d * cosAngle - c * sinAngle;
+        const float shearX   = FMath::Abs(scaleY) > UE_SMALL_NUMBER ? (c * cosAngle + d * sinAngle) / scaleY : 0.0f;
+
+        return FWidgetTransform(FVector2D(pRenderTransform.GetTranslation()),
+                                FVector2D(scaleX, scaleY),
+                                FVector2D(FMath::RadiansToDegrees(FMath::Atan(shearX)), 0.0f),
+                                FMath::RadiansToDegrees(angle));
+    }
+}
+
+// public ----------------------------------------------------------------------
+FSlateTweenDriver::FSlateTweenDriver()
+    : mNextTweenId(0)
+{
+
+}
+
+// public ----------------------------------------------------------------------
+FSlateTweenDriver::~FSlateTweenDriver()
+{
+    if (mTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(mTickerHandle);
+    }
+}
+
+// static public ---------------------------------------------------------------
+FSlateTweenDriver& FSlateTweenDriver::Get()
+{
+    if (!sInstance.IsValid())
+    {
+        sInstance = MakeUnique<FSlateTweenDriver>();
+    }
+
+    return *sInstance;
+}
+
+// static public ---------------------------------------------------------------
+void FSlateTweenDriver::Shutdown()
+{
+    sInstance.Reset();
+}
+
+// public ----------------------------------------------------------------------
+int32 FSlateTweenDriver::AddTween(const TSharedRef<SWidget>& pWidget,
+                                  ESlateTweenProperty pProperty,
+                                  const FVector2D& pTo,
+                                  float pDuration,
+                                  ETweenEaseType pEaseType,
+                                  int32 pNumLoops,
+                                  ETweenLoopType pLoopType,
+                                  float pDelay,
+                                  FOnSlateTweenEnd pOnTweenEnd)
+{
+    FindOrAddWidgetState(pWidget);
+
+    FSlateTween& tween     = mTweens.AddDefaulted_GetRef();
+    tween.Id               = mNextTweenId++;
+    tween.Widget           = pWidget;
+    tween.Property         = pProperty;
+    tween.From             = pTo;
+    tween.To               = pTo;
+    tween.Duration         = FMath::Max(pDuration, 0.0f);
+    tween.Delay            = FMath::Max(pDelay, 0.0f);
+    tween.ElapsedTime      = 0.0f;
+    tween.EaseType         = pEaseType;
+    tween.NumLoops         = pNumLoops;
+    tween.LoopsDone        = 0;
+    tween.LoopType         = pLoopType;
+    tween.OnTweenEnd       = MoveTemp(pOnTweenEnd);
+    tween.bHasStarted      = false;
+    tween.bIsStopped       = false;
+    tween.bShouldJumpToEnd = false;
+
+    if (!mTickerHandle.IsValid())
+    {
+        mTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSlateTweenDriver::Tick));
+    }
+
+    return tween.Id;
+}
+
+// public ----------------------------------------------------------------------
+void FSlateTweenDriver::SetInitialRenderTransform(const TSharedRef<SWidget>& pWidget,
+                                                  const FVector2D& pTranslation,
+                                                  const FVector2D& pScale,
+                                                  const FVector2D& pShear,
+                                                  float pAngle)
+{
+    if (mWidgetStates.Contains(pWidget))
+    {
+        return;
+    }
+
+    FSlateWidgetState& widgetState = FindOrAddWidgetState(pWidget);
+    widgetState.Translation        = pTranslation;
+    widgetState.Scale              = pScale;
+    widgetState.Shear              = pShear;
+    widgetState.Angle              = pAngle;
+}
+
+// public ----------------------------------------------------------------------
+void FSlateTweenDriver::StopTween(int32 pTweenId, bool pShouldJumpToEnd)
+{
+    for (FSlateTween& tween : mTweens)
+    {
+        if (tween.Id == pTweenId && !tween.bIsStopped)
+        {
+            tween.bIsStopped       = true;
+            tween.bShouldJumpToEnd = pShouldJumpToEnd;
+            break;
+        }
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FSlateTweenDriver::StopWidgetTweens(const TSharedRef<SWidget>& pWidget, bool pShouldJumpToEnd)
+{
+    for (FSlateTween& tween : mTweens)
+    {
+        if (tween.Widget.HasSameObject(&pWidget.Get()) && !tween.bIsStopped)
+        {
+            tween.bIsStopped       = true;
+            tween.bShouldJumpToEnd = pShouldJumpToEnd;
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+bool FSlateTweenDriver::Tick(float pDeltaTime)
+{
+    // Delegates are executed only once all the widgets have been written, since they may add or stop Tweens
+    TArray<TTuple<FOnSlateTweenEnd, FVector2D, TWeakPtr<SWidget>>> endedTweenDelegates;
+    TMap<TWeakPtr<SWidget>, FWidgetTransform> endedWidgetTransforms;
+
+    for (int32 i = 0; i < mTweens.Num(); ++i)
+    {
+        FSlateTween& tween             = mTweens[i];
+        TSharedPtr<SWidget> widget     = tween.Widget.Pin();
+        FSlateWidgetState* widgetState = widget.IsValid() ? mWidgetStates.Find(tween.Widget) : nullptr;
+
+        if (widgetState == nullptr)
+        {
+            mTweens.RemoveAt(i--, 1, false);
+            continue;
+        }
+
+        bool hasEnded = false;
+
+        if (tween.bIsStopped)
+        {
+            if (tween.bShouldJumpToEnd)
+            {
+                SetPropertyValue(*widgetState, tween.Property, tween.To);
+                hasEnded = true;
+            }
+            else
+            {
+                mTweens.RemoveAt(i--, 1, false);
+                continue;
+            }
+        }
+        else
+        {
+            tween.ElapsedTime += pDeltaTime;
+
+            if (!tween.bHasStarted)
+            {
+                if (tween.ElapsedTime < tween.Delay)
+                {
+                    continue;
+                }
+
+                tween.ElapsedTime -= tween.Delay;
+                tween.From         = GetPropertyValue(*widgetState, tween.Property);
+                tween.bHasStarted  = true;
+            }
+
+            if (tween.ElapsedTime >= tween.Duration)
+            {
+                SetPropertyValue(*widgetState, tween.Property, tween.To);
+
+                ++tween.LoopsDone;
+
+                if (tween.NumLoops > 0 && tween.LoopsDone >= tween.NumLoops)
+                {
+                    hasEnded = true;
+                }
+                else
+                {
+                    if (tween.LoopType == ETweenLoopType::Yoyo)
+                    {
+                        Swap(tween.From, tween.To);
+                    }
+
+                    tween.ElapsedTime = 0.0f;
+                }
+            }
+            else
+            {
+                FVector2D newValue;
+                EaseEquations::ComputeVector2DEasing(tween.EaseType, tween.ElapsedTime, tween.From, tween.To, tween.Duration, newValue);
+
+                SetPropertyValue(*widgetState, tween.Property, newValue);
+            }
+        }
+
+        if (hasEnded)
+        {
+            if (tween.OnTweenEnd.IsBound())
+            {
+                endedTweenDelegates.Emplace(MoveTemp(tween.OnTweenEnd), tween.To, tween.Widget);
+            }
+
+            mTweens.RemoveAt(i--, 1, false);
+        }
+    }
+
+    // Writing each widget once. Both setters invalidate the widget with the narrowest reason that fits ("RenderTransform" and "Paint").
+    for (auto it = mWidgetStates.CreateIterator(); it; ++it)
+    {
+        TSharedPtr<SWidget> widget     = it.Key().Pin();
+        FSlateWidgetState& widgetState = it.Value();
+
+        if (!widget.IsValid())
+        {
+            it.RemoveCurrent();
+            continue;
+        }
+
+        if (widgetState.bTransformChanged)
+        {
+            FWidgetTransform renderTransform(widgetState.Translation, widgetState.Scale, widgetState.Shear, widgetState.Angle);
+            widget->SetRenderTransform(renderTransform.ToSlateRenderTransform());
+
+            widgetState.bTransformChanged = false;
+        }
+
+        if (widgetState.bOpacityChanged)
+        {
+            widget->SetRenderOpacity(widgetState.Opacity);
+
+            widgetState.bOpacityChanged = false;
+        }
+    }
+
+    // Keeping the render transforms the ended Tweens report, since their widgets may be forgotten below
+    for (const TTuple<FOnSlateTweenEnd, FVector2D, TWeakPtr<SWidget>>& endedTween : endedTweenDelegates)
+    {
+        const FSlateWidgetState* widgetState = mWidgetStates.Find(endedTween.Get<2>());
+
+        if (widgetState != nullptr && !endedWidgetTransforms.Contains(endedTween.Get<2>()))
+        {
+            endedWidgetTransforms.Add(endedTween.Get<2>(), FWidgetTransform(widgetState->Translation,
+                                                                            widgetState->Scale,
+                                                                            widgetState->Shear,
+                                                                            widgetState->Angle));
+        }
+    }
+
+    // Forgetting the widgets that are no longer animated, so that their next Tweens read their state again
+    for (auto it = mWidgetStates.CreateIterator(); it; ++it)
+    {
+        const TWeakPtr<SWidget>& widget = it.Key();
+
+        if (!mTweens.ContainsByPredicate([&widget](const FSlateTween& pTween) { return pTween.Widget == widget; }))
+        {
+            it.RemoveCurrent();
+        }
+    }
+
+    for (const TTuple<FOnSlateTweenEnd, FVector2D, TWeakPtr<SWidget>>& endedTween : endedTweenDelegates)
+    {
+        const FWidgetTransform* renderTransform = endedWidgetTransforms.Find(endedTween.Get<2>());
+
+        if (renderTransform != nullptr)
+        {
+            endedTween.Get<0>().ExecuteIfBound(endedTween.Get<1>(), *renderTransform);
+        }
+    }
+
+    // Returning false removes the ticker, which is registered again by the next AddTween
+    if (mTweens.Num() == 0)
+    {
+        mTickerHandle.Reset();
+        return false;
+    }
+
+    return true;
+}
+
+// private ---------------------------------------------------------------------
+FSlateTweenDriver::FSlateWidgetState& FSlateTweenDriver::FindOrAddWidgetState(const TSharedRef<SWidget>& pWidget)
+{
+    FSlateWidgetState* widgetState = mWidgetStates.Find(pWidget);
+
+    if (widgetState == nullptr)
+    {
+        TOptional<FSlateRenderTransform> renderTransform = pWidget->GetRenderTransform();
+
+        // The widget may have been given a transform outside of the Tweens, which the first written transform must not discard
+        const FWidgetTransform widgetTransform = renderTransform.IsSet() ? DecomposeRenderTransform(renderTransform.GetValue())
+                                                                         : FWidgetTransform();
+
+        widgetState                    = &mWidgetStates.Add(pWidget);
+        widgetState->Translation       = widgetTransform.Translation;
+        widgetState->Scale             = widgetTransform.Scale;
+        widgetState->Shear             = widgetTransform.Shear;
+        widgetState->Angle             = widgetTransform.Angle;
+        widgetState->Opacity           = pWidget->GetRenderOpacity();
+        widgetState->bTransformChanged = false;
+        widgetState->bOpacityChanged   = false;
+    }
+
+    return *widgetState;
+}
+
+// static private --------------------------------------------------------------
+FVector2D FSlateTweenDriver::GetPropertyValue(const FSlateWidgetState& pState, ESlateTweenProperty pProperty)
+{
+    switch (pProperty)
+    {
+        case ESlateTweenProperty::Translation:
+        {
+            return pState.Translation;
+        }
+        case ESlateTweenProperty::Scale:
+        {
+            return pState.Scale;
+        }
+        case ESlateTweenProperty::Shear:
+        {
+            return pState.Shear;
+        }
+        case ESlateTweenProperty::Angle:
+        {
+            return FVector2D(pState.Angle, 0.0f);
+        }
+        case ESlateTweenProperty::Opacity:
+        {
+            return FVector2D(pState.Opacity, 0.0f);
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    return FVector2D::ZeroVector;
+}
+
+// static private --------------------------------------------------------------
+void FSlateTweenDriver::SetPropertyValue(FSlateWidgetState& pState, ESlateTweenProperty pProperty, const FVector2D& pValue)
+{
+    switch (pProperty)
+    {
+        case ESlateTweenProperty::Translation:
+        {
+            pState.bTransformChanged |= pState.Translation != pValue;
+            pState.Translation        = pValue;
+            break;
+        }
+        case ESlateTweenProperty::Scale:
+        {
+            pState.bTransformChanged |= pState.Scale != pValue;
+            pState.Scale              = pValue;
+            break;
+        }
+        case ESlateTweenProperty::Shear:
+        {
+            pState.bTransformChanged |= pState.Shear != pValue;
+            pState.Shear              = pValue;
+            break;
+        }
+        case ESlateTweenProperty::Angle:
+        {
+            pState.bTransformChanged |= pState.Angle != pValue.X;
+            pState.Angle              = pValue.X;
+            break;
+        }
+        case ESlateTweenProperty::Opacity:
+        {
+            pState.bOpacityChanged |= pState.Opacity != pValue.X;
+            pState.Opacity          = pValue.X;
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
@@ -0,0 +1,810 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Utils/TweenDifferentialHarness.h"
+#include "Utils/Utility.h"
+#include "Tweens/TweenFloat.h"
+#include "Tweens/TweenRotator.h"
+#include "Tweens/TweenVector.h"
+#include "Tweens/TweenVector2D.h"
+#include "TweenContainer.h"
+#include "TweenManagerComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/SplineComponent.h"
+#include "Components/Image.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+    /// @brief Number of frames simulated by each program of the console command.
+    const int32 HarnessNumFrames = 240;
+
+    /// @brief Maximum difference allowed between two traced values.
+    const float HarnessTolerance = 1e-3f;
+
+    TArray<FTweenHarnessBackend>& GetBackendRegistry()
+    {
+        static TArray<FTweenHarnessBackend> registry;
+        return registry;
+    }
+
+    FVector4f ToHarnessValue(float pValue)
+    {
+        return FVector4f(pValue, 0.0f, 0.0f, 0.0f);
+    }
+
+    FVector4f ToHarnessValue(const FVector& pValue)
+    {
+        return FVector4f(FVector3f(pValue), 0.0f);
+    }
+
+    FVector4f ToHarnessValue(const FVector2D& pValue)
+    {
+        return FVector4f(static_cast<float>(pValue.X), static_cast<float>(pValue.Y), 0.0f, 0.0f);
+    }
+
+    FVector4f ToHarnessValue(const FQuat& pValue)
+    {
+        // The same rotation can be expressed by two opposite quaternions, so they're compared in the hemisphere with a positive W
+        FQuat4f quat = FQuat4f(pValue.W < 0.0 ? pValue * -1.0 : pValue);
+        return FVector4f(quat.X, quat.Y, quat.Z, quat.W);
+    }
+
+    FVector4f ToHarnessValue(const FRotator& pValue)
+    {
+        return ToHarnessValue(pValue.Quaternion());
+    }
+
+    bool AreHarnessValuesEqual(const FVector4f& pA, const FVector4f& pB, float pTolerance)
+    {
+        for (int32 i = 0; i < 4; ++i)
+        {
+            float scale = FMath::Max(1.0f, FMath::Max(FMath::Abs(pA[i]), FMath::Abs(pB[i])));
+
+            if (!(FMath::Abs(pA[i] - pB[i]) <= pTolerance * scale))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    FTweenHarnessTween MakeRandomTween(FRandomStream& pStream, bool pCanJoin)
+    {
+        FTweenHarnessTween tween;
+
+        tween.Kind         = static_cast<ETweenHarnessTweenKind>(pStream.RandRange(0, static_cast<int32>(ETweenHarnessTweenKind::WidgetAngleTo)));
+        tween.bIsJoin      = pCanJoin && pStream.FRand() < 0.4f;
+        tween.From         = FVector4f(pStream.FRandRange(-100.0f, 100.0f), pStream.FRandRange(-80.0f, 80.0f), pStream.FRandRange(-180.0f, 180.0f), 0.0f);
+        tween.To           = FVector4f(pStream.FRandRange(-100.0f, 100.0f), pStream.FRandRange(-80.0f, 80.0f), pStream.FRandRange(-180.0f, 180.0f), 0.0f);
+        tween.Duration     = pStream.FRandRange(0.05f, 1.5f);
+        tween.EaseType     = static_cast<ETweenEaseType>(pStream.RandRange(0, static_cast<int32>(ETweenEaseType::EaseOutInBounce)));
+        tween.NumLoops     = pStream.RandRange(1, 3);
+        tween.LoopType     = pStream.RandBool() ? ETweenLoopType::Yoyo : ETweenLoopType::Restart;
+        tween.Delay        = pStream.FRand() < 0.3f ? pStream.FRandRange(0.0f, 0.5f) : 0.0f;
+        tween.TimeScale    = pStream.FRandRange(0.5f, 2.0f);
+        tween.RotationMode = pStream.RandBool() ? ETweenRotationMode::ShortestPath : ETweenRotationMode::FullPath;
+        tween.TargetIndex  = pStream.RandRange(0, TWEEN_HARNESS_NUM_TARGETS - 1);
+        tween.bAppendOnEnd = pStream.FRand() < 0.2f;
+
+        tween.bUseConstantSpeed = pStream.RandBool();
+
+        return tween;
+    }
+
+    float MakeRandomTimeScale(FRandomStream& pStream, float pNegativeProbability)
+    {
+        float timeScale = pStream.FRandRange(0.5f, 2.0f);
+        return pStream.FRand() < pNegativeProbability ? -timeScale : timeScale;
+    }
+
+    void AddRandomContainer(FTweenHarnessProgram& pProgram, FRandomStream& pStream, int32& pNumContainers)
+    {
+        FTweenHarnessStep createStep;
+        createStep.Type     = ETweenHarnessStepType::CreateContainer;
+        createStep.NumLoops = pStream.RandRange(1, 3);
+        createStep.LoopType = pStream.RandBool() ? ETweenLoopType::Yoyo : ETweenLoopType::Restart;
+        createStep.Value    = MakeRandomTimeScale(pStream, 0.2f);
+        pProgram.Steps.Add(createStep);
+
+        int32 numTweens = pStream.RandRange(1, 4);
+
+        for (int32 i = 0; i < numTweens; ++i)
+        {
+            FTweenHarnessStep tweenStep;
+            tweenStep.Type           = ETweenHarnessStepType::AddTween;
+            tweenStep.ContainerIndex = pNumContainers;
+            tweenStep.Tween          = MakeRandomTween(pStream, i > 0);
+            pProgram.Steps.Add(tweenStep);
+        }
+
+        pNumContainers++;
+    }
+
+    FString GetHarnessEventName(ETweenHarnessEvent pEvent)
+    {
+        switch (pEvent)
+        {
+            case ETweenHarnessEvent::Start:
+            {
+                return TEXT("Start");
+            }
+            case ETweenHarnessEvent::Update:
+            {
+                return TEXT("Update");
+            }
+            case ETweenHarnessEvent::End:
+            {
+                return TEXT("End");
+            }
+            case ETweenHarnessEvent::TargetLocation:
+            {
+                return TEXT("TargetLocation");
+            }
+            case ETweenHarnessEvent::TargetRotation:
+            {
+                return TEXT("TargetRotation");
+            }
+            case ETweenHarnessEvent::TargetWidget:
+            {
+                return TEXT("TargetWidget");
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        return TEXT("Unknown");
+    }
+
+    FAutoConsoleCommand DiffTestCommand(TEXT("TweenMaker.DiffTest"),
+                                        TEXT("Runs random TweenContainer programs with and without alternate backends and reports the first divergence. ")
+                                        TEXT("Usage: TweenMaker.DiffTest [NumPrograms] [Seed] [ConsoleVariable...]. Each console variable is an alternate backend; ")
+                                        TEXT("if none is given, the registered backends are tested."),
+                                        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& pArgs)
+                                        {
+                                            int32 numPrograms = pArgs.Num() > 0 ? FMath::Max(1, FCString::Atoi(*pArgs[0])) : 100;
+                                            int32 seed        = pArgs.Num() > 1 ? FCString::Atoi(*pArgs[1]) : 0;
+
+                                            TArray<FTweenHarnessBackend> backends;
+
+                                            for (int32 i = 2; i < pArgs.Num(); ++i)
+                                            {
+                                                backends.Add(FTweenHarnessBackend::FromConsoleVariable(pArgs[i]));
+                                            }
+
+                                            if (backends.Num() == 0)
+                                            {
+                                                backends = FTweenDifferentialHarness::GetRegisteredBackends();
+                                            }
+
+                                            if (backends.Num() == 0)
+                                            {
+                                                UE_LOG(LogTweenMaker, Warning, TEXT("TweenMaker.DiffTest -> no alternate backend available, checking that the reference implementation is deterministic."));
+
+                                                FTweenHarnessBackend reference;
+                                                reference.Name = TEXT("Reference");
+                                                backends.Add(reference);
+                                            }
+
+                                            FTweenDifferentialHarness harness;
+
+                                            for (const FTweenHarnessBackend& backend : backends)
+                                            {
+                                                FString report;
+
+                                                if (harness.RunDifferential(numPrograms, seed, backend, report))
+                                                {
+                                                    UE_LOG(LogTweenMaker, Display, TEXT("TweenMaker.DiffTest -> %s: %d programs matched the reference."), *backend.Name, numPrograms);
+                                                }
+                                                else
+                                                {
+                                                    UE_LOG(LogTweenMaker, Error, TEXT("TweenMaker.DiffTest -> %s: %s"), *backend.Name, *report);
+                                                }
+                                            }
+                                        }));
+}
+
+// public ----------------------------------------------------------------------
+FTweenHarnessTween::FTweenHarnessTween()
+    : Kind(ETweenHarnessTweenKind::CustomFloat)
+    , bIsJoin(false)
+    , From(FVector4f::Zero())
+    , To(FVector4f::Zero())
+    , Duration(1.0f)
+    , EaseType(ETweenEaseType::Linear)
+    , NumLoops(1)
+    , LoopType(ETweenLoopType::Yoyo)
+    , Delay(0.0f)
+    , TimeScale(1.0f)
+    , RotationMode(ETweenRotationMode::ShortestPath)
+    , TargetIndex(0)
+    , bUseConstantSpeed(false)
+    , bAppendOnEnd(false)
+{
+
+}
+
+// public ----------------------------------------------------------------------
+FTweenHarnessStep::FTweenHarnessStep()
+    : Type(ETweenHarnessStepType::Frame)
+    , ContainerIndex(0)
+    , NumLoops(1)
+    , LoopType(ETweenLoopType::Yoyo)
+    , Value(0.0f)
+{
+
+}
+
+// public ----------------------------------------------------------------------
+FTweenHarnessProgram::FTweenHarnessProgram()
+    : Seed(0)
+{
+
+}
+
+// static public ---------------------------------------------------------------
+FTweenHarnessProgram FTweenHarnessProgram::Generate(int32 pSeed, int32 pNumFrames)
+{
+    FTweenHarnessProgram program;
+    program.Seed = pSeed;
+
+    FRandomStream stream(pSeed);
+    int32 numContainers = 0;
+
+    int32 numInitialContainers = stream.RandRange(1, 3);
+
+    for (int32 i = 0; i < numInitialContainers; ++i)
+    {
+        AddRandomContainer(program, stream, numContainers);
+    }
+
+    for (int32 frame = 0; frame < pNumFrames; ++frame)
+    {
+        float roll = stream.FRand();
+
+        if (roll < 0.04f)
+        {
+            AddRandomContainer(program, stream, numContainers);
+        }
+        else if (roll < 0.30f)
+        {
+            FTweenHarnessStep step;
+            step.ContainerIndex = stream.RandRange(0, numContainers - 1);
+
+            if (roll < 0.12f)
+            {
+                step.Type  = ETweenHarnessStepType::AddTween;
+                step.Tween = MakeRandomTween(stream, true);
+            }
+            else if (roll < 0.18f)
+            {
+                step.Type  = ETweenHarnessStepType::SetTimeScale;
+                step.Value = MakeRandomTimeScale(stream, 0.5f);
+            }
+            else if (roll < 0.22f)
+            {
+                step.Type = ETweenHarnessStepType::Restart;
+            }
+            else if (roll < 0.25f)
+            {
+                step.Type = ETweenHarnessStepType::Pause;
+            }
+            else if (roll < 0.28f)
+            {
+                step.Type = ETweenHarnessStepType::Resume;
+            }
+            else
+            {
+                step.Type = ETweenHarnessStepType::Delete;
+            }
+
+            program.Steps.Add(step);
+        }
+
+        // Mostly regular frames, with some long ones that cross several Tween boundaries at once
+        FTweenHarnessStep frameStep;
+        frameStep.Type  = ETweenHarnessStepType::Frame;
+        frameStep.Value = stream.FRand() < 0.05f ? stream.FRandRange(0.2f, 0.6f) : stream.FRandRange(1.0f / 120.0f, 1.0f / 20.0f);
+        program.Steps.Add(frameStep);
+    }
+
+    return program;
+}
+
+// public ----------------------------------------------------------------------
+FString FTweenHarnessTraceEntry::ToString() const
+{
+    return FString::Printf(TEXT("frame %d, %s of %s %d, value (%f, %f, %f, %f)"),
+                           Frame,
+                           *GetHarnessEventName(Event),
+                           Event == ETweenHarnessEvent::TargetLocation || Event == ETweenHarnessEvent::TargetRotation || Event == ETweenHarnessEvent::TargetWidget
+                           ? TEXT("target")
+                           : TEXT("tween"),
+                           Id,
+                           Value.X,
+                           Value.Y,
+                           Value.Z,
+                           Value.W);
+}
+
+// static public ---------------------------------------------------------------
+FTweenHarnessBackend FTweenHarnessBackend::FromConsoleVariable(const FString& pConsoleVariableName, const FString& pValue)
+{
+    TSharedRef<FString> previousValue = MakeShared<FString>();
+
+    FTweenHarnessBackend backend;
+    backend.Name   = pValue == TEXT("1") ? pConsoleVariableName : FString::Printf(TEXT("%s=%s"), *pConsoleVariableName, *pValue);
+    backend.Enable = [pConsoleVariableName, pValue, previousValue]()
+    {
+        IConsoleVariable* consoleVariable = IConsoleManager::Get().FindConsoleVariable(*pConsoleVariableName);
+
+        if (consoleVariable != nullptr)
+        {
+            *previousValue = consoleVariable->GetString();
+            consoleVariable->Set(*pValue, ECVF_SetByCode);
+        }
+        else
+        {
+            UE_LOG(LogTweenMaker, Warning, TEXT("FTweenHarnessBackend::Enable -> the console variable %s doesn't exist."), *pConsoleVariableName);
+        }
+    };
+    backend.Disable = [pConsoleVariableName, previousValue]()
+    {
+        IConsoleVariable* consoleVariable = IConsoleManager::Get().FindConsoleVariable(*pConsoleVariableName);
+
+        if (consoleVariable != nullptr && !previousValue->IsEmpty())
+        {
+            consoleVariable->Set(**previousValue, ECVF_SetByCode);
+        }
+    };
+
+    return backend;
+}
+
+// public ----------------------------------------------------------------------
+FTweenDifferentialHarness::FTweenDifferentialHarness()
+    : mTweenManager(nullptr)
+    , mSpline(nullptr)
+    , mTrace(nullptr)
+    , mCurrentFrame(0)
+    , mNextTweenId(0)
+{
+
+}
+
+// static public ---------------------------------------------------------------
+void FTweenDifferentialHarness::RegisterBackend(const FTweenHarnessBackend& pBackend)
+{
+    TArray<FTweenHarnessBackend>& registry = GetBackendRegistry();
+
+    registry.RemoveAll([&pBackend](const FTweenHarnessBackend& pOther) { return pOther.Name == pBackend.Name; });
+    registry.Add(pBackend);
+}
+
+// static public ---------------------------------------------------------------
+const TArray<FTweenHarnessBackend>& FTweenDifferentialHarness::GetRegisteredBackends()
+{
+    return GetBackendRegistry();
+}
+
+// public ----------------------------------------------------------------------
+void FTweenDifferentialHarness::Run(const FTweenHarnessProgram& pProgram, const FTweenHarnessBackend* pBackend, TArray<FTweenHarnessTraceEntry>& pOutTrace)
+{
+    Reset();
+
+    if (pBackend != nullptr && pBackend->Enable)
+    {
+        pBackend->Enable();
+    }
+
+    pOutTrace.Reset();
+    mTrace        = &pOutTrace;
+    mCurrentFrame = 0;
+    mNextTweenId  = 0;
+
+    mTweenManager = NewObject<UTweenManagerComponent>(GetTransientPackage());
+
+    for (int32 i = 0; i < TWEEN_HARNESS_NUM_TARGETS; ++i)
+    {
+        mTargets.Add(NewObject<USceneComponent>(GetTransientPackage()));
+        mWidgets.Add(NewObject<UImage>(GetTransientPackage()));
+    }
+
+    // A curved spline, so that the spline caches are actually interpolating between their samples
+    mSpline = NewObject<USplineComponent>(GetTransientPackage());
+    mSpline->SetSplinePoints({FVector(0.0f, 0.0f, 0.0f), FVector(200.0f, 150.0f, 0.0f), FVector(400.0f, -150.0f, 80.0f), FVector(600.0f, 0.0f, 0.0f)},
+                             ESplineCoordinateSpace::World);
+
+    for (const FTweenHarnessStep& step : pProgram.Steps)
+    {
+        UTweenContainer* tweenContainer = mContainers.IsValidIndex(step.ContainerIndex) ? mContainers[step.ContainerIndex].Get() : nullptr;
+
+        if (tweenContainer != nullptr && tweenContainer->IsPendingDeletion())
+        {
+            tweenContainer = nullptr;
+        }
+
+        switch (step.Type)
+        {
+            case ETweenHarnessStepType::CreateContainer:
+            {
+                mContainers.Add(mTweenManager->CreateTweenContainer(step.NumLoops, step.LoopType, step.Value));
+                break;
+            }
+            case ETweenHarnessStepType::AddTween:
+            {
+                if (tweenContainer != nullptr)
+                {
+                    FTweenHarnessTween tween = step.Tween;
+
+                    if (pBackend != nullptr && pBackend->ModifyTween)
+                    {
+                        pBackend->ModifyTween(tween);
+                    }
+
+                    AddTween(tweenContainer, tween);
+                }
+                break;
+            }
+            case ETweenHarnessStepType::Frame:
+            {
+                mCurrentFrame++;
+                mTweenManager->UpdateTweenContainers(step.Value, false);
+                AddTargetStates();
+                break;
+            }
+            case ETweenHarnessStepType::SetTimeScale:
+            {
+                if (tweenContainer != nullptr)
+                {
+                    tweenContainer->SetTimeScale(step.Value);
+                }
+                break;
+            }
+            case ETweenHarnessStepType::Restart:
+            {
+                if (tweenContainer != nullptr)
+                {
+                    tweenContainer->RestartTweenContainer();
+                }
+                break;
+            }
+            case ETweenHarnessStepType::Pause:
+            {
+                if (tweenContainer != nullptr)
+                {
+                    tweenContainer->PauseTweenContainer();
+                }
+                break;
+            }
+            case ETweenHarnessStepType::Resume:
+            {
+                if (tweenContainer != nullptr)
+                {
+                    tweenContainer->ResumeTweenContainer();
+                }
+                break;
+            }
+            case ETweenHarnessStepType::Delete:
+            {
+                if (tweenContainer != nullptr)
+                {
+                    tweenContainer->DeleteTweenContainer();
+                }
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    // Events fired by the final cleanup are not part of the program
+    mTrace = nullptr;
+
+    Reset();
+
+    if (pBackend != nullptr && pBackend->Disable)
+    {
+        pBackend->Disable();
+    }
+}
+
+// static public ---------------------------------------------------------------
+bool FTweenDifferentialHarness::CompareTraces(const TArray<FTweenHarnessTraceEntry>& pReference,
+                                              const TArray<FTweenHarnessTraceEntry>& pCandidate,
+                                              float pTolerance,
+                                              FString& pOutReport)
+{
+    int32 numCommonEntries = FMath::Min(pReference.Num(), pCandidate.Num());
+
+    for (int32 i = 0; i < numCommonEntries; ++i)
+    {
+        const FTweenHarnessTraceEntry& reference = pReference[i];
+        const FTweenHarnessTraceEntry& candidate = pCandidate[i];
+
+        if (reference.Frame != candidate.Frame || reference.Event != candidate.Event || reference.Id != candidate.Id)
+        {
+            pOutReport = FString::Printf(TEXT("event order diverges at entry %d. Reference: %s. Candidate: %s."), i, *reference.ToString(), *candidate.ToString());
+            return false;
+        }
+
+        if (!AreHarnessValuesEqual(reference.Value, candidate.Value, pTolerance))
+        {
+            pOutReport = FString::Printf(TEXT("values diverge at entry %d. Reference: %s. Candidate: %s."), i, *reference.ToString(), *candidate.ToString());
+            return false;
+        }
+    }
+
+    if (pReference.Num() != pCandidate.Num())
+    {
+        const TArray<FTweenHarnessTraceEntry>& longerTrace = pReference.Num() > pCandidate.Num() ? pReference : pCandidate;
+
+        pOutReport = FString::Printf(TEXT("the %s trace has %d extra entries, starting with: %s."),
+                                     pReference.Num() > pCandidate.Num() ? TEXT("reference") : TEXT("candidate"),
+                                     FMath::Abs(pReference.Num() - pCandidate.Num()),
+                                     *longerTrace[numCommonEntries].ToString());
+        return false;
+    }
+
+    return true;
+}
+
+// public ----------------------------------------------------------------------
+bool FTweenDifferentialHarness::RunDifferential(int32 pNumPrograms, int32 pSeed, const FTweenHarnessBackend& pBackend, FString& pOutReport)
+{
+    TArray<FTweenHarnessTraceEntry> referenceTrace;
+    TArray<FTweenHarnessTraceEntry> candidateTrace;
+
+    for (int32 i = 0; i < pNumPrograms; ++i)
+    {
+        FTweenHarnessProgram program = FTweenHarnessProgram::Generate(pSeed + i, HarnessNumFrames);
+
+        Run(program, nullptr, referenceTrace);
+        Run(program, &pBackend, candidateTrace);
+
+        FString divergence;
+
+        if (!CompareTraces(referenceTrace, candidateTrace, HarnessTolerance, divergence))
+        {
+            pOutReport = FString::Printf(TEXT("program with seed %d: %s"), program.Seed, *divergence);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// public ----------------------------------------------------------------------
+void FTweenDifferentialHarness::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    Collector.AddReferencedObject(mTweenManager);
+    Collector.AddReferencedObjects(mTargets);
+    Collector.AddReferencedObjects(mWidgets);
+    Collector.AddReferencedObject(mSpline);
+}
+
+// public ----------------------------------------------------------------------
+FString FTweenDifferentialHarness::GetReferencerName() const
+{
+    return TEXT("FTweenDifferentialHarness");
+}
+
+// private ---------------------------------------------------------------------
+void FTweenDifferentialHarness::AddTween(UTweenContainer* pTweenContainer, const FTweenHarnessTween& pTween)
+{
+    // Joins are only possible on an existing sequence, otherwise the Tween is appended
+    bool isJoin         = pTween.bIsJoin && pTweenContainer->GetSequencesNum() > 0;
+    int32 sequenceIndex = isJoin ? pTweenContainer->GetSequencesNum() - 1 : pTweenContainer->GetSequencesNum();
+    USceneComponent* target = mTargets[pTween.TargetIndex];
+    UWidget* widget         = mWidgets[pTween.TargetIndex];
+
+    FVector from(pTween.From.X, pTween.From.Y, pTween.From.Z);
+    FVector to(pTween.To.X, pTween.To.Y, pTween.To.Z);
+    FRotator fromRotator(pTween.From.Y, pTween.From.Z, pTween.From.X);
+    FRotator toRotator(pTween.To.Y, pTween.To.Z, pTween.To.X);
+
+    switch (pTween.Kind)
+    {
+        case ETweenHarnessTweenKind::CustomFloat:
+        {
+            UTweenFloat* tween = isJoin
+                                 ? mTweenManager->JoinTweenFloat(pTweenContainer, sequenceIndex, ETweenFloatType::Custom, target, ETweenTargetType::Custom,
+                                                                 pTween.From.X, pTween.To.X, pTween.Duration, pTween.EaseType, pTween.Delay, pTween.TimeScale, false)
+                                 : mTweenManager->AppendTweenFloat(pTweenContainer, sequenceIndex, ETweenFloatType::Custom, target, ETweenTargetType::Custom,
+                                                                   pTween.From.X, pTween.To.X, pTween.Duration, pTween.EaseType, pTween.NumLoops, pTween.LoopType,
+                                                                   pTween.Delay, pTween.TimeScale, false);
+            BindTraceDelegates(tween, pTween.bAppendOnEnd);
+            break;
+        }
+        case ETweenHarnessTweenKind::CustomVector:
+        case ETweenHarnessTweenKind::MoveBy:
+        {
+            bool isCustom               = pTween.Kind == ETweenHarnessTweenKind::CustomVector;
+            ETweenVectorType tweenType  = isCustom ? ETweenVectorType::Custom : ETweenVectorType::MoveBy;
+            ETweenTargetType targetType = isCustom ? ETweenTargetType::Custom : ETweenTargetType::SceneComponent;
+
+            UTweenVector* tween = isJoin
+                                  ? mTweenManager->JoinTweenVector(pTweenContainer, sequenceIndex, tweenType, target, targetType, from, to, pTween.Duration,
+                                                                   pTween.EaseType, ETweenSpace::World, false, false, pTween.Delay, pTween.TimeScale, false)
+                                  : mTweenManager->AppendTweenVector(pTweenContainer, sequenceIndex, tweenType, target, targetType, from, to, pTween.Duration,
+                                                                     pTween.EaseType, ETweenSpace::World, false, false, pTween.NumLoops, pTween.LoopType,
+                                                                     pTween.Delay, pTween.TimeScale, false);
+            BindTraceDelegates(tween, pTween.bAppendOnEnd);
+            break;
+        }
+        case ETweenHarnessTweenKind::CustomVector2D:
+        {
+            FVector2D from2D(pTween.From.X, pTween.From.Y);
+            FVector2D to2D(pTween.To.X, pTween.To.Y);
+
+            UTweenVector2D* tween = isJoin
+                                    ? mTweenManager->JoinTweenVector2D(pTweenContainer, sequenceIndex, ETweenVector2DType::Custom, target, ETweenTargetType::Custom,
+                                                                       from2D, to2D, pTween.Duration, pTween.EaseType, pTween.Delay, pTween.TimeScale, false)
+                                    : mTweenManager->AppendTweenVector2D(pTweenContainer, sequenceIndex, ETweenVector2DType::Custom, target, ETweenTargetType::Custom,
+                                                                         from2D, to2D, pTween.Duration, pTween.EaseType, pTween.NumLoops, pTween.LoopType,
+                                                                         pTween.Delay, pTween.TimeScale, false);
+            BindTraceDelegates(tween, pTween.bAppendOnEnd);
+            break;
+        }
+        case ETweenHarnessTweenKind::RotateTo:
+        {
+            UTweenRotator* tween = isJoin
+                                   ? mTweenManager->JoinTweenRotator(pTweenContainer, sequenceIndex, ETweenRotatorType::RotateTo, target, ETweenTargetType::SceneComponent,
+                                                                     fromRotator, toRotator, pTween.Duration, pTween.EaseType, ETweenSpace::World, pTween.RotationMode,
+                                                                     false, false, false, pTween.Delay, pTween.TimeScale, false)
+                                   : mTweenManager->AppendTweenRotator(pTweenContainer, sequenceIndex, ETweenRotatorType::RotateTo, target, ETweenTargetType::SceneComponent,
+                                                                       fromRotator, toRotator, pTween.Duration, pTween.EaseType, ETweenSpace::World, pTween.RotationMode,
+                                                                       false, false, false, pTween.NumLoops, pTween.LoopType, pTween.Delay, pTween.TimeScale, false);
+            BindTraceDelegates(tween, pTween.bAppendOnEnd);
+            break;
+        }
+        case ETweenHarnessTweenKind::RotateAroundPoint:
+        {
+            float radius = 10.0f + FMath::Abs(pTween.To.X);
+
+            UTweenFloat* tween = isJoin
+                                 ? mTweenManager->JoinTweenRotateAroundFloat(pTweenContainer, sequenceIndex, ETweenFloatType::RotateAroundPoint, target,
+                                                                             ETweenTargetType::SceneComponent, from, pTween.From.Z, pTween.To.Z, radius,
+                                                                             FVector::UpVector, ETweenSpace::World, pTween.Duration, pTween.EaseType, false, false,
+                                                                             pTween.Delay, pTween.TimeScale, false)
+                                 : mTweenManager->AppendTweenRotateAroundFloat(pTweenContainer, sequenceIndex, ETweenFloatType::RotateAroundPoint, target,
+                                                                               ETweenTargetType::SceneComponent, from, pTween.From.Z, pTween.To.Z, radius,
+                                                                               FVector::UpVector, ETweenSpace::World, pTween.Duration, pTween.EaseType, false, false,
+                                                                               pTween.NumLoops, pTween.LoopType, pTween.Delay, pTween.TimeScale, false);
+            BindTraceDelegates(tween, pTween.bAppendOnEnd);
+            break;
+        }
+        case ETweenHarnessTweenKind::FollowSpline:
+        {
+            UTweenFloat* tween = isJoin
+                                 ? mTweenManager->JoinTweenFollowSplineFloat(pTweenContainer, sequenceIndex, ETweenFloatType::FollowSpline, target,
+                                                                             ETweenTargetType::SceneComponent, mSpline, true, false, pTween.bUseConstantSpeed,
+                                                                             pTween.Duration, pTween.EaseType, false, false, pTween.Delay, pTween.TimeScale, false)
+                                 : mTweenManager->AppendTweenFollowSplineFloat(pTweenContainer, sequenceIndex, ETweenFloatType::FollowSpline, target,
+                                                                               ETweenTargetType::SceneComponent, mSpline, true, false, pTween.bUseConstantSpeed,
+                                                                               pTween.Duration, pTween.EaseType, false, false, pTween.NumLoops, pTween.LoopType,
+                                                                               pTween.Delay, pTween.TimeScale, false);
+            BindTraceDelegates(tween, pTween.bAppendOnEnd);
+            break;
+        }
+        case ETweenHarnessTweenKind::WidgetMoveTo:
+        {
+            FVector2D to2D(pTween.To.X, pTween.To.Y);
+
+            UTweenVector2D* tween = isJoin
+                                    ? mTweenManager->JoinTweenVector2D(pTweenContainer, sequenceIndex, ETweenVector2DType::MoveTo, widget, ETweenTargetType::UMG,
+                                                                       FVector2D::ZeroVector, to2D, pTween.Duration, pTween.EaseType, pTween.Delay, pTween.TimeScale, false)
+                                    : mTweenManager->AppendTweenVector2D(pTweenContainer, sequenceIndex, ETweenVector2DType::MoveTo, widget, ETweenTargetType::UMG,
+                                                                         FVector2D::ZeroVector, to2D, pTween.Duration, pTween.EaseType, pTween.NumLoops, pTween.LoopType,
+                                                                         pTween.Delay, pTween.TimeScale, false);
+            BindTraceDelegates(tween, pTween.bAppendOnEnd);
+            break;
+        }
+        case ETweenHarnessTweenKind::WidgetAngleTo:
+        {
+            UTweenFloat* tween = isJoin
+                                 ? mTweenManager->JoinTweenFloat(pTweenContainer, sequenceIndex, ETweenFloatType::WidgetAngleTo, widget, ETweenTargetType::UMG,
+                                                                 0.0f, pTween.To.Z, pTween.Duration, pTween.EaseType, pTween.Delay, pTween.TimeScale, false)
+                                 : mTweenManager->AppendTweenFloat(pTweenContainer, sequenceIndex, ETweenFloatType::WidgetAngleTo, widget, ETweenTargetType::UMG,
+                                                                   0.0f, pTween.To.Z, pTween.Duration, pTween.EaseType, pTween.NumLoops, pTween.LoopType,
+                                                                   pTween.Delay, pTween.TimeScale, false);
+            BindTraceDelegates(tween, pTween.bAppendOnEnd);
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+template<typename TweenClass>
+void FTweenDifferentialHarness::BindTraceDelegates(TweenClass* pTween, bool pAppendOnEnd)
+{
+    if (pTween == nullptr)
+    {
+        return;
+    }
+
+    int32 tweenId = mNextTweenId++;
+
+    pTween->OnTweenStartDelegate.BindLambda([this, tweenId](TweenClass* pInTween)
+    {
+        AddTraceEntry(ETweenHarnessEvent::Start, tweenId, ToHarnessValue(pInTween->GetCurrentValue()));
+    });
+
+    pTween->OnTweenUpdateDelegate.BindLambda([this, tweenId](TweenClass* pInTween)
+    {
+        AddTraceEntry(ETweenHarnessEvent::Update, tweenId, ToHarnessValue(pInTween->GetCurrentValue()));
+    });
+
+    // The end callback fires at each loop, but the new Tween is appended only the first time
+    TSharedRef<bool> hasAppended = MakeShared<bool>(!pAppendOnEnd);
+
+    pTween->OnTweenEndDelegate.BindLambda([this, tweenId, hasAppended](TweenClass* pInTween)
+    {
+        AddTraceEntry(ETweenHarnessEvent::End, tweenId, ToHarnessValue(pInTween->GetCurrentValue()));
+
+        if (!*hasAppended && mTrace != nullptr)
+        {
+            *hasAppended = true;
+            BindTraceDelegates(pInTween->AppendTweenCustomFloat(mTargets[0], 0.0f, 1.0f, 0.3f, ETweenEaseType::EaseInOutQuad), false);
+        }
+    });
+}
+
+// private ---------------------------------------------------------------------
+void FTweenDifferentialHarness::AddTraceEntry(ETweenHarnessEvent pEvent, int32 pId, const FVector4f& pValue)
+{
+    if (mTrace != nullptr)
+    {
+        FTweenHarnessTraceEntry entry;
+        entry.Frame = mCurrentFrame;
+        entry.Event = pEvent;
+        entry.Id    = pId;
+        entry.Value = pValue;
+
+        mTrace->Add(entry);
+    }
+}
+
+// private ---------------------------------------------------------------------
+void FTweenDifferentialHarness::AddTargetStates()
+{
+    for (int32 i = 0; i < mTargets.Num(); ++i)
+    {
+        AddTraceEntry(ETweenHarnessEvent::TargetLocation, i, ToHarnessValue(mTargets[i]->GetComponentLocation()));
+        AddTraceEntry(ETweenHarnessEvent::TargetRotation, i, ToHarnessValue(mTargets[i]->GetComponentQuat()));
+    }
+
+    for (int32 i = 0; i < mWidgets.Num(); ++i)
+    {
+        const FWidgetTransform& renderTransform = mWidgets[i]->GetRenderTransform();
+
+        AddTraceEntry(ETweenHarnessEvent::TargetWidget,
+                      i,
+                      FVector4f(static_cast<float>(renderTransform.Translation.X), static_cast<float>(renderTransform.Translation.Y), renderTransform.Angle, 0.0f));
+    }
+}
+
+// private ---------------------------------------------------------------------
+void FTweenDifferentialHarness::Reset()
+{
+    if (mTweenManager != nullptr)
+    {
+        mTweenManager->DeleteAllTweens();
+        mTweenManager = nullptr;
+    }
+
+    mTargets.Reset();
+    mWidgets.Reset();
+    mContainers.Reset();
+
+    mSpline = nullptr;
+}
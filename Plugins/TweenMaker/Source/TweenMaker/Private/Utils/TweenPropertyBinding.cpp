@@ -0,0 +1,369 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Utils/TweenPropertyBinding.h"
+
+#include "Utils/Utility.h"
+#include "Components/LightComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "UObject/UnrealType.h"
+#include "Algo/Find.h"
+
+namespace
+{
+    FProperty* FindPropertyInStruct(const UStruct* pStruct, const FString& pName)
+    {
+        FProperty* property = FindFProperty<FProperty>(pStruct, *pName);
+
+        // The members of the structs defined in Blueprint have generated names, so I'll also look for the name the user gave them
+        if (property == nullptr)
+        {
+            for (TFieldIterator<FProperty> it(pStruct); it; ++it)
+            {
+                if (it->GetAuthoredName() == pName)
+                {
+                    property = *it;
+                    break;
+                }
+            }
+        }
+
+        return property;
+    }
+
+    /// The properties of a light that reach the render thread through ULightComponent::UpdateColorAndBrightness()
+    const FName LightColorAndBrightnessProperties[] =
+    {
+        TEXT("Intensity"),
+        TEXT("Temperature"),
+        TEXT("IndirectLightingIntensity"),
+        TEXT("VolumetricScatteringIntensity")
+    };
+}
+
+// public ----------------------------------------------------------------------
+FTweenPropertyBinding::FTweenPropertyBinding()
+    : mValueType(EValueType::Float)
+    , mProperty(nullptr)
+    , mOffset(0)
+    , mPropertyType(EPropertyType::Float)
+    , bUseSetter(false)
+    , mRenderUpdate(ERenderUpdate::None)
+{
+
+}
+
+// public ----------------------------------------------------------------------
+bool FTweenPropertyBinding::Bind(UObject* pObject, const FString& pPropertyPath, EValueType pValueType)
+{
+    Reset();
+
+    mPropertyPath = pPropertyPath;
+    mValueType    = pValueType;
+
+    // Until the binding succeeds this is the class it failed on, so that the writes don't try (and warn) again until the class changes
+    mFailedClass  = pObject != nullptr ? pObject->GetClass() : nullptr;
+
+    if (pObject == nullptr)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("FTweenPropertyBinding::Bind -> the Tween has no target, can't bind \"%s\"."), *pPropertyPath);
+        return false;
+    }
+
+    TArray<FString> names;
+    pPropertyPath.ParseIntoArray(names, TEXT("."));
+
+    if (names.Num() == 0)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("FTweenPropertyBinding::Bind -> the property path is empty."));
+        return false;
+    }
+
+    // Walking the path, and adding up the offsets of the nested structs
+    const UStruct* owner = pObject->GetClass();
+    FProperty* property  = nullptr;
+    int32 offset         = 0;
+
+    for (int32 i = 0; i < names.Num(); ++i)
+    {
+        property = FindPropertyInStruct(owner, names[i]);
+
+        if (property == nullptr || property->ArrayDim != 1)
+        {
+            UE_LOG(LogTweenMaker, Warning, TEXT("FTweenPropertyBinding::Bind -> \"%s\" isn't a property of %s (static arrays aren't supported)."),
+                   *names[i], *owner->GetName());
+            return false;
+        }
+
+        offset += property->GetOffset_ForInternal();
+
+        if (i < names.Num() - 1)
+        {
+            FStructProperty* structProperty = CastField<FStructProperty>(property);
+
+            if (structProperty == nullptr)
+            {
+                UE_LOG(LogTweenMaker, Warning, TEXT("FTweenPropertyBinding::Bind -> \"%s\" in \"%s\" isn't a struct."), *names[i], *pPropertyPath);
+                return false;
+            }
+
+            owner = structProperty->Struct;
+        }
+    }
+
+    // Checking that the property can hold the value
+    EPropertyType propertyType      = EPropertyType::Float;
+    bool isTypeValid                = false;
+    FStructProperty* structProperty = CastField<FStructProperty>(property);
+    const UScriptStruct* structType = structProperty != nullptr ? structProperty->Struct : nullptr;
+
+    switch (pValueType)
+    {
+        case EValueType::Float:
+        {
+            if (property->IsA<FFloatProperty>())
+            {
+                propertyType = EPropertyType::Float;
+                isTypeValid  = true;
+            }
+            else if (property->IsA<FDoubleProperty>())
+            {
+                propertyType = EPropertyType::Double;
+                isTypeValid  = true;
+            }
+            break;
+        }
+        case EValueType::Vector:
+        {
+            if (structType == TBaseStructure<FVector>::Get())
+            {
+                propertyType = EPropertyType::Vector;
+                isTypeValid  = true;
+            }
+            else if (structType == TVariantStructure<FVector3f>::Get())
+            {
+                propertyType = EPropertyType::Vector3f;
+                isTypeValid  = true;
+            }
+            break;
+        }
+        case EValueType::Vector2D:
+        {
+            if (structType == TBaseStructure<FVector2D>::Get())
+            {
+                propertyType = EPropertyType::Vector2D;
+                isTypeValid  = true;
+            }
+            else if (structType == TVariantStructure<FVector2f>::Get())
+            {
+                propertyType = EPropertyType::Vector2f;
+                isTypeValid  = true;
+            }
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    if (!isTypeValid)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("FTweenPropertyBinding::Bind -> the type of \"%s\" (%s) doesn't match the value of the Tween."),
+               *pPropertyPath, *property->GetCPPType());
+        return false;
+    }
+
+    mBoundClass   = pObject->GetClass();
+    mFailedClass  = nullptr;
+    mProperty     = property;
+    mOffset       = offset;
+    mPropertyType = propertyType;
+
+    // A setter can only be called on a property of the object itself: the members of a struct are always written in place
+    bUseSetter = names.Num() == 1 && property->HasSetter();
+
+    // The setter already takes care of the render thread. Otherwise only the components with a scene proxy need to be told, and only
+    // about the native properties (the ones declared in Blueprint never reach the proxy)
+    FProperty* rootProperty = FindPropertyInStruct(pObject->GetClass(), names[0]);
+    UClass* rootOwnerClass  = rootProperty->GetOwnerClass();
+
+    if (bUseSetter || rootOwnerClass == nullptr || !rootOwnerClass->HasAnyClassFlags(CLASS_Native))
+    {
+        mRenderUpdate = ERenderUpdate::None;
+    }
+    else if (pObject->IsA<ULightComponent>() && names.Num() == 1
+             && Algo::Find(LightColorAndBrightnessProperties, rootProperty->GetFName()) != nullptr)
+    {
+        mRenderUpdate = ERenderUpdate::LightColorAndBrightness;
+    }
+    else if (pObject->IsA<UPrimitiveComponent>() || pObject->IsA<ULightComponentBase>())
+    {
+        mRenderUpdate = ERenderUpdate::RenderState;
+    }
+    else
+    {
+        mRenderUpdate = ERenderUpdate::None;
+    }
+
+    return true;
+}
+
+// public ----------------------------------------------------------------------
+void FTweenPropertyBinding::Reset()
+{
+    mPropertyPath.Reset();
+    mValueType    = EValueType::Float;
+    mBoundClass   = nullptr;
+    mFailedClass  = nullptr;
+    mProperty     = nullptr;
+    mOffset       = 0;
+    mPropertyType = EPropertyType::Float;
+    bUseSetter    = false;
+    mRenderUpdate = ERenderUpdate::None;
+}
+
+// public ----------------------------------------------------------------------
+void FTweenPropertyBinding::Write(UObject* pObject, float pValue)
+{
+    if (!ValidateBinding(pObject))
+    {
+        return;
+    }
+
+    switch (mPropertyType)
+    {
+        case EPropertyType::Float:
+        {
+            WriteValue(pObject, pValue);
+            break;
+        }
+        case EPropertyType::Double:
+        {
+            WriteValue(pObject, static_cast<double>(pValue));
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FTweenPropertyBinding::Write(UObject* pObject, const FVector& pValue)
+{
+    if (!ValidateBinding(pObject))
+    {
+        return;
+    }
+
+    switch (mPropertyType)
+    {
+        case EPropertyType::Vector:
+        {
+            WriteValue(pObject, pValue);
+            break;
+        }
+        case EPropertyType::Vector3f:
+        {
+            WriteValue(pObject, FVector3f(pValue));
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FTweenPropertyBinding::Write(UObject* pObject, const FVector2D& pValue)
+{
+    if (!ValidateBinding(pObject))
+    {
+        return;
+    }
+
+    switch (mPropertyType)
+    {
+        case EPropertyType::Vector2D:
+        {
+            WriteValue(pObject, pValue);
+            break;
+        }
+        case EPropertyType::Vector2f:
+        {
+            WriteValue(pObject, FVector2f(pValue));
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// private ---------------------------------------------------------------------
+bool FTweenPropertyBinding::ValidateBinding(UObject* pObject)
+{
+    if (pObject == nullptr)
+    {
+        return false;
+    }
+
+    if (mProperty == nullptr)
+    {
+        // A path that couldn't be resolved is only tried again on a different class (e.g. once the Blueprint has been fixed and recompiled)
+        if (mPropertyPath.IsEmpty() || pObject->GetClass() == mFailedClass.Get())
+        {
+            return false;
+        }
+    }
+    else if (pObject->GetClass() == mBoundClass.Get())
+    {
+        return true;
+    }
+
+    // Recompiling a Blueprint replaces its class (and its instances), and the cached property and offset die with the old one
+    const FString propertyPath = mPropertyPath;
+    return Bind(pObject, propertyPath, mValueType);
+}
+
+// private ---------------------------------------------------------------------
+template<typename PropertyValueType>
+void FTweenPropertyBinding::WriteValue(UObject* pObject, const PropertyValueType& pValue) const
+{
+    if (bUseSetter)
+    {
+        mProperty->CallSetter(pObject, &pValue);
+        return;
+    }
+
+    PropertyValueType& propertyValue = *reinterpret_cast<PropertyValueType*>(reinterpret_cast<uint8*>(pObject) + mOffset);
+
+    // Nothing to tell the render thread if the value didn't change (e.g. while a Tween is delayed)
+    if (propertyValue == pValue)
+    {
+        return;
+    }
+
+    propertyValue = pValue;
+
+    switch (mRenderUpdate)
+    {
+        case ERenderUpdate::LightColorAndBrightness:
+        {
+            CastChecked<ULightComponent>(pObject)->UpdateColorAndBrightness();
+            break;
+        }
+        case ERenderUpdate::RenderState:
+        {
+            CastChecked<UActorComponent>(pObject)->MarkRenderStateDirty();
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
@@ -0,0 +1,678 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Utils/TweenRecorder.h"
+#include "Utils/Utility.h"
+#include "Tweens/BaseTween.h"
+#include "Tweens/TweenVector.h"
+#include "Tweens/TweenVector2D.h"
+#include "Tweens/TweenRotator.h"
+#include "Tweens/TweenLinearColor.h"
+#include "Tweens/TweenFloat.h"
+#include "Tweens/TweenTransform.h"
+#include "TweenContainer.h"
+#include "TweenManagerComponent.h"
+#include "TweenManagerActor.h"
+#include "Components/SplineComponent.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+namespace
+{
+    void WriteOp(FArchive& pArchive, ETweenRecordOp pOp)
+    {
+        uint8 op = static_cast<uint8>(pOp);
+        pArchive << op;
+    }
+
+    void WriteId(FArchive& pArchive, uint32 pId)
+    {
+        pArchive.SerializeIntPacked(pId);
+    }
+
+    /// @brief Number of frames between two prunings of the targets and the splines that were destroyed.
+    const int32 FramesBetweenPrunes = 600;
+
+    FAutoConsoleCommand StartRecordingCommand(TEXT("TweenMaker.StartRecording"),
+                                              TEXT("Starts recording the workload of the global TweenManager. Usage: TweenMaker.StartRecording [FileName]"),
+                                              FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& pArgs)
+                                              {
+                                                  UTweenManagerComponent* instance = ATweenManagerActor::GetInstance();
+
+                                                  if (instance != nullptr)
+                                                  {
+                                                      instance->StartRecording(pArgs.Num() > 0 ? pArgs[0] : FString());
+                                                  }
+                                              }));
+
+    FAutoConsoleCommand StopRecordingCommand(TEXT("TweenMaker.StopRecording"),
+                                             TEXT("Stops recording the workload of the global TweenManager."),
+                                             FConsoleCommandDelegate::CreateLambda([]()
+                                             {
+                                                 UTweenManagerComponent* instance = ATweenManagerActor::GetInstance();
+
+                                                 if (instance != nullptr)
+                                                 {
+                                                     instance->StopRecording();
+                                                 }
+                                             }));
+}
+
+// public ----------------------------------------------------------------------
+FTweenRecordedTween::FTweenRecordedTween()
+    : TweenClass(ETweenRecordedClass::Float)
+    , TweenType(0)
+    , TargetType(ETweenTargetType::Custom)
+    , ContainerId(0)
+    , TargetId(0)
+    , SequenceIndex(0)
+    , From(0.0f, 0.0f, 0.0f, 0.0f)
+    , To(0.0f, 0.0f, 0.0f, 0.0f)
+    , Duration(0.0f)
+    , EaseType(ETweenEaseType::Linear)
+    , NumLoops(1)
+    , LoopType(ETweenLoopType::Yoyo)
+    , Delay(0.0f)
+    , TimeScale(1.0f)
+    , TweenSpace(ETweenSpace::World)
+    , RotationMode(ETweenRotationMode::ShortestPath)
+    , Flags(0)
+    , ParameterName(NAME_None)
+    , PivotPoint(0.0f, 0.0f, 0.0f)
+    , Axis(0.0f, 0.0f, 1.0f)
+    , Radius(0.0f)
+    , SplineId(0)
+    , ToRotation(FQuat4f::Identity)
+    , ToScale(1.0f, 1.0f, 1.0f)
+    , BezierControlPoints()
+{
+
+}
+
+// public ----------------------------------------------------------------------
+FArchive& operator<<(FArchive& pArchive, FTweenRecordedTween& pRecord)
+{
+    pArchive << pRecord.TweenClass;
+    pArchive << pRecord.TweenType;
+    pArchive << pRecord.TargetType;
+    pArchive.SerializeIntPacked(pRecord.ContainerId);
+    pArchive.SerializeIntPacked(pRecord.TargetId);
+    pArchive << pRecord.SequenceIndex;
+    pArchive << pRecord.Duration;
+    pArchive << pRecord.EaseType;
+    pArchive << pRecord.NumLoops;
+    pArchive << pRecord.LoopType;
+    pArchive << pRecord.Delay;
+    pArchive << pRecord.TimeScale;
+    pArchive << pRecord.Flags;
+
+    // Only the payload that the Tween class actually uses is written
+    switch (pRecord.TweenClass)
+    {
+        case ETweenRecordedClass::Float:
+        {
+            pArchive << pRecord.From.X << pRecord.To.X;
+
+            FString parameterName = pRecord.ParameterName.ToString();
+            pArchive << parameterName;
+            pRecord.ParameterName = FName(*parameterName);
+            break;
+        }
+        case ETweenRecordedClass::FloatRotateAround:
+        {
+            pArchive << pRecord.From.X << pRecord.To.X;
+            pArchive << pRecord.PivotPoint << pRecord.Axis << pRecord.Radius;
+            pArchive << pRecord.TweenSpace;
+            break;
+        }
+        case ETweenRecordedClass::FloatFollowSpline:
+        {
+            pArchive.SerializeIntPacked(pRecord.SplineId);
+            break;
+        }
+        case ETweenRecordedClass::Vector2D:
+        {
+            pArchive << pRecord.From.X << pRecord.From.Y << pRecord.To.X << pRecord.To.Y;
+            break;
+        }
+        case ETweenRecordedClass::Vector:
+        {
+            pArchive << pRecord.From.X << pRecord.From.Y << pRecord.From.Z;
+            pArchive << pRecord.To.X << pRecord.To.Y << pRecord.To.Z;
+            pArchive << pRecord.TweenSpace;
+
+            if (static_cast<ETweenVectorType>(pRecord.TweenType) == ETweenVectorType::MoveAlongBezier)
+            {
+                pArchive << pRecord.BezierControlPoints;
+            }
+            break;
+        }
+        case ETweenRecordedClass::Rotator:
+        {
+            pArchive << pRecord.From.X << pRecord.From.Y << pRecord.From.Z;
+            pArchive << pRecord.To.X << pRecord.To.Y << pRecord.To.Z;
+            pArchive << pRecord.TweenSpace << pRecord.RotationMode;
+            break;
+        }
+        case ETweenRecordedClass::LinearColor:
+        {
+            pArchive << pRecord.From << pRecord.To;
+
+            FString parameterName = pRecord.ParameterName.ToString();
+            pArchive << parameterName;
+            pRecord.ParameterName = FName(*parameterName);
+            break;
+        }
+        case ETweenRecordedClass::Transform:
+        {
+            pArchive << pRecord.To.X << pRecord.To.Y << pRecord.To.Z;
+            pArchive << pRecord.ToRotation << pRecord.ToScale;
+            pArchive << pRecord.TweenSpace << pRecord.RotationMode;
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    return pArchive;
+}
+
+// public ----------------------------------------------------------------------
+FTweenRecorder::FTweenRecorder(const FString& pFilePath)
+    : mFilePath(pFilePath)
+    , mNextContainerId(1)
+    , mNextTweenId(1)
+    , mNextTargetId(1)
+    , mNextSplineId(1)
+    , mFramesSincePrune(0)
+{
+    mWriter = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*mFilePath));
+
+    if (mWriter.IsValid())
+    {
+        uint32 magic   = TWEEN_RECORDING_MAGIC;
+        uint32 version = TWEEN_RECORDING_VERSION;
+
+        *mWriter << magic << version;
+    }
+    else
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("FTweenRecorder::FTweenRecorder -> couldn't open the file %s for writing."), *mFilePath);
+    }
+}
+
+// public ----------------------------------------------------------------------
+FTweenRecorder::~FTweenRecorder()
+{
+    if (mWriter.IsValid())
+    {
+        WriteOp(*mWriter, ETweenRecordOp::End);
+        mWriter->Close();
+    }
+}
+
+// public ----------------------------------------------------------------------
+bool FTweenRecorder::IsValid() const
+{
+    return mWriter.IsValid();
+}
+
+// public ----------------------------------------------------------------------
+const FString& FTweenRecorder::GetFilePath() const
+{
+    return mFilePath;
+}
+
+// static public ---------------------------------------------------------------
+FTweenRecorder* FTweenRecorder::Get(const UTweenContainer* pTweenContainer)
+{
+    FTweenRecorder* outRecorder = nullptr;
+
+    if (pTweenContainer != nullptr && pTweenContainer->OwningTweenManager != nullptr)
+    {
+        outRecorder = pTweenContainer->OwningTweenManager->GetTweenRecorder();
+    }
+
+    return outRecorder;
+}
+
+// static public ---------------------------------------------------------------
+FString FTweenRecorder::MakeRecordingPath(const FString& pFileName)
+{
+    FString fileName = pFileName;
+
+    if (fileName.IsEmpty())
+    {
+        fileName = FString::Printf(TEXT("TweenRecording-%s"), *FDateTime::Now().ToString());
+    }
+
+    if (FPaths::GetExtension(fileName).IsEmpty())
+    {
+        fileName += TEXT(".tweenrec");
+    }
+
+    if (FPaths::IsRelative(fileName))
+    {
+        fileName = FPaths::Combine(FPaths::ProfilingDir(), TEXT("TweenMaker"), fileName);
+    }
+
+    return fileName;
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::RecordFrame(float pDeltaTime, bool pIsGamePaused)
+{
+    if (mWriter.IsValid())
+    {
+        uint8 isGamePaused = pIsGamePaused ? 1 : 0;
+
+        WriteOp(*mWriter, ETweenRecordOp::Frame);
+        *mWriter << pDeltaTime << isGamePaused;
+    }
+
+    // Tweens and TweenContainers are forgotten when they're destroyed, while targets and splines have no such notification
+    if (++mFramesSincePrune >= FramesBetweenPrunes)
+    {
+        PruneObjectIds(mTargetIds);
+        PruneObjectIds(mSplineIds);
+        mFramesSincePrune = 0;
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::RecordCreateContainer(const UTweenContainer* pTweenContainer, int32 pNumLoops, ETweenLoopType pLoopType, float pTimeScale)
+{
+    if (mWriter.IsValid())
+    {
+        uint32 containerId = mNextContainerId++;
+        mContainerIds.Add(FObjectKey(pTweenContainer), containerId);
+
+        WriteOp(*mWriter, ETweenRecordOp::CreateContainer);
+        WriteId(*mWriter, containerId);
+        *mWriter << pNumLoops << pLoopType << pTimeScale;
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::RecordTween(const UTweenContainer* pTweenContainer, int32 pSequenceIndex, bool pIsJoin, const UBaseTween* pTween)
+{
+    uint32 containerId = GetObjectId(mContainerIds, mNextContainerId, pTweenContainer, false);
+
+    // Tweens added to containers that were created before the recording started can't be replayed
+    if (!mWriter.IsValid() || containerId == 0)
+    {
+        return;
+    }
+
+    FTweenRecordedTween record;
+    record.TargetType    = pTween->mTargetType;
+    record.ContainerId   = containerId;
+    record.TargetId      = GetObjectId(mTargetIds, mNextTargetId, pTween->mTargetObject.Get(), true);
+    record.SequenceIndex = pSequenceIndex;
+    record.Duration      = pTween->mTweenDuration;
+    record.EaseType      = pTween->mEaseType;
+    record.NumLoops      = pTween->mNumLoops;
+    record.LoopType      = pTween->mLoopType;
+    record.Delay         = pTween->mDelay;
+    record.TimeScale     = pTween->mTimeScale;
+    record.Flags         = pTween->bTweenWhileGameIsPaused ? FTweenRecordedTween::TweenWhileGamePaused : 0;
+
+    if (const UTweenVector* tweenVector = Cast<UTweenVector>(pTween))
+    {
+        record.TweenClass = ETweenRecordedClass::Vector;
+        record.TweenType  = static_cast<uint8>(tweenVector->mTweenType);
+        record.From       = FVector4f(FVector3f(tweenVector->mFrom), 0.0f);
+        record.To         = FVector4f(FVector3f(tweenVector->mTo), 0.0f);
+        record.TweenSpace = tweenVector->mTweenSpace;
+        record.Flags     |= tweenVector->bDeleteTweenOnHit ? FTweenRecordedTween::DeleteOnHit : 0;
+        record.Flags     |= tweenVector->bDeleteTweenOnOverlap ? FTweenRecordedTween::DeleteOnOverlap : 0;
+
+        if (tweenVector->mTweenType == ETweenVectorType::MoveAlongBezier)
+        {
+            record.BezierControlPoints.Add(FVector3f(tweenVector->mBezierControlPoint1));
+
+            if (tweenVector->bIsCubicBezier)
+            {
+                record.BezierControlPoints.Add(FVector3f(tweenVector->mBezierControlPoint2));
+            }
+
+            record.Flags |= tweenVector->bBezierConstantSpeed ? FTweenRecordedTween::BezierConstantSpeed : 0;
+        }
+    }
+    else if (const UTweenVector2D* tweenVector2D = Cast<UTweenVector2D>(pTween))
+    {
+        record.TweenClass = ETweenRecordedClass::Vector2D;
+        record.TweenType  = static_cast<uint8>(tweenVector2D->mTweenType);
+        record.From       = FVector4f(tweenVector2D->mFrom.X, tweenVector2D->mFrom.Y, 0.0f, 0.0f);
+        record.To         = FVector4f(tweenVector2D->mTo.X, tweenVector2D->mTo.Y, 0.0f, 0.0f);
+    }
+    else if (const UTweenRotator* tweenRotator = Cast<UTweenRotator>(pTween))
+    {
+        record.TweenClass   = ETweenRecordedClass::Rotator;
+        record.TweenType    = static_cast<uint8>(tweenRotator->mTweenType);
+        record.From         = FVector4f(tweenRotator->mFromRotator.Pitch, tweenRotator->mFromRotator.Yaw, tweenRotator->mFromRotator.Roll, 0.0f);
+        record.To           = FVector4f(tweenRotator->mToRotator.Pitch, tweenRotator->mToRotator.Yaw, tweenRotator->mToRotator.Roll, 0.0f);
+        record.TweenSpace   = tweenRotator->mTweenSpace;
+        record.RotationMode = tweenRotator->mRotationMode;
+        record.Flags       |= tweenRotator->mLocalSpace ? FTweenRecordedTween::LocalSpace : 0;
+        record.Flags       |= tweenRotator->bDeleteTweenOnHit ? FTweenRecordedTween::DeleteOnHit : 0;
+        record.Flags       |= tweenRotator->bDeleteTweenOnOverlap ? FTweenRecordedTween::DeleteOnOverlap : 0;
+    }
+    else if (const UTweenLinearColor* tweenLinearColor = Cast<UTweenLinearColor>(pTween))
+    {
+        record.TweenClass    = ETweenRecordedClass::LinearColor;
+        record.TweenType     = static_cast<uint8>(tweenLinearColor->mTweenType);
+        record.From          = FVector4f(tweenLinearColor->From.R, tweenLinearColor->From.G, tweenLinearColor->From.B, tweenLinearColor->From.A);
+        record.To            = FVector4f(tweenLinearColor->To.R, tweenLinearColor->To.G, tweenLinearColor->To.B, tweenLinearColor->To.A);
+        record.ParameterName = tweenLinearColor->mParameterName;
+    }
+    else if (const UTweenFloat* tweenFloat = Cast<UTweenFloat>(pTween))
+    {
+        record.TweenType = static_cast<uint8>(tweenFloat->mTweenType);
+        record.From.X    = tweenFloat->mFrom;
+        record.To.X      = tweenFloat->mTo;
+
+        switch (tweenFloat->mTweenType)
+        {
+            case ETweenFloatType::RotateAroundPoint:
+            {
+                record.TweenClass = ETweenRecordedClass::FloatRotateAround;
+                record.PivotPoint = FVector3f(tweenFloat->mPivotPoint);
+                record.Axis       = FVector3f(tweenFloat->mAxis);
+                record.Radius     = tweenFloat->mRadius;
+                record.TweenSpace = tweenFloat->mTweenSpace;
+                break;
+            }
+            case ETweenFloatType::FollowSpline:
+            {
+                record.TweenClass = ETweenRecordedClass::FloatFollowSpline;
+                record.SplineId   = RecordSpline(tweenFloat->mSpline);
+                record.Flags     |= tweenFloat->bSplineApplyRotation ? FTweenRecordedTween::SplineApplyRotation : 0;
+                record.Flags     |= tweenFloat->bSplineApplyScale ? FTweenRecordedTween::SplineApplyScale : 0;
+                record.Flags     |= tweenFloat->bUseConstantSpeed ? FTweenRecordedTween::SplineConstantSpeed : 0;
+                break;
+            }
+            default:
+            {
+                record.TweenClass    = ETweenRecordedClass::Float;
+                record.ParameterName = tweenFloat->mParameterName;
+                break;
+            }
+        }
+
+        record.Flags |= tweenFloat->bDeleteTweenOnHit ? FTweenRecordedTween::DeleteOnHit : 0;
+        record.Flags |= tweenFloat->bDeleteTweenOnOverlap ? FTweenRecordedTween::DeleteOnOverlap : 0;
+    }
+    else if (const UTweenTransform* tweenTransform = Cast<UTweenTransform>(pTween))
+    {
+        record.TweenClass   = ETweenRecordedClass::Transform;
+        record.TweenType    = static_cast<uint8>(tweenTransform->mTweenType);
+        record.To           = FVector4f(FVector3f(tweenTransform->mTo.GetLocation()), 0.0f);
+        record.ToRotation   = FQuat4f(tweenTransform->mTo.GetRotation());
+        record.ToScale      = FVector3f(tweenTransform->mTo.GetScale3D());
+        record.TweenSpace   = tweenTransform->mTweenSpace;
+        record.RotationMode = tweenTransform->mRotationMode;
+        record.Flags       |= tweenTransform->bDeleteTweenOnHit ? FTweenRecordedTween::DeleteOnHit : 0;
+        record.Flags       |= tweenTransform->bDeleteTweenOnOverlap ? FTweenRecordedTween::DeleteOnOverlap : 0;
+    }
+    else
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("FTweenRecorder::RecordTween -> unknown Tween class %s, it won't be recorded."), *pTween->GetClass()->GetName());
+        return;
+    }
+
+    // The id is assigned only now, so that the ids in the file are always sequential (the replayer relies on it)
+    mTweenIds.Add(FObjectKey(pTween), mNextTweenId++);
+
+    WriteOp(*mWriter, pIsJoin ? ETweenRecordOp::JoinTween : ETweenRecordOp::AppendTween);
+    *mWriter << record;
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::RecordContainerOp(ETweenRecordOp pOp, const UTweenContainer* pTweenContainer, float pValue, int32 pIntValue)
+{
+    uint32 containerId = GetObjectId(mContainerIds, mNextContainerId, pTweenContainer, false);
+
+    if (mWriter.IsValid() && containerId != 0)
+    {
+        WriteOp(*mWriter, pOp);
+        WriteId(*mWriter, containerId);
+
+        switch (pOp)
+        {
+            case ETweenRecordOp::ContainerTimeScale:
+            {
+                *mWriter << pValue;
+                break;
+            }
+            case ETweenRecordOp::ContainerPersistent:
+            {
+                *mWriter << pIntValue;
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::RecordContainerLoop(const UTweenContainer* pTweenContainer, int32 pNumLoops, ETweenLoopType pLoopType)
+{
+    uint32 containerId = GetObjectId(mContainerIds, mNextContainerId, pTweenContainer, false);
+
+    if (mWriter.IsValid() && containerId != 0)
+    {
+        WriteOp(*mWriter, ETweenRecordOp::ContainerLoop);
+        WriteId(*mWriter, containerId);
+        *mWriter << pNumLoops << pLoopType;
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::RecordTweenOp(ETweenRecordOp pOp, const UBaseTween* pTween, float pValue, int32 pIntValue)
+{
+    uint32 tweenId = GetObjectId(mTweenIds, mNextTweenId, pTween, false);
+
+    if (mWriter.IsValid() && tweenId != 0)
+    {
+        WriteOp(*mWriter, pOp);
+        WriteId(*mWriter, tweenId);
+
+        switch (pOp)
+        {
+            case ETweenRecordOp::TweenTimeScale:
+            case ETweenRecordOp::TweenDelay:
+            {
+                *mWriter << pValue;
+                break;
+            }
+            case ETweenRecordOp::TweenDelete:
+            case ETweenRecordOp::TweenPause:
+            case ETweenRecordOp::TweenTogglePause:
+            case ETweenRecordOp::TweenInstanceIndex:
+            case ETweenRecordOp::TweenCustomPrimitiveDataIndex:
+            {
+                *mWriter << pIntValue;
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::RecordTweenSpring(const UBaseTween* pTween, float pFrequency, float pDampingRatio, float pSettleThreshold, bool pEndWhenSettled)
+{
+    uint32 tweenId = GetObjectId(mTweenIds, mNextTweenId, pTween, false);
+
+    if (mWriter.IsValid() && tweenId != 0)
+    {
+        uint8 endWhenSettled = pEndWhenSettled ? 1 : 0;
+
+        WriteOp(*mWriter, ETweenRecordOp::TweenSpring);
+        WriteId(*mWriter, tweenId);
+        *mWriter << pFrequency << pDampingRatio << pSettleThreshold << endWhenSettled;
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::RecordTweenRetarget(const UBaseTween* pTween, const FVector4f& pNewTo, float pNewDuration)
+{
+    uint32 tweenId = GetObjectId(mTweenIds, mNextTweenId, pTween, false);
+
+    if (mWriter.IsValid() && tweenId != 0)
+    {
+        FVector4f newTo = pNewTo;
+
+        WriteOp(*mWriter, ETweenRecordOp::TweenRetarget);
+        WriteId(*mWriter, tweenId);
+        *mWriter << newTo << pNewDuration;
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::RecordTweenOrbiters(const UBaseTween* pTween, const TArray<USceneComponent*>& pOrbiters)
+{
+    uint32 tweenId = GetObjectId(mTweenIds, mNextTweenId, pTween, false);
+
+    if (mWriter.IsValid() && tweenId != 0)
+    {
+        // The orbiters share the ids of the targets, so a component that is also tweened on its own is the same dummy in the replay
+        TArray<uint32> orbiterIds;
+        orbiterIds.Reserve(pOrbiters.Num());
+
+        for (USceneComponent* orbiter : pOrbiters)
+        {
+            orbiterIds.Add(GetObjectId(mTargetIds, mNextTargetId, orbiter, true));
+        }
+
+        int32 numOrbiters = orbiterIds.Num();
+
+        WriteOp(*mWriter, ETweenRecordOp::TweenAddOrbiters);
+        WriteId(*mWriter, tweenId);
+        *mWriter << numOrbiters;
+
+        for (uint32 orbiterId : orbiterIds)
+        {
+            WriteId(*mWriter, orbiterId);
+        }
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::RecordTweenDestination(const UBaseTween* pTween, const USceneComponent* pDestination, FName pSocketName, const FVector& pOffset)
+{
+    uint32 tweenId = GetObjectId(mTweenIds, mNextTweenId, pTween, false);
+
+    if (mWriter.IsValid() && tweenId != 0)
+    {
+        uint32 destinationId = GetObjectId(mTargetIds, mNextTargetId, pDestination, true);
+        FString socketName   = pSocketName.ToString();
+        FVector3f offset     = FVector3f(pOffset);
+
+        WriteOp(*mWriter, ETweenRecordOp::TweenDestination);
+        WriteId(*mWriter, tweenId);
+        WriteId(*mWriter, destinationId);
+        *mWriter << socketName << offset;
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::RecordDeleteAllTweens()
+{
+    if (mWriter.IsValid())
+    {
+        WriteOp(*mWriter, ETweenRecordOp::DeleteAllTweens);
+    }
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::ForgetContainer(const UTweenContainer* pTweenContainer)
+{
+    mContainerIds.Remove(FObjectKey(pTweenContainer));
+}
+
+// public ----------------------------------------------------------------------
+void FTweenRecorder::ForgetTween(const UBaseTween* pTween)
+{
+    mTweenIds.Remove(FObjectKey(pTween));
+}
+
+// private ---------------------------------------------------------------------
+uint32 FTweenRecorder::RecordSpline(const USplineComponent* pSpline)
+{
+    uint32 splineId = GetObjectId(mSplineIds, mNextSplineId, pSpline, false);
+
+    if (splineId == 0 && pSpline != nullptr)
+    {
+        splineId = GetObjectId(mSplineIds, mNextSplineId, pSpline, true);
+
+        // The points are saved in world space, so that the replayed spline doesn't need its owner's transform
+        int32 numPoints   = pSpline->GetNumberOfSplinePoints();
+        uint8 isClosed    = pSpline->IsClosedLoop() ? 1 : 0;
+        float duration    = pSpline->Duration;
+
+        WriteOp(*mWriter, ETweenRecordOp::SplineDefinition);
+        WriteId(*mWriter, splineId);
+        *mWriter << numPoints << isClosed << duration;
+
+        for (int32 i = 0; i < numPoints; ++i)
+        {
+            FVector3f location      = FVector3f(pSpline->GetLocationAtSplinePoint(i, ESplineCoordinateSpace::World));
+            FVector3f arriveTangent = FVector3f(pSpline->GetArriveTangentAtSplinePoint(i, ESplineCoordinateSpace::World));
+            FVector3f leaveTangent  = FVector3f(pSpline->GetLeaveTangentAtSplinePoint(i, ESplineCoordinateSpace::World));
+            FRotator3f rotation     = FRotator3f(pSpline->GetRotationAtSplinePoint(i, ESplineCoordinateSpace::World));
+            FVector3f scale         = FVector3f(pSpline->GetScaleAtSplinePoint(i));
+            uint8 pointType         = static_cast<uint8>(pSpline->GetSplinePointType(i));
+
+            *mWriter << location << arriveTangent << leaveTangent << rotation << scale << pointType;
+        }
+    }
+
+    return splineId;
+}
+
+// static private --------------------------------------------------------------
+uint32 FTweenRecorder::GetObjectId(TMap<FObjectKey, uint32>& pMap, uint32& pNextId, const UObject* pObject, bool pAddIfMissing)
+{
+    uint32 outId = 0;
+
+    if (pObject != nullptr)
+    {
+        FObjectKey objectKey  = FObjectKey(pObject);
+        const uint32* foundId = pMap.Find(objectKey);
+
+        if (foundId != nullptr)
+        {
+            outId = *foundId;
+        }
+        else if (pAddIfMissing)
+        {
+            outId = pNextId++;
+            pMap.Add(objectKey, outId);
+        }
+    }
+
+    return outId;
+}
+
+// static private --------------------------------------------------------------
+void FTweenRecorder::PruneObjectIds(TMap<FObjectKey, uint32>& pMap)
+{
+    for (auto it = pMap.CreateIterator(); it; ++it)
+    {
+        if (it.Key().ResolveObjectPtr() == nullptr)
+        {
+            it.RemoveCurrent();
+        }
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Utils/TweenReplayCommandlet.h"
+#include "Utils/TweenReplayer.h"
+#include "Utils/TweenRecorder.h"
+#include "Utils/Utility.h"
+
+// public ----------------------------------------------------------------------
+UTweenReplayCommandlet::UTweenReplayCommandlet()
+{
+    IsClient     = false;
+    IsServer     = false;
+    IsEditor     = false;
+    LogToConsole = true;
+}
+
+// public ----------------------------------------------------------------------
+int32 UTweenReplayCommandlet::Main(const FString& Params)
+{
+    FString fileName;
+    int32 iterations = 1;
+
+    if (!FParse::Value(*Params, TEXT("File="), fileName))
+    {
+        UE_LOG(LogTweenMaker, Error, TEXT("UTweenReplayCommandlet::Main -> missing -File=<FileName> argument."));
+        return 1;
+    }
+
+    FParse::Value(*Params, TEXT("Iterations="), iterations);
+    iterations = FMath::Max(1, iterations);
+
+    FTweenReplayer replayer;
+
+    if (!replayer.Load(FTweenRecorder::MakeRecordingPath(fileName)))
+    {
+        return 1;
+    }
+
+    int32 result = 0;
+
+    for (int32 i = 0; i < iterations; ++i)
+    {
+        FTweenReplayStats stats;
+
+        if (!replayer.Replay(stats))
+        {
+            result = 1;
+        }
+
+        UE_LOG(LogTweenMaker, Display, TEXT("UTweenReplayCommandlet::Main -> run %d: %s"), i + 1, *stats.ToString());
+    }
+
+    return result;
+}
@@ -0,0 +1,818 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Utils/TweenReplayer.h"
+#include "Utils/TweenRecorder.h"
+#include "Utils/Utility.h"
+#include "Tweens/BaseTween.h"
+#include "Tweens/TweenVector.h"
+#include "Tweens/TweenVector2D.h"
+#include "Tweens/TweenRotator.h"
+#include "Tweens/TweenLinearColor.h"
+#include "Tweens/TweenFloat.h"
+#include "Tweens/TweenTransform.h"
+#include "TweenContainer.h"
+#include "TweenManagerComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/SplineComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/Image.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+
+namespace
+{
+    FAutoConsoleCommand ReplayCommand(TEXT("TweenMaker.Replay"),
+                                      TEXT("Replays a Tween recording on dummy targets and logs its timings. Usage: TweenMaker.Replay <FileName> [Iterations]"),
+                                      FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& pArgs)
+                                      {
+                                          if (pArgs.Num() == 0)
+                                          {
+                                              UE_LOG(LogTweenMaker, Warning, TEXT("TweenMaker.Replay -> missing file name."));
+                                              return;
+                                          }
+
+                                          int32 iterations = pArgs.Num() > 1 ? FMath::Max(1, FCString::Atoi(*pArgs[1])) : 1;
+
+                                          FTweenReplayer replayer;
+
+                                          if (replayer.Load(FTweenRecorder::MakeRecordingPath(pArgs[0])))
+                                          {
+                                              for (int32 i = 0; i < iterations; ++i)
+                                              {
+                                                  FTweenReplayStats stats;
+                                                  replayer.Replay(stats);
+
+                                                  UE_LOG(LogTweenMaker, Display, TEXT("TweenMaker.Replay -> run %d: %s"), i + 1, *stats.ToString());
+                                              }
+                                          }
+                                      }));
+}
+
+// public ----------------------------------------------------------------------
+FTweenReplayStats::FTweenReplayStats()
+    : NumFrames(0)
+    , NumContainers(0)
+    , NumTweens(0)
+    , TotalUpdateSeconds(0.0)
+    , MaxFrameSeconds(0.0)
+    , TotalOpsSeconds(0.0)
+{
+
+}
+
+// public ----------------------------------------------------------------------
+FString FTweenReplayStats::ToString() const
+{
+    double averageFrameMs = NumFrames > 0 ? TotalUpdateSeconds * 1000.0 / NumFrames : 0.0;
+
+    return FString::Printf(TEXT("%d frames, %d containers, %d tweens | update %.3f ms total, %.4f ms avg, %.4f ms max | ops %.3f ms total"),
+                           NumFrames,
+                           NumContainers,
+                           NumTweens,
+                           TotalUpdateSeconds * 1000.0,
+                           averageFrameMs,
+                           MaxFrameSeconds * 1000.0,
+                           TotalOpsSeconds * 1000.0);
+}
+
+// public ----------------------------------------------------------------------
+FTweenReplayer::FTweenReplayer()
+    : mTweenManager(nullptr)
+{
+
+}
+
+// public ----------------------------------------------------------------------
+bool FTweenReplayer::Load(const FString& pFilePath)
+{
+    mData.Reset();
+
+    if (!FFileHelper::LoadFileToArray(mData, *pFilePath))
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("FTweenReplayer::Load -> couldn't read the file %s."), *pFilePath);
+        return false;
+    }
+
+    FMemoryReader reader(mData);
+    uint32 magic   = 0;
+    uint32 version = 0;
+
+    reader << magic << version;
+
+    if (reader.IsError() || magic != TWEEN_RECORDING_MAGIC || version != TWEEN_RECORDING_VERSION)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("FTweenReplayer::Load -> the file %s is not a Tween recording, or it was written by a different version."), *pFilePath);
+        mData.Reset();
+        return false;
+    }
+
+    return true;
+}
+
+// public ----------------------------------------------------------------------
+bool FTweenReplayer::Replay(FTweenReplayStats& pOutStats)
+{
+    pOutStats = FTweenReplayStats();
+
+    if (mData.Num() == 0)
+    {
+        UE_LOG(LogTweenMaker, Warning, TEXT("FTweenReplayer::Replay -> no recording was loaded."));
+        return false;
+    }
+
+    Reset();
+
+    mTweenManager = NewObject<UTweenManagerComponent>(GetTransientPackage());
+
+    FMemoryReader reader(mData);
+    uint32 magic   = 0;
+    uint32 version = 0;
+
+    reader << magic << version;
+
+    bool hasReachedEnd = false;
+    bool isCorrupted   = false;
+
+    while (!hasReachedEnd && !isCorrupted && !reader.AtEnd() && !reader.IsError())
+    {
+        uint8 opValue = 0;
+        reader << opValue;
+
+        ETweenRecordOp op  = static_cast<ETweenRecordOp>(opValue);
+        double opStartTime = FPlatformTime::Seconds();
+        bool isFrame       = false;
+
+        switch (op)
+        {
+            case ETweenRecordOp::Frame:
+            {
+                float deltaTime    = 0.0f;
+                uint8 isGamePaused = 0;
+                reader << deltaTime << isGamePaused;
+
+                isFrame = true;
+
+                double frameStartTime = FPlatformTime::Seconds();
+                mTweenManager->UpdateTweenContainers(deltaTime, isGamePaused != 0);
+                double frameSeconds = FPlatformTime::Seconds() - frameStartTime;
+
+                pOutStats.NumFrames++;
+                pOutStats.TotalUpdateSeconds += frameSeconds;
+                pOutStats.MaxFrameSeconds     = FMath::Max(pOutStats.MaxFrameSeconds, frameSeconds);
+                break;
+            }
+            case ETweenRecordOp::CreateContainer:
+            {
+                uint32 containerId      = 0;
+                int32 numLoops          = 1;
+                ETweenLoopType loopType = ETweenLoopType::Yoyo;
+                float timeScale         = 1.0f;
+
+                reader.SerializeIntPacked(containerId);
+                reader << numLoops << loopType << timeScale;
+
+                // Ids are assigned sequentially by the recorder
+                mContainers.SetNum(FMath::Max<int32>(mContainers.Num(), containerId + 1));
+                mContainers[containerId] = mTweenManager->CreateTweenContainer(numLoops, loopType, timeScale);
+
+                pOutStats.NumContainers++;
+                break;
+            }
+            case ETweenRecordOp::AppendTween:
+            case ETweenRecordOp::JoinTween:
+            {
+                FTweenRecordedTween record;
+                reader << record;
+
+                ReplayTween(record, op == ETweenRecordOp::JoinTween);
+
+                pOutStats.NumTweens++;
+                break;
+            }
+            case ETweenRecordOp::SplineDefinition:
+            {
+                ReplaySplineDefinition(reader);
+                break;
+            }
+            case ETweenRecordOp::ContainerTimeScale:
+            case ETweenRecordOp::ContainerLoop:
+            case ETweenRecordOp::ContainerPersistent:
+            case ETweenRecordOp::ContainerPause:
+            case ETweenRecordOp::ContainerResume:
+            case ETweenRecordOp::ContainerTogglePause:
+            case ETweenRecordOp::ContainerRestart:
+            case ETweenRecordOp::ContainerDelete:
+            {
+                uint32 containerId = 0;
+                reader.SerializeIntPacked(containerId);
+
+                UTweenContainer* tweenContainer = mContainers.IsValidIndex(containerId) ? mContainers[containerId].Get() : nullptr;
+
+                float value             = 0.0f;
+                int32 intValue          = 0;
+                ETweenLoopType loopType = ETweenLoopType::Yoyo;
+
+                if (op == ETweenRecordOp::ContainerTimeScale)
+                {
+                    reader << value;
+                }
+                else if (op == ETweenRecordOp::ContainerLoop)
+                {
+                    reader << intValue << loopType;
+                }
+                else if (op == ETweenRecordOp::ContainerPersistent)
+                {
+                    reader << intValue;
+                }
+
+                if (tweenContainer != nullptr)
+                {
+                    switch (op)
+                    {
+                        case ETweenRecordOp::ContainerTimeScale:
+                        {
+                            tweenContainer->SetTimeScale(value);
+                            break;
+                        }
+                        case ETweenRecordOp::ContainerLoop:
+                        {
+                            tweenContainer->SetLoop(intValue, loopType);
+                            break;
+                        }
+                        case ETweenRecordOp::ContainerPersistent:
+                        {
+                            tweenContainer->SetPersistent(intValue != 0);
+                            break;
+                        }
+                        case ETweenRecordOp::ContainerPause:
+                        {
+                            tweenContainer->PauseTweenContainer();
+                            break;
+                        }
+                        case ETweenRecordOp::ContainerResume:
+                        {
+                            tweenContainer->ResumeTweenContainer();
+                            break;
+                        }
+                        case ETweenRecordOp::ContainerTogglePause:
+                        {
+                            tweenContainer->TogglePauseTweenContainer();
+                            break;
+                        }
+                        case ETweenRecordOp::ContainerRestart:
+                        {
+                            tweenContainer->RestartTweenContainer();
+                            break;
+                        }
+                        case ETweenRecordOp::ContainerDelete:
+                        {
+                            tweenContainer->DeleteTweenContainer();
+                            break;
+                        }
+                        default:
+                        {
+                            break;
+                        }
+                    }
+                }
+                break;
+            }
+            case ETweenRecordOp::TweenDelete:
+            case ETweenRecordOp::TweenPause:
+            case ETweenRecordOp::TweenResume:
+            case ETweenRecordOp::TweenTogglePause:
+            case ETweenRecordOp::TweenRestart:
+            case ETweenRecordOp::TweenTimeScale:
+            case ETweenRecordOp::TweenDelay:
+            case ETweenRecordOp::TweenInstanceIndex:
+            case ETweenRecordOp::TweenCustomPrimitiveDataIndex:
+            {
+                uint32 tweenId = 0;
+                reader.SerializeIntPacked(tweenId);
+
+                UBaseTween* tween = mTweens.IsValidIndex(tweenId) ? mTweens[tweenId].Get() : nullptr;
+
+                float value    = 0.0f;
+                int32 intValue = 0;
+
+                if (op == ETweenRecordOp::TweenTimeScale || op == ETweenRecordOp::TweenDelay)
+                {
+                    reader << value;
+                }
+                else if (   op == ETweenRecordOp::TweenDelete
+                         || op == ETweenRecordOp::TweenPause
+                         || op == ETweenRecordOp::TweenTogglePause
+                         || op == ETweenRecordOp::TweenInstanceIndex
+                         || op == ETweenRecordOp::TweenCustomPrimitiveDataIndex)
+                {
+                    reader << intValue;
+                }
+
+                if (tween != nullptr)
+                {
+                    switch (op)
+                    {
+                        case ETweenRecordOp::TweenDelete:
+                        {
+                            tween->DeleteTween((intValue & 1) != 0, static_cast<ESnapMode>(intValue >> 1));
+                            break;
+                        }
+                        case ETweenRecordOp::TweenPause:
+                        {
+                            tween->PauseTween(intValue != 0);
+                            break;
+                        }
+                        case ETweenRecordOp::TweenResume:
+                        {
+                            tween->ResumeTween();
+                            break;
+                        }
+                        case ETweenRecordOp::TweenTogglePause:
+                        {
+                            tween->TogglePauseTween(intValue != 0);
+                            break;
+                        }
+                        case ETweenRecordOp::TweenRestart:
+                        {
+                            tween->RestartTween();
+                            break;
+                        }
+                        case ETweenRecordOp::TweenTimeScale:
+                        {
+                            tween->SetTimeScale(value);
+                            break;
+                        }
+                        case ETweenRecordOp::TweenDelay:
+                        {
+                            tween->SetDelay(value);
+                            break;
+                        }
+                        case ETweenRecordOp::TweenInstanceIndex:
+                        {
+                            // The dummy component needs the instance to exist, otherwise the Tween has nothing to move
+                            if (UInstancedStaticMeshComponent* component = Cast<UInstancedStaticMeshComponent>(tween->GetTweenTarget()))
+                            {
+                                while (component->GetInstanceCount() <= intValue)
+                                {
+                                    component->AddInstance(FTransform::Identity);
+                                }
+                            }
+
+                            tween->SetTweenTargetInstanceIndex(intValue);
+                            break;
+                        }
+                        case ETweenRecordOp::TweenCustomPrimitiveDataIndex:
+                        {
+                            tween->SetCustomPrimitiveDataIndex(intValue);
+                            break;
+                        }
+                        default:
+                        {
+                            break;
+                        }
+                    }
+                }
+                break;
+            }
+            case ETweenRecordOp::TweenSpring:
+            {
+                uint32 tweenId        = 0;
+                float frequency       = 0.0f;
+                float dampingRatio    = 0.0f;
+                float settleThreshold = 0.0f;
+                uint8 endWhenSettled  = 0;
+
+                reader.SerializeIntPacked(tweenId);
+                reader << frequency << dampingRatio << settleThreshold << endWhenSettled;
+
+                if (UBaseTween* tween = mTweens.IsValidIndex(tweenId) ? mTweens[tweenId].Get() : nullptr)
+                {
+                    tween->SetSpring(frequency, dampingRatio, settleThreshold, endWhenSettled != 0);
+                }
+                break;
+            }
+            case ETweenRecordOp::TweenRetarget:
+            {
+                uint32 tweenId    = 0;
+                FVector4f newTo   = FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+                float newDuration = -1.0f;
+
+                reader.SerializeIntPacked(tweenId);
+                reader << newTo << newDuration;
+
+                if (UBaseTween* tween = mTweens.IsValidIndex(tweenId) ? mTweens[tweenId].Get() : nullptr)
+                {
+                    ReplayRetarget(tween, newTo, newDuration);
+                }
+                break;
+            }
+            case ETweenRecordOp::TweenAddOrbiters:
+            {
+                uint32 tweenId    = 0;
+                int32 numOrbiters = 0;
+
+                reader.SerializeIntPacked(tweenId);
+                reader << numOrbiters;
+
+                TArray<USceneComponent*> orbiters;
+
+                for (int32 i = 0; i < numOrbiters && !reader.IsError(); ++i)
+                {
+                    uint32 orbiterId            = 0;
+                    ETweenTargetType targetType = ETweenTargetType::SceneComponent;
+                    reader.SerializeIntPacked(orbiterId);
+
+                    orbiters.Add(Cast<USceneComponent>(GetDummyTarget(orbiterId, targetType)));
+                }
+
+                if (UTweenFloat* tween = Cast<UTweenFloat>(mTweens.IsValidIndex(tweenId) ? mTweens[tweenId].Get() : nullptr))
+                {
+                    tween->AddOrbiters(orbiters);
+                }
+                break;
+            }
+            case ETweenRecordOp::TweenDestination:
+            {
+                uint32 tweenId              = 0;
+                uint32 destinationId        = 0;
+                FString socketName;
+                FVector3f offset            = FVector3f(0.0f, 0.0f, 0.0f);
+                ETweenTargetType targetType = ETweenTargetType::SceneComponent;
+
+                reader.SerializeIntPacked(tweenId);
+                reader.SerializeIntPacked(destinationId);
+                reader << socketName << offset;
+
+                // A destination that is tweened too is the same dummy as its Tweens' target, so it moves like it did in the recorded session
+                UBaseTween* tween            = mTweens.IsValidIndex(tweenId) ? mTweens[tweenId].Get() : nullptr;
+                USceneComponent* destination = Cast<USceneComponent>(GetDummyTarget(destinationId, targetType));
+
+                if (UTweenVector* tweenVector = Cast<UTweenVector>(tween))
+                {
+                    tweenVector->InitDestination(destination, FName(*socketName), FVector(offset));
+                }
+                else if (UTweenRotator* tweenRotator = Cast<UTweenRotator>(tween))
+                {
+                    tweenRotator->InitDestination(destination, FName(*socketName), FVector(offset));
+                }
+                break;
+            }
+            case ETweenRecordOp::DeleteAllTweens:
+            {
+                mTweenManager->DeleteAllTweens();
+                break;
+            }
+            case ETweenRecordOp::End:
+            {
+                hasReachedEnd = true;
+                break;
+            }
+            default:
+            {
+                UE_LOG(LogTweenMaker, Warning, TEXT("FTweenReplayer::Replay -> unknown record %d, the recording is corrupted."), opValue);
+                isCorrupted = true;
+                break;
+            }
+        }
+
+        if (!isFrame)
+        {
+            pOutStats.TotalOpsSeconds += FPlatformTime::Seconds() - opStartTime;
+        }
+    }
+
+    bool isSuccessful = hasReachedEnd && !isCorrupted && !reader.IsError();
+
+    Reset();
+
+    return isSuccessful;
+}
+
+// public ----------------------------------------------------------------------
+void FTweenReplayer::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    Collector.AddReferencedObject(mTweenManager);
+    Collector.AddReferencedObjects(mSplines);
+    Collector.AddReferencedObjects(mDummyTargets);
+}
+
+// public ----------------------------------------------------------------------
+FString FTweenReplayer::GetReferencerName() const
+{
+    return TEXT("FTweenReplayer");
+}
+
+// private ---------------------------------------------------------------------
+void FTweenReplayer::ReplayTween(const FTweenRecordedTween& pRecord, bool pIsJoin)
+{
+    UTweenContainer* tweenContainer = mContainers.IsValidIndex(pRecord.ContainerId) ? mContainers[pRecord.ContainerId].Get() : nullptr;
+    UBaseTween* newTween            = nullptr;
+
+    if (tweenContainer != nullptr)
+    {
+        ETweenTargetType targetType = pRecord.TargetType;
+        UObject* target             = GetDummyTarget(pRecord.TargetId, targetType);
+
+        bool deleteOnHit     = (pRecord.Flags & FTweenRecordedTween::DeleteOnHit) != 0;
+        bool deleteOnOverlap = (pRecord.Flags & FTweenRecordedTween::DeleteOnOverlap) != 0;
+        bool whilePaused     = (pRecord.Flags & FTweenRecordedTween::TweenWhileGamePaused) != 0;
+
+        switch (pRecord.TweenClass)
+        {
+            case ETweenRecordedClass::Vector:
+            {
+                ETweenVectorType tweenType = static_cast<ETweenVectorType>(pRecord.TweenType);
+                FVector from               = FVector(pRecord.From.X, pRecord.From.Y, pRecord.From.Z);
+                FVector to                 = FVector(pRecord.To.X, pRecord.To.Y, pRecord.To.Z);
+                bool bezierConstantSpeed   = (pRecord.Flags & FTweenRecordedTween::BezierConstantSpeed) != 0;
+
+                TArray<FVector> bezierControlPoints;
+
+                for (const FVector3f& controlPoint : pRecord.BezierControlPoints)
+                {
+                    bezierControlPoints.Add(FVector(controlPoint));
+                }
+
+                const TArray<FVector>* controlPoints = tweenType == ETweenVectorType::MoveAlongBezier ? &bezierControlPoints : nullptr;
+
+                newTween = pIsJoin
+                    ? mTweenManager->JoinTweenVector(tweenContainer, pRecord.SequenceIndex, tweenType, target, targetType, from, to, pRecord.Duration,
+                                                     pRecord.EaseType, pRecord.TweenSpace, deleteOnHit, deleteOnOverlap, pRecord.Delay, pRecord.TimeScale, whilePaused,
+                                                     nullptr, controlPoints, bezierConstantSpeed)
+                    : mTweenManager->AppendTweenVector(tweenContainer, pRecord.SequenceIndex, tweenType, target, targetType, from, to, pRecord.Duration,
+                                                       pRecord.EaseType, pRecord.TweenSpace, deleteOnHit, deleteOnOverlap, pRecord.NumLoops, pRecord.LoopType,
+                                                       pRecord.Delay, pRecord.TimeScale, whilePaused, nullptr, controlPoints, bezierConstantSpeed);
+                break;
+            }
+            case ETweenRecordedClass::Vector2D:
+            {
+                ETweenVector2DType tweenType = static_cast<ETweenVector2DType>(pRecord.TweenType);
+                FVector2D from               = FVector2D(pRecord.From.X, pRecord.From.Y);
+                FVector2D to                 = FVector2D(pRecord.To.X, pRecord.To.Y);
+
+                newTween = pIsJoin
+                    ? mTweenManager->JoinTweenVector2D(tweenContainer, pRecord.SequenceIndex, tweenType, target, targetType, from, to, pRecord.Duration,
+                                                       pRecord.EaseType, pRecord.Delay, pRecord.TimeScale, whilePaused)
+                    : mTweenManager->AppendTweenVector2D(tweenContainer, pRecord.SequenceIndex, tweenType, target, targetType, from, to, pRecord.Duration,
+                                                         pRecord.EaseType, pRecord.NumLoops, pRecord.LoopType, pRecord.Delay, pRecord.TimeScale, whilePaused);
+                break;
+            }
+            case ETweenRecordedClass::Rotator:
+            {
+                ETweenRotatorType tweenType = static_cast<ETweenRotatorType>(pRecord.TweenType);
+                FRotator from               = FRotator(pRecord.From.X, pRecord.From.Y, pRecord.From.Z);
+                FRotator to                 = FRotator(pRecord.To.X, pRecord.To.Y, pRecord.To.Z);
+                bool localSpace             = (pRecord.Flags & FTweenRecordedTween::LocalSpace) != 0;
+
+                newTween = pIsJoin
+                    ? mTweenManager->JoinTweenRotator(tweenContainer, pRecord.SequenceIndex, tweenType, target, targetType, from, to, pRecord.Duration,
+                                                      pRecord.EaseType, pRecord.TweenSpace, pRecord.RotationMode, localSpace, deleteOnHit, deleteOnOverlap,
+                                                      pRecord.Delay, pRecord.TimeScale, whilePaused)
+                    : mTweenManager->AppendTweenRotator(tweenContainer, pRecord.SequenceIndex, tweenType, target, targetType, from, to, pRecord.Duration,
+                                                        pRecord.EaseType, pRecord.TweenSpace, pRecord.RotationMode, localSpace, deleteOnHit, deleteOnOverlap,
+                                                        pRecord.NumLoops, pRecord.LoopType, pRecord.Delay, pRecord.TimeScale, whilePaused);
+                break;
+            }
+            case ETweenRecordedClass::LinearColor:
+            {
+                ETweenLinearColorType tweenType = static_cast<ETweenLinearColorType>(pRecord.TweenType);
+                FLinearColor from               = FLinearColor(pRecord.From.X, pRecord.From.Y, pRecord.From.Z, pRecord.From.W);
+                FLinearColor to                 = FLinearColor(pRecord.To.X, pRecord.To.Y, pRecord.To.Z, pRecord.To.W);
+
+                newTween = pIsJoin
+                    ? mTweenManager->JoinTweenLinearColor(tweenContainer, pRecord.SequenceIndex, tweenType, target, pRecord.ParameterName, targetType, from, to,
+                                                          pRecord.Duration, pRecord.EaseType, pRecord.Delay, pRecord.TimeScale, whilePaused)
+                    : mTweenManager->AppendTweenLinearColor(tweenContainer, pRecord.SequenceIndex, tweenType, target, pRecord.ParameterName, targetType, from, to,
+                                                            pRecord.Duration, pRecord.EaseType, pRecord.NumLoops, pRecord.LoopType, pRecord.Delay, pRecord.TimeScale,
+                                                            whilePaused);
+                break;
+            }
+            case ETweenRecordedClass::Float:
+            {
+                ETweenFloatType tweenType = static_cast<ETweenFloatType>(pRecord.TweenType);
+
+                newTween = pIsJoin
+                    ? mTweenManager->JoinTweenFloat(tweenContainer, pRecord.SequenceIndex, tweenType, target, targetType, pRecord.From.X, pRecord.To.X,
+                                                    pRecord.Duration, pRecord.EaseType, pRecord.Delay, pRecord.TimeScale, whilePaused, nullptr, pRecord.ParameterName)
+                    : mTweenManager->AppendTweenFloat(tweenContainer, pRecord.SequenceIndex, tweenType, target, targetType, pRecord.From.X, pRecord.To.X,
+                                                      pRecord.Duration, pRecord.EaseType, pRecord.NumLoops, pRecord.LoopType, pRecord.Delay, pRecord.TimeScale,
+                                                      whilePaused, nullptr, pRecord.ParameterName);
+                break;
+            }
+            case ETweenRecordedClass::FloatRotateAround:
+            {
+                FVector pivotPoint = FVector(pRecord.PivotPoint);
+                FVector axis       = FVector(pRecord.Axis);
+
+                newTween = pIsJoin
+                    ? mTweenManager->JoinTweenRotateAroundFloat(tweenContainer, pRecord.SequenceIndex, ETweenFloatType::RotateAroundPoint, target, targetType,
+                                                                pivotPoint, pRecord.From.X, pRecord.To.X, pRecord.Radius, axis, pRecord.TweenSpace, pRecord.Duration,
+                                                                pRecord.EaseType, deleteOnHit, deleteOnOverlap, pRecord.Delay, pRecord.TimeScale, whilePaused)
+                    : mTweenManager->AppendTweenRotateAroundFloat(tweenContainer, pRecord.SequenceIndex, ETweenFloatType::RotateAroundPoint, target, targetType,
+                                                                  pivotPoint, pRecord.From.X, pRecord.To.X, pRecord.Radius, axis, pRecord.TweenSpace, pRecord.Duration,
+                                                                  pRecord.EaseType, deleteOnHit, deleteOnOverlap, pRecord.NumLoops, pRecord.LoopType, pRecord.Delay,
+                                                                  pRecord.TimeScale, whilePaused);
+                break;
+            }
+            case ETweenRecordedClass::FloatFollowSpline:
+            {
+                USplineComponent** spline = mSplines.Find(pRecord.SplineId);
+
+                if (spline == nullptr)
+                {
+                    UE_LOG(LogTweenMaker, Warning, TEXT("FTweenReplayer::ReplayTween -> FollowSpline Tween without a recorded spline, it will be skipped."));
+                    break;
+                }
+
+                bool applyRotation = (pRecord.Flags & FTweenRecordedTween::SplineApplyRotation) != 0;
+                bool applyScale    = (pRecord.Flags & FTweenRecordedTween::SplineApplyScale) != 0;
+                bool constantSpeed = (pRecord.Flags & FTweenRecordedTween::SplineConstantSpeed) != 0;
+
+                newTween = pIsJoin
+                    ? mTweenManager->JoinTweenFollowSplineFloat(tweenContainer, pRecord.SequenceIndex, ETweenFloatType::FollowSpline, target, targetType, *spline,
+                                                                applyRotation, applyScale, constantSpeed, pRecord.Duration, pRecord.EaseType, deleteOnHit,
+                                                                deleteOnOverlap, pRecord.Delay, pRecord.TimeScale, whilePaused)
+                    : mTweenManager->AppendTweenFollowSplineFloat(tweenContainer, pRecord.SequenceIndex, ETweenFloatType::FollowSpline, target, targetType, *spline,
+                                                                  applyRotation, applyScale, constantSpeed, pRecord.Duration, pRecord.EaseType, deleteOnHit,
+                                                                  deleteOnOverlap, pRecord.NumLoops, pRecord.LoopType, pRecord.Delay, pRecord.TimeScale, whilePaused);
+                break;
+            }
+            case ETweenRecordedClass::Transform:
+            {
+                ETweenTransformType tweenType = static_cast<ETweenTransformType>(pRecord.TweenType);
+                FTransform to                 = FTransform(FQuat(pRecord.ToRotation), FVector(pRecord.To.X, pRecord.To.Y, pRecord.To.Z), FVector(pRecord.ToScale));
+
+                newTween = pIsJoin
+                    ? mTweenManager->JoinTweenTransform(tweenContainer, pRecord.SequenceIndex, tweenType, target, targetType, to, pRecord.Duration,
+                                                        pRecord.EaseType, pRecord.TweenSpace, pRecord.RotationMode, deleteOnHit, deleteOnOverlap,
+                                                        pRecord.Delay, pRecord.TimeScale, whilePaused)
+                    : mTweenManager->AppendTweenTransform(tweenContainer, pRecord.SequenceIndex, tweenType, target, targetType, to, pRecord.Duration,
+                                                          pRecord.EaseType, pRecord.TweenSpace, pRecord.RotationMode, deleteOnHit, deleteOnOverlap,
+                                                          pRecord.NumLoops, pRecord.LoopType, pRecord.Delay, pRecord.TimeScale, whilePaused);
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    // Tween ids are sequential (starting from 1), so even Tweens that couldn't be created need a slot
+    mTweens.SetNum(FMath::Max(mTweens.Num(), 1));
+    mTweens.Add(newTween);
+}
+
+// private ---------------------------------------------------------------------
+void FTweenReplayer::ReplayRetarget(UBaseTween* pTween, const FVector4f& pNewTo, float pNewDuration)
+{
+    if (UTweenVector* tweenVector = Cast<UTweenVector>(pTween))
+    {
+        tweenVector->Retarget(FVector(pNewTo.X, pNewTo.Y, pNewTo.Z), pNewDuration);
+    }
+    else if (UTweenVector2D* tweenVector2D = Cast<UTweenVector2D>(pTween))
+    {
+        tweenVector2D->Retarget(FVector2D(pNewTo.X, pNewTo.Y), pNewDuration);
+    }
+    else if (UTweenRotator* tweenRotator = Cast<UTweenRotator>(pTween))
+    {
+        tweenRotator->Retarget(FRotator(pNewTo.X, pNewTo.Y, pNewTo.Z), pNewDuration);
+    }
+    else if (UTweenLinearColor* tweenLinearColor = Cast<UTweenLinearColor>(pTween))
+    {
+        tweenLinearColor->Retarget(FLinearColor(pNewTo.X, pNewTo.Y, pNewTo.Z, pNewTo.W), pNewDuration);
+    }
+    else if (UTweenFloat* tweenFloat = Cast<UTweenFloat>(pTween))
+    {
+        tweenFloat->Retarget(pNewTo.X, pNewDuration);
+    }
+}
+
+// private ---------------------------------------------------------------------
+void FTweenReplayer::ReplaySplineDefinition(FArchive& pArchive)
+{
+    uint32 splineId = 0;
+    int32 numPoints = 0;
+    uint8 isClosed  = 0;
+    float duration  = 1.0f;
+
+    pArchive.SerializeIntPacked(splineId);
+    pArchive << numPoints << isClosed << duration;
+
+    USplineComponent* spline = NewObject<USplineComponent>(GetTransientPackage());
+    spline->ClearSplinePoints(false);
+
+    for (int32 i = 0; i < numPoints; ++i)
+    {
+        FVector3f location;
+        FVector3f arriveTangent;
+        FVector3f leaveTangent;
+        FRotator3f rotation;
+        FVector3f scale;
+        uint8 pointType = 0;
+
+        pArchive << location << arriveTangent << leaveTangent << rotation << scale << pointType;
+
+        FSplinePoint splinePoint(static_cast<float>(i),
+                                 FVector(location),
+                                 FVector(arriveTangent),
+                                 FVector(leaveTangent),
+                                 FRotator(rotation),
+                                 FVector(scale),
+                                 static_cast<ESplinePointType::Type>(pointType));
+
+        spline->AddPoint(splinePoint, false);
+    }
+
+    spline->SetClosedLoop(isClosed != 0, false);
+    spline->Duration = duration;
+    spline->UpdateSpline();
+
+    mSplines.Add(splineId, spline);
+}
+
+// private ---------------------------------------------------------------------
+UObject* FTweenReplayer::GetDummyTarget(uint32 pTargetId, ETweenTargetType& pTargetType)
+{
+    // Actors can't exist without a world: their Tweens are replayed on a scene component, which goes through the same transform updates
+    if (pTargetType == ETweenTargetType::Actor)
+    {
+        pTargetType = ETweenTargetType::SceneComponent;
+    }
+
+    if (pTargetId == 0)
+    {
+        return nullptr;
+    }
+
+    uint64 key         = (static_cast<uint64>(pTargetId) << 8) | static_cast<uint8>(pTargetType);
+    UObject** existing = mDummyTargets.Find(key);
+
+    if (existing != nullptr)
+    {
+        return *existing;
+    }
+
+    UObject* dummyTarget = nullptr;
+
+    switch (pTargetType)
+    {
+        case ETweenTargetType::Material:
+        {
+            dummyTarget = UMaterialInstanceDynamic::Create(UMaterial::GetDefaultMaterial(MD_Surface), GetTransientPackage());
+            break;
+        }
+        case ETweenTargetType::UMG:
+        {
+            dummyTarget = NewObject<UImage>(GetTransientPackage());
+            break;
+        }
+        case ETweenTargetType::InstancedStaticMesh:
+        {
+            // The instances are added when the Tweens set their index
+            dummyTarget = NewObject<UInstancedStaticMeshComponent>(GetTransientPackage());
+            break;
+        }
+        case ETweenTargetType::MaterialParameterCollection:
+        {
+            // Without a world there's no instance of the collection to write to, so only the Tweens' own work is replayed
+            dummyTarget = NewObject<UMaterialParameterCollection>(GetTransientPackage());
+            break;
+        }
+        case ETweenTargetType::CustomPrimitiveData:
+        {
+            dummyTarget = NewObject<UStaticMeshComponent>(GetTransientPackage());
+            break;
+        }
+        case ETweenTargetType::SceneComponent:
+        case ETweenTargetType::Custom:
+        default:
+        {
+            dummyTarget = NewObject<USceneComponent>(GetTransientPackage());
+            break;
+        }
+    }
+
+    mDummyTargets.Add(key, dummyTarget);
+
+    return dummyTarget;
+}
+
+// private ---------------------------------------------------------------------
+void FTweenReplayer::Reset()
+{
+    if (mTweenManager != nullptr)
+    {
+        mTweenManager->DeleteAllTweens();
+        mTweenManager = nullptr;
+    }
+
+    mContainers.Reset();
+    mTweens.Reset();
+    mSplines.Reset();
+    mDummyTargets.Reset();
+}
@@ -0,0 +1,146 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Utils/TweenSplineCache.h"
+#include "Components/SplineComponent.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+    TAutoConsoleVariable<float> CVarSplineCacheSampleDistance(TEXT("TweenMaker.SplineCacheSampleDistance"),
+                                                              10.0f,
+                                                              TEXT("Distance (in cm) between two samples of the spline caches used by the FollowSpline Tweens. "
+                                                                   "Lower values are more accurate but use more memory. If <= 0, splines are evaluated directly."));
+
+    /// @brief Bounds of the number of samples of a cache, whatever the spline length.
+    const int32 SplineCacheMinSamples = 16;
+    const int32 SplineCacheMaxSamples = 8192;
+}
+
+TMap<TPair<TWeakObjectPtr<USplineComponent>, bool>, TWeakPtr<FTweenSplineCache>> FTweenSplineCache::sCaches;
+
+// public ----------------------------------------------------------------------
+FTweenSplineCache::FTweenSplineCache(USplineComponent* pSpline, bool pUseConstantSpeed)
+    : mSpline(pSpline)
+    , bUseConstantSpeed(pUseConstantSpeed)
+    , mSplineVersion(0)
+    , mSplineDuration(0.0f)
+{
+    Build();
+}
+
+// static public ---------------------------------------------------------------
+TSharedPtr<FTweenSplineCache> FTweenSplineCache::FindOrCreate(USplineComponent* pSpline, bool pUseConstantSpeed)
+{
+    if (pSpline == nullptr || CVarSplineCacheSampleDistance.GetValueOnGameThread() <= 0.0f)
+    {
+        return nullptr;
+    }
+
+    TWeakPtr<FTweenSplineCache>& weakCache = sCaches.FindOrAdd(TPair<TWeakObjectPtr<USplineComponent>, bool>(pSpline, pUseConstantSpeed));
+    TSharedPtr<FTweenSplineCache> cache    = weakCache.Pin();
+
+    if (cache.IsValid())
+    {
+        cache->Refresh();
+    }
+    else
+    {
+        cache     = MakeShared<FTweenSplineCache>(pSpline, pUseConstantSpeed);
+        weakCache = cache;
+
+        // Forgetting the caches no Tween uses anymore
+        for (auto it = sCaches.CreateIterator(); it; ++it)
+        {
+            if (!it.Value().IsValid() || !it.Key().Key.IsValid())
+            {
+                it.RemoveCurrent();
+            }
+        }
+    }
+
+    return cache;
+}
+
+// public ----------------------------------------------------------------------
+bool FTweenSplineCache::Refresh()
+{
+    USplineComponent* spline = mSpline.Get();
+
+    if (spline == nullptr)
+    {
+        return false;
+    }
+
+    if (   spline->SplineCurves.Version != mSplineVersion
+        || spline->Duration != mSplineDuration)
+    {
+        Build();
+    }
+
+    return true;
+}
+
+// public ----------------------------------------------------------------------
+FVector FTweenSplineCache::GetLocationAtTime(float pTime) const
+{
+    int32 index = 0;
+    float alpha = 0.0f;
+    FindSamples(pTime, index, alpha);
+
+    FVector localLocation = FMath::Lerp(mLocations[index], mLocations[index + 1], alpha);
+
+    return mSpline->GetComponentTransform().TransformPosition(localLocation);
+}
+
+// public ----------------------------------------------------------------------
+FTransform FTweenSplineCache::GetTransformAtTime(float pTime) const
+{
+    int32 index = 0;
+    float alpha = 0.0f;
+    FindSamples(pTime, index, alpha);
+
+    const FTransform& splineTransform = mSpline->GetComponentTransform();
+
+    FVector localLocation = FMath::Lerp(mLocations[index], mLocations[index + 1], alpha);
+    FQuat localRotation   = FQuat::Slerp(mRotations[index], mRotations[index + 1], alpha);
+
+    return FTransform(splineTransform.GetRotation() * localRotation,
+                      splineTransform.TransformPosition(localLocation),
+                      FMath::Lerp(mScales[index], mScales[index + 1], alpha));
+}
+
+// private ---------------------------------------------------------------------
+void FTweenSplineCache::Build()
+{
+    USplineComponent* spline = mSpline.Get();
+
+    mSplineVersion  = spline->SplineCurves.Version;
+    mSplineDuration = spline->Duration;
+
+    float sampleDistance = FMath::Max(CVarSplineCacheSampleDistance.GetValueOnGameThread(), KINDA_SMALL_NUMBER);
+    int32 numSegments    = FMath::CeilToInt(spline->GetSplineLength() / sampleDistance);
+    numSegments          = FMath::Clamp(numSegments, SplineCacheMinSamples, SplineCacheMaxSamples);
+
+    mLocations.SetNumUninitialized(numSegments + 1);
+    mRotations.SetNumUninitialized(numSegments + 1);
+    mScales.SetNumUninitialized(numSegments + 1);
+
+    for (int32 i = 0; i <= numSegments; ++i)
+    {
+        float time = mSplineDuration * i / numSegments;
+
+        mLocations[i] = spline->GetLocationAtTime(time, ESplineCoordinateSpace::Local, bUseConstantSpeed);
+        mRotations[i] = spline->GetQuaternionAtTime(time, ESplineCoordinateSpace::Local, bUseConstantSpeed);
+        mScales[i]    = spline->GetScaleAtTime(time, bUseConstantSpeed);
+    }
+}
+
+// private ---------------------------------------------------------------------
+void FTweenSplineCache::FindSamples(float pTime, int32& pOutIndex, float& pOutAlpha) const
+{
+    int32 numSegments = mLocations.Num() - 1;
+    float position    = mSplineDuration > 0.0f ? FMath::Clamp(pTime / mSplineDuration, 0.0f, 1.0f) * numSegments : 0.0f;
+
+    pOutIndex = FMath::Min(FMath::FloorToInt(position), numSegments - 1);
+    pOutAlpha = position - pOutIndex;
+}
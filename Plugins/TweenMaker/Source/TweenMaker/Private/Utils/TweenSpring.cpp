@@ -0,0 +1,97 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#include "Utils/TweenSpring.h"
+
+namespace
+{
+    /// @brief Damping ratios closer than this to 1 use the critically damped solution, since the others are singular there.
+    const float CriticalDampingTolerance = 0.0001f;
+}
+
+// public ----------------------------------------------------------------------
+FTweenSpring::FTweenSpring()
+    : bIsEnabled(false)
+    , bEndsWhenSettled(false)
+    , mAngularFrequency(0.0f)
+    , mDampingRatio(1.0f)
+    , mSettleThresholdSquared(0.0f)
+    , mPositionPosition(1.0f)
+    , mPositionVelocity(0.0f)
+    , mVelocityPosition(0.0f)
+    , mVelocityVelocity(1.0f)
+{
+
+}
+
+// public ----------------------------------------------------------------------
+void FTweenSpring::Init(float pFrequency, float pDampingRatio, float pSettleThreshold, bool pEndsWhenSettled)
+{
+    bIsEnabled              = true;
+    bEndsWhenSettled        = pEndsWhenSettled;
+    mAngularFrequency       = 2.0f * PI * FMath::Max(pFrequency, 0.0f);
+    mDampingRatio           = FMath::Max(pDampingRatio, 0.0f);
+    mSettleThresholdSquared = FMath::Square(FMath::Max(pSettleThreshold, KINDA_SMALL_NUMBER));
+}
+
+// public ----------------------------------------------------------------------
+void FTweenSpring::ComputeCoefficients(float pDeltaTime)
+{
+    // Without stiffness (or time) nothing moves
+    if (mAngularFrequency < KINDA_SMALL_NUMBER || pDeltaTime <= 0.0f)
+    {
+        mPositionPosition = 1.0f;
+        mPositionVelocity = 0.0f;
+        mVelocityPosition = 0.0f;
+        mVelocityVelocity = 1.0f;
+        return;
+    }
+
+    float omega = mAngularFrequency;
+    float zeta  = mDampingRatio;
+
+    if (FMath::Abs(zeta - 1.0f) < CriticalDampingTolerance)
+    {
+        float expTerm          = FMath::Exp(-omega * pDeltaTime);
+        float timeExp          = pDeltaTime * expTerm;
+        float timeExpFrequency = timeExp * omega;
+
+        mPositionPosition = timeExpFrequency + expTerm;
+        mPositionVelocity = timeExp;
+        mVelocityPosition = -omega * timeExpFrequency;
+        mVelocityVelocity = -timeExpFrequency + expTerm;
+    }
+    else if (zeta < 1.0f)
+    {
+        float omegaZeta = omega * zeta;
+        float alpha     = omega * FMath::Sqrt(1.0f - zeta * zeta);
+
+        float expTerm = FMath::Exp(-omegaZeta * pDeltaTime);
+        float sinTerm = 0.0f;
+        float cosTerm = 0.0f;
+        FMath::SinCos(&sinTerm, &cosTerm, alpha * pDeltaTime);
+
+        float expSin               = expTerm * sinTerm;
+        float expCos               = expTerm * cosTerm;
+        float expOmegaZetaSinAlpha = expTerm * omegaZeta * sinTerm / alpha;
+
+        mPositionPosition = expCos + expOmegaZetaSinAlpha;
+        mPositionVelocity = expSin / alpha;
+        mVelocityPosition = -expSin * alpha - omegaZeta * expOmegaZetaSinAlpha;
+        mVelocityVelocity = expCos - expOmegaZetaSinAlpha;
+    }
+    else
+    {
+        float zetaBase  = -omega * zeta;
+        float zetaDelta = omega * FMath::Sqrt(zeta * zeta - 1.0f);
+        float z1        = zetaBase - zetaDelta;
+        float z2        = zetaBase + zetaDelta;
+
+        float e1 = FMath::Exp(z1 * pDeltaTime) / (2.0f * zetaDelta);
+        float e2 = FMath::Exp(z2 * pDeltaTime) / (2.0f * zetaDelta);
+
+        mPositionPosition = e1 * z2 - e2 * z1;
+        mPositionVelocity = -e1 + e2;
+        mVelocityPosition = (e1 - e2) * z1 * z2;
+        mVelocityVelocity = -e1 * z1 + e2 * z2;
+    }
+}
@@ -5,6 +5,7 @@
 #include "Tweens/TweenVector.h"
 #include "Tweens/TweenVector2D.h"
 #include "Tweens/TweenRotator.h"
+#include "Tweens/TweenTransform.h"
 #include "Tweens/TweenLinearColor.h"
 #include "Tweens/TweenFloat.h"
 #include "Engine/Engine.h"
@@ -12,8 +13,21 @@
 // Custom log declaration
 DEFINE_LOG_CATEGORY(LogTweenMaker);
 
+// Custom stats
+DEFINE_STAT(STAT_TweenMakerSweeps);
+
 namespace 
 {
+    /// @brief Coefficients of the alpha correction used by the fast slerp (fitted by A. Kapoulkine in "Approximating slerp"), as functions
+    ///        of the absolute dot product between the two rotations.
+    const float FastSlerpA0 = 1.0904f;
+    const float FastSlerpA1 = -3.2452f;
+    const float FastSlerpA2 = 3.55645f;
+    const float FastSlerpA3 = -1.43519f;
+    const float FastSlerpB0 = 0.848013f;
+    const float FastSlerpB1 = -1.06021f;
+    const float FastSlerpB2 = 0.215638f;
+
     void ComputeRotateAroundPointData(const FVector& objectLocation,
                                       const FVector& pPivotPoint,
                                       ETweenReferenceAxis pReferenceAxis,
@@ -62,6 +76,8 @@ ETweenGenericType Utility::ConvertTweenTypeEnum(ETweenVectorType pTweenType)
     {
         case ETweenVectorType::MoveTo:
         case ETweenVectorType::MoveBy:
+        case ETweenVectorType::MoveAlongBezier:
+        case ETweenVectorType::MoveToComponent:
         {
             type = ETweenGenericType::Move;
             break;
@@ -133,6 +149,7 @@ ETweenGenericType Utility::ConvertTweenTypeEnum(ETweenRotatorType pTweenType)
     {
         case ETweenRotatorType::RotateTo:
         case ETweenRotatorType::RotateBy:
+        case ETweenRotatorType::LookAtComponent:
         {
             type = ETweenGenericType::Rotate;
             break;
@@ -146,6 +163,27 @@ ETweenGenericType Utility::ConvertTweenTypeEnum(ETweenRotatorType pTweenType)
     return type;
 }
 
+// static public ---------------------------------------------------------------
+ETweenGenericType Utility::ConvertTweenTypeEnum(ETweenTransformType pTweenType)
+{
+    ETweenGenericType type = ETweenGenericType::Any;
+
+    switch (pTweenType)
+    {
+        case ETweenTransformType::TransformTo:
+        {
+            type = ETweenGenericType::Transform;
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    return type;
+}
+
 // static public ---------------------------------------------------------------
 ETweenGenericType Utility::ConvertTweenTypeEnum(ETweenLinearColorType pTweenType)
 {
@@ -233,6 +271,10 @@ ETweenGenericType Utility::FindOutTypeOfTween(UBaseTween* pTween)
     {
         tweenType = ConvertTweenTypeEnum(tweenRotator->GetTweenType());
     }
+    else if (UTweenTransform* tweenTransform = Cast<UTweenTransform>(pTween))
+    {
+        tweenType = ConvertTweenTypeEnum(tweenTransform->GetTweenType());
+    }
     else if (UTweenLinearColor* tweenLinearColor = Cast<UTweenLinearColor>(pTween))
     {
         tweenType = ConvertTweenTypeEnum(tweenLinearColor->GetTweenType());
@@ -245,6 +287,39 @@ ETweenGenericType Utility::FindOutTypeOfTween(UBaseTween* pTween)
     return tweenType;
 }
 
+// static public ---------------------------------------------------------------
+FString Utility::GetTweenTypeName(const UBaseTween* pTween)
+{
+    FString typeName;
+
+    if (const UTweenVector* tweenVector = Cast<UTweenVector>(pTween))
+    {
+        typeName = TEXT("Vector ") + StaticEnum<ETweenVectorType>()->GetNameStringByValue(static_cast<int64>(tweenVector->GetTweenType()));
+    }
+    else if (const UTweenVector2D* tweenVector2D = Cast<UTweenVector2D>(pTween))
+    {
+        typeName = TEXT("Vector2D ") + StaticEnum<ETweenVector2DType>()->GetNameStringByValue(static_cast<int64>(tweenVector2D->GetTweenType()));
+    }
+    else if (const UTweenRotator* tweenRotator = Cast<UTweenRotator>(pTween))
+    {
+        typeName = TEXT("Rotator ") + StaticEnum<ETweenRotatorType>()->GetNameStringByValue(static_cast<int64>(tweenRotator->GetTweenType()));
+    }
+    else if (const UTweenTransform* tweenTransform = Cast<UTweenTransform>(pTween))
+    {
+        typeName = TEXT("Transform ") + StaticEnum<ETweenTransformType>()->GetNameStringByValue(static_cast<int64>(tweenTransform->GetTweenType()));
+    }
+    else if (const UTweenLinearColor* tweenLinearColor = Cast<UTweenLinearColor>(pTween))
+    {
+        typeName = TEXT("LinearColor ") + StaticEnum<ETweenLinearColorType>()->GetNameStringByValue(static_cast<int64>(tweenLinearColor->GetTweenType()));
+    }
+    else if (const UTweenFloat* tweenFloat = Cast<UTweenFloat>(pTween))
+    {
+        typeName = TEXT("Float ") + StaticEnum<ETweenFloatType>()->GetNameStringByValue(static_cast<int64>(tweenFloat->GetTweenType()));
+    }
+
+    return typeName;
+}
+
 // static public ---------------------------------------------------------------
 FVector Utility::FromReferenceAxisToVector(ETweenReferenceAxis pReferenceAxis)
 {
@@ -332,6 +407,104 @@ void Utility::ComputeDataForRotateAroundPoint(USceneComponent* pComponent,
     ComputeRotateAroundPointData(location, pPivotPoint, pReferenceAxis, pOutAxis, pOutRadius);
 }
 
+// static public ---------------------------------------------------------------
+FQuat Utility::FastSlerp(const FQuat& pFrom, const FQuat& pTo, float pAlpha)
+{
+    float dot    = pFrom | pTo;
+    float absDot = FMath::Abs(dot);
+
+    float a = FastSlerpA0 + absDot * (FastSlerpA1 + absDot * (FastSlerpA2 + absDot * FastSlerpA3));
+    float b = FastSlerpB0 + absDot * (FastSlerpB1 + absDot * FastSlerpB2);
+
+    float centeredAlpha  = pAlpha - 0.5f;
+    float correctedAlpha = pAlpha + pAlpha * centeredAlpha * (pAlpha - 1.0f) * (a * centeredAlpha * centeredAlpha + b);
+
+    // Flipping the ending rotation if needed, so that the shortest path is taken
+    FQuat to     = dot < 0.0f ? pTo * -1.0f : pTo;
+    FQuat result = pFrom + (to - pFrom) * correctedAlpha;
+    result.Normalize();
+
+    return result;
+}
+
+// static public ---------------------------------------------------------------
+void Utility::FastSlerpBatch(const FQuat* pFrom, const FQuat& pTo, float pAlpha, FQuat* pOutResults, int32 pNum)
+{
+    // The alpha terms are shared, only the dot product changes from a rotation to another
+    float centeredAlpha = pAlpha - 0.5f;
+
+    const VectorRegister4Float toX          = VectorSetFloat1((float)pTo.X);
+    const VectorRegister4Float toY          = VectorSetFloat1((float)pTo.Y);
+    const VectorRegister4Float toZ          = VectorSetFloat1((float)pTo.Z);
+    const VectorRegister4Float toW          = VectorSetFloat1((float)pTo.W);
+    const VectorRegister4Float alpha        = VectorSetFloat1(pAlpha);
+    const VectorRegister4Float alphaSquared = VectorSetFloat1(centeredAlpha * centeredAlpha);
+    const VectorRegister4Float alphaCubic   = VectorSetFloat1(pAlpha * centeredAlpha * (pAlpha - 1.0f));
+
+    int32 i = 0;
+
+    // Four rotations at a time, one per lane, with each register holding the same component of all of them
+    for (; i + 4 <= pNum; i += 4)
+    {
+        const FQuat* from = pFrom + i;
+
+        VectorRegister4Float fromX = MakeVectorRegisterFloat((float)from[0].X, (float)from[1].X, (float)from[2].X, (float)from[3].X);
+        VectorRegister4Float fromY = MakeVectorRegisterFloat((float)from[0].Y, (float)from[1].Y, (float)from[2].Y, (float)from[3].Y);
+        VectorRegister4Float fromZ = MakeVectorRegisterFloat((float)from[0].Z, (float)from[1].Z, (float)from[2].Z, (float)from[3].Z);
+        VectorRegister4Float fromW = MakeVectorRegisterFloat((float)from[0].W, (float)from[1].W, (float)from[2].W, (float)from[3].W);
+
+        VectorRegister4Float dot = VectorMultiply(fromX, toX);
+        dot                      = VectorMultiplyAdd(fromY, toY, dot);
+        dot                      = VectorMultiplyAdd(fromZ, toZ, dot);
+        dot                      = VectorMultiplyAdd(fromW, toW, dot);
+
+        VectorRegister4Float sign   = VectorSelect(VectorCompareLT(dot, GlobalVectorConstants::FloatZero), GlobalVectorConstants::FloatMinusOne, GlobalVectorConstants::FloatOne);
+        VectorRegister4Float absDot = VectorAbs(dot);
+
+        VectorRegister4Float a = VectorMultiplyAdd(absDot, VectorSetFloat1(FastSlerpA3), VectorSetFloat1(FastSlerpA2));
+        a                      = VectorMultiplyAdd(absDot, a, VectorSetFloat1(FastSlerpA1));
+        a                      = VectorMultiplyAdd(absDot, a, VectorSetFloat1(FastSlerpA0));
+
+        VectorRegister4Float b = VectorMultiplyAdd(absDot, VectorSetFloat1(FastSlerpB2), VectorSetFloat1(FastSlerpB1));
+        b                      = VectorMultiplyAdd(absDot, b, VectorSetFloat1(FastSlerpB0));
+
+        VectorRegister4Float correctedAlpha = VectorMultiplyAdd(alphaCubic, VectorMultiplyAdd(a, alphaSquared, b), alpha);
+
+        // Normalized lerp towards the (possibly flipped) ending rotation
+        VectorRegister4Float resultX = VectorMultiplyAdd(VectorSubtract(VectorMultiply(toX, sign), fromX), correctedAlpha, fromX);
+        VectorRegister4Float resultY = VectorMultiplyAdd(VectorSubtract(VectorMultiply(toY, sign), fromY), correctedAlpha, fromY);
+        VectorRegister4Float resultZ = VectorMultiplyAdd(VectorSubtract(VectorMultiply(toZ, sign), fromZ), correctedAlpha, fromZ);
+        VectorRegister4Float resultW = VectorMultiplyAdd(VectorSubtract(VectorMultiply(toW, sign), fromW), correctedAlpha, fromW);
+
+        VectorRegister4Float squaredLength = VectorMultiply(resultX, resultX);
+        squaredLength                      = VectorMultiplyAdd(resultY, resultY, squaredLength);
+        squaredLength                      = VectorMultiplyAdd(resultZ, resultZ, squaredLength);
+        squaredLength                      = VectorMultiplyAdd(resultW, resultW, squaredLength);
+
+        VectorRegister4Float inverseLength = VectorReciprocalSqrt(squaredLength);
+
+        float x[4];
+        float y[4];
+        float z[4];
+        float w[4];
+        VectorStore(VectorMultiply(resultX, inverseLength), x);
+        VectorStore(VectorMultiply(resultY, inverseLength), y);
+        VectorStore(VectorMultiply(resultZ, inverseLength), z);
+        VectorStore(VectorMultiply(resultW, inverseLength), w);
+
+        for (int32 lane = 0; lane < 4; ++lane)
+        {
+            pOutResults[i + lane] = FQuat(x[lane], y[lane], z[lane], w[lane]);
+        }
+    }
+
+    // Remaining rotations
+    for (; i < pNum; ++i)
+    {
+        pOutResults[i] = FastSlerp(pFrom[i], pTo, pAlpha);
+    }
+}
+
 // static public ---------------------------------------------------------------
 float Utility::MapToRange(float pValue, float pOldMin, float pOldMax, float pNewMin, float pNewMax)
 {
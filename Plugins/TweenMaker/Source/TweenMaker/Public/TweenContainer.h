@@ -10,6 +10,9 @@
 
 class UTweenManagerComponent;
 class UBaseTween;
+class UMaterialParameterCollection;
+class UPrimitiveComponent;
+class UInstancedStaticMeshComponent;
 
 /*
  **************************************************************************
@@ -45,6 +48,8 @@ class TWEENMAKER_API UTweenContainer : public UObject
     GENERATED_BODY()
 
     friend class UTweenManagerComponent;
+    friend class UBaseTween;
+    friend class FGameplayDebuggerCategory_TweenMaker;
     
 public:
 
@@ -215,6 +220,22 @@ public:
      */
     bool IsEmpty() const;
 
+    /**
+     * Retrieves the time spent by the last update of this TweenContainer, in seconds (internal usage only).
+     * It's only measured while the owning TweenManager is tracking costs.
+     */
+    float GetLastUpdateCost() const;
+
+    /**
+     * Retrieves the number of start/update/end events fired by the Tweens (and by this TweenContainer) during the last update (internal usage only).
+     */
+    int32 GetNumEventsAtLastUpdate() const;
+
+    /**
+     * Retrieves the number of collision sweeps made by the Tweens during the last update (internal usage only).
+     */
+    int32 GetNumSweepsAtLastUpdate() const;
+
     // Begin of UObject interface
     virtual void BeginDestroy() override;
     // End of UObject interface
@@ -524,6 +545,122 @@ public:
                                           float TimeScale             = 1.0f,
                                           bool TweenWhileGameIsPaused = false);
 
+    /**
+      * Appends to this TweenContainer a Tween that moves an instance of an InstancedStaticMeshComponent from its current location (at the start of the Tween) to the given location.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to move.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenVector* AppendTweenMoveInstanceTo(UInstancedStaticMeshComponent* TweenTarget,
+                                            int32 InstanceIndex,
+                                            const FVector& To,
+                                            float Duration              = 1.0f,
+                                            ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                            ETweenSpace TweenSpace      = ETweenSpace::World,
+                                            int32 NumLoops              = 1,
+                                            ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                            float Delay                 = 0.0f,
+                                            float TimeScale             = 1.0f,
+                                            bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Appends to this TweenContainer a Tween that moves an instance of an InstancedStaticMeshComponent by the given offset with respect to its current location (at the start of the Tween).
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to move.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenVector* AppendTweenMoveInstanceBy(UInstancedStaticMeshComponent* TweenTarget,
+                                            int32 InstanceIndex,
+                                            const FVector& By,
+                                            float Duration              = 1.0f,
+                                            ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                            int32 NumLoops              = 1,
+                                            ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                            float Delay                 = 0.0f,
+                                            float TimeScale             = 1.0f,
+                                            bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Appends to this TweenContainer a Tween that scales an instance of an InstancedStaticMeshComponent from its current scale (at the start of the Tween) to the given size.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to scale.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenVector* AppendTweenScaleInstanceTo(UInstancedStaticMeshComponent* TweenTarget,
+                                             int32 InstanceIndex,
+                                             const FVector& To,
+                                             float Duration              = 1.0f,
+                                             ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                             ETweenSpace TweenSpace      = ETweenSpace::World,
+                                             int32 NumLoops              = 1,
+                                             ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                             float Delay                 = 0.0f,
+                                             float TimeScale             = 1.0f,
+                                             bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Appends to this TweenContainer a Tween that scales an instance of an InstancedStaticMeshComponent by the given offset with respect to its current size (at the start of the Tween).
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to scale.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenVector* AppendTweenScaleInstanceBy(UInstancedStaticMeshComponent* TweenTarget,
+                                             int32 InstanceIndex,
+                                             const FVector& By,
+                                             float Duration              = 1.0f,
+                                             ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                             int32 NumLoops              = 1,
+                                             ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                             float Delay                 = 0.0f,
+                                             float TimeScale             = 1.0f,
+                                             bool TweenWhileGameIsPaused = false);
+
     /* TweenRotator methods */
 
     /**
@@ -658,6 +795,68 @@ public:
                                                      float TimeScale             = 1.0f,
                                                      bool TweenWhileGameIsPaused = false);
 
+    /**
+      * Appends to this TweenContainer a Tween that rotates an instance of an InstancedStaticMeshComponent from its current orientation (at the start of the Tween) to the given rotation.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to rotate.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode	The rotation mode to use.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenRotator* AppendTweenRotateInstanceTo(UInstancedStaticMeshComponent* TweenTarget,
+                                               int32 InstanceIndex,
+                                               const FRotator& To,
+                                               float Duration                  = 1.0f,
+                                               ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                               ETweenSpace TweenSpace          = ETweenSpace::World,
+                                               ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                               int32 NumLoops                  = 1,
+                                               ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                               float Delay                     = 0.0f,
+                                               float TimeScale                 = 1.0f,
+                                               bool TweenWhileGameIsPaused     = false);
+
+    /**
+      * Appends to this TweenContainer a Tween that rotates an instance of an InstancedStaticMeshComponent by the given offset with respect to its current orientation (at the start of the Tween).
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to rotate.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param LocalSpace Whether to rotate around the instance's own local axes, not the component's
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenRotator* AppendTweenRotateInstanceBy(UInstancedStaticMeshComponent* TweenTarget,
+                                               int32 InstanceIndex,
+                                               const FRotator& By,
+                                               float Duration              = 1.0f,
+                                               ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                               bool LocalSpace             = false,
+                                               int32 NumLoops              = 1,
+                                               ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                               float Delay                 = 0.0f,
+                                               float TimeScale             = 1.0f,
+                                               bool TweenWhileGameIsPaused = false);
+
     /* TweenLinearColor methods */
 
     /**
@@ -718,6 +917,122 @@ public:
                                                    float TimeScale             = 1.0f,
                                                    bool TweenWhileGameIsPaused = false);
 
+    /**
+      * Appends to this TweenContainer a Tween that modifies a "Vector" custom primitive data value of a PrimitiveComponent from the starting value to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the first of the four custom primitive data values to tween (R, G, B and A are written at DataIndex, DataIndex + 1, DataIndex + 2 and DataIndex + 3).
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenLinearColor* AppendTweenCustomPrimitiveDataVectorFromTo(UPrimitiveComponent* TweenTarget,
+                                                                  int32 DataIndex,
+                                                                  const FLinearColor& From,
+                                                                  const FLinearColor& To,
+                                                                  float Duration              = 1.0f,
+                                                                  ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                  int32 NumLoops              = 1,
+                                                                  ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                                  float Delay                 = 0.0f,
+                                                                  float TimeScale             = 1.0f,
+                                                                  bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Appends to this TweenContainer a Tween that modifies a "Vector" custom primitive data value of a PrimitiveComponent from its current value (at the start of the Tween) to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the first of the four custom primitive data values to tween (R, G, B and A are written at DataIndex, DataIndex + 1, DataIndex + 2 and DataIndex + 3).
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenLinearColor* AppendTweenCustomPrimitiveDataVectorTo(UPrimitiveComponent* TweenTarget,
+                                                              int32 DataIndex,
+                                                              const FLinearColor& To,
+                                                              float Duration              = 1.0f,
+                                                              ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                              int32 NumLoops              = 1,
+                                                              ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                              float Delay                 = 0.0f,
+                                                              float TimeScale             = 1.0f,
+                                                              bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Appends to this TweenContainer a Tween that modifies a "Vector" parameter of a Material Parameter Collection from the starting value to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenLinearColor* AppendTweenParameterCollectionVectorFromTo(UMaterialParameterCollection* TweenTarget,
+                                                                  const FName& ParameterName,
+                                                                  const FLinearColor& From,
+                                                                  const FLinearColor& To,
+                                                                  float Duration              = 1.0f,
+                                                                  ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                  int32 NumLoops              = 1,
+                                                                  ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                                  float Delay                 = 0.0f,
+                                                                  float TimeScale             = 1.0f,
+                                                                  bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Appends to this TweenContainer a Tween that modifies a "Vector" parameter of a Material Parameter Collection from its current value (at the start of the Tween) to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenLinearColor* AppendTweenParameterCollectionVectorTo(UMaterialParameterCollection* TweenTarget,
+                                                              const FName& ParameterName,
+                                                              const FLinearColor& To,
+                                                              float Duration              = 1.0f,
+                                                              ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                              int32 NumLoops              = 1,
+                                                              ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                              float Delay                 = 0.0f,
+                                                              float TimeScale             = 1.0f,
+                                                              bool TweenWhileGameIsPaused = false);
+
     /* TweenFloat methods */
 
 
@@ -780,6 +1095,122 @@ public:
                                             float TimeScale             = 1.0f,
                                             bool TweenWhileGameIsPaused = false);
 
+    /**
+      * Appends to this TweenContainer a Tween that modifies a "float" custom primitive data value of a PrimitiveComponent from the starting value to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the custom primitive data value to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenFloat* AppendTweenCustomPrimitiveDataFloatFromTo(UPrimitiveComponent* TweenTarget,
+                                                           int32 DataIndex,
+                                                           float From,
+                                                           float To,
+                                                           float Duration              = 1.0f,
+                                                           ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                           int32 NumLoops              = 1,
+                                                           ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                           float Delay                 = 0.0f,
+                                                           float TimeScale             = 1.0f,
+                                                           bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Appends to this TweenContainer a Tween that modifies a "float" custom primitive data value of a PrimitiveComponent from its current value (at the start of the Tween) to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the custom primitive data value to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenFloat* AppendTweenCustomPrimitiveDataFloatTo(UPrimitiveComponent* TweenTarget,
+                                                       int32 DataIndex,
+                                                       float To,
+                                                       float Duration              = 1.0f,
+                                                       ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                       int32 NumLoops              = 1,
+                                                       ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                       float Delay                 = 0.0f,
+                                                       float TimeScale             = 1.0f,
+                                                       bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Appends to this TweenContainer a Tween that modifies a "float" parameter of a Material Parameter Collection from the starting value to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenFloat* AppendTweenParameterCollectionFloatFromTo(UMaterialParameterCollection* TweenTarget,
+                                                           const FName& ParameterName,
+                                                           float From,
+                                                           float To,
+                                                           float Duration              = 1.0f,
+                                                           ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                           int32 NumLoops              = 1,
+                                                           ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                           float Delay                 = 0.0f,
+                                                           float TimeScale             = 1.0f,
+                                                           bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Appends to this TweenContainer a Tween that modifies a "float" parameter of a Material Parameter Collection from its current value (at the start of the Tween) to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenFloat* AppendTweenParameterCollectionFloatTo(UMaterialParameterCollection* TweenTarget,
+                                                       const FName& ParameterName,
+                                                       float To,
+                                                       float Duration              = 1.0f,
+                                                       ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                       int32 NumLoops              = 1,
+                                                       ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                       float Delay                 = 0.0f,
+                                                       float TimeScale             = 1.0f,
+                                                       bool TweenWhileGameIsPaused = false);
+
 
     /**
       * Appends to this TweenContainer a Tween that rotates an Actor around a given pivot point, with a given radius and rotation axis. The Actor will move
@@ -1518,6 +1949,106 @@ public:
                                         bool TweenWhileGameIsPaused = false);
 
 
+    /**
+      * Joins to this TweenContainer a Tween that moves an instance of an InstancedStaticMeshComponent from its current location (at the start of the Tween) to the given location.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to move.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenVector* JoinTweenMoveInstanceTo(UInstancedStaticMeshComponent* TweenTarget,
+                                          int32 InstanceIndex,
+                                          const FVector& To,
+                                          float Duration              = 1.0f,
+                                          ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                          ETweenSpace TweenSpace      = ETweenSpace::World,
+                                          float Delay                 = 0.0f,
+                                          float TimeScale             = 1.0f,
+                                          bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Joins to this TweenContainer a Tween that moves an instance of an InstancedStaticMeshComponent by the given offset with respect to its current location (at the start of the Tween).
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to move.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenVector* JoinTweenMoveInstanceBy(UInstancedStaticMeshComponent* TweenTarget,
+                                          int32 InstanceIndex,
+                                          const FVector& By,
+                                          float Duration              = 1.0f,
+                                          ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                          float Delay                 = 0.0f,
+                                          float TimeScale             = 1.0f,
+                                          bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Joins to this TweenContainer a Tween that scales an instance of an InstancedStaticMeshComponent from its current scale (at the start of the Tween) to the given size.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to scale.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenVector* JoinTweenScaleInstanceTo(UInstancedStaticMeshComponent* TweenTarget,
+                                           int32 InstanceIndex,
+                                           const FVector& To,
+                                           float Duration              = 1.0f,
+                                           ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                           ETweenSpace TweenSpace      = ETweenSpace::World,
+                                           float Delay                 = 0.0f,
+                                           float TimeScale             = 1.0f,
+                                           bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Joins to this TweenContainer a Tween that scales an instance of an InstancedStaticMeshComponent by the given offset with respect to its current size (at the start of the Tween).
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to scale.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenVector* JoinTweenScaleInstanceBy(UInstancedStaticMeshComponent* TweenTarget,
+                                           int32 InstanceIndex,
+                                           const FVector& By,
+                                           float Duration              = 1.0f,
+                                           ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                           float Delay                 = 0.0f,
+                                           float TimeScale             = 1.0f,
+                                           bool TweenWhileGameIsPaused = false);
+
     /* TweenRotator methods */
 
 
@@ -1640,6 +2171,60 @@ public:
                                                    bool TweenWhileGameIsPaused = false);
 
 
+    /**
+      * Joins to this TweenContainer a Tween that rotates an instance of an InstancedStaticMeshComponent from its current orientation (at the start of the Tween) to the given rotation.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to rotate.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode	The rotation mode to use.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenRotator* JoinTweenRotateInstanceTo(UInstancedStaticMeshComponent* TweenTarget,
+                                             int32 InstanceIndex,
+                                             const FRotator& To,
+                                             float Duration                  = 1.0f,
+                                             ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                             ETweenSpace TweenSpace          = ETweenSpace::World,
+                                             ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                             float Delay                     = 0.0f,
+                                             float TimeScale                 = 1.0f,
+                                             bool TweenWhileGameIsPaused     = false);
+
+    /**
+      * Joins to this TweenContainer a Tween that rotates an instance of an InstancedStaticMeshComponent by the given offset with respect to its current orientation (at the start of the Tween).
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to rotate.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param LocalSpace Whether to rotate around the instance's own local axes, not the component's
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenRotator* JoinTweenRotateInstanceBy(UInstancedStaticMeshComponent* TweenTarget,
+                                             int32 InstanceIndex,
+                                             const FRotator& By,
+                                             float Duration              = 1.0f,
+                                             ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                             bool LocalSpace             = false,
+                                             float Delay                 = 0.0f,
+                                             float TimeScale             = 1.0f,
+                                             bool TweenWhileGameIsPaused = false);
+
     /* TweenLinearColor methods */
 
     /**
@@ -1692,6 +2277,106 @@ public:
                                                  float TimeScale             = 1.0f,
                                                  bool TweenWhileGameIsPaused = false);
 
+    /**
+      * Joins to this TweenContainer a Tween that modifies a "Vector" custom primitive data value of a PrimitiveComponent from the starting value to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the first of the four custom primitive data values to tween (R, G, B and A are written at DataIndex, DataIndex + 1, DataIndex + 2 and DataIndex + 3).
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenLinearColor* JoinTweenCustomPrimitiveDataVectorFromTo(UPrimitiveComponent* TweenTarget,
+                                                                int32 DataIndex,
+                                                                const FLinearColor& From,
+                                                                const FLinearColor& To,
+                                                                float Duration              = 1.0f,
+                                                                ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                float Delay                 = 0.0f,
+                                                                float TimeScale             = 1.0f,
+                                                                bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Joins to this TweenContainer a Tween that modifies a "Vector" custom primitive data value of a PrimitiveComponent from its current value (at the start of the Tween) to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the first of the four custom primitive data values to tween (R, G, B and A are written at DataIndex, DataIndex + 1, DataIndex + 2 and DataIndex + 3).
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenLinearColor* JoinTweenCustomPrimitiveDataVectorTo(UPrimitiveComponent* TweenTarget,
+                                                            int32 DataIndex,
+                                                            const FLinearColor& To,
+                                                            float Duration              = 1.0f,
+                                                            ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                            float Delay                 = 0.0f,
+                                                            float TimeScale             = 1.0f,
+                                                            bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Joins to this TweenContainer a Tween that modifies a "Vector" parameter of a Material Parameter Collection from the starting value to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenLinearColor* JoinTweenParameterCollectionVectorFromTo(UMaterialParameterCollection* TweenTarget,
+                                                                const FName& ParameterName,
+                                                                const FLinearColor& From,
+                                                                const FLinearColor& To,
+                                                                float Duration              = 1.0f,
+                                                                ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                float Delay                 = 0.0f,
+                                                                float TimeScale             = 1.0f,
+                                                                bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Joins to this TweenContainer a Tween that modifies a "Vector" parameter of a Material Parameter Collection from its current value (at the start of the Tween) to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenLinearColor* JoinTweenParameterCollectionVectorTo(UMaterialParameterCollection* TweenTarget,
+                                                            const FName& ParameterName,
+                                                            const FLinearColor& To,
+                                                            float Duration              = 1.0f,
+                                                            ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                            float Delay                 = 0.0f,
+                                                            float TimeScale             = 1.0f,
+                                                            bool TweenWhileGameIsPaused = false);
+
 
     /* TweenFloat methods */
 
@@ -1747,6 +2432,106 @@ public:
                                           float TimeScale             = 1.0f,
                                           bool TweenWhileGameIsPaused = false);
 
+    /**
+      * Joins to this TweenContainer a Tween that modifies a "float" custom primitive data value of a PrimitiveComponent from the starting value to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the custom primitive data value to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenFloat* JoinTweenCustomPrimitiveDataFloatFromTo(UPrimitiveComponent* TweenTarget,
+                                                         int32 DataIndex,
+                                                         float From,
+                                                         float To,
+                                                         float Duration              = 1.0f,
+                                                         ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                         float Delay                 = 0.0f,
+                                                         float TimeScale             = 1.0f,
+                                                         bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Joins to this TweenContainer a Tween that modifies a "float" custom primitive data value of a PrimitiveComponent from its current value (at the start of the Tween) to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the custom primitive data value to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenFloat* JoinTweenCustomPrimitiveDataFloatTo(UPrimitiveComponent* TweenTarget,
+                                                     int32 DataIndex,
+                                                     float To,
+                                                     float Duration              = 1.0f,
+                                                     ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                     float Delay                 = 0.0f,
+                                                     float TimeScale             = 1.0f,
+                                                     bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Joins to this TweenContainer a Tween that modifies a "float" parameter of a Material Parameter Collection from the starting value to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenFloat* JoinTweenParameterCollectionFloatFromTo(UMaterialParameterCollection* TweenTarget,
+                                                         const FName& ParameterName,
+                                                         float From,
+                                                         float To,
+                                                         float Duration              = 1.0f,
+                                                         ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                         float Delay                 = 0.0f,
+                                                         float TimeScale             = 1.0f,
+                                                         bool TweenWhileGameIsPaused = false);
+
+    /**
+      * Joins to this TweenContainer a Tween that modifies a "float" parameter of a Material Parameter Collection from its current value (at the start of the Tween) to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UTweenFloat* JoinTweenParameterCollectionFloatTo(UMaterialParameterCollection* TweenTarget,
+                                                     const FName& ParameterName,
+                                                     float To,
+                                                     float Duration              = 1.0f,
+                                                     ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                     float Delay                 = 0.0f,
+                                                     float TimeScale             = 1.0f,
+                                                     bool TweenWhileGameIsPaused = false);
+
 
     /**
       * Joins to this TweenContainer a Tween that rotates an Actor around a given pivot point, with a given radius and rotation axis. The Actor will move
@@ -2243,6 +3028,15 @@ protected:
     /// @brief True if at least one Tween handled by this container should tween while the game is paused.
     bool bShouldTweenWhileGamePaused;
 
+    /// @brief Time spent by the last update (in seconds), measured only while the owning TweenManager is tracking costs.
+    float mLastUpdateCost;
+
+    /// @brief Number of start/update/end events fired by the Tweens (and by this TweenContainer) during the last update.
+    int32 mNumEventsAtLastUpdate;
+
+    /// @brief Number of collision sweeps (synchronous or asynchronous) made by the Tweens during the last update.
+    int32 mNumSweepsAtLastUpdate;
+
 public:
     bool ShouldTweenWhileGamePaused() const { return bShouldTweenWhileGamePaused; }
 };
@@ -0,0 +1,332 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "TweenManagerComponent.h"
+#include "Utils/TweenEnums.h"
+
+#include "TweenTransformLatentFactory.generated.h"
+
+class UTweenManagerComponent;
+class UTweenContainer;
+class UTweenTransform;
+
+
+/**
+ * @brief The UTweenTransformLatentFactory class handles the creation of all Transform related Tweens, i.e. all tweens that
+ *        move, rotate and scale their target together, driven by a single clock and a single easing.
+ *
+ *        The class inherits from UBlueprintAsyncActionBase in order to be able to create "Latent" functions for Blueprint,
+ *        which allow the user to easily deal with the Tween callbacks.
+ */
+UCLASS()
+class TWEENMAKER_API UTweenTransformLatentFactory : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    UTweenTransformLatentFactory(const FObjectInitializer& ObjectInitializer);
+
+    /// @brief Called by a Latent proxy when the Tween starts the execution.
+    UPROPERTY(BlueprintAssignable)
+    FBP_OnTweenTransformChange OnTweenStart;
+
+    /// @brief Called by a Latent proxy at each Tween's update during the the execution.
+    UPROPERTY(BlueprintAssignable)
+    FBP_OnTweenTransformChange OnTweenUpdate;
+
+    /// @brief Called by a Latent proxy when the Tween ends the execution.
+    UPROPERTY(BlueprintAssignable)
+    FBP_OnTweenTransformChange OnTweenEnd;
+
+    /*
+     **************************************************************************
+     * "Create" methods
+     **************************************************************************
+     */
+
+    /**
+      * Creates a Latent Tween that moves, rotates and scales an Actor from its current transform (at the start of the Tween) to the given one.
+      * Location, rotation and scale share the same easing and are applied together, with a single transform update.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Actor to transform.
+      * @param OutTweenContainer (optional, output) If this pin is connected with a variable, it will contain the TweenContainer that owns the Tween.
+      * @param OutTween (optional, output) If this pin is connected with a variable, it will contain the Tween that was just created.
+      * @param To The ending transform.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      */
+    UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly="true", DisplayName="Create Latent Tween Actor Transform To", KeyWords="Tween Transform Actor To Move Rotate Scale Latent Create", AdvancedDisplay=7, AutoCreateRefTerm="OutTweenContainer, OutTween"), Category = "Tween|LatentTween|Actor|Transform")
+    static UTweenTransformLatentFactory* BP_CreateLatentTweenActorTransformTo(UTweenManagerComponent* TweenManager,
+                                                                              AActor* TweenTarget,
+                                                                              UTweenContainer*& OutTweenContainer,
+                                                                              UTweenTransform*& OutTween,
+                                                                              FTransform To,
+                                                                              float Duration                  = 1.0f,
+                                                                              ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                              ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                                              ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                              bool DeleteTweenOnHit           = false,
+                                                                              bool DeleteTweenOnOverlap       = false,
+                                                                              int32 NumLoops                  = 1,
+                                                                              ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                                                              float Delay                     = 0.0f,
+                                                                              float TimeScale                 = 1.0f,
+                                                                              bool TweenWhileGameIsPaused     = false);
+
+    /**
+      * Creates a Latent Tween that moves, rotates and scales a SceneComponent from its current transform (at the start of the Tween) to the given one.
+      * Location, rotation and scale share the same easing and are applied together, with a single transform update.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The SceneComponent to transform.
+      * @param OutTweenContainer (optional, output) If this pin is connected with a variable, it will contain the TweenContainer that owns the Tween.
+      * @param OutTween (optional, output) If this pin is connected with a variable, it will contain the Tween that was just created.
+      * @param To The ending transform.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      */
+    UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly="true", DisplayName="Create Latent Tween Scene Component Transform To", KeyWords="Tween Transform Scene Component To Move Rotate Scale Latent Create", AdvancedDisplay=7, AutoCreateRefTerm="OutTweenContainer, OutTween"), Category = "Tween|LatentTween|SceneComponent|Transform")
+    static UTweenTransformLatentFactory* BP_CreateLatentTweenSceneComponentTransformTo(UTweenManagerComponent* TweenManager,
+                                                                                       USceneComponent* TweenTarget,
+                                                                                       UTweenContainer*& OutTweenContainer,
+                                                                                       UTweenTransform*& OutTween,
+                                                                                       FTransform To,
+                                                                                       float Duration                  = 1.0f,
+                                                                                       ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                                       ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                                                       ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                                       bool DeleteTweenOnHit           = false,
+                                                                                       bool DeleteTweenOnOverlap       = false,
+                                                                                       int32 NumLoops                  = 1,
+                                                                                       ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                                                                       float Delay                     = 0.0f,
+                                                                                       float TimeScale                 = 1.0f,
+                                                                                       bool TweenWhileGameIsPaused     = false);
+
+    /*
+     **************************************************************************
+     * "Append" methods
+     **************************************************************************
+     */
+
+    /**
+      * Appends to the TweenContainer a Latent Tween that moves, rotates and scales an Actor from its current transform (at the start of the Tween) to the given one.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param OutTween (optional, output) If this pin is connected with a variable, it will contain the Tween that was just created.
+      * @param TweenTarget The Actor to transform.
+      * @param To The ending transform.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      */
+    UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly="true", DisplayName="Append Latent Tween Actor Transform To", KeyWords="Tween Transform Actor To Move Rotate Scale Latent Append Sequence", AdvancedDisplay=6, AutoCreateRefTerm="OutTween"), Category = "Tween|LatentTween|Actor|Transform")
+    static UTweenTransformLatentFactory* BP_AppendLatentTweenActorTransformTo(UTweenContainer* TweenContainer,
+                                                                              UTweenTransform*& OutTween,
+                                                                              AActor* TweenTarget,
+                                                                              FTransform To,
+                                                                              float Duration                  = 1.0f,
+                                                                              ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                              ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                                              ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                              bool DeleteTweenOnHit           = false,
+                                                                              bool DeleteTweenOnOverlap       = false,
+                                                                              int32 NumLoops                  = 1,
+                                                                              ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                                                              float Delay                     = 0.0f,
+                                                                              float TimeScale                 = 1.0f,
+                                                                              bool TweenWhileGameIsPaused     = false);
+
+    /**
+      * Appends to the TweenContainer a Latent Tween that moves, rotates and scales a SceneComponent from its current transform (at the start of the Tween) to the given one.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param OutTween (optional, output) If this pin is connected with a variable, it will contain the Tween that was just created.
+      * @param TweenTarget The SceneComponent to transform.
+      * @param To The ending transform.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      */
+    UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly="true", DisplayName="Append Latent Tween Scene Component Transform To", KeyWords="Tween Transform Scene Component To Move Rotate Scale Latent Append Sequence", AdvancedDisplay=6, AutoCreateRefTerm="OutTween"), Category = "Tween|LatentTween|SceneComponent|Transform")
+    static UTweenTransformLatentFactory* BP_AppendLatentTweenSceneComponentTransformTo(UTweenContainer* TweenContainer,
+                                                                                       UTweenTransform*& OutTween,
+                                                                                       USceneComponent* TweenTarget,
+                                                                                       FTransform To,
+                                                                                       float Duration                  = 1.0f,
+                                                                                       ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                                       ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                                                       ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                                       bool DeleteTweenOnHit           = false,
+                                                                                       bool DeleteTweenOnOverlap       = false,
+                                                                                       int32 NumLoops                  = 1,
+                                                                                       ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                                                                       float Delay                     = 0.0f,
+                                                                                       float TimeScale                 = 1.0f,
+                                                                                       bool TweenWhileGameIsPaused     = false);
+
+    /*
+     **************************************************************************
+     * "Join" methods
+     **************************************************************************
+     */
+
+    /**
+      * Joins to the TweenContainer a Latent Tween that moves, rotates and scales an Actor from its current transform (at the start of the Tween) to the given one.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param OutTween (optional, output) If this pin is connected with a variable, it will contain the Tween that was just created.
+      * @param TweenTarget The Actor to transform.
+      * @param To The ending transform.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      */
+    UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly="true", DisplayName="Join Latent Tween Actor Transform To", KeyWords="Tween Transform Actor To Move Rotate Scale Latent Join Parallel", AdvancedDisplay=6, AutoCreateRefTerm="OutTween"), Category = "Tween|LatentTween|Actor|Transform")
+    static UTweenTransformLatentFactory* BP_JoinLatentTweenActorTransformTo(UTweenContainer* TweenContainer,
+                                                                            UTweenTransform*& OutTween,
+                                                                            AActor* TweenTarget,
+                                                                            FTransform To,
+                                                                            float Duration                  = 1.0f,
+                                                                            ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                            ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                                            ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                            bool DeleteTweenOnHit           = false,
+                                                                            bool DeleteTweenOnOverlap       = false,
+                                                                            float Delay                     = 0.0f,
+                                                                            float TimeScale                 = 1.0f,
+                                                                            bool TweenWhileGameIsPaused     = false);
+
+    /**
+      * Joins to the TweenContainer a Latent Tween that moves, rotates and scales a SceneComponent from its current transform (at the start of the Tween) to the given one.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param OutTween (optional, output) If this pin is connected with a variable, it will contain the Tween that was just created.
+      * @param TweenTarget The SceneComponent to transform.
+      * @param To The ending transform.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      */
+    UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly="true", DisplayName="Join Latent Tween Scene Component Transform To", KeyWords="Tween Transform Scene Component To Move Rotate Scale Latent Join Parallel", AdvancedDisplay=6, AutoCreateRefTerm="OutTween"), Category = "Tween|LatentTween|SceneComponent|Transform")
+    static UTweenTransformLatentFactory* BP_JoinLatentTweenSceneComponentTransformTo(UTweenContainer* TweenContainer,
+                                                                                     UTweenTransform*& OutTween,
+                                                                                     USceneComponent* TweenTarget,
+                                                                                     FTransform To,
+                                                                                     float Duration                  = 1.0f,
+                                                                                     ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                                     ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                                                     ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                                     bool DeleteTweenOnHit           = false,
+                                                                                     bool DeleteTweenOnOverlap       = false,
+                                                                                     float Delay                     = 0.0f,
+                                                                                     float TimeScale                 = 1.0f,
+                                                                                     bool TweenWhileGameIsPaused     = false);
+
+    // UBlueprintAsyncActionBase interface
+    virtual void Activate() override;
+    // End of UBlueprintAsyncActionBase interface
+
+private:
+
+    /*
+     **************************************************************************
+     * Helper methods that create the actual Tweens
+     **************************************************************************
+     */
+
+    static UTweenTransformLatentFactory* CreateProxyForAppendTweenTransform(UTweenContainer* pTweenContainer,
+                                                                            ETweenTransformType pTweenType,
+                                                                            UObject* pTarget,
+                                                                            ETweenTargetType pTargetType,
+                                                                            const FTransform& pTo,
+                                                                            float pDuration,
+                                                                            ETweenEaseType pEaseType,
+                                                                            ETweenSpace pTweenSpace,
+                                                                            ETweenRotationMode pRotationMode,
+                                                                            bool pDeleteTweenOnHit,
+                                                                            bool pDeleteTweenOnOverlap,
+                                                                            int32 pNumLoops,
+                                                                            ETweenLoopType pLoopType,
+                                                                            float pDelay,
+                                                                            float pTimeScale,
+                                                                            bool pTweenWhileGameIsPaused,
+                                                                            UTweenTransform*& OutTween);
+
+    static UTweenTransformLatentFactory* CreateProxyForJoinTweenTransform(UTweenContainer* pTweenContainer,
+                                                                          ETweenTransformType pTweenType,
+                                                                          UObject* pTarget,
+                                                                          ETweenTargetType pTargetType,
+                                                                          const FTransform& pTo,
+                                                                          float pDuration,
+                                                                          ETweenEaseType pEaseType,
+                                                                          ETweenSpace pTweenSpace,
+                                                                          ETweenRotationMode pRotationMode,
+                                                                          bool pDeleteTweenOnHit,
+                                                                          bool pDeleteTweenOnOverlap,
+                                                                          float pDelay,
+                                                                          float pTimeScale,
+                                                                          bool pTweenWhileGameIsPaused,
+                                                                          UTweenTransform*& OutTween);
+};
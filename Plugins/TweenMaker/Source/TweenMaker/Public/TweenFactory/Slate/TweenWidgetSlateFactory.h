@@ -0,0 +1,176 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Utils/TweenEnums.h"
+
+#include "TweenWidgetSlateFactory.generated.h"
+
+class UWidget;
+enum class ESlateTweenProperty : uint8;
+
+/**
+ * @brief The UTweenWidgetSlateFactory class exposes the FSlateTweenDriver to Blueprint: its Tweens animate the Slate widget behind a UMG widget
+ *        without a TweenManager, keep running while the game is paused and don't create any UObject, which makes them suited for menus.
+ *        They're identified by an id instead of a Tween object, and they have no callbacks, loops aside.
+ *
+ *        When a Tween ends, its final value is also stored in the UMG widget, so that rebuilding the widget doesn't lose it.
+ */
+UCLASS()
+class TWEENMAKER_API UTweenWidgetSlateFactory : public UObject
+{
+    GENERATED_BODY()
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    UTweenWidgetSlateFactory(const FObjectInitializer& ObjectInitializer);
+
+    /**
+      * Moves a UMG widget from its current location (at the start of the Tween) to the given location, without using a TweenManager.
+      *
+      * @param TweenTarget The Widget to move. It must have been constructed already (e.g. added to the viewport).
+      * @param TweenId The id of the created Tween, -1 if it couldn't be created.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Slate Tween Move Widget To", KeyWords="Tween Move Widget UMG Slate To", AdvancedDisplay=4), Category = "Tween|SlateTween|UMG")
+    static void BP_SlateTweenMoveWidgetTo(UWidget* TweenTarget,
+                                          int32& TweenId,
+                                          FVector2D To,
+                                          float Duration          = 1.0f,
+                                          ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                          int32 NumLoops          = 1,
+                                          ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                          float Delay             = 0.0f);
+
+    /**
+      * Scales a UMG widget from its current scale (at the start of the Tween) to the given one, without using a TweenManager.
+      *
+      * @param TweenTarget The Widget to scale. It must have been constructed already (e.g. added to the viewport).
+      * @param TweenId The id of the created Tween, -1 if it couldn't be created.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Slate Tween Scale Widget To", KeyWords="Tween Scale Widget UMG Slate To", AdvancedDisplay=4), Category = "Tween|SlateTween|UMG")
+    static void BP_SlateTweenScaleWidgetTo(UWidget* TweenTarget,
+                                           int32& TweenId,
+                                           FVector2D To,
+                                           float Duration          = 1.0f,
+                                           ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                           int32 NumLoops          = 1,
+                                           ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                           float Delay             = 0.0f);
+
+    /**
+      * Shears a UMG widget from its current shear (at the start of the Tween) to the given one, without using a TweenManager.
+      *
+      * @param TweenTarget The Widget to shear. It must have been constructed already (e.g. added to the viewport).
+      * @param TweenId The id of the created Tween, -1 if it couldn't be created.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Slate Tween Shear Widget To", KeyWords="Tween Shear Widget UMG Slate To", AdvancedDisplay=4), Category = "Tween|SlateTween|UMG")
+    static void BP_SlateTweenShearWidgetTo(UWidget* TweenTarget,
+                                           int32& TweenId,
+                                           FVector2D To,
+                                           float Duration          = 1.0f,
+                                           ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                           int32 NumLoops          = 1,
+                                           ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                           float Delay             = 0.0f);
+
+    /**
+      * Rotates a UMG widget from its current angle (at the start of the Tween) to the given one, without using a TweenManager.
+      *
+      * @param TweenTarget The Widget to rotate. It must have been constructed already (e.g. added to the viewport).
+      * @param TweenId The id of the created Tween, -1 if it couldn't be created.
+      * @param To The ending angle (in degrees).
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Slate Tween Widget Angle To", KeyWords="Tween Angle Rotate Widget UMG Slate To", AdvancedDisplay=4), Category = "Tween|SlateTween|UMG")
+    static void BP_SlateTweenWidgetAngleTo(UWidget* TweenTarget,
+                                           int32& TweenId,
+                                           float To,
+                                           float Duration          = 1.0f,
+                                           ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                           int32 NumLoops          = 1,
+                                           ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                           float Delay             = 0.0f);
+
+    /**
+      * Makes a UMG widget's opacity reach the given value, without using a TweenManager.
+      *
+      * @param TweenTarget The target Widget. It must have been constructed already (e.g. added to the viewport).
+      * @param TweenId The id of the created Tween, -1 if it couldn't be created.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Slate Tween Widget Opacity To", KeyWords="Tween Opacity Fade Widget UMG Slate To", AdvancedDisplay=4), Category = "Tween|SlateTween|UMG")
+    static void BP_SlateTweenWidgetOpacityTo(UWidget* TweenTarget,
+                                             int32& TweenId,
+                                             float To,
+                                             float Duration          = 1.0f,
+                                             ETweenEaseType EaseType = ETweenEaseType::Linear,
+                                             int32 NumLoops          = 1,
+                                             ETweenLoopType LoopType = ETweenLoopType::Yoyo,
+                                             float Delay             = 0.0f);
+
+    /**
+      * Stops a Tween created by one of the "Slate Tween" functions.
+      *
+      * @param TweenId The id of the Tween.
+      * @param JumpToEnd If true, the Tween will apply its ending value before stopping.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Stop Slate Tween", KeyWords="Tween Stop Slate"), Category = "Tween|SlateTween")
+    static void BP_StopSlateTween(int32 TweenId, bool JumpToEnd = false);
+
+    /**
+      * Stops all the Tweens created by the "Slate Tween" functions on the given widget.
+      *
+      * @param TweenTarget The Widget.
+      * @param JumpToEnd If true, the Tweens will apply their ending values before stopping.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Stop Widget Slate Tweens", KeyWords="Tween Stop Widget UMG Slate"), Category = "Tween|SlateTween|UMG")
+    static void BP_StopWidgetSlateTweens(UWidget* TweenTarget, bool JumpToEnd = false);
+
+private:
+
+    /**
+     * @brief Adds a Tween on the Slate widget of the given UMG widget to the FSlateTweenDriver.
+     *
+     * @return The id of the Tween, -1 if the widget hasn't been constructed yet.
+     */
+    static int32 AddWidgetTween(UWidget* pTweenTarget,
+                                ESlateTweenProperty pProperty,
+                                const FVector2D& pTo,
+                                float pDuration,
+                                ETweenEaseType pEaseType,
+                                int32 pNumLoops,
+                                ETweenLoopType pLoopType,
+                                float pDelay);
+};
@@ -15,6 +15,8 @@ class UTweenContainer;
 class UBaseTween;
 class UTweenFloat;
 class UMaterialInstanceDynamic;
+class UMaterialParameterCollection;
+class UPrimitiveComponent;
 class USplineComponent;
 class UWidget;
 
@@ -116,6 +118,150 @@ public:
                                               bool TweenWhileGameIsPaused = false,
                                               int32 SequenceIndex         = -1);
 
+    /**
+      * Creates a Tween that modifies a "float" custom primitive data value of a PrimitiveComponent from the starting value to the ending value.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param DataIndex The index of the custom primitive data value to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Custom Primitive Data Float From To", KeyWords="Tween Tween Custom Primitive Data Float From To Create", AdvancedDisplay=8, HidePin=SequenceIndex), Category = "Tween|StandardTween|CustomPrimitiveData")
+    static void BP_CreateTweenCustomPrimitiveDataFloatFromTo(UTweenManagerComponent* TweenManager,
+                                                             UPrimitiveComponent* TweenTarget,
+                                                             UTweenContainer*& TweenContainer,
+                                                             UTweenFloat*& Tween,
+                                                             int32 DataIndex,
+                                                             float From,
+                                                             float To,
+                                                             float Duration              = 1.0f,
+                                                             ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                             int32 NumLoops              = 1,
+                                                             ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                             float Delay                 = 0.0f,
+                                                             float TimeScale             = 1.0f,
+                                                             bool TweenWhileGameIsPaused = false,
+                                                             int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that modifies a "float" custom primitive data value of a PrimitiveComponent from its current value (at the start of the Tween) to the ending value.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param DataIndex The index of the custom primitive data value to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Custom Primitive Data Float To", KeyWords="Tween Tween Custom Primitive Data Float To Create", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|CustomPrimitiveData")
+    static void BP_CreateTweenCustomPrimitiveDataFloatTo(UTweenManagerComponent* TweenManager,
+                                                         UPrimitiveComponent* TweenTarget,
+                                                         UTweenContainer*& TweenContainer,
+                                                         UTweenFloat*& Tween,
+                                                         int32 DataIndex,
+                                                         float To,
+                                                         float Duration              = 1.0f,
+                                                         ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                         int32 NumLoops              = 1,
+                                                         ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                         float Delay                 = 0.0f,
+                                                         float TimeScale             = 1.0f,
+                                                         bool TweenWhileGameIsPaused = false,
+                                                         int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that modifies a "float" parameter of a Material Parameter Collection from the starting value to the ending value.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Parameter Collection Float From To", KeyWords="Tween Tween Material Parameter Collection MPC Float From To Create", AdvancedDisplay=8, HidePin=SequenceIndex), Category = "Tween|StandardTween|MaterialParameterCollection")
+    static void BP_CreateTweenParameterCollectionFloatFromTo(UTweenManagerComponent* TweenManager,
+                                                             UMaterialParameterCollection* TweenTarget,
+                                                             UTweenContainer*& TweenContainer,
+                                                             UTweenFloat*& Tween,
+                                                             FName ParameterName,
+                                                             float From,
+                                                             float To,
+                                                             float Duration              = 1.0f,
+                                                             ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                             int32 NumLoops              = 1,
+                                                             ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                             float Delay                 = 0.0f,
+                                                             float TimeScale             = 1.0f,
+                                                             bool TweenWhileGameIsPaused = false,
+                                                             int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that modifies a "float" parameter of a Material Parameter Collection from its current value (at the start of the Tween) to the ending value.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Parameter Collection Float To", KeyWords="Tween Tween Material Parameter Collection MPC Float To Create", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|MaterialParameterCollection")
+    static void BP_CreateTweenParameterCollectionFloatTo(UTweenManagerComponent* TweenManager,
+                                                         UMaterialParameterCollection* TweenTarget,
+                                                         UTweenContainer*& TweenContainer,
+                                                         UTweenFloat*& Tween,
+                                                         FName ParameterName,
+                                                         float To,
+                                                         float Duration              = 1.0f,
+                                                         ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                         int32 NumLoops              = 1,
+                                                         ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                         float Delay                 = 0.0f,
+                                                         float TimeScale             = 1.0f,
+                                                         bool TweenWhileGameIsPaused = false,
+                                                         int32 SequenceIndex         = -1);
+
     /**
       * Creates a Tween that rotates an Actor around a given pivot point, with a given radius and rotation axis. The Actor will move
       * relative to its parent (if there is none, it will move in world coordinates).
@@ -562,6 +708,142 @@ public:
                                                       bool TweenWhileGameIsPaused = false,
                                                       int32 SequenceIndex         = -1);
 
+    /**
+      * Appends to the TweenContainer a Tween that modifies a "float" custom primitive data value of a PrimitiveComponent from the starting value to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the custom primitive data value to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Custom Primitive Data Float From To", KeyWords="Tween Tween Custom Primitive Data Float From To Append Sequence", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|CustomPrimitiveData")
+    static UTweenFloat* BP_AppendTweenCustomPrimitiveDataFloatFromTo(UTweenContainer* TweenContainer,
+                                                                     UPrimitiveComponent* TweenTarget,
+                                                                     int32 DataIndex,
+                                                                     float From,
+                                                                     float To,
+                                                                     float Duration              = 1.0f,
+                                                                     ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                     int32 NumLoops              = 1,
+                                                                     ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                                     float Delay                 = 0.0f,
+                                                                     float TimeScale             = 1.0f,
+                                                                     bool TweenWhileGameIsPaused = false,
+                                                                     int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that modifies a "float" custom primitive data value of a PrimitiveComponent from its current value (at the start of the Tween) to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the custom primitive data value to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Custom Primitive Data Float To", KeyWords="Tween Tween Custom Primitive Data Float To Append Sequence", AdvancedDisplay=5, HidePin=SequenceIndex), Category = "Tween|StandardTween|CustomPrimitiveData")
+    static UTweenFloat* BP_AppendTweenCustomPrimitiveDataFloatTo(UTweenContainer* TweenContainer,
+                                                                 UPrimitiveComponent* TweenTarget,
+                                                                 int32 DataIndex,
+                                                                 float To,
+                                                                 float Duration              = 1.0f,
+                                                                 ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                 int32 NumLoops              = 1,
+                                                                 ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                                 float Delay                 = 0.0f,
+                                                                 float TimeScale             = 1.0f,
+                                                                 bool TweenWhileGameIsPaused = false,
+                                                                 int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that modifies a "float" parameter of a Material Parameter Collection from the starting value to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Parameter Collection Float From To", KeyWords="Tween Tween Material Parameter Collection MPC Float From To Append Sequence", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|MaterialParameterCollection")
+    static UTweenFloat* BP_AppendTweenParameterCollectionFloatFromTo(UTweenContainer* TweenContainer,
+                                                                     UMaterialParameterCollection* TweenTarget,
+                                                                     FName ParameterName,
+                                                                     float From,
+                                                                     float To,
+                                                                     float Duration              = 1.0f,
+                                                                     ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                     int32 NumLoops              = 1,
+                                                                     ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                                     float Delay                 = 0.0f,
+                                                                     float TimeScale             = 1.0f,
+                                                                     bool TweenWhileGameIsPaused = false,
+                                                                     int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that modifies a "float" parameter of a Material Parameter Collection from its current value (at the start of the Tween) to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Parameter Collection Float To", KeyWords="Tween Tween Material Parameter Collection MPC Float To Append Sequence", AdvancedDisplay=5, HidePin=SequenceIndex), Category = "Tween|StandardTween|MaterialParameterCollection")
+    static UTweenFloat* BP_AppendTweenParameterCollectionFloatTo(UTweenContainer* TweenContainer,
+                                                                 UMaterialParameterCollection* TweenTarget,
+                                                                 FName ParameterName,
+                                                                 float To,
+                                                                 float Duration              = 1.0f,
+                                                                 ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                 int32 NumLoops              = 1,
+                                                                 ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                                 float Delay                 = 0.0f,
+                                                                 float TimeScale             = 1.0f,
+                                                                 bool TweenWhileGameIsPaused = false,
+                                                                 int32 SequenceIndex         = -1);
+
     /**
       * Appends to the TweenContainer a Tween that rotates an Actor around a given pivot point, with a given radius and rotation axis. The Actor will move
       * relative to its parent (if there is none, it will move in world coordinates).
@@ -982,6 +1264,126 @@ public:
                                                     bool TweenWhileGameIsPaused = false,
                                                     int32 SequenceIndex         = -1);
 
+    /**
+      * Joins to the TweenContainer a Tween that modifies a "float" custom primitive data value of a PrimitiveComponent from the starting value to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the custom primitive data value to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Custom Primitive Data Float From To", KeyWords="Tween Custom Primitive Data Float From To Join Parallel", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|CustomPrimitiveData")
+    static UTweenFloat* BP_JoinTweenCustomPrimitiveDataFloatFromTo(UTweenContainer* TweenContainer,
+                                                                   UPrimitiveComponent* TweenTarget,
+                                                                   int32 DataIndex,
+                                                                   float From,
+                                                                   float To,
+                                                                   float Duration              = 1.0f,
+                                                                   ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                   float Delay                 = 0.0f,
+                                                                   float TimeScale             = 1.0f,
+                                                                   bool TweenWhileGameIsPaused = false,
+                                                                   int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that modifies a "float" custom primitive data value of a PrimitiveComponent from its current value (at the start of the Tween) to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the custom primitive data value to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Custom Primitive Data Float To", KeyWords="Tween Custom Primitive Data Float To Join Parallel", AdvancedDisplay=5, HidePin=SequenceIndex), Category = "Tween|StandardTween|CustomPrimitiveData")
+    static UTweenFloat* BP_JoinTweenCustomPrimitiveDataFloatTo(UTweenContainer* TweenContainer,
+                                                               UPrimitiveComponent* TweenTarget,
+                                                               int32 DataIndex,
+                                                               float To,
+                                                               float Duration              = 1.0f,
+                                                               ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                               float Delay                 = 0.0f,
+                                                               float TimeScale             = 1.0f,
+                                                               bool TweenWhileGameIsPaused = false,
+                                                               int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that modifies a "float" parameter of a Material Parameter Collection from the starting value to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Parameter Collection Float From To", KeyWords="Tween Material Parameter Collection MPC Float From To Join Parallel", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|MaterialParameterCollection")
+    static UTweenFloat* BP_JoinTweenParameterCollectionFloatFromTo(UTweenContainer* TweenContainer,
+                                                                   UMaterialParameterCollection* TweenTarget,
+                                                                   FName ParameterName,
+                                                                   float From,
+                                                                   float To,
+                                                                   float Duration              = 1.0f,
+                                                                   ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                   float Delay                 = 0.0f,
+                                                                   float TimeScale             = 1.0f,
+                                                                   bool TweenWhileGameIsPaused = false,
+                                                                   int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that modifies a "float" parameter of a Material Parameter Collection from its current value (at the start of the Tween) to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Parameter Collection Float To", KeyWords="Tween Material Parameter Collection MPC Float To Join Parallel", AdvancedDisplay=5, HidePin=SequenceIndex), Category = "Tween|StandardTween|MaterialParameterCollection")
+    static UTweenFloat* BP_JoinTweenParameterCollectionFloatTo(UTweenContainer* TweenContainer,
+                                                               UMaterialParameterCollection* TweenTarget,
+                                                               FName ParameterName,
+                                                               float To,
+                                                               float Duration              = 1.0f,
+                                                               ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                               float Delay                 = 0.0f,
+                                                               float TimeScale             = 1.0f,
+                                                               bool TweenWhileGameIsPaused = false,
+                                                               int32 SequenceIndex         = -1);
+
     /**
       * Joins to the TweenContainer a Tween that rotates an Actor around a given pivot point, with a given radius and rotation axis. The Actor will move
       * relative to its parent (if there is none, it will move in world coordinates).
@@ -15,6 +15,8 @@ class UTweenContainer;
 class UBaseTween;
 class UTweenLinearColor;
 class UMaterialInstanceDynamic;
+class UMaterialParameterCollection;
+class UPrimitiveComponent;
 
 /**
  * @brief The UTweenLinearColorStandardFactory class handles the creation of all LinearColor related Tweens, i.e. all tweens that
@@ -115,6 +117,150 @@ public:
                                                bool TweenWhileGameIsPaused = false,
                                                int32 SequenceIndex         = -1);
 
+    /**
+      * Creates a Tween that modifies a "Vector" custom primitive data value of a PrimitiveComponent from the starting value to the ending value.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param DataIndex The index of the first of the four custom primitive data values to tween (R, G, B and A are written at DataIndex, DataIndex + 1, DataIndex + 2 and DataIndex + 3).
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+	  * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+	  */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Custom Primitive Data Vector From To", KeyWords="Tween Tween Custom Primitive Data Vector From To Create", AdvancedDisplay=8, HidePin=SequenceIndex), Category = "Tween|StandardTween|CustomPrimitiveData")
+    static void BP_CreateTweenCustomPrimitiveDataVectorFromTo(UTweenManagerComponent* TweenManager,
+                                                              UPrimitiveComponent* TweenTarget,
+                                                              UTweenContainer*& TweenContainer,
+                                                              UTweenLinearColor*& Tween,
+                                                              int32 DataIndex,
+                                                              FLinearColor From,
+                                                              FLinearColor To,
+                                                              float Duration              = 1.0f,
+                                                              ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                              int32 NumLoops              = 1,
+                                                              ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                              float Delay                 = 0.0f,
+                                                              float TimeScale             = 1.0f,
+                                                              bool TweenWhileGameIsPaused = false,
+                                                              int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that modifies a "Vector" custom primitive data value of a PrimitiveComponent from its current value (at the start of the Tween) to the ending value.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param DataIndex The index of the first of the four custom primitive data values to tween (R, G, B and A are written at DataIndex, DataIndex + 1, DataIndex + 2 and DataIndex + 3).
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+	  * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+	  */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Custom Primitive Data Vector To", KeyWords="Tween Tween Custom Primitive Data Vector To Create", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|CustomPrimitiveData")
+    static void BP_CreateTweenCustomPrimitiveDataVectorTo(UTweenManagerComponent* TweenManager,
+                                                          UPrimitiveComponent* TweenTarget,
+                                                          UTweenContainer*& TweenContainer,
+                                                          UTweenLinearColor*& Tween,
+                                                          int32 DataIndex,
+                                                          FLinearColor To,
+                                                          float Duration              = 1.0f,
+                                                          ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                          int32 NumLoops              = 1,
+                                                          ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                          float Delay                 = 0.0f,
+                                                          float TimeScale             = 1.0f,
+                                                          bool TweenWhileGameIsPaused = false,
+                                                          int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that modifies a "Vector" parameter of a Material Parameter Collection from the starting value to the ending value.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+	  * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+	  */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Parameter Collection Vector From To", KeyWords="Tween Tween Material Parameter Collection MPC Vector From To Create", AdvancedDisplay=8, HidePin=SequenceIndex), Category = "Tween|StandardTween|MaterialParameterCollection")
+    static void BP_CreateTweenParameterCollectionVectorFromTo(UTweenManagerComponent* TweenManager,
+                                                              UMaterialParameterCollection* TweenTarget,
+                                                              UTweenContainer*& TweenContainer,
+                                                              UTweenLinearColor*& Tween,
+                                                              FName ParameterName,
+                                                              FLinearColor From,
+                                                              FLinearColor To,
+                                                              float Duration              = 1.0f,
+                                                              ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                              int32 NumLoops              = 1,
+                                                              ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                              float Delay                 = 0.0f,
+                                                              float TimeScale             = 1.0f,
+                                                              bool TweenWhileGameIsPaused = false,
+                                                              int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that modifies a "Vector" parameter of a Material Parameter Collection from its current value (at the start of the Tween) to the ending value.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+	  * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+	  */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Parameter Collection Vector To", KeyWords="Tween Tween Material Parameter Collection MPC Vector To Create", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|MaterialParameterCollection")
+    static void BP_CreateTweenParameterCollectionVectorTo(UTweenManagerComponent* TweenManager,
+                                                          UMaterialParameterCollection* TweenTarget,
+                                                          UTweenContainer*& TweenContainer,
+                                                          UTweenLinearColor*& Tween,
+                                                          FName ParameterName,
+                                                          FLinearColor To,
+                                                          float Duration              = 1.0f,
+                                                          ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                          int32 NumLoops              = 1,
+                                                          ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                          float Delay                 = 0.0f,
+                                                          float TimeScale             = 1.0f,
+                                                          bool TweenWhileGameIsPaused = false,
+                                                          int32 SequenceIndex         = -1);
+
     /*
      **************************************************************************
      * "Append" methods
@@ -190,6 +336,142 @@ public:
                                                              bool TweenWhileGameIsPaused = false,
                                                              int32 SequenceIndex         = -1);
 
+    /**
+      * Appends to the TweenContainer a Tween that modifies a "Vector" custom primitive data value of a PrimitiveComponent from the starting value to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the first of the four custom primitive data values to tween (R, G, B and A are written at DataIndex, DataIndex + 1, DataIndex + 2 and DataIndex + 3).
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+	  * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+	  *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Custom Primitive Data Vector From To", KeyWords="Tween Tween Custom Primitive Data Vector From To Append Sequence", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|CustomPrimitiveData")
+    static UTweenLinearColor* BP_AppendTweenCustomPrimitiveDataVectorFromTo(UTweenContainer* TweenContainer,
+                                                                            UPrimitiveComponent* TweenTarget,
+                                                                            int32 DataIndex,
+                                                                            FLinearColor From,
+                                                                            FLinearColor To,
+                                                                            float Duration              = 1.0f,
+                                                                            ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                            int32 NumLoops              = 1,
+                                                                            ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                                            float Delay                 = 0.0f,
+                                                                            float TimeScale             = 1.0f,
+                                                                            bool TweenWhileGameIsPaused = false,
+                                                                            int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that modifies a "Vector" custom primitive data value of a PrimitiveComponent from its current value (at the start of the Tween) to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the first of the four custom primitive data values to tween (R, G, B and A are written at DataIndex, DataIndex + 1, DataIndex + 2 and DataIndex + 3).
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+	  * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+	  *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Custom Primitive Data Vector To", KeyWords="Tween Tween Custom Primitive Data Vector To Append Sequence", AdvancedDisplay=5, HidePin=SequenceIndex), Category = "Tween|StandardTween|CustomPrimitiveData")
+    static UTweenLinearColor* BP_AppendTweenCustomPrimitiveDataVectorTo(UTweenContainer* TweenContainer,
+                                                                        UPrimitiveComponent* TweenTarget,
+                                                                        int32 DataIndex,
+                                                                        FLinearColor To,
+                                                                        float Duration              = 1.0f,
+                                                                        ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                        int32 NumLoops              = 1,
+                                                                        ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                                        float Delay                 = 0.0f,
+                                                                        float TimeScale             = 1.0f,
+                                                                        bool TweenWhileGameIsPaused = false,
+                                                                        int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that modifies a "Vector" parameter of a Material Parameter Collection from the starting value to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+	  * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+	  *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Parameter Collection Vector From To", KeyWords="Tween Tween Material Parameter Collection MPC Vector From To Append Sequence", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|MaterialParameterCollection")
+    static UTweenLinearColor* BP_AppendTweenParameterCollectionVectorFromTo(UTweenContainer* TweenContainer,
+                                                                            UMaterialParameterCollection* TweenTarget,
+                                                                            FName ParameterName,
+                                                                            FLinearColor From,
+                                                                            FLinearColor To,
+                                                                            float Duration              = 1.0f,
+                                                                            ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                            int32 NumLoops              = 1,
+                                                                            ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                                            float Delay                 = 0.0f,
+                                                                            float TimeScale             = 1.0f,
+                                                                            bool TweenWhileGameIsPaused = false,
+                                                                            int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that modifies a "Vector" parameter of a Material Parameter Collection from its current value (at the start of the Tween) to the ending value.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+	  * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+	  *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Parameter Collection Vector To", KeyWords="Tween Tween Material Parameter Collection MPC Vector To Append Sequence", AdvancedDisplay=5, HidePin=SequenceIndex), Category = "Tween|StandardTween|MaterialParameterCollection")
+    static UTweenLinearColor* BP_AppendTweenParameterCollectionVectorTo(UTweenContainer* TweenContainer,
+                                                                        UMaterialParameterCollection* TweenTarget,
+                                                                        FName ParameterName,
+                                                                        FLinearColor To,
+                                                                        float Duration              = 1.0f,
+                                                                        ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                        int32 NumLoops              = 1,
+                                                                        ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                                        float Delay                 = 0.0f,
+                                                                        float TimeScale             = 1.0f,
+                                                                        bool TweenWhileGameIsPaused = false,
+                                                                        int32 SequenceIndex         = -1);
+
     /*
      **************************************************************************
      * "Join" methods
@@ -256,6 +538,126 @@ public:
                                                            bool TweenWhileGameIsPaused = false,
                                                            int32 SequenceIndex         = -1);
 
+    /**
+      * Joins to the TweenContainer a Tween that modifies a "Vector" custom primitive data value of a PrimitiveComponent from the starting value to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the first of the four custom primitive data values to tween (R, G, B and A are written at DataIndex, DataIndex + 1, DataIndex + 2 and DataIndex + 3).
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+	  * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+	  *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Custom Primitive Data Vector From To", KeyWords="Tween Custom Primitive Data Vector From To Join Parallel", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|CustomPrimitiveData")
+    static UTweenLinearColor* BP_JoinTweenCustomPrimitiveDataVectorFromTo(UTweenContainer* TweenContainer,
+                                                                          UPrimitiveComponent* TweenTarget,
+                                                                          int32 DataIndex,
+                                                                          FLinearColor From,
+                                                                          FLinearColor To,
+                                                                          float Duration              = 1.0f,
+                                                                          ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                          float Delay                 = 0.0f,
+                                                                          float TimeScale             = 1.0f,
+                                                                          bool TweenWhileGameIsPaused = false,
+                                                                          int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that modifies a "Vector" custom primitive data value of a PrimitiveComponent from its current value (at the start of the Tween) to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target PrimitiveComponent. Its materials must read the value through a "PerInstanceCustomData" node.
+      * @param DataIndex The index of the first of the four custom primitive data values to tween (R, G, B and A are written at DataIndex, DataIndex + 1, DataIndex + 2 and DataIndex + 3).
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+	  * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+	  *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Custom Primitive Data Vector To", KeyWords="Tween Custom Primitive Data Vector To Join Parallel", AdvancedDisplay=5, HidePin=SequenceIndex), Category = "Tween|StandardTween|CustomPrimitiveData")
+    static UTweenLinearColor* BP_JoinTweenCustomPrimitiveDataVectorTo(UTweenContainer* TweenContainer,
+                                                                      UPrimitiveComponent* TweenTarget,
+                                                                      int32 DataIndex,
+                                                                      FLinearColor To,
+                                                                      float Duration              = 1.0f,
+                                                                      ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                      float Delay                 = 0.0f,
+                                                                      float TimeScale             = 1.0f,
+                                                                      bool TweenWhileGameIsPaused = false,
+                                                                      int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that modifies a "Vector" parameter of a Material Parameter Collection from the starting value to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param From	The starting value.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+	  * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+	  *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Parameter Collection Vector From To", KeyWords="Tween Material Parameter Collection MPC Vector From To Join Parallel", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|MaterialParameterCollection")
+    static UTweenLinearColor* BP_JoinTweenParameterCollectionVectorFromTo(UTweenContainer* TweenContainer,
+                                                                          UMaterialParameterCollection* TweenTarget,
+                                                                          FName ParameterName,
+                                                                          FLinearColor From,
+                                                                          FLinearColor To,
+                                                                          float Duration              = 1.0f,
+                                                                          ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                          float Delay                 = 0.0f,
+                                                                          float TimeScale             = 1.0f,
+                                                                          bool TweenWhileGameIsPaused = false,
+                                                                          int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that modifies a "Vector" parameter of a Material Parameter Collection from its current value (at the start of the Tween) to the ending value.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The target Material Parameter Collection. The value is written on its instance in the world of the TweenManager.
+      * @param ParameterName The name of the collection's parameter to tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+	  * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+	  *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Parameter Collection Vector To", KeyWords="Tween Material Parameter Collection MPC Vector To Join Parallel", AdvancedDisplay=5, HidePin=SequenceIndex), Category = "Tween|StandardTween|MaterialParameterCollection")
+    static UTweenLinearColor* BP_JoinTweenParameterCollectionVectorTo(UTweenContainer* TweenContainer,
+                                                                      UMaterialParameterCollection* TweenTarget,
+                                                                      FName ParameterName,
+                                                                      FLinearColor To,
+                                                                      float Duration              = 1.0f,
+                                                                      ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                      float Delay                 = 0.0f,
+                                                                      float TimeScale             = 1.0f,
+                                                                      bool TweenWhileGameIsPaused = false,
+                                                                      int32 SequenceIndex         = -1);
+
 private:
 
     /*
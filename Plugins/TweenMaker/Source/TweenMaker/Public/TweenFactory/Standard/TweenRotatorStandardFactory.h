@@ -13,6 +13,7 @@ class ATweenManagerActor;
 class UTweenManagerComponent;
 class UTweenContainer;
 class UBaseTween;
+class UInstancedStaticMeshComponent;
 class UTweenRotator;
 
 /**
@@ -201,6 +202,169 @@ public:
                                                      bool TweenWhileGameIsPaused = false,
                                                      int32 SequenceIndex         = -1);
 
+    /**
+      * Creates a Tween that rotates an instance of an InstancedStaticMeshComponent from its current orientation (at the start of the Tween) to the given rotation.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to rotate.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode	The rotation mode to use.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Rotate Instance To", KeyWords="Tween Rotate Instance To Instanced Static Mesh Create", AdvancedDisplay=8, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Rotate")
+    static void BP_CreateTweenRotateInstanceTo(UTweenManagerComponent* TweenManager,
+                                               UInstancedStaticMeshComponent* TweenTarget,
+                                               int32 InstanceIndex,
+                                               UTweenContainer*& TweenContainer,
+                                               UTweenRotator*& Tween,
+                                               FRotator To,
+                                               float Duration                  = 1.0f,
+                                               ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                               ETweenSpace TweenSpace          = ETweenSpace::World,
+                                               ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                               int32 NumLoops                  = 1,
+                                               ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                               float Delay                     = 0.0f,
+                                               float TimeScale                 = 1.0f,
+                                               bool TweenWhileGameIsPaused     = false,
+                                               int32 SequenceIndex             = -1);
+
+    /**
+      * Creates a Tween that rotates an instance of an InstancedStaticMeshComponent by the given offset with respect to its current orientation (at the start of the Tween).
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to rotate.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param LocalSpace Whether to rotate around the instance's own local axes, not the component's
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Rotate Instance By", KeyWords="Tween Rotate Instance By Instanced Static Mesh Create", AdvancedDisplay=8, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Rotate")
+    static void BP_CreateTweenRotateInstanceBy(UTweenManagerComponent* TweenManager,
+                                               UInstancedStaticMeshComponent* TweenTarget,
+                                               int32 InstanceIndex,
+                                               UTweenContainer*& TweenContainer,
+                                               UTweenRotator*& Tween,
+                                               FRotator By,
+                                               float Duration              = 1.0f,
+                                               ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                               bool LocalSpace             = false,
+                                               int32 NumLoops              = 1,
+                                               ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                               float Delay                 = 0.0f,
+                                               float TimeScale             = 1.0f,
+                                               bool TweenWhileGameIsPaused = false,
+                                               int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that rotates an Actor from its current orientation (at the start of the Tween) until it faces a SceneComponent, e.g. to aim a turret.
+      * The direction of the destination is computed again at each update, so the Actor keeps facing it even while either of them moves.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Actor to rotate.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param Destination The SceneComponent to look at (to look at an Actor, pass its root component).
+      * @param SocketName (optional) The socket of the destination to look at.
+      * @param Offset Offset from the destination (or its socket), in its own space.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param RotationMode	The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Rotate Actor Look At Component", KeyWords="Tween Rotate Actor Look At Component Face Aim Create", AdvancedDisplay=9, HidePin=SequenceIndex), Category = "Tween|StandardTween|Actor|Rotate")
+    static void BP_CreateTweenRotateActorLookAtComponent(UTweenManagerComponent* TweenManager,
+                                                         AActor* TweenTarget,
+                                                         UTweenContainer*& TweenContainer,
+                                                         UTweenRotator*& Tween,
+                                                         USceneComponent* Destination,
+                                                         FName SocketName                = NAME_None,
+                                                         FVector Offset                  = FVector::ZeroVector,
+                                                         float Duration                  = 1.0f,
+                                                         ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                         ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                         bool DeleteTweenOnHit           = false,
+                                                         bool DeleteTweenOnOverlap       = false,
+                                                         int32 NumLoops                  = 1,
+                                                         ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                                         float Delay                     = 0.0f,
+                                                         float TimeScale                 = 1.0f,
+                                                         bool TweenWhileGameIsPaused     = false,
+                                                         int32 SequenceIndex             = -1);
+
+    /**
+      * Creates a Tween that rotates a SceneComponent from its current orientation (at the start of the Tween) until it faces a SceneComponent, e.g. to aim a turret.
+      * The direction of the destination is computed again at each update, so the SceneComponent keeps facing it even while either of them moves.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The SceneComponent to rotate.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param Destination The SceneComponent to look at (to look at an Actor, pass its root component).
+      * @param SocketName (optional) The socket of the destination to look at.
+      * @param Offset Offset from the destination (or its socket), in its own space.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param RotationMode	The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Rotate Scene Component Look At Component", KeyWords="Tween Rotate Scene Component Look At Component Face Aim Create", AdvancedDisplay=9, HidePin=SequenceIndex), Category = "Tween|StandardTween|SceneComponent|Rotate")
+    static void BP_CreateTweenRotateSceneComponentLookAtComponent(UTweenManagerComponent* TweenManager,
+                                                                  USceneComponent* TweenTarget,
+                                                                  UTweenContainer*& TweenContainer,
+                                                                  UTweenRotator*& Tween,
+                                                                  USceneComponent* Destination,
+                                                                  FName SocketName                = NAME_None,
+                                                                  FVector Offset                  = FVector::ZeroVector,
+                                                                  float Duration                  = 1.0f,
+                                                                  ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                  ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                  bool DeleteTweenOnHit           = false,
+                                                                  bool DeleteTweenOnOverlap       = false,
+                                                                  int32 NumLoops                  = 1,
+                                                                  ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                                                  float Delay                     = 0.0f,
+                                                                  float TimeScale                 = 1.0f,
+                                                                  bool TweenWhileGameIsPaused     = false,
+                                                                  int32 SequenceIndex             = -1);
 
     /*
      **************************************************************************
@@ -360,6 +524,161 @@ public:
                                                                bool TweenWhileGameIsPaused = false,
                                                                int32 SequenceIndex         = -1);
 
+    /**
+      * Appends to the TweenContainer a Tween that rotates an instance of an InstancedStaticMeshComponent from its current orientation (at the start of the Tween) to the given rotation.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to rotate.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode	The rotation mode to use.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Rotate Instance To", KeyWords="Tween Rotate Instance To Instanced Static Mesh Append Sequence", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Rotate")
+    static UTweenRotator* BP_AppendTweenRotateInstanceTo(UTweenContainer* TweenContainer,
+                                                         UInstancedStaticMeshComponent* TweenTarget,
+                                                         int32 InstanceIndex,
+                                                         FRotator To,
+                                                         float Duration                  = 1.0f,
+                                                         ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                         ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                         ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                         int32 NumLoops                  = 1,
+                                                         ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                                         float Delay                     = 0.0f,
+                                                         float TimeScale                 = 1.0f,
+                                                         bool TweenWhileGameIsPaused     = false,
+                                                         int32 SequenceIndex             = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that rotates an instance of an InstancedStaticMeshComponent by the given offset with respect to its current orientation (at the start of the Tween).
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to rotate.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param LocalSpace Whether to rotate around the instance's own local axes, not the component's
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Rotate Instance By", KeyWords="Tween Rotate Instance By Instanced Static Mesh Append Sequence", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Rotate")
+    static UTweenRotator* BP_AppendTweenRotateInstanceBy(UTweenContainer* TweenContainer,
+                                                         UInstancedStaticMeshComponent* TweenTarget,
+                                                         int32 InstanceIndex,
+                                                         FRotator By,
+                                                         float Duration              = 1.0f,
+                                                         ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                         bool LocalSpace             = false,
+                                                         int32 NumLoops              = 1,
+                                                         ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                         float Delay                 = 0.0f,
+                                                         float TimeScale             = 1.0f,
+                                                         bool TweenWhileGameIsPaused = false,
+                                                         int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that rotates an Actor from its current orientation (at the start of the Tween) until it faces a SceneComponent.
+      * The direction of the destination is computed again at each update, so the Actor keeps facing it even while either of them moves.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The Actor to rotate.
+      * @param Destination The SceneComponent to look at (to look at an Actor, pass its root component).
+      * @param SocketName (optional) The socket of the destination to look at.
+      * @param Offset Offset from the destination (or its socket), in its own space.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param RotationMode	The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Rotate Actor Look At Component", KeyWords="Tween Rotate Actor Look At Component Face Aim Append Sequence", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|Actor|Rotate")
+    static UTweenRotator* BP_AppendTweenRotateActorLookAtComponent(UTweenContainer* TweenContainer,
+                                                                   AActor* TweenTarget,
+                                                                   USceneComponent* Destination,
+                                                                   FName SocketName                = NAME_None,
+                                                                   FVector Offset                  = FVector::ZeroVector,
+                                                                   float Duration                  = 1.0f,
+                                                                   ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                   ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                   bool DeleteTweenOnHit           = false,
+                                                                   bool DeleteTweenOnOverlap       = false,
+                                                                   int32 NumLoops                  = 1,
+                                                                   ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                                                   float Delay                     = 0.0f,
+                                                                   float TimeScale                 = 1.0f,
+                                                                   bool TweenWhileGameIsPaused     = false,
+                                                                   int32 SequenceIndex             = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that rotates a SceneComponent from its current orientation (at the start of the Tween) until it faces a SceneComponent.
+      * The direction of the destination is computed again at each update, so the SceneComponent keeps facing it even while either of them moves.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The SceneComponent to rotate.
+      * @param Destination The SceneComponent to look at (to look at an Actor, pass its root component).
+      * @param SocketName (optional) The socket of the destination to look at.
+      * @param Offset Offset from the destination (or its socket), in its own space.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param RotationMode	The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Rotate Scene Component Look At Component", KeyWords="Tween Rotate Scene Component Look At Component Face Aim Append Sequence", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|SceneComponent|Rotate")
+    static UTweenRotator* BP_AppendTweenRotateSceneComponentLookAtComponent(UTweenContainer* TweenContainer,
+                                                                            USceneComponent* TweenTarget,
+                                                                            USceneComponent* Destination,
+                                                                            FName SocketName                = NAME_None,
+                                                                            FVector Offset                  = FVector::ZeroVector,
+                                                                            float Duration                  = 1.0f,
+                                                                            ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                            ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                            bool DeleteTweenOnHit           = false,
+                                                                            bool DeleteTweenOnOverlap       = false,
+                                                                            int32 NumLoops                  = 1,
+                                                                            ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                                                            float Delay                     = 0.0f,
+                                                                            float TimeScale                 = 1.0f,
+                                                                            bool TweenWhileGameIsPaused     = false,
+                                                                            int32 SequenceIndex             = -1);
 
     /*
      **************************************************************************
@@ -504,6 +823,146 @@ public:
                                                              bool TweenWhileGameIsPaused = false,
                                                              int32 SequenceIndex         = -1);
 
+    /**
+      * Joins to the TweenContainer a Tween that rotates an instance of an InstancedStaticMeshComponent from its current orientation (at the start of the Tween) to the given rotation.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to rotate.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode	The rotation mode to use.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Rotate Instance To", KeyWords="Tween Rotate Instance To Instanced Static Mesh Join Parallel", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Rotate")
+    static UTweenRotator* BP_JoinTweenRotateInstanceTo(UTweenContainer* TweenContainer,
+                                                       UInstancedStaticMeshComponent* TweenTarget,
+                                                       int32 InstanceIndex,
+                                                       FRotator To,
+                                                       float Duration                  = 1.0f,
+                                                       ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                       ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                       ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                       float Delay                     = 0.0f,
+                                                       float TimeScale                 = 1.0f,
+                                                       bool TweenWhileGameIsPaused     = false,
+                                                       int32 SequenceIndex             = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that rotates an instance of an InstancedStaticMeshComponent by the given offset with respect to its current orientation (at the start of the Tween).
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to rotate.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param LocalSpace Whether to rotate around the instance's own local axes, not the component's
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Rotate Instance By", KeyWords="Tween Rotate Instance By Instanced Static Mesh Join Parallel", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Rotate")
+    static UTweenRotator* BP_JoinTweenRotateInstanceBy(UTweenContainer* TweenContainer,
+                                                       UInstancedStaticMeshComponent* TweenTarget,
+                                                       int32 InstanceIndex,
+                                                       FRotator By,
+                                                       float Duration              = 1.0f,
+                                                       ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                       bool LocalSpace             = false,
+                                                       float Delay                 = 0.0f,
+                                                       float TimeScale             = 1.0f,
+                                                       bool TweenWhileGameIsPaused = false,
+                                                       int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that rotates an Actor from its current orientation (at the start of the Tween) until it faces a SceneComponent.
+      * The direction of the destination is computed again at each update, so the Actor keeps facing it even while either of them moves.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The Actor to rotate.
+      * @param Destination The SceneComponent to look at (to look at an Actor, pass its root component).
+      * @param SocketName (optional) The socket of the destination to look at.
+      * @param Offset Offset from the destination (or its socket), in its own space.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param RotationMode	The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Rotate Actor Look At Component", KeyWords="Tween Rotate Actor Look At Component Face Aim Join Parallel", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|Actor|Rotate")
+    static UTweenRotator* BP_JoinTweenRotateActorLookAtComponent(UTweenContainer* TweenContainer,
+                                                                 AActor* TweenTarget,
+                                                                 USceneComponent* Destination,
+                                                                 FName SocketName                = NAME_None,
+                                                                 FVector Offset                  = FVector::ZeroVector,
+                                                                 float Duration                  = 1.0f,
+                                                                 ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                 ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                 bool DeleteTweenOnHit           = false,
+                                                                 bool DeleteTweenOnOverlap       = false,
+                                                                 float Delay                     = 0.0f,
+                                                                 float TimeScale                 = 1.0f,
+                                                                 bool TweenWhileGameIsPaused     = false,
+                                                                 int32 SequenceIndex             = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that rotates a SceneComponent from its current orientation (at the start of the Tween) until it faces a SceneComponent.
+      * The direction of the destination is computed again at each update, so the SceneComponent keeps facing it even while either of them moves.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The SceneComponent to rotate.
+      * @param Destination The SceneComponent to look at (to look at an Actor, pass its root component).
+      * @param SocketName (optional) The socket of the destination to look at.
+      * @param Offset Offset from the destination (or its socket), in its own space.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param RotationMode	The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Rotate Scene Component Look At Component", KeyWords="Tween Rotate Scene Component Look At Component Face Aim Join Parallel", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|SceneComponent|Rotate")
+    static UTweenRotator* BP_JoinTweenRotateSceneComponentLookAtComponent(UTweenContainer* TweenContainer,
+                                                                          USceneComponent* TweenTarget,
+                                                                          USceneComponent* Destination,
+                                                                          FName SocketName                = NAME_None,
+                                                                          FVector Offset                  = FVector::ZeroVector,
+                                                                          float Duration                  = 1.0f,
+                                                                          ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                          ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                          bool DeleteTweenOnHit           = false,
+                                                                          bool DeleteTweenOnOverlap       = false,
+                                                                          float Delay                     = 0.0f,
+                                                                          float TimeScale                 = 1.0f,
+                                                                          bool TweenWhileGameIsPaused     = false,
+                                                                          int32 SequenceIndex             = -1);
+
 private:
 
     /*
@@ -0,0 +1,326 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TweenManagerComponent.h"
+#include "Utils/TweenEnums.h"
+
+#include "TweenTransformStandardFactory.generated.h"
+
+class UTweenManagerComponent;
+class UTweenContainer;
+class UTweenTransform;
+
+/**
+ * @brief The UTweenTransformStandardFactory class handles the creation of all Transform related Tweens, i.e. all tweens that
+ *        move, rotate and scale their target together, driven by a single clock and a single easing.
+ *
+ *        The methods here are "standard", meaning that if the user wishes to use one of the tween callbacks (OnTweenStart,
+ *        OnTweenUpdate, OnTweenEnd) he has to manually bind the delegates.
+ */
+UCLASS()
+class TWEENMAKER_API UTweenTransformStandardFactory : public UObject
+{
+    GENERATED_BODY()
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    UTweenTransformStandardFactory(const FObjectInitializer& ObjectInitializer);
+
+    /*
+     **************************************************************************
+     * "Create" methods
+     **************************************************************************
+     */
+
+    /**
+      * Creates a Tween that moves, rotates and scales an Actor from its current transform (at the start of the Tween) to the given one.
+      * Location, rotation and scale share the same easing and are applied together, with a single transform update.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Actor to transform.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param To The ending transform.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Actor Transform To", KeyWords="Tween Transform Actor To Move Rotate Scale Create", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|Actor|Transform")
+    static void BP_CreateTweenActorTransformTo(UTweenManagerComponent* TweenManager,
+                                               AActor* TweenTarget,
+                                               UTweenContainer*& TweenContainer,
+                                               UTweenTransform*& Tween,
+                                               FTransform To,
+                                               float Duration                  = 1.0f,
+                                               ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                               ETweenSpace TweenSpace          = ETweenSpace::World,
+                                               ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                               bool DeleteTweenOnHit           = false,
+                                               bool DeleteTweenOnOverlap       = false,
+                                               int32 NumLoops                  = 1,
+                                               ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                               float Delay                     = 0.0f,
+                                               float TimeScale                 = 1.0f,
+                                               bool TweenWhileGameIsPaused     = false,
+                                               int32 SequenceIndex             = -1);
+
+    /**
+      * Creates a Tween that moves, rotates and scales a SceneComponent from its current transform (at the start of the Tween) to the given one.
+      * Location, rotation and scale share the same easing and are applied together, with a single transform update.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The SceneComponent to transform.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param To The ending transform.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Scene Component Transform To", KeyWords="Tween Transform Scene Component To Move Rotate Scale Create", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|SceneComponent|Transform")
+    static void BP_CreateTweenSceneComponentTransformTo(UTweenManagerComponent* TweenManager,
+                                                        USceneComponent* TweenTarget,
+                                                        UTweenContainer*& TweenContainer,
+                                                        UTweenTransform*& Tween,
+                                                        FTransform To,
+                                                        float Duration                  = 1.0f,
+                                                        ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                        ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                        ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                        bool DeleteTweenOnHit           = false,
+                                                        bool DeleteTweenOnOverlap       = false,
+                                                        int32 NumLoops                  = 1,
+                                                        ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                                        float Delay                     = 0.0f,
+                                                        float TimeScale                 = 1.0f,
+                                                        bool TweenWhileGameIsPaused     = false,
+                                                        int32 SequenceIndex             = -1);
+
+    /*
+     **************************************************************************
+     * "Append" methods
+     **************************************************************************
+     */
+
+    /**
+      * Appends to the TweenContainer a Tween that moves, rotates and scales an Actor from its current transform (at the start of the Tween) to the given one.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The Actor to transform.
+      * @param To The ending transform.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Actor Transform To", KeyWords="Tween Transform Actor To Move Rotate Scale Append Sequence", AdvancedDisplay=5, HidePin=SequenceIndex), Category = "Tween|StandardTween|Actor|Transform")
+    static UTweenTransform* BP_AppendTweenActorTransformTo(UTweenContainer* TweenContainer,
+                                                           AActor* TweenTarget,
+                                                           FTransform To,
+                                                           float Duration                  = 1.0f,
+                                                           ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                           ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                           ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                           bool DeleteTweenOnHit           = false,
+                                                           bool DeleteTweenOnOverlap       = false,
+                                                           int32 NumLoops                  = 1,
+                                                           ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                                           float Delay                     = 0.0f,
+                                                           float TimeScale                 = 1.0f,
+                                                           bool TweenWhileGameIsPaused     = false,
+                                                           int32 SequenceIndex             = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that moves, rotates and scales a SceneComponent from its current transform (at the start of the Tween) to the given one.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The SceneComponent to transform.
+      * @param To The ending transform.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Scene Component Transform To", KeyWords="Tween Transform Scene Component To Move Rotate Scale Append Sequence", AdvancedDisplay=5, HidePin=SequenceIndex), Category = "Tween|StandardTween|SceneComponent|Transform")
+    static UTweenTransform* BP_AppendTweenSceneComponentTransformTo(UTweenContainer* TweenContainer,
+                                                                    USceneComponent* TweenTarget,
+                                                                    FTransform To,
+                                                                    float Duration                  = 1.0f,
+                                                                    ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                    ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                                    ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                    bool DeleteTweenOnHit           = false,
+                                                                    bool DeleteTweenOnOverlap       = false,
+                                                                    int32 NumLoops                  = 1,
+                                                                    ETweenLoopType LoopType         = ETweenLoopType::Yoyo,
+                                                                    float Delay                     = 0.0f,
+                                                                    float TimeScale                 = 1.0f,
+                                                                    bool TweenWhileGameIsPaused     = false,
+                                                                    int32 SequenceIndex             = -1);
+
+    /*
+     **************************************************************************
+     * "Join" methods
+     **************************************************************************
+     */
+
+    /**
+      * Joins to the TweenContainer a Tween that moves, rotates and scales an Actor from its current transform (at the start of the Tween) to the given one.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The Actor to transform.
+      * @param To The ending transform.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Actor Transform To", KeyWords="Tween Transform Actor To Move Rotate Scale Join Parallel", AdvancedDisplay=5, HidePin=SequenceIndex), Category = "Tween|StandardTween|Actor|Transform")
+    static UTweenTransform* BP_JoinTweenActorTransformTo(UTweenContainer* TweenContainer,
+                                                         AActor* TweenTarget,
+                                                         FTransform To,
+                                                         float Duration                  = 1.0f,
+                                                         ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                         ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                         ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                         bool DeleteTweenOnHit           = false,
+                                                         bool DeleteTweenOnOverlap       = false,
+                                                         float Delay                     = 0.0f,
+                                                         float TimeScale                 = 1.0f,
+                                                         bool TweenWhileGameIsPaused     = false,
+                                                         int32 SequenceIndex             = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that moves, rotates and scales a SceneComponent from its current transform (at the start of the Tween) to the given one.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The SceneComponent to transform.
+      * @param To The ending transform.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param RotationMode The rotation mode to use.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Scene Component Transform To", KeyWords="Tween Transform Scene Component To Move Rotate Scale Join Parallel", AdvancedDisplay=5, HidePin=SequenceIndex), Category = "Tween|StandardTween|SceneComponent|Transform")
+    static UTweenTransform* BP_JoinTweenSceneComponentTransformTo(UTweenContainer* TweenContainer,
+                                                                  USceneComponent* TweenTarget,
+                                                                  FTransform To,
+                                                                  float Duration                  = 1.0f,
+                                                                  ETweenEaseType EaseType         = ETweenEaseType::Linear,
+                                                                  ETweenSpace TweenSpace          = ETweenSpace::World,
+                                                                  ETweenRotationMode RotationMode = ETweenRotationMode::ShortestPath,
+                                                                  bool DeleteTweenOnHit           = false,
+                                                                  bool DeleteTweenOnOverlap       = false,
+                                                                  float Delay                     = 0.0f,
+                                                                  float TimeScale                 = 1.0f,
+                                                                  bool TweenWhileGameIsPaused     = false,
+                                                                  int32 SequenceIndex             = -1);
+
+private:
+
+    /*
+     **************************************************************************
+     * Helper methods that create the actual Tweens
+     **************************************************************************
+     */
+
+    static UTweenTransform* CreateAppendTweenTransform(UTweenContainer* pTweenContainer,
+                                                       ETweenTransformType pTweenType,
+                                                       UObject* pTarget,
+                                                       ETweenTargetType pTargetType,
+                                                       const FTransform& pTo,
+                                                       float pDuration,
+                                                       ETweenEaseType pEaseType,
+                                                       ETweenSpace pTweenSpace,
+                                                       ETweenRotationMode pRotationMode,
+                                                       bool pDeleteTweenOnHit,
+                                                       bool pDeleteTweenOnOverlap,
+                                                       int32 pNumLoops,
+                                                       ETweenLoopType pLoopType,
+                                                       float pDelay,
+                                                       float pTimeScale,
+                                                       bool pTweenWhileGameIsPaused,
+                                                       int32 pSequenceIndex);
+
+    static UTweenTransform* CreateJoinTweenTransform(UTweenContainer* pTweenContainer,
+                                                     ETweenTransformType pTweenType,
+                                                     UObject* pTarget,
+                                                     ETweenTargetType pTargetType,
+                                                     const FTransform& pTo,
+                                                     float pDuration,
+                                                     ETweenEaseType pEaseType,
+                                                     ETweenSpace pTweenSpace,
+                                                     ETweenRotationMode pRotationMode,
+                                                     bool pDeleteTweenOnHit,
+                                                     bool pDeleteTweenOnOverlap,
+                                                     float pDelay,
+                                                     float pTimeScale,
+                                                     bool pTweenWhileGameIsPaused,
+                                                     int32 pSequenceIndex);
+};
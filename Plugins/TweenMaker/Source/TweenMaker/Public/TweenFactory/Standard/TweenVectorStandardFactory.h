@@ -13,6 +13,7 @@ class ATweenManagerActor;
 class UTweenManagerComponent;
 class UTweenContainer;
 class UBaseTween;
+class UInstancedStaticMeshComponent;
 
 
 /**
@@ -382,6 +383,322 @@ public:
                                            bool TweenWhileGameIsPaused = false,
                                            int32 SequenceIndex         = -1);
 
+    /**
+      * Creates a Tween that moves an instance of an InstancedStaticMeshComponent from its current location (at the start of the Tween) to the given location.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to move.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Move Instance To", KeyWords="Tween Move Instance To Instanced Static Mesh Create", AdvancedDisplay=8, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Move")
+    static void BP_CreateTweenMoveInstanceTo(UTweenManagerComponent* TweenManager,
+                                             UInstancedStaticMeshComponent* TweenTarget,
+                                             int32 InstanceIndex,
+                                             UTweenContainer*& TweenContainer,
+                                             UTweenVector*& Tween,
+                                             FVector To,
+                                             float Duration              = 1.0f,
+                                             ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                             ETweenSpace TweenSpace      = ETweenSpace::World,
+                                             int32 NumLoops              = 1,
+                                             ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                             float Delay                 = 0.0f,
+                                             float TimeScale             = 1.0f,
+                                             bool TweenWhileGameIsPaused = false,
+                                             int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that moves an instance of an InstancedStaticMeshComponent by the given offset with respect to its current location (at the start of the Tween).
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to move.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Move Instance By", KeyWords="Tween Move Instance By Instanced Static Mesh Create", AdvancedDisplay=8, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Move")
+    static void BP_CreateTweenMoveInstanceBy(UTweenManagerComponent* TweenManager,
+                                             UInstancedStaticMeshComponent* TweenTarget,
+                                             int32 InstanceIndex,
+                                             UTweenContainer*& TweenContainer,
+                                             UTweenVector*& Tween,
+                                             FVector By,
+                                             float Duration              = 1.0f,
+                                             ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                             int32 NumLoops              = 1,
+                                             ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                             float Delay                 = 0.0f,
+                                             float TimeScale             = 1.0f,
+                                             bool TweenWhileGameIsPaused = false,
+                                             int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that scales an instance of an InstancedStaticMeshComponent from its current scale (at the start of the Tween) to the given size.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to scale.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Scale Instance To", KeyWords="Tween Scale Instance To Instanced Static Mesh Create", AdvancedDisplay=8, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Scale")
+    static void BP_CreateTweenScaleInstanceTo(UTweenManagerComponent* TweenManager,
+                                              UInstancedStaticMeshComponent* TweenTarget,
+                                              int32 InstanceIndex,
+                                              UTweenContainer*& TweenContainer,
+                                              UTweenVector*& Tween,
+                                              FVector To,
+                                              float Duration              = 1.0f,
+                                              ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                              ETweenSpace TweenSpace      = ETweenSpace::World,
+                                              int32 NumLoops              = 1,
+                                              ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                              float Delay                 = 0.0f,
+                                              float TimeScale             = 1.0f,
+                                              bool TweenWhileGameIsPaused = false,
+                                              int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that scales an instance of an InstancedStaticMeshComponent by the given offset with respect to its current size (at the start of the Tween).
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to scale.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Scale Instance By", KeyWords="Tween Scale Instance By Instanced Static Mesh Create", AdvancedDisplay=8, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Scale")
+    static void BP_CreateTweenScaleInstanceBy(UTweenManagerComponent* TweenManager,
+                                              UInstancedStaticMeshComponent* TweenTarget,
+                                              int32 InstanceIndex,
+                                              UTweenContainer*& TweenContainer,
+                                              UTweenVector*& Tween,
+                                              FVector By,
+                                              float Duration              = 1.0f,
+                                              ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                              int32 NumLoops              = 1,
+                                              ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                              float Delay                 = 0.0f,
+                                              float TimeScale             = 1.0f,
+                                              bool TweenWhileGameIsPaused = false,
+                                              int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that moves an Actor from its current location (at the start of the Tween) to the given location along a quadratic or cubic Bezier curve.
+      * No SplineComponent is needed: the curve is evaluated directly from its control points.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Actor to move.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param To The ending value.
+      * @param ControlPoints The control points of the curve: one for a quadratic curve, two for a cubic one.
+      * @param UseConstantSpeed If true the curve is traveled at constant speed, using a small arc length table built at the start of the Tween.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative'). The control points are expressed in the same space.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Move Actor Along Bezier", KeyWords="Tween Move Actor Along Bezier Curve Create", AdvancedDisplay=9, HidePin=SequenceIndex), Category = "Tween|StandardTween|Actor|Move")
+    static void BP_CreateTweenMoveActorAlongBezier(UTweenManagerComponent* TweenManager,
+                                                   AActor* TweenTarget,
+                                                   UTweenContainer*& TweenContainer,
+                                                   UTweenVector*& Tween,
+                                                   FVector To,
+                                                   const TArray<FVector>& ControlPoints,
+                                                   bool UseConstantSpeed       = true,
+                                                   float Duration              = 1.0f,
+                                                   ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                   ETweenSpace TweenSpace      = ETweenSpace::World,
+                                                   bool DeleteTweenOnHit       = false,
+                                                   bool DeleteTweenOnOverlap   = false,
+                                                   int32 NumLoops              = 1,
+                                                   ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                   float Delay                 = 0.0f,
+                                                   float TimeScale             = 1.0f,
+                                                   bool TweenWhileGameIsPaused = false,
+                                                   int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that moves a SceneComponent from its current location (at the start of the Tween) to the given location along a quadratic or cubic Bezier curve.
+      * No SplineComponent is needed: the curve is evaluated directly from its control points.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The SceneComponent to move.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param To The ending value.
+      * @param ControlPoints The control points of the curve: one for a quadratic curve, two for a cubic one.
+      * @param UseConstantSpeed If true the curve is traveled at constant speed, using a small arc length table built at the start of the Tween.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative'). The control points are expressed in the same space.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Move Scene Component Along Bezier", KeyWords="Tween Move Scene Component Along Bezier Curve Create", AdvancedDisplay=9, HidePin=SequenceIndex), Category = "Tween|StandardTween|SceneComponent|Move")
+    static void BP_CreateTweenMoveSceneComponentAlongBezier(UTweenManagerComponent* TweenManager,
+                                                            USceneComponent* TweenTarget,
+                                                            UTweenContainer*& TweenContainer,
+                                                            UTweenVector*& Tween,
+                                                            FVector To,
+                                                            const TArray<FVector>& ControlPoints,
+                                                            bool UseConstantSpeed       = true,
+                                                            float Duration              = 1.0f,
+                                                            ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                            ETweenSpace TweenSpace      = ETweenSpace::World,
+                                                            bool DeleteTweenOnHit       = false,
+                                                            bool DeleteTweenOnOverlap   = false,
+                                                            int32 NumLoops              = 1,
+                                                            ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                            float Delay                 = 0.0f,
+                                                            float TimeScale             = 1.0f,
+                                                            bool TweenWhileGameIsPaused = false,
+                                                            int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that moves an Actor from its current location (at the start of the Tween) to a SceneComponent, e.g. to make a pickup fly to the player.
+      * The location of the destination is read again at each update, so the Tween reaches it even while it moves.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The Actor to move.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param Destination The SceneComponent to move to (to follow an Actor, pass its root component).
+      * @param SocketName (optional) The socket of the destination to move to.
+      * @param Offset Offset from the destination (or its socket), in its own space.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Move Actor To Component", KeyWords="Tween Move Actor To Component Follow Create", AdvancedDisplay=9, HidePin=SequenceIndex), Category = "Tween|StandardTween|Actor|Move")
+    static void BP_CreateTweenMoveActorToComponent(UTweenManagerComponent* TweenManager,
+                                                   AActor* TweenTarget,
+                                                   UTweenContainer*& TweenContainer,
+                                                   UTweenVector*& Tween,
+                                                   USceneComponent* Destination,
+                                                   FName SocketName            = NAME_None,
+                                                   FVector Offset              = FVector::ZeroVector,
+                                                   float Duration              = 1.0f,
+                                                   ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                   bool DeleteTweenOnHit       = false,
+                                                   bool DeleteTweenOnOverlap   = false,
+                                                   int32 NumLoops              = 1,
+                                                   ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                   float Delay                 = 0.0f,
+                                                   float TimeScale             = 1.0f,
+                                                   bool TweenWhileGameIsPaused = false,
+                                                   int32 SequenceIndex         = -1);
+
+    /**
+      * Creates a Tween that moves a SceneComponent from its current location (at the start of the Tween) to a SceneComponent, e.g. to make a pickup fly to the player.
+      * The location of the destination is read again at each update, so the Tween reaches it even while it moves.
+      * With this function a new TweenContainer will be created, which will hold any other Tween appended/joined to this one.
+      *
+      * @param TweenManager (optional) The TweenManager that will handle the Tween. If none is passed, the global TweenManagerActor will be used if present.
+      * @param TweenTarget The SceneComponent to move.
+      * @param TweenContainer The TweenContainer that owns the Tween.
+      * @param Tween The created Tween.
+      * @param Destination The SceneComponent to move to (to follow an Actor, pass its root component).
+      * @param SocketName (optional) The socket of the destination to move to.
+      * @param Offset Offset from the destination (or its socket), in its own space.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Create Tween Move Scene Component To Component", KeyWords="Tween Move Scene Component To Component Follow Create", AdvancedDisplay=9, HidePin=SequenceIndex), Category = "Tween|StandardTween|SceneComponent|Move")
+    static void BP_CreateTweenMoveSceneComponentToComponent(UTweenManagerComponent* TweenManager,
+                                                            USceneComponent* TweenTarget,
+                                                            UTweenContainer*& TweenContainer,
+                                                            UTweenVector*& Tween,
+                                                            USceneComponent* Destination,
+                                                            FName SocketName            = NAME_None,
+                                                            FVector Offset              = FVector::ZeroVector,
+                                                            float Duration              = 1.0f,
+                                                            ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                            bool DeleteTweenOnHit       = false,
+                                                            bool DeleteTweenOnOverlap   = false,
+                                                            int32 NumLoops              = 1,
+                                                            ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                            float Delay                 = 0.0f,
+                                                            float TimeScale             = 1.0f,
+                                                            bool TweenWhileGameIsPaused = false,
+                                                            int32 SequenceIndex         = -1);
+
     /*
      **************************************************************************
      * "Append" methods
@@ -710,6 +1027,306 @@ public:
                                                     bool TweenWhileGameIsPaused = false,
                                                     int32 SequenceIndex         = -1);
 
+    /**
+      * Appends to the TweenContainer a Tween that moves an instance of an InstancedStaticMeshComponent from its current location (at the start of the Tween) to the given location.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to move.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Move Instance To", KeyWords="Tween Move Instance To Instanced Static Mesh Append Sequence", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Move")
+    static UTweenVector* BP_AppendTweenMoveInstanceTo(UTweenContainer* TweenContainer,
+                                                      UInstancedStaticMeshComponent* TweenTarget,
+                                                      int32 InstanceIndex,
+                                                      FVector To,
+                                                      float Duration              = 1.0f,
+                                                      ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                      ETweenSpace TweenSpace      = ETweenSpace::World,
+                                                      int32 NumLoops              = 1,
+                                                      ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                      float Delay                 = 0.0f,
+                                                      float TimeScale             = 1.0f,
+                                                      bool TweenWhileGameIsPaused = false,
+                                                      int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that moves an instance of an InstancedStaticMeshComponent by the given offset with respect to its current location (at the start of the Tween).
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to move.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Move Instance By", KeyWords="Tween Move Instance By Instanced Static Mesh Append Sequence", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Move")
+    static UTweenVector* BP_AppendTweenMoveInstanceBy(UTweenContainer* TweenContainer,
+                                                      UInstancedStaticMeshComponent* TweenTarget,
+                                                      int32 InstanceIndex,
+                                                      FVector By,
+                                                      float Duration              = 1.0f,
+                                                      ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                      int32 NumLoops              = 1,
+                                                      ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                      float Delay                 = 0.0f,
+                                                      float TimeScale             = 1.0f,
+                                                      bool TweenWhileGameIsPaused = false,
+                                                      int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that scales an instance of an InstancedStaticMeshComponent from its current scale (at the start of the Tween) to the given size.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to scale.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Scale Instance To", KeyWords="Tween Scale Instance To Instanced Static Mesh Append Sequence", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Scale")
+    static UTweenVector* BP_AppendTweenScaleInstanceTo(UTweenContainer* TweenContainer,
+                                                       UInstancedStaticMeshComponent* TweenTarget,
+                                                       int32 InstanceIndex,
+                                                       FVector To,
+                                                       float Duration              = 1.0f,
+                                                       ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                       ETweenSpace TweenSpace      = ETweenSpace::World,
+                                                       int32 NumLoops              = 1,
+                                                       ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                       float Delay                 = 0.0f,
+                                                       float TimeScale             = 1.0f,
+                                                       bool TweenWhileGameIsPaused = false,
+                                                       int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that scales an instance of an InstancedStaticMeshComponent by the given offset with respect to its current size (at the start of the Tween).
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to scale.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Scale Instance By", KeyWords="Tween Scale Instance By Instanced Static Mesh Append Sequence", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Scale")
+    static UTweenVector* BP_AppendTweenScaleInstanceBy(UTweenContainer* TweenContainer,
+                                                       UInstancedStaticMeshComponent* TweenTarget,
+                                                       int32 InstanceIndex,
+                                                       FVector By,
+                                                       float Duration              = 1.0f,
+                                                       ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                       int32 NumLoops              = 1,
+                                                       ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                       float Delay                 = 0.0f,
+                                                       float TimeScale             = 1.0f,
+                                                       bool TweenWhileGameIsPaused = false,
+                                                       int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that moves an Actor from its current location (at the start of the Tween) to the given location along a quadratic or cubic Bezier curve.
+      * No SplineComponent is needed: the curve is evaluated directly from its control points.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The Actor to move.
+      * @param To The ending value.
+      * @param ControlPoints The control points of the curve: one for a quadratic curve, two for a cubic one.
+      * @param UseConstantSpeed If true the curve is traveled at constant speed, using a small arc length table built at the start of the Tween.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative'). The control points are expressed in the same space.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Move Actor Along Bezier", KeyWords="Tween Move Actor Along Bezier Curve Append Sequence", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|Actor|Move")
+    static UTweenVector* BP_AppendTweenMoveActorAlongBezier(UTweenContainer* TweenContainer,
+                                                            AActor* TweenTarget,
+                                                            FVector To,
+                                                            const TArray<FVector>& ControlPoints,
+                                                            bool UseConstantSpeed       = true,
+                                                            float Duration              = 1.0f,
+                                                            ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                            ETweenSpace TweenSpace      = ETweenSpace::World,
+                                                            bool DeleteTweenOnHit       = false,
+                                                            bool DeleteTweenOnOverlap   = false,
+                                                            int32 NumLoops              = 1,
+                                                            ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                            float Delay                 = 0.0f,
+                                                            float TimeScale             = 1.0f,
+                                                            bool TweenWhileGameIsPaused = false,
+                                                            int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that moves a SceneComponent from its current location (at the start of the Tween) to the given location along a quadratic or cubic Bezier curve.
+      * No SplineComponent is needed: the curve is evaluated directly from its control points.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The SceneComponent to move.
+      * @param To The ending value.
+      * @param ControlPoints The control points of the curve: one for a quadratic curve, two for a cubic one.
+      * @param UseConstantSpeed If true the curve is traveled at constant speed, using a small arc length table built at the start of the Tween.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative'). The control points are expressed in the same space.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Move Scene Component Along Bezier", KeyWords="Tween Move Scene Component Along Bezier Curve Append Sequence", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|SceneComponent|Move")
+    static UTweenVector* BP_AppendTweenMoveSceneComponentAlongBezier(UTweenContainer* TweenContainer,
+                                                                     USceneComponent* TweenTarget,
+                                                                     FVector To,
+                                                                     const TArray<FVector>& ControlPoints,
+                                                                     bool UseConstantSpeed       = true,
+                                                                     float Duration              = 1.0f,
+                                                                     ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                     ETweenSpace TweenSpace      = ETweenSpace::World,
+                                                                     bool DeleteTweenOnHit       = false,
+                                                                     bool DeleteTweenOnOverlap   = false,
+                                                                     int32 NumLoops              = 1,
+                                                                     ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                                     float Delay                 = 0.0f,
+                                                                     float TimeScale             = 1.0f,
+                                                                     bool TweenWhileGameIsPaused = false,
+                                                                     int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that moves an Actor from its current location (at the start of the Tween) to a SceneComponent.
+      * The location of the destination is read again at each update, so the Tween reaches it even while it moves.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The Actor to move.
+      * @param Destination The SceneComponent to move to (to follow an Actor, pass its root component).
+      * @param SocketName (optional) The socket of the destination to move to.
+      * @param Offset Offset from the destination (or its socket), in its own space.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Move Actor To Component", KeyWords="Tween Move Actor To Component Follow Append Sequence", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|Actor|Move")
+    static UTweenVector* BP_AppendTweenMoveActorToComponent(UTweenContainer* TweenContainer,
+                                                            AActor* TweenTarget,
+                                                            USceneComponent* Destination,
+                                                            FName SocketName            = NAME_None,
+                                                            FVector Offset              = FVector::ZeroVector,
+                                                            float Duration              = 1.0f,
+                                                            ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                            bool DeleteTweenOnHit       = false,
+                                                            bool DeleteTweenOnOverlap   = false,
+                                                            int32 NumLoops              = 1,
+                                                            ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                            float Delay                 = 0.0f,
+                                                            float TimeScale             = 1.0f,
+                                                            bool TweenWhileGameIsPaused = false,
+                                                            int32 SequenceIndex         = -1);
+
+    /**
+      * Appends to the TweenContainer a Tween that moves a SceneComponent from its current location (at the start of the Tween) to a SceneComponent.
+      * The location of the destination is read again at each update, so the Tween reaches it even while it moves.
+      * It will be executed when all previous Tweens in the TweenContainer are completed.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The SceneComponent to move.
+      * @param Destination The SceneComponent to move to (to follow an Actor, pass its root component).
+      * @param SocketName (optional) The socket of the destination to move to.
+      * @param Offset Offset from the destination (or its socket), in its own space.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param NumLoops	The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+      * @param LoopType	The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Append Tween Move Scene Component To Component", KeyWords="Tween Move Scene Component To Component Follow Append Sequence", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|SceneComponent|Move")
+    static UTweenVector* BP_AppendTweenMoveSceneComponentToComponent(UTweenContainer* TweenContainer,
+                                                                     USceneComponent* TweenTarget,
+                                                                     USceneComponent* Destination,
+                                                                     FName SocketName            = NAME_None,
+                                                                     FVector Offset              = FVector::ZeroVector,
+                                                                     float Duration              = 1.0f,
+                                                                     ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                     bool DeleteTweenOnHit       = false,
+                                                                     bool DeleteTweenOnOverlap   = false,
+                                                                     int32 NumLoops              = 1,
+                                                                     ETweenLoopType LoopType     = ETweenLoopType::Yoyo,
+                                                                     float Delay                 = 0.0f,
+                                                                     float TimeScale             = 1.0f,
+                                                                     bool TweenWhileGameIsPaused = false,
+                                                                     int32 SequenceIndex         = -1);
+
     /*
      **************************************************************************
      * "Join" methods
@@ -1001,6 +1618,274 @@ public:
                                                   bool TweenWhileGameIsPaused = false,
                                                   int32 SequenceIndex         = -1);
 
+    /**
+      * Joins to the TweenContainer a Tween that moves an instance of an InstancedStaticMeshComponent from its current location (at the start of the Tween) to the given location.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to move.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Move Instance To", KeyWords="Tween Move Instance To Instanced Static Mesh Join Parallel", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Move")
+    static UTweenVector* BP_JoinTweenMoveInstanceTo(UTweenContainer* TweenContainer,
+                                                    UInstancedStaticMeshComponent* TweenTarget,
+                                                    int32 InstanceIndex,
+                                                    FVector To,
+                                                    float Duration              = 1.0f,
+                                                    ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                    ETweenSpace TweenSpace      = ETweenSpace::World,
+                                                    float Delay                 = 0.0f,
+                                                    float TimeScale             = 1.0f,
+                                                    bool TweenWhileGameIsPaused = false,
+                                                    int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that moves an instance of an InstancedStaticMeshComponent by the given offset with respect to its current location (at the start of the Tween).
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to move.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Move Instance By", KeyWords="Tween Move Instance By Instanced Static Mesh Join Parallel", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Move")
+    static UTweenVector* BP_JoinTweenMoveInstanceBy(UTweenContainer* TweenContainer,
+                                                    UInstancedStaticMeshComponent* TweenTarget,
+                                                    int32 InstanceIndex,
+                                                    FVector By,
+                                                    float Duration              = 1.0f,
+                                                    ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                    float Delay                 = 0.0f,
+                                                    float TimeScale             = 1.0f,
+                                                    bool TweenWhileGameIsPaused = false,
+                                                    int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that scales an instance of an InstancedStaticMeshComponent from its current scale (at the start of the Tween) to the given size.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to scale.
+      * @param To The ending value.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative').
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Scale Instance To", KeyWords="Tween Scale Instance To Instanced Static Mesh Join Parallel", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Scale")
+    static UTweenVector* BP_JoinTweenScaleInstanceTo(UTweenContainer* TweenContainer,
+                                                     UInstancedStaticMeshComponent* TweenTarget,
+                                                     int32 InstanceIndex,
+                                                     FVector To,
+                                                     float Duration              = 1.0f,
+                                                     ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                     ETweenSpace TweenSpace      = ETweenSpace::World,
+                                                     float Delay                 = 0.0f,
+                                                     float TimeScale             = 1.0f,
+                                                     bool TweenWhileGameIsPaused = false,
+                                                     int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that scales an instance of an InstancedStaticMeshComponent by the given offset with respect to its current size (at the start of the Tween).
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The InstancedStaticMeshComponent (or HierarchicalInstancedStaticMeshComponent) that owns the instance.
+      * @param InstanceIndex The index of the instance to scale.
+      * @param By The offset to apply.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Scale Instance By", KeyWords="Tween Scale Instance By Instanced Static Mesh Join Parallel", AdvancedDisplay=6, HidePin=SequenceIndex), Category = "Tween|StandardTween|InstancedStaticMesh|Scale")
+    static UTweenVector* BP_JoinTweenScaleInstanceBy(UTweenContainer* TweenContainer,
+                                                     UInstancedStaticMeshComponent* TweenTarget,
+                                                     int32 InstanceIndex,
+                                                     FVector By,
+                                                     float Duration              = 1.0f,
+                                                     ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                     float Delay                 = 0.0f,
+                                                     float TimeScale             = 1.0f,
+                                                     bool TweenWhileGameIsPaused = false,
+                                                     int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that moves an Actor from its current location (at the start of the Tween) to the given location along a quadratic or cubic Bezier curve.
+      * No SplineComponent is needed: the curve is evaluated directly from its control points.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The Actor to move.
+      * @param To The ending value.
+      * @param ControlPoints The control points of the curve: one for a quadratic curve, two for a cubic one.
+      * @param UseConstantSpeed If true the curve is traveled at constant speed, using a small arc length table built at the start of the Tween.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative'). The control points are expressed in the same space.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Move Actor Along Bezier", KeyWords="Tween Move Actor Along Bezier Curve Join Parallel", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|Actor|Move")
+    static UTweenVector* BP_JoinTweenMoveActorAlongBezier(UTweenContainer* TweenContainer,
+                                                          AActor* TweenTarget,
+                                                          FVector To,
+                                                          const TArray<FVector>& ControlPoints,
+                                                          bool UseConstantSpeed       = true,
+                                                          float Duration              = 1.0f,
+                                                          ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                          ETweenSpace TweenSpace      = ETweenSpace::World,
+                                                          bool DeleteTweenOnHit       = false,
+                                                          bool DeleteTweenOnOverlap   = false,
+                                                          float Delay                 = 0.0f,
+                                                          float TimeScale             = 1.0f,
+                                                          bool TweenWhileGameIsPaused = false,
+                                                          int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that moves a SceneComponent from its current location (at the start of the Tween) to the given location along a quadratic or cubic Bezier curve.
+      * No SplineComponent is needed: the curve is evaluated directly from its control points.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The SceneComponent to move.
+      * @param To The ending value.
+      * @param ControlPoints The control points of the curve: one for a quadratic curve, two for a cubic one.
+      * @param UseConstantSpeed If true the curve is traveled at constant speed, using a small arc length table built at the start of the Tween.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param TweenSpace The space in which the Tween makes its update (i.e. 'world' or 'relative'). The control points are expressed in the same space.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Move Scene Component Along Bezier", KeyWords="Tween Move Scene Component Along Bezier Curve Join Parallel", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|SceneComponent|Move")
+    static UTweenVector* BP_JoinTweenMoveSceneComponentAlongBezier(UTweenContainer* TweenContainer,
+                                                                   USceneComponent* TweenTarget,
+                                                                   FVector To,
+                                                                   const TArray<FVector>& ControlPoints,
+                                                                   bool UseConstantSpeed       = true,
+                                                                   float Duration              = 1.0f,
+                                                                   ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                   ETweenSpace TweenSpace      = ETweenSpace::World,
+                                                                   bool DeleteTweenOnHit       = false,
+                                                                   bool DeleteTweenOnOverlap   = false,
+                                                                   float Delay                 = 0.0f,
+                                                                   float TimeScale             = 1.0f,
+                                                                   bool TweenWhileGameIsPaused = false,
+                                                                   int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that moves an Actor from its current location (at the start of the Tween) to a SceneComponent.
+      * The location of the destination is read again at each update, so the Tween reaches it even while it moves.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The Actor to move.
+      * @param Destination The SceneComponent to move to (to follow an Actor, pass its root component).
+      * @param SocketName (optional) The socket of the destination to move to.
+      * @param Offset Offset from the destination (or its socket), in its own space.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Move Actor To Component", KeyWords="Tween Move Actor To Component Follow Join Parallel", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|Actor|Move")
+    static UTweenVector* BP_JoinTweenMoveActorToComponent(UTweenContainer* TweenContainer,
+                                                          AActor* TweenTarget,
+                                                          USceneComponent* Destination,
+                                                          FName SocketName            = NAME_None,
+                                                          FVector Offset              = FVector::ZeroVector,
+                                                          float Duration              = 1.0f,
+                                                          ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                          bool DeleteTweenOnHit       = false,
+                                                          bool DeleteTweenOnOverlap   = false,
+                                                          float Delay                 = 0.0f,
+                                                          float TimeScale             = 1.0f,
+                                                          bool TweenWhileGameIsPaused = false,
+                                                          int32 SequenceIndex         = -1);
+
+    /**
+      * Joins to the TweenContainer a Tween that moves a SceneComponent from its current location (at the start of the Tween) to a SceneComponent.
+      * The location of the destination is read again at each update, so the Tween reaches it even while it moves.
+      * It will be executed in parallel with the last appended Tween in the TweenContainer.
+      *
+      * @param TweenContainer The TweenContainer that will own the new Tween.
+      * @param TweenTarget The SceneComponent to move.
+      * @param Destination The SceneComponent to move to (to follow an Actor, pass its root component).
+      * @param SocketName (optional) The socket of the destination to move to.
+      * @param Offset Offset from the destination (or its socket), in its own space.
+      * @param Duration The total duration of the Tween (in seconds).
+      * @param EaseType	The easing functions to apply.
+      * @param DeleteTweenOnHit If true the Tween will be deleted when the TweenTarget hits something.
+      * @param DeleteTweenOnOverlap If true the Tween will be deleted when the TweenTarget overlaps something.
+      * @param Delay The initial delay to apply to the Tween (in seconds).
+      * @param TimeScale The scale to apply to the Tween execution. If < 1 the Tween will slow down, if > 1 it will speed up. If < 0 it will make the Tween go backward.
+      * @param TweenWhileGameIsPaused Sets whether the Tween should keep updating while the game is paused. Useful for Tween on UMG widgets that animate menus.
+      * @param SequenceIndex The index of the sequence in which the new Tween should be added (hidden in Blueprint).
+      *
+      * @return The newly created Tween.
+      */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Join Tween Move Scene Component To Component", KeyWords="Tween Move Scene Component To Component Follow Join Parallel", AdvancedDisplay=7, HidePin=SequenceIndex), Category = "Tween|StandardTween|SceneComponent|Move")
+    static UTweenVector* BP_JoinTweenMoveSceneComponentToComponent(UTweenContainer* TweenContainer,
+                                                                   USceneComponent* TweenTarget,
+                                                                   USceneComponent* Destination,
+                                                                   FName SocketName            = NAME_None,
+                                                                   FVector Offset              = FVector::ZeroVector,
+                                                                   float Duration              = 1.0f,
+                                                                   ETweenEaseType EaseType     = ETweenEaseType::Linear,
+                                                                   bool DeleteTweenOnHit       = false,
+                                                                   bool DeleteTweenOnOverlap   = false,
+                                                                   float Delay                 = 0.0f,
+                                                                   float TimeScale             = 1.0f,
+                                                                   bool TweenWhileGameIsPaused = false,
+                                                                   int32 SequenceIndex         = -1);
+
 private:
 
     /*
@@ -1025,7 +1910,9 @@ private:
                                                  float pDelay,
                                                  float pTimeScale,
                                                  bool pTweenWhileGameIsPaused,
-                                                 int32 pSequenceIndex);
+                                                 int32 pSequenceIndex,
+                                                 const TArray<FVector>* pBezierControlPoints = nullptr,
+                                                 bool pBezierConstantSpeed = false);
 
     static UTweenVector* CreateJoinTweenVector(UTweenContainer* pTweenContainer,
                                                ETweenVectorType pTweenType,
@@ -1041,5 +1928,7 @@ private:
                                                float pDelay,
                                                float pTimeScale,
                                                bool pTweenWhileGameIsPaused,
-                                               int32 pSequenceIndex);
+                                               int32 pSequenceIndex,
+                                               const TArray<FVector>* pBezierControlPoints = nullptr,
+                                               bool pBezierConstantSpeed = false);
 };
@@ -4,8 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
 #include "Utils/TweenEnums.h"
 #include "Utils/Utility.h"
+#include "Utils/TweenRecorder.h"
 #include "Engine/HitResult.h"
 #include "TweenManagerComponent.generated.h"
 
@@ -14,26 +16,101 @@ class UTweenVector2DLatentFactory;
 class UTweenRotatorLatentFactory;
 class UTweenLinearColorLatentFactory;
 class UTweenFloatLatentFactory;
+class UTweenTransformLatentFactory;
 class UTweenContainer;
 class UBaseTween;
 class UTweenVector;
 class UTweenVector2D;
 class UTweenRotator;
+class UTweenTransform;
 class UTweenLinearColor;
 class UTweenFloat;
 class USplineComponent;
+class UInstancedStaticMeshComponent;
+class UMaterialInstanceDynamic;
+class UWidget;
 
 
+/*
+ **************************************************************************
+ * Hitch watchdog reports
+ **************************************************************************
+ */
+
+/**
+ * @brief Cost of a TweenContainer that took part in a hitch detected by the TweenManager's watchdog.
+ */
+USTRUCT(BlueprintType)
+struct TWEENMAKER_API FTweenHitchContainerInfo
+{
+    GENERATED_BODY()
+
+    FTweenHitchContainerInfo();
+
+    /// @brief The TweenContainer.
+    UPROPERTY(BlueprintReadOnly, Category = "Tween|Watchdog")
+    UTweenContainer* TweenContainer;
+
+    /// @brief Time spent updating the TweenContainer (in milliseconds).
+    UPROPERTY(BlueprintReadOnly, Category = "Tween|Watchdog")
+    float CostMs;
+
+    /// @brief Number of Tweens in the sequence being updated.
+    UPROPERTY(BlueprintReadOnly, Category = "Tween|Watchdog")
+    int32 NumTweens;
+
+    /// @brief Number of collision sweeps (synchronous or asynchronous) the Tweens actually made during the update.
+    UPROPERTY(BlueprintReadOnly, Category = "Tween|Watchdog")
+    int32 NumSweeps;
+
+    /// @brief Number of start/update/end events fired during the update (their callbacks are part of the cost).
+    UPROPERTY(BlueprintReadOnly, Category = "Tween|Watchdog")
+    int32 NumEventsFired;
+
+    /// @brief Readable description of the TweenContainer: Tween types, targets and the actors owning them.
+    UPROPERTY(BlueprintReadOnly, Category = "Tween|Watchdog")
+    FString Description;
+};
+
+/**
+ * @brief A hitch detected by the TweenManager's watchdog.
+ */
+USTRUCT(BlueprintType)
+struct TWEENMAKER_API FTweenHitchReport
+{
+    GENERATED_BODY()
+
+    FTweenHitchReport();
+
+    /// @brief Time spent updating all TweenContainers of the TweenManager (in milliseconds), deferred writes flush included.
+    UPROPERTY(BlueprintReadOnly, Category = "Tween|Watchdog")
+    float TotalCostMs;
+
+    /// @brief Time spent applying the writes deferred until the end of the update (in milliseconds): the deferred movements (with the
+    ///        transforms of the children and the overlaps), the instance transforms, the material parameters and the widgets.
+    ///        It isn't part of the cost of any TweenContainer.
+    UPROPERTY(BlueprintReadOnly, Category = "Tween|Watchdog")
+    float FlushCostMs;
+
+    /// @brief The offending TweenContainers, the most expensive first.
+    UPROPERTY(BlueprintReadOnly, Category = "Tween|Watchdog")
+    TArray<FTweenHitchContainerInfo> Containers;
+};
+
 /*
  **************************************************************************
  * Blueprint delegates declaration
  **************************************************************************
  */
 
+/// @brief Delegate type declaration, used when the watchdog detects a hitch (Blueprint only).
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FBP_OnTweenHitch, const FTweenHitchReport&, Report);
+
 // Generic delegates used for the tween start/update/end events (one for each type).
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FBP_OnTweenVectorChange, UTweenVector*, Tween);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FBP_OnTweenVector2DChange, UTweenVector2D*, Tween);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FBP_OnTweenRotatorChange, UTweenRotator*, Tween);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FBP_OnTweenTransformChange, UTweenTransform*, Tween);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FBP_OnTweenLinearColorChange, UTweenLinearColor*, Tween);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FBP_OnTweenFloatChange, UTweenFloat*, Tween);
 
@@ -57,6 +134,16 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FBP_OnTweenActorHitRotator, UTween
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FBP_OnTweenPrimitiveComponentBeginOverlapRotator, UTweenRotator*, Tween, UPrimitiveComponent*, ThisComponent, AActor*, OtherActor, UPrimitiveComponent*, OtherComp, const FHitResult&, SweepResult);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_SixParams(FBP_OnTweenPrimitiveComponentHitRotator, UTweenRotator*, Tween, UPrimitiveComponent*, ThisComponent, AActor*, OtherActor, UPrimitiveComponent*, OtherComp, FVector, NormalImpulse, const FHitResult&, HitResult);
 
+/* Hit and overlap events for Transforms */
+
+// Actors
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FBP_OnTweenActorBeginOverlapTransform, UTweenTransform*, Tween, AActor*, ThisActor, AActor*, OtherActor);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FBP_OnTweenActorHitTransform, UTweenTransform*, Tween, AActor*, ThisActor, AActor*, OtherActor, FVector, NormalImpulse, const FHitResult&, Hit);
+
+// PrimitiveComponents
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FBP_OnTweenPrimitiveComponentBeginOverlapTransform, UTweenTransform*, Tween, UPrimitiveComponent*, ThisComponent, AActor*, OtherActor, UPrimitiveComponent*, OtherComp, const FHitResult&, SweepResult);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_SixParams(FBP_OnTweenPrimitiveComponentHitTransform, UTweenTransform*, Tween, UPrimitiveComponent*, ThisComponent, AActor*, OtherActor, UPrimitiveComponent*, OtherComp, FVector, NormalImpulse, const FHitResult&, HitResult);
+
 /* Hit and overlap events for floats */
 
 // Actors
@@ -77,9 +164,13 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FBP_OnTweenSplinePointReached, UTwe
  **************************************************************************
  */
 
+/// @brief Delegate type declaration, used when the watchdog detects a hitch (C++ only).
+DECLARE_DELEGATE_OneParam(FOnTweenHitch, const FTweenHitchReport&);
+
 DECLARE_DELEGATE_OneParam(FOnTweenVectorChange, UTweenVector*);
 DECLARE_DELEGATE_OneParam(FOnTweenVector2DChange, UTweenVector2D*);
 DECLARE_DELEGATE_OneParam(FOnTweenRotatorChange, UTweenRotator*);
+DECLARE_DELEGATE_OneParam(FOnTweenTransformChange, UTweenTransform*);
 DECLARE_DELEGATE_OneParam(FOnTweenLinearColorChange, UTweenLinearColor*);
 DECLARE_DELEGATE_OneParam(FOnTweenFloatChange, UTweenFloat*);
 
@@ -103,6 +194,16 @@ DECLARE_DELEGATE_FiveParams(FOnTweenActorHitRotator, UTweenRotator*, AActor*, AA
 DECLARE_DELEGATE_FiveParams(FOnTweenPrimitiveComponentBeginOverlapRotator, UTweenRotator*, UPrimitiveComponent*, AActor*, UPrimitiveComponent*, const FHitResult&);
 DECLARE_DELEGATE_SixParams(FOnTweenPrimitiveComponentHitRotator, UTweenRotator*, UPrimitiveComponent*, AActor*, UPrimitiveComponent*, FVector, const FHitResult&);
 
+/* Hit and overlap events for Transforms */
+
+// Actors
+DECLARE_DELEGATE_ThreeParams(FOnTweenActorBeginOverlapTransform, UTweenTransform*, AActor*, AActor*);
+DECLARE_DELEGATE_FiveParams(FOnTweenActorHitTransform, UTweenTransform*, AActor*, AActor*, FVector, const FHitResult&);
+
+// PrimitiveComponents
+DECLARE_DELEGATE_FiveParams(FOnTweenPrimitiveComponentBeginOverlapTransform, UTweenTransform*, UPrimitiveComponent*, AActor*, UPrimitiveComponent*, const FHitResult&);
+DECLARE_DELEGATE_SixParams(FOnTweenPrimitiveComponentHitTransform, UTweenTransform*, UPrimitiveComponent*, AActor*, UPrimitiveComponent*, FVector, const FHitResult&);
+
 /* Hit and overlap events for floats */
 
 // Actors
@@ -117,6 +218,73 @@ DECLARE_DELEGATE_SixParams(FOnTweenPrimitiveComponentHitFloat, UTweenFloat*, UPr
 
 DECLARE_DELEGATE_TwoParams(FOnTweenSplinePointReached, UTweenFloat*, int32);
 
+/// @brief Number of frames during which the costs of the TweenContainers are measured after each call to UTweenManagerComponent::RequestCostTracking().
+#define TWEEN_COST_TRACKING_FRAMES 60
+
+/**
+ * @brief A material parameter written by a Tween and not yet applied to its UMaterialInstanceDynamic.
+ */
+struct FTweenPendingMaterialParameter
+{
+    /// @brief Name of the parameter, used if the cached index isn't valid anymore.
+    FName Name;
+
+    /// @brief Index of the parameter in the scalar (or vector) parameter values of the material, or INDEX_NONE if it's not resolved.
+    int32 Index;
+
+    /// @brief True for a vector parameter, false for a scalar one.
+    bool bIsVector;
+
+    /// @brief The new value. Scalar parameters only use the R channel.
+    FLinearColor Value;
+};
+
+/**
+ * @brief A deferred movement update on a component moved by Tweens, ended at the end of the TweenManager's update.
+ */
+struct FTweenScopedMovement
+{
+    /// @brief Number of attach parents of the component.
+    int32 AttachmentDepth;
+
+    /// @brief The scope deferring the movement updates of the component.
+    TUniquePtr<FScopedMovementUpdate> Scope;
+};
+
+/**
+ * @brief The render properties of a widget that the Tweens animate.
+ */
+enum class ETweenWidgetProperty : uint8
+{
+    Translation,
+    Scale,
+    Shear,
+    Angle,
+    Opacity
+};
+
+/**
+ * @brief Render transform and opacity of a widget animated by Tweens, written in the widget once at the end of the TweenManager's update.
+ *        It mirrors FWidgetTransform, so that this header doesn't depend on UMG. Only the properties flagged as changed are written: the
+ *        other ones keep whatever the widget has at that time (e.g. a scale set by the game while a Tween moves the widget).
+ */
+struct FTweenPendingWidgetState
+{
+    FTweenPendingWidgetState();
+
+    FVector2D Translation;
+    FVector2D Scale;
+    FVector2D Shear;
+    float Angle;
+    float Opacity;
+
+    bool bTranslationChanged;
+    bool bScaleChanged;
+    bool bShearChanged;
+    bool bAngleChanged;
+    bool bOpacityChanged;
+};
+
 /**
  * The UTweenManagerComponent class is in charge of managing TweenContainers (that contain the actual Tweens).
  * It can be attached to an Actor or used globally in a level by placing a ATweenManagerActor.
@@ -135,12 +303,18 @@ class TWEENMAKER_API UTweenManagerComponent : public UActorComponent
     friend class UTweenVectorLatentFactory;
     friend class UTweenVector2DLatentFactory;
     friend class UTweenRotatorLatentFactory;
+    friend class UTweenTransformLatentFactory;
 
     friend class UTweenFloatStandardFactory;
     friend class UTweenLinearColorStandardFactory;
     friend class UTweenVectorStandardFactory;
     friend class UTweenVector2DStandardFactory;
     friend class UTweenRotatorStandardFactory;
+    friend class UTweenTransformStandardFactory;
+
+    friend class FTweenReplayer;
+    friend class FTweenDifferentialHarness;
+    friend class FGameplayDebuggerCategory_TweenMaker;
 
 public:
 
@@ -156,6 +330,11 @@ protected:
      */
     virtual void BeginPlay() override;
 
+    /**
+     * @brief Overridden from UActorComponent. Stops the recording, if one is active.
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:
     
     /**
@@ -163,6 +342,36 @@ public:
      */
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+    /*
+     **************************************************************************
+     * Hitch watchdog
+     **************************************************************************
+     */
+
+    /// @brief If true, the time spent by each TweenContainer is measured at each Tick, and the frames that exceed the thresholds are reported.
+    ///        It can also be enabled on every TweenManager with the "TweenMaker.HitchWatchdog" console variable.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween|Watchdog")
+    bool bEnableHitchWatchdog;
+
+    /// @brief A frame is reported if the update of all TweenContainers takes longer than this (in milliseconds).
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween|Watchdog", meta = (ClampMin = "0.0"))
+    float HitchThresholdMs;
+
+    /// @brief A frame is reported if the update of a single TweenContainer takes longer than this (in milliseconds).
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween|Watchdog", meta = (ClampMin = "0.0"))
+    float ContainerHitchThresholdMs;
+
+    /// @brief Minimum time between two hitch logs (in seconds). The hitches detected in between are only counted, and the delegates are still called.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tween|Watchdog", meta = (ClampMin = "0.0"))
+    float HitchLogInterval;
+
+    /// @brief Delegate called each time the watchdog detects a hitch. Use only in Blueprints.
+    UPROPERTY(BlueprintAssignable, meta = (DisplayName = "On Tween Hitch"))
+    FBP_OnTweenHitch OnTweenHitch;
+
+    /// @brief Delegate called each time the watchdog detects a hitch. Use only in C++.
+    FOnTweenHitch OnTweenHitchDelegate;
+
     /*
      **************************************************************************
      * "Tween Utils" methods
@@ -224,6 +433,30 @@ public:
     UFUNCTION(BlueprintCallable, meta = (DisplayName="Find Tween By Name", KeyWords="Find Tween By Name"), Category = "Tween|Utils")
     bool FindTweenByName(FName TweenName, ETweenGenericType TweenType, UBaseTween*& TweenFound) const;
 
+    /**
+     * Starts recording every TweenContainer and Tween created by this TweenManager, the operations made on them and the frame times,
+     * so that the workload can be replayed later without running the game (see the "TweenReplay" commandlet). If a recording is
+     * already active, it's stopped first.
+     *
+     * @param FileName The file to write. Relative names are placed in the "Profiling/TweenMaker" directory. If empty, a timestamped name is used.
+     *
+     * @return True if the recording started.
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Start Recording Tweens", KeyWords="Start Record Recording Tweens Profile"), Category = "Tween|Utils")
+    bool StartRecording(const FString& FileName);
+
+    /**
+     * Stops the active recording, if any, and closes its file.
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName="Stop Recording Tweens", KeyWords="Stop Record Recording Tweens Profile"), Category = "Tween|Utils")
+    void StopRecording();
+
+    /**
+     * Returns true if this TweenManager is currently recording.
+     */
+    UFUNCTION(BlueprintPure, meta = (DisplayName="Is Recording Tweens", KeyWords="Is Record Recording Tweens Profile"), Category = "Tween|Utils")
+    bool IsRecording() const;
+
     /*
      **************************************************************************
      * C++ methods (i.e. meant to be called when using this plugin in C++)
@@ -253,6 +486,134 @@ public:
      */
     static UTweenContainer* CreateTweenContainerStatic(int32 pNumLoops = 1, ETweenLoopType pLoopType = ETweenLoopType::Yoyo, float pTimeScale = 1.0f);
 
+    /**
+     * @brief Returns the active recorder, or nullptr if this TweenManager isn't recording.
+     */
+    FTweenRecorder* GetTweenRecorder() const
+    {
+        return mTweenRecorder.Get();
+    }
+
+    /**
+     * @brief Makes this TweenManager measure the time spent by each TweenContainer during the next few frames (see UTweenContainer::GetLastUpdateCost()).
+     *        Debugging tools call it periodically while they display the costs, so that nothing is measured otherwise.
+     */
+    void RequestCostTracking();
+
+    /**
+     * @brief Returns the time spent by the last update of all TweenContainers (in seconds). It's only measured while tracking costs.
+     */
+    float GetLastUpdateCost() const
+    {
+        return mLastUpdateCost;
+    }
+
+    /**
+     * @brief Returns the part of GetLastUpdateCost() spent applying the writes deferred until the end of the update (in seconds), which
+     *        isn't part of the cost of any TweenContainer. It's only measured while tracking costs.
+     */
+    float GetLastFlushCost() const
+    {
+        return mLastFlushCost;
+    }
+
+    /**
+     * @brief Returns the transform of an instance of the given InstancedStaticMeshComponent, including the changes made by the Tweens
+     *        during the current update that weren't flushed yet.
+     *
+     * @param pComponent The component that owns the instance.
+     * @param pInstanceIndex The index of the instance.
+     * @param pWorldSpace If true the transform is in world space, otherwise it's relative to the component.
+     *
+     * @return The transform of the instance.
+     */
+    FTransform GetInstanceTransform(UInstancedStaticMeshComponent* pComponent, int32 pInstanceIndex, bool pWorldSpace) const;
+
+    /**
+     * @brief Changes the transform of an instance of the given InstancedStaticMeshComponent. During the update, the change is deferred until
+     *        its end, where all the instances changed on the same component are written with batched transform updates and a single
+     *        render state invalidation. Outside of it (e.g. when a Tween is deleted and snapped to its end), it's written right away.
+     *
+     * @param pComponent The component that owns the instance.
+     * @param pInstanceIndex The index of the instance.
+     * @param pTransform The new transform.
+     * @param pWorldSpace If true the transform is in world space, otherwise it's relative to the component.
+     */
+    void SetInstanceTransform(UInstancedStaticMeshComponent* pComponent, int32 pInstanceIndex, const FTransform& pTransform, bool pWorldSpace);
+
+    /**
+     * @brief Changes a scalar parameter of the given material. During the update, the change is deferred until its end, where all the
+     *        parameters changed on the same material are written together, once each, by index. Outside of it, it's written right away.
+     *
+     * @param pMaterial The material.
+     * @param pParameterName The name of the parameter.
+     * @param pParameterIndex The index of the parameter, as returned by UMaterialInstanceDynamic::InitializeScalarParameterAndGetIndex()
+     *                        (INDEX_NONE to write it by name).
+     * @param pValue The new value.
+     */
+    void SetMaterialScalarParameter(UMaterialInstanceDynamic* pMaterial, FName pParameterName, int32 pParameterIndex, float pValue);
+
+    /**
+     * @brief Changes a vector parameter of the given material. The change is deferred like for SetMaterialScalarParameter().
+     *
+     * @param pMaterial The material.
+     * @param pParameterName The name of the parameter.
+     * @param pParameterIndex The index of the parameter, as returned by UMaterialInstanceDynamic::InitializeVectorParameterAndGetIndex()
+     *                        (INDEX_NONE to write it by name).
+     * @param pValue The new value.
+     */
+    void SetMaterialVectorParameter(UMaterialInstanceDynamic* pMaterial, FName pParameterName, int32 pParameterIndex, const FLinearColor& pValue);
+
+    /**
+     * @brief Returns a render property of the given widget, including the change made by the Tweens during the current update.
+     *
+     * @param pWidget The widget.
+     * @param pProperty The property.
+     *
+     * @return The value of the property (the angle and the opacity are in X).
+     */
+    FVector2D GetWidgetProperty(UWidget* pWidget, ETweenWidgetProperty pProperty) const;
+
+    /**
+     * @brief Changes a render property of the given widget. During the update, the change is deferred until its end: each widget then
+     *        receives at most one render transform and one opacity change, however many Tweens animate it, merged with the properties that
+     *        no Tween changed. Outside of it (e.g. when a Tween is deleted and snapped to its end), it's written right away.
+     *
+     * @param pWidget The widget.
+     * @param pProperty The property.
+     * @param pValue The new value of the property (the angle and the opacity are in X).
+     */
+    void SetWidgetProperty(UWidget* pWidget, ETweenWidgetProperty pProperty, const FVector2D& pValue);
+
+    /**
+     * @brief Called before a Tween moves the given component without sweeping. Defers the movement updates of the component (and its
+     *        children) until the end of the current update, so that their transforms and overlaps are updated once however many Tweens move
+     *        them, but only when that pays off: when the component was moved by several Tweens in the previous update, or together with one
+     *        of its attach parents or children (e.g. a turret on a moving platform). A hierarchy is therefore only batched from its second
+     *        update on. Any other component is moved right away, without allocating a scope, so that the game sees it where it is.
+     *
+     * @param pComponent The component that is going to be moved.
+     */
+    void BeginScopedMovement(USceneComponent* pComponent);
+
+    /**
+     * @brief Ends right away the scoped movements begun on the attach parents of the given component, so that its world transform (and the
+     *        ones of its sockets) can be read. A deferred parent updates its own transform but not the ones of its children, so without this a
+     *        Tween would read where a child was before its parents moved in this update. Used before preparing a Tween on an Actor or a
+     *        SceneComponent, before the sweeps, and before reading the destination of a MoveTo/LookAtComponent or the spline of a FollowSpline.
+     *
+     *        The trade-off: a parent moved again later in the same update begins a new scope, and propagates its transform to its children
+     *        once more at the end of the update. Only the scopes begun by the TweenManager can be ended: the children of a component deferred by
+     *        an outer scope (e.g. one opened by the game around the TweenManager's tick) are still read with their transforms from before it.
+     *
+     *        Also used before broadcasting the "update" and "end" events of a Tween whose target is deferred, since their callbacks may read the
+     *        transforms of its children and sockets, or expect its overlaps to be up to date.
+     *
+     * @param pComponent The component whose world transform is going to be read.
+     * @param pShouldIncludeComponent If true, the scoped movement of the component itself is ended as well.
+     */
+    void EndParentScopedMovements(USceneComponent* pComponent, bool pShouldIncludeComponent = false);
+
 protected:
 
     /*
@@ -308,7 +669,9 @@ protected:
                                     float pDelay,
                                     float pTimeScale,
                                     bool pTweenWhileGameIsPaused,
-                                    UTweenVectorLatentFactory* pLatentProxy = nullptr);
+                                    UTweenVectorLatentFactory* pLatentProxy = nullptr,
+                                    const TArray<FVector>* pBezierControlPoints = nullptr,
+                                    bool pBezierConstantSpeed = false);
 
     UTweenVector* JoinTweenVector(UTweenContainer* pTweenContainer,
                                   int32 pSequenceIndex,
@@ -325,8 +688,9 @@ protected:
                                   float pDelay,
                                   float pTimeScale,
                                   bool pTweenWhileGameIsPaused,
-                                  UTweenVectorLatentFactory* pLatentProxy = nullptr);
-
+                                  UTweenVectorLatentFactory* pLatentProxy = nullptr,
+                                  const TArray<FVector>* pBezierControlPoints = nullptr,
+                                  bool pBezierConstantSpeed = false);
 
     UTweenVector2D* AppendTweenVector2D(UTweenContainer* pTweenContainer,
                                         int32 pSequenceIndex,
@@ -400,6 +764,43 @@ protected:
                                     UTweenRotatorLatentFactory* pLatentProxy = nullptr);
 
 
+    UTweenTransform* AppendTweenTransform(UTweenContainer* pTweenContainer,
+                                          int32 pSequenceIndex,
+                                          ETweenTransformType pTweenType,
+                                          UObject* pTarget,
+                                          ETweenTargetType pTargetType,
+                                          const FTransform& pTo,
+                                          float pDuration,
+                                          ETweenEaseType pEaseType,
+                                          ETweenSpace pTweenSpace,
+                                          ETweenRotationMode pRotationMode,
+                                          bool pDeleteTweenOnHit,
+                                          bool pDeleteTweenOnOverlap,
+                                          int32 pNumLoops,
+                                          ETweenLoopType pLoopType,
+                                          float pDelay,
+                                          float pTimeScale,
+                                          bool pTweenWhileGameIsPaused,
+                                          UTweenTransformLatentFactory* pLatentProxy = nullptr);
+
+    UTweenTransform* JoinTweenTransform(UTweenContainer* pTweenContainer,
+                                        int32 pSequenceIndex,
+                                        ETweenTransformType pTweenType,
+                                        UObject* pTarget,
+                                        ETweenTargetType pTargetType,
+                                        const FTransform& pTo,
+                                        float pDuration,
+                                        ETweenEaseType pEaseType,
+                                        ETweenSpace pTweenSpace,
+                                        ETweenRotationMode pRotationMode,
+                                        bool pDeleteTweenOnHit,
+                                        bool pDeleteTweenOnOverlap,
+                                        float pDelay,
+                                        float pTimeScale,
+                                        bool pTweenWhileGameIsPaused,
+                                        UTweenTransformLatentFactory* pLatentProxy = nullptr);
+
+
     UTweenLinearColor* AppendTweenLinearColor(UTweenContainer* pTweenContainer,
                                               int32 pSequenceIndex,
                                               ETweenLinearColorType pTweenType,
@@ -553,11 +954,77 @@ protected:
      **************************************************************************
      */
 
+    /**
+     * @brief Updates all TweenContainers owned by this TweenManager, deleting the ones that are done.
+     *
+     * @param pDeltaTime The delta time.
+     * @param pIsGamePaused True if the game is paused (only the TweenContainers that tween while the game is paused will be updated).
+     */
+    void UpdateTweenContainers(float pDeltaTime, bool pIsGamePaused);
+
+    /**
+     * @brief Writes the instance transforms changed during the update in their InstancedStaticMeshComponents.
+     */
+    void FlushInstanceTransforms();
+
+    /**
+     * @brief Writes the material parameters changed during the update in their materials.
+     */
+    void FlushMaterialParameters();
+
+    /**
+     * @brief Writes the render transforms and opacities changed during the update in their widgets.
+     */
+    void FlushWidgetStates();
+
+    /**
+     * @brief Ends the scoped movements begun during the update, applying the deferred movement updates by attachment depth (parents first):
+     *        a parent propagates its transform to its children while their own updates are still deferred, so each of them is updated once
+     *        (unless EndParentScopedMovements() already ended some of them during the update).
+     */
+    void EndScopedMovements();
+
+    /**
+     * @brief Chooses the components whose movement is deferred during the next update (see BeginScopedMovement()), from the ones moved
+     *        during this one.
+     */
+    void UpdateBatchedMovements();
+
+    /**
+     * @brief Adds a material parameter write to the pending ones, replacing the previous write of the same parameter in this update.
+     */
+    void AddPendingMaterialParameter(UMaterialInstanceDynamic* pMaterial, const FTweenPendingMaterialParameter& pParameter);
+
+    /**
+     * @brief Writes a material parameter by index, or by name if the index isn't valid.
+     */
+    static void WriteMaterialParameter(UMaterialInstanceDynamic* pMaterial, const FTweenPendingMaterialParameter& pParameter);
+
     /**
      * @brief Fully destroys a TweenContainer.
      */
     void DestroyTweenContainer(UTweenContainer* pTweenContainer, int32 pIndex);
 
+    /**
+     * @brief Forwards a newly created Tween to the active recorder, if any.
+     *
+     * @param pTweenContainer The TweenContainer the Tween is being added to.
+     * @param pSequenceIndex The sequence index the Tween is being added at.
+     * @param pIsJoin True if the Tween is being joined, false if it's being appended.
+     * @param pTween The initialized Tween.
+     */
+    void RecordTween(UTweenContainer* pTweenContainer, int32 pSequenceIndex, bool pIsJoin, UBaseTween* pTween);
+
+    /**
+     * @brief Checks the costs measured during the last update against the watchdog's thresholds, and reports the hitch if needed.
+     */
+    void CheckForHitches();
+
+    /**
+     * @brief Builds the part of a hitch report that describes the given TweenContainer.
+     */
+    FTweenHitchContainerInfo MakeHitchContainerInfo(UTweenContainer* pTweenContainer) const;
+
     /**
     * @brief Helper method that takes a TweenTarget and the Tween type and makes an association
     *        between them and the corresponding Tween in the reference MultiMap.
@@ -601,4 +1068,59 @@ protected:
      * Values: the corresponding Tweens. Might be more than one, if the names are not unique.
      */
     TMultiMap<TPair<FName, ETweenGenericType>, TWeakObjectPtr<UBaseTween>> mTweensByNameMap;
+
+    /// @brief The active recorder, if the workload of this TweenManager is being recorded.
+    TUniquePtr<FTweenRecorder> mTweenRecorder;
+
+    /**
+     * @brief Instance transforms changed by the Tweens and not yet written in their components.
+     * Keys: the InstancedStaticMeshComponents.
+     * Values: the new transforms (relative to the component), by instance index.
+     */
+    TMap<TWeakObjectPtr<UInstancedStaticMeshComponent>, TMap<int32, FTransform>> mPendingInstanceTransforms;
+
+    /**
+     * @brief Material parameters changed by the Tweens and not yet written in their materials.
+     * Keys: the materials.
+     * Values: the parameters to write, at most one per parameter.
+     */
+    TMap<TWeakObjectPtr<UMaterialInstanceDynamic>, TArray<FTweenPendingMaterialParameter>> mPendingMaterialParameters;
+
+    /**
+     * @brief Render transforms and opacities of the widgets animated during the current update.
+     * Keys: the widgets.
+     * Values: their pending state, written only for the parts flagged as changed.
+     */
+    TMap<TWeakObjectPtr<UWidget>, FTweenPendingWidgetState> mPendingWidgetStates;
+
+    /// @brief True while the TweenContainers are being updated: the writes made in the meantime are deferred until the end of the update.
+    bool bIsUpdatingTweenContainers;
+
+    /// @brief Scoped movements begun by the Tweens during the current update.
+    TArray<FTweenScopedMovement> mScopedMovements;
+
+    /**
+     * @brief Components moved by non sweeping Tweens during the current update.
+     * Keys: the components.
+     * Values: the number of Tweens that moved them.
+     */
+    TMap<TWeakObjectPtr<USceneComponent>, int32> mMovedComponents;
+
+    /// @brief Components whose movement is deferred during the current update, chosen at the end of the previous one.
+    TSet<TWeakObjectPtr<USceneComponent>> mBatchedMovementComponents;
+
+    /// @brief Number of frames during which the costs of the TweenContainers are still measured.
+    int32 mCostTrackingFramesLeft;
+
+    /// @brief Time spent by the last update of all TweenContainers (in seconds), measured only while tracking costs.
+    float mLastUpdateCost;
+
+    /// @brief Part of mLastUpdateCost spent applying the deferred writes (in seconds), measured only while tracking costs.
+    float mLastFlushCost;
+
+    /// @brief Time of the last hitch log (in seconds, platform time).
+    double mLastHitchLogTime;
+
+    /// @brief Number of hitches detected since the last log that weren't logged.
+    int32 mNumHitchesNotLogged;
 };
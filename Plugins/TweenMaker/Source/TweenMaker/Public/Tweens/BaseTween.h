@@ -6,18 +6,25 @@
 #include "UObject/NoExportTypes.h"
 #include "Utils/TweenEnums.h"
 #include "Utils/Utility.h"
+#include "Utils/TweenSpring.h"
 #include "BaseTween.generated.h"
 
 class USplineComponent;
 class UMaterialInsstanceDynamic;
 class UWidget;
 class UCurveFloat;
+class UInstancedStaticMeshComponent;
+class UMaterialParameterCollectionInstance;
 class UTweenContainer;
 class UTweenVector;
 class UTweenRotator;
 class UTweenLinearColor;
 class UTweenFloat;
 class UTweenVector2D;
+class UPrimitiveComponent;
+class USceneComponent;
+struct FTraceHandle;
+struct FTraceDatum;
 
 
 /// @brief Delegate emitted whenever the name of the Tween changes. Used to update the internal map, for easier access
@@ -43,6 +50,8 @@ public:
     
     friend class UTweenManagerComponent;
     friend class UTweenContainer;
+    friend class FTweenRecorder;
+    friend class FGameplayDebuggerCategory_TweenMaker;
 
     /**
      * @brief Constructor.
@@ -93,6 +102,17 @@ public:
         return mTargetObject.Get();
     }
 
+    /**
+     * Returns the index of the instance animated by the Tween, if its target is an InstancedStaticMeshComponent.
+     *
+     * @return The instance index, or -1 if the target isn't an InstancedStaticMeshComponent.
+     */
+    UFUNCTION(BlueprintPure, meta = (KeyWords="Tween Target Instance Index Info"), Category = "Tween|Info")
+    int32 GetTweenTargetInstanceIndex() const
+    {
+        return mTargetInstanceIndex;
+    }
+
     /**
      * Returns the TweenContainer that owns this Tween. It can be used to append/joins new Tweens at the end or to manipulate all owned Tweens.
      *
@@ -126,6 +146,67 @@ public:
         return !bIsTweenDone && !bIsTweenPaused;
     }
 
+    /**
+     * @brief Checks if the Tween moves its target with collision sweeps.
+     *
+     * @return True if the Tween sweeps; false otherwise.
+     */
+    virtual bool IsSweeping() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Checks if the Tween can be driven by a spring (see SetSpring()).
+     *
+     * @return True if it can; false otherwise.
+     */
+    virtual bool SupportsSpring() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Gets the settle threshold used by a spring when none is given to SetSpring(). Each kind of Tween has its own, since the same
+     *        distance isn't as noticeable in centimeters, radians or color channels.
+     *
+     * @return The default settle threshold.
+     */
+    virtual float GetDefaultSpringSettleThreshold() const
+    {
+        return 0.01f;
+    }
+
+    /**
+     * @brief Checks if something listens to the "update" event of the Tween (its delegates, or the ones of its latent proxy).
+     *
+     * @return True if the event has listeners; false otherwise.
+     */
+    virtual bool IsUpdateEventBound() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Checks if something listens to the "end" event of the Tween (its delegates, or the ones of its latent proxy).
+     *
+     * @return True if the event has listeners; false otherwise.
+     */
+    virtual bool IsEndEventBound() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Checks if something listens to the hits of the Tween's target (its hit delegates, or "DeleteTweenOnHit").
+     *
+     * @return True if the hits have listeners; false otherwise.
+     */
+    virtual bool IsHitEventBound() const
+    {
+        return false;
+    }
+
     /**
      * Retrieves the current timescale.
      *
@@ -227,6 +308,49 @@ public:
     UFUNCTION(BlueprintCallable, meta = (KeyWords = "Tween Custom Easing"), Category = "Tween|Utils")
     void SetCustomEasisng(UCurveFloat *Curve);
 
+    /**
+     * Changes how the Tween checks collisions when it moves its target while hit or overlap events are bound (e.g. "DeleteTweenOnHit").
+     * Sweeping every move is accurate but expensive: the other modes trade some accuracy (thin obstacles can be missed) for fewer sweeps.
+     * "AsyncSweep" keeps the accuracy but moves the sweeps off the game thread: hits (and "DeleteTweenOnHit") happen one frame late.
+     * It only concerns the hits: overlaps are still updated synchronously at each move, so overlap events (and "DeleteTweenOnOverlap") have
+     * no latency, but their cost isn't saved either. A Tween that binds only overlap events therefore falls back to "OverlapOnly".
+     *
+     * @param CollisionMode The collision mode.
+     * @param SweepInterval Used by "SweepEveryNFrames": number of frames between two sweeps.
+     * @param SweepDistance Used by "SweepOnDistance": distance the target has to move (since the last sweep) before sweeping again.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Collision Sweep Hit Overlap"), Category = "Tween|Utils")
+    void SetCollisionMode(ETweenCollisionMode CollisionMode, int32 SweepInterval = 4, float SweepDistance = 50.0f);
+
+    /**
+     * Marks the Tween as purely visual (e.g. for decorative props). A visual only Tween ignores hit/overlap events and writes the transform
+     * of its target directly, as a teleport: it doesn't go through the movement of the component, so no physics velocity is computed and
+     * the overlaps of the target (and of its children) are never updated. Each write updates the children's transforms once.
+     * It must be set before the Tween starts.
+     *
+     * @param VisualOnly The new value.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Visual Only Teleport Decorative"), Category = "Tween|Utils")
+    void SetVisualOnly(bool VisualOnly = true);
+
+    /**
+     * Drives the Tween with a damped spring instead of its duration and easing: the value is pulled towards the ending value until it
+     * settles there. The ending value can then be changed at any time with "Retarget", even at each frame: the value keeps its velocity
+     * and heads to the new target, without recreating the Tween.
+     * By default the Tween stays alive once settled (without ending nor broadcasting its end), so that it can be retargeted again until
+     * it's deleted; this also means that the following Tweens of its sequence never start. Use EndWhenSettled for a spring that must end.
+     * If called while the Tween is running, the spring starts from the current value. Only Float, Vector, Rotator and LinearColor Tweens
+     * can be springs (except the Bezier ones); Rotator Tweens only drive their main target with the spring.
+     *
+     * @param Frequency How fast the spring reacts, in oscillations per second.
+     * @param DampingRatio 1 reaches the target as fast as possible without overshooting it; lower values overshoot and oscillate.
+     * @param SettleThreshold The spring settles when both the distance from the target and the speed are below this value. If zero or
+     *                        negative, a value suited to what is tweened is used (e.g. a hundredth of a centimeter for a move).
+     * @param EndWhenSettled If true, the Tween ends as soon as the spring settles and can't be retargeted anymore.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Spring Damped Follow"), Category = "Tween|Utils")
+    void SetSpring(float Frequency = 2.0f, float DampingRatio = 1.0f, float SettleThreshold = 0.0f, bool EndWhenSettled = false);
+
     /*
      **************************************************************************
      * Methods used internally. Should not be called.
@@ -260,6 +384,21 @@ public:
                   int32 pNumLoops          = 1,
                   ETweenLoopType pLoopType = ETweenLoopType::Yoyo);
 
+    /**
+     * @brief Sets the index of the instance animated by the Tween, when its target is an InstancedStaticMeshComponent (called internally).
+     *
+     * @param pInstanceIndex The instance index.
+     */
+    void SetTweenTargetInstanceIndex(int32 pInstanceIndex);
+
+    /**
+     * @brief Sets the index of the first custom primitive data value animated by the Tween, when its target is a PrimitiveComponent's
+     *        custom primitive data (called internally).
+     *
+     * @param pDataIndex The custom primitive data index.
+     */
+    void SetCustomPrimitiveDataIndex(int32 pDataIndex);
+
     /**
      * @brief UpdateTween is called at each Tick to update the Tween state (called internally).
      *
@@ -400,6 +539,24 @@ public:
         // Don't restart the delay, otherwise it will always apply it at each loop, with is not usually a good thing
         mDelayElapsedTime = 0.0f;
         bIsTweenDone = false;
+
+        EndRetargetedLoop();
+    }
+
+    /**
+     * @brief Saves the starting value of the current loop, right before a retarget replaces it with the current value (see RetargetClock()).
+     */
+    virtual void SaveLoopStart()
+    {
+
+    }
+
+    /**
+     * @brief Restores the starting value saved by SaveLoopStart(), when the retargeted loop is over.
+     */
+    virtual void RestoreLoopStart()
+    {
+
     }
 
     /**
@@ -479,6 +636,127 @@ protected:
 
     }
 
+    /**
+     * @brief Restarts the clock of a Tween whose ending value is being changed (see the "Retarget" methods). If the Tween is running, its
+     *        elapsed time goes back to zero without broadcasting the start again, so that it can ease from its current value.
+     *        A spring has no clock and always keeps its current value and velocity.
+     *
+     *        The new duration and starting value only apply to the current loop: the ones the Tween had before are restored when it
+     *        loops or restarts, so that each loop keeps covering the whole way. Only the ending value changes for good.
+     *
+     * @param pNewTo The new ending value, packed like the values of a recorded Tween (only used to record the retarget).
+     * @param pDuration The new duration. If negative, a running Tween keeps the time it had left and one that didn't start keeps its duration.
+     *
+     * @return True if the Tween is running, meaning that its starting value must be replaced by the current one.
+     */
+    bool RetargetClock(const FVector4f& pNewTo, float pDuration);
+
+    /*
+     **************************************************************************
+     * Helper methods for InstancedStaticMeshComponent targets
+     **************************************************************************
+     */
+
+    /**
+     * @brief Returns the transform of the instance animated by the Tween, including the changes not yet flushed by the TweenManager.
+     *        If the target isn't valid (or the instance doesn't exist anymore), the identity is returned.
+     *
+     * @param pWorldSpace If true the transform is in world space, otherwise it's relative to the component.
+     */
+    FTransform GetTargetInstanceTransform(bool pWorldSpace) const;
+
+    /**
+     * @brief Changes the transform of the instance animated by the Tween. The change is applied by the TweenManager at the end of the update,
+     *        together with all the other changes made on the same component.
+     *
+     * @param pTransform The new transform.
+     * @param pWorldSpace If true the transform is in world space, otherwise it's relative to the component.
+     */
+    void SetTargetInstanceTransform(const FTransform& pTransform, bool pWorldSpace);
+
+    /*
+     **************************************************************************
+     * Helper methods for MaterialParameterCollection targets
+     **************************************************************************
+     */
+
+    /**
+     * @brief Returns the instance of the target MaterialParameterCollection in the world of the owning TweenManager.
+     *        Returns null if the target isn't valid or if the TweenManager has no world.
+     */
+    UMaterialParameterCollectionInstance* GetTargetParameterCollectionInstance() const;
+
+    /*
+     **************************************************************************
+     * Helper methods for Actor and SceneComponent targets
+     **************************************************************************
+     */
+
+    /**
+     * @brief Moves the given component (the target, or the root component of an Actor target). Visual only Tweens write its relative location
+     *        directly and update it as a teleport, without going through MoveComponent: neither the physics velocity nor the overlaps are updated.
+     *
+     * @param pComponent The component to move.
+     * @param pTweenSpace The space of the given location.
+     * @param pLocation The new location.
+     * @param pShouldSweep Whether the move is a collision sweep. Visual only Tweens never sweep.
+     */
+    void SetComponentLocation(USceneComponent* pComponent, ETweenSpace pTweenSpace, const FVector& pLocation, bool pShouldSweep);
+
+    /**
+     * @brief Rotates the given component, like SetComponentLocation() does.
+     */
+    void SetComponentRotation(USceneComponent* pComponent, ETweenSpace pTweenSpace, const FQuat& pRotation);
+
+    /**
+     * @brief Scales the given component, like SetComponentLocation() does.
+     */
+    void SetComponentScale(USceneComponent* pComponent, ETweenSpace pTweenSpace, const FVector& pScale);
+
+    /**
+     * @brief Changes the whole transform of the given component, like SetComponentLocation() does.
+     */
+    void SetComponentTransform(USceneComponent* pComponent, ETweenSpace pTweenSpace, const FTransform& pTransform, bool pShouldSweep);
+
+    /*
+     **************************************************************************
+     * Helper methods for collisions
+     **************************************************************************
+     */
+
+    /**
+     * @brief Returns the component moved (and swept) by the Tween: the target itself, or the root component of an Actor target.
+     *        Returns null if it isn't a PrimitiveComponent.
+     */
+    UPrimitiveComponent* GetTargetPrimitiveComponent() const;
+
+    /**
+     * @brief Returns whether the next move of the target should be a collision sweep, according to the collision mode.
+     *        Meant to be called only when hit or overlap events are bound, once per move. Each sweep is counted in the "Collision sweeps" stat.
+     *        If the previous moves weren't swept, the target is first brought back where the last sweep stopped, so that the sweep
+     *        covers the whole path travelled since then.
+     */
+    bool ShouldSweep();
+
+    /**
+     * @brief Returns the teleport type to use when moving or rotating the target: visual only Tweens teleport it.
+     */
+    ETeleportType GetTeleportType() const
+    {
+        return bIsVisualOnly ? ETeleportType::TeleportPhysics : ETeleportType::None;
+    }
+
+    /**
+     * @brief Issues the asynchronous sweep of the move made during the last update, with the "AsyncSweep" collision mode.
+     */
+    void RequestAsyncSweep();
+
+    /**
+     * @brief Called (on the game thread, the frame after the request) with the result of an asynchronous sweep. A blocking hit is dispatched
+     *        to the target like the hit of a synchronous sweep, so the same events fire.
+     */
+    void OnAsyncSweepDone(const FTraceHandle& pTraceHandle, FTraceDatum& pTraceDatum);
+
 public:
 
     /*
@@ -2459,6 +2737,12 @@ protected:
     /// @brief Tween target type.
     ETweenTargetType mTargetType;
 
+    /// @brief Index of the animated instance, if the target is an InstancedStaticMeshComponent (INDEX_NONE otherwise).
+    int32 mTargetInstanceIndex;
+
+    /// @brief Index of the first animated custom primitive data value, if the target is a CustomPrimitiveData one (INDEX_NONE otherwise).
+    int32 mCustomPrimitiveDataIndex;
+
     /// @brief Easing equation to use.
     ETweenEaseType mEaseType;
 
@@ -2481,9 +2765,53 @@ protected:
     /// @brief If true, the Tween will keep updating even if the game is paused (by default it's false).
     bool bTweenWhileGameIsPaused;
 
+    /// @brief If true, the Tween only has a visual purpose: it teleports its target, ignores collisions and defers its movement.
+    bool bIsVisualOnly;
+
+    /// @brief How collisions are checked when the target moves while hit or overlap events are bound.
+    ETweenCollisionMode mCollisionMode;
+
+    /// @brief Number of frames between two sweeps, with the "SweepEveryNFrames" collision mode.
+    int32 mSweepInterval;
+
+    /// @brief Distance the target has to move before sweeping again, with the "SweepOnDistance" collision mode.
+    float mSweepDistance;
+
+    /// @brief Number of moves since the last sweep (INDEX_NONE if the target has never been swept).
+    int32 mMovesSinceLastSweep;
+
+    /// @brief World location where the last sweep left the target (i.e. where it stopped, if the sweep was blocked).
+    FVector mLastSweepLocation;
+
+    /// @brief True if the target was swept during the current update, so that its location is saved once it's moved.
+    bool bHasSweptInUpdate;
+
+    /// @brief With the "AsyncSweep" collision mode, the component moved during the current update.
+    TWeakObjectPtr<UPrimitiveComponent> mAsyncSweepComponent;
+
+    /// @brief With the "AsyncSweep" collision mode, the world location of the moved component before the move.
+    FVector mAsyncSweepStart;
+
+    /// @brief The spring driving the Tween, if SetSpring() was called.
+    FTweenSpring mSpring;
+
     /// @brief True if the Tween's PrepareTween() method was already called.
     bool bHasPreparedTween;
 
+    /// @brief True if the elapsed time was reset by a retarget, so that the next update doesn't start the Tween again.
+    bool bHasBeenRetargeted;
+
+    /// @brief True if the current loop was retargeted while running, meaning that its duration and starting value must be restored.
+    bool bIsLoopRetargeted;
+
+    /// @brief The duration of the Tween before the current loop was retargeted.
+    float mLoopDuration;
+
+    /**
+     * @brief Restores the duration and the starting value of a Tween whose current loop was retargeted. Does nothing otherwise.
+     */
+    void EndRetargetedLoop();
+
     /**
      * @brief PreDestroy is called right before the Tween object gets deleted, for any reason. It executes cleanup operations.
      */
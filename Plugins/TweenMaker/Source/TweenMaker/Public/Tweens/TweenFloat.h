@@ -5,13 +5,35 @@
 #include "CoreMinimal.h"
 #include "Tweens/BaseTween.h"
 #include "TweenManagerComponent.h"
+#include "Utils/TweenPropertyBinding.h"
 #include "Engine/HitResult.h"
 #include "TweenFloat.generated.h"
 
 class UTweenFloatLatentFactory;
 class UMaterialInstanceDynamic;
+class UMaterialParameterCollectionInstance;
+class UPrimitiveComponent;
 class USplineComponent;
 class UWidget;
+class FTweenSplineCache;
+
+/**
+ * @brief Additional component moved by a "RotateAroundPoint" Tween, with the circle it describes.
+ */
+struct FTweenOrbiter
+{
+    /// @brief The moved component.
+    TWeakObjectPtr<USceneComponent> Component;
+
+    /// @brief Center of the circle.
+    FVector Center;
+
+    /// @brief Offset from the center at the Tween's reference angle.
+    FVector AxisU;
+
+    /// @brief Offset from the center at 90 degrees past the Tween's reference angle.
+    FVector AxisV;
+};
 
 /**
  * The UTweenFloat handles the update of all Tweens that use only floats.
@@ -21,6 +43,9 @@ class TWEENMAKER_API UTweenFloat : public UBaseTween
 {
     GENERATED_BODY()
 
+    friend class FTweenRecorder;
+    friend class FGameplayDebuggerCategory_TweenMaker;
+
 public:
 
     /**
@@ -45,6 +70,43 @@ public:
         return mCurrentValue;
     }
 
+    /**
+     * Makes more components rotate around the pivot point of this "RotateAroundPoint" Tween, each one starting from its own location.
+     * The whole group shares the Tween's angle, so each update evaluates the easing and the trigonometry only once for all of them,
+     * which is much cheaper than one Tween per component when many objects orbit the same point.
+     * The added components are only moved (they ignore hit/overlap events and collision modes). It must be called before the Tween starts.
+     *
+     * @param Orbiters The components to add.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Rotate Around Point Orbit Batch"), Category = "Tween|Utils|Float")
+    void AddOrbiters(const TArray<USceneComponent*>& Orbiters);
+
+    /**
+     * Changes the ending value of the Tween while it's running, e.g. when a health bar is hit again or a counter must reach a new score.
+     * The Tween starts over from its current value, so there is no jump, and the same Tween (with its container and latent node)
+     * keeps going instead of being deleted and created again. If the Tween hasn't started yet, only its ending value changes.
+     * Spring Tweens (see "SetSpring") keep their velocity and just head to the new value, which can be changed at each frame to follow
+     * a moving target; a spring at rest starts moving again.
+     *
+     * @param NewTo The new ending value.
+     * @param NewDuration The time to reach the new ending value. If negative, the Tween keeps the time it had left.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Retarget Set To Change End Value Spring Follow"), Category = "Tween|Utils|Float")
+    void Retarget(float NewTo, float NewDuration = -1.0f);
+
+    /**
+     * Binds the Tween to a property of its target, which is then set directly at each update: there's no need to copy the value in an
+     * "OnTweenUpdate" event. The path is resolved only once, and can go through the members of structs (e.g. "FieldOfView" of a
+     * CameraComponent, or "Stats.Speed"). If the property has a native setter it's called, otherwise the value is written in place
+     * (and the render state of a component target is refreshed, e.g. for the intensity of a light). Only valid for Custom Tweens.
+     *
+     * @param PropertyPath The name of the property (float or double), with the members of nested structs separated by dots.
+     *
+     * @return True if the property was found and can hold the value of the Tween.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Bind Property Path Custom Set"), Category = "Tween|Utils|Float")
+    bool BindProperty(const FString& PropertyPath);
+
     /*
      **************************************************************************
      * Methods used internally. Should not be called.
@@ -119,6 +181,45 @@ public:
         return mTweenType;
     }
 
+    /**
+     * @brief Overridden from UBaseTween.
+     */
+    virtual bool IsUpdateEventBound() const override;
+    virtual bool IsEndEventBound() const override;
+    virtual bool IsHitEventBound() const override;
+
+    /**
+     * @brief Overridden from UBaseTween. The target is moved with sweeps whenever hit/overlap functions are bound, unless the collision mode is
+     *        "OverlapOnly" or "AsyncSweep" (whose moves are never swept, the query being issued afterwards).
+     */
+    virtual bool IsSweeping() const override
+    {
+        return    bHasBoundedFunctions
+               && mCollisionMode != ETweenCollisionMode::OverlapOnly
+               && mCollisionMode != ETweenCollisionMode::AsyncSweep;
+    }
+
+    /**
+     * @brief Overridden from UBaseTween. Any float Tween can be driven by a spring.
+     */
+    virtual bool SupportsSpring() const override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Overridden from UBaseTween. A hundredth of a degree or centimeter for the angles and the splines, a thousandth for the others
+     *        (e.g. an opacity or a material parameter).
+     */
+    virtual float GetDefaultSpringSettleThreshold() const override
+    {
+        return    mTweenType == ETweenFloatType::RotateAroundPoint
+               || mTweenType == ETweenFloatType::FollowSpline
+               || mTweenType == ETweenFloatType::WidgetAngleTo
+               ? 0.01f
+               : 0.001f;
+    }
+
     /*
      **************************************************************************
      * Blueprint delegates
@@ -232,6 +333,8 @@ protected:
     // Begin of UBaseTween interface
     virtual bool Update(float pDeltaTime, float pTimeScale) override;
     virtual void Restart(bool pRestartFromEnd) override;
+    virtual void SaveLoopStart() override;
+    virtual void RestoreLoopStart() override;
     virtual void Invert(bool pShouldInvertElapsedTime = true) override;
     virtual void PrepareTween() override;
     virtual void PositionAt(bool pBeginning) override;
@@ -244,6 +347,15 @@ protected:
     virtual void OnTweenDeletedInternal() override;
     // End of UBaseTween interface
 
+    /**
+     * @brief Advances the spring driving the Tween and moves the current value accordingly.
+     *
+     * @param pDeltaTime The time passed since the last update (in seconds).
+     *
+     * @return True if the value has settled on the ending value.
+     */
+    bool UpdateSpring(float pDeltaTime);
+
     /*
      **************************************************************************
      * Helper methods for updating individual classes
@@ -257,6 +369,20 @@ protected:
      */
     void UpdateForMaterial(UMaterialInstanceDynamic *pTarget);
 
+    /**
+     * @brief Updates the current value for a material parameter collection Tween.
+     *
+     * @param pTarget The instance of the target collection (can be null).
+     */
+    void UpdateForParameterCollection(UMaterialParameterCollectionInstance *pTarget);
+
+    /**
+     * @brief Updates the current value for a custom primitive data Tween.
+     *
+     * @param pTarget The target of the Tween.
+     */
+    void UpdateForCustomPrimitiveData(UPrimitiveComponent *pTarget);
+
     /**
      * @brief Updates the current value for an Actor Tween.
      *
@@ -280,12 +406,34 @@ protected:
 
     
     /**
-     * @brief Checks whether a spline point has been reached. Only meaningful for the
+     * @brief Checks whether spline points have been crossed since the last update, and notifies each of them. Only meaningful for the
      *        "FollowSpline" Tween and if the corresponding delegate is bound.
-     *        
-     * @param WorldPosition Position to check.
      */
-    void CheckSplinePointReached(const FVector& WorldPosition);
+    void CheckSplinePointReached();
+
+    /**
+     * @brief Returns the spline input key matching the given spline time. Only meaningful for the "FollowSpline" Tween.
+     *
+     * @param pTime The time along the spline (between 0 and its duration).
+     */
+    float GetSplineInputKeyAtTime(float pTime) const;
+
+    /**
+     * @brief Computes the location at the current angle, for the "RotateAroundPoint" Tween, and moves the additional orbiters as well.
+     *
+     * @return The new location of the target.
+     */
+    FVector UpdateAroundPoint();
+
+    /**
+     * @brief Computes, in a single evaluation, the world transform at the current point of the spline, reading it from the spline cache
+     *        when there is one. Only meaningful for the "FollowSpline" Tween.
+     *
+     * @param pCurrentTransform The current world transform of the target, whose rotation and scale are kept if they're not to be applied.
+     *
+     * @return The new world transform of the target.
+     */
+    FTransform ComputeSplineTransform(const FTransform& pCurrentTransform);
 
     /*
      **************************************************************************
@@ -355,12 +503,21 @@ protected:
     /// @brief Starting value.
     float mFrom;
 
+    /// @brief The starting value of the current loop before it was retargeted (see RetargetClock()).
+    float mLoopFrom;
+
     /// @brief Ending value.
     float mTo;
 
     /// @brief Previous value.
     float mPreviousValue;
 
+    /// @brief Velocity of the current value, while the Tween is driven by a spring.
+    float mSpringVelocity;
+
+    /// @brief Property of the target written at each update, for Custom Tweens bound with BindProperty().
+    FTweenPropertyBinding mPropertyBinding;
+
     /// @brief If true, the Tween will be deleted if the tween target hits something. Only valid of specific objects and specific tween types.
     bool bDeleteTweenOnHit;
 
@@ -373,9 +530,9 @@ protected:
     /// @brief Name of the material parameter. It's only valid if the Tween's type deals with materials.
     FName mParameterName;
 
-    /// @brief Offset vector, used for the "RotateAround" type of Tween.
-    FVector mOffsetVector;
-    
+    /// @brief Index of the material parameter in the target material, resolved when the Tween is prepared (INDEX_NONE if not resolved).
+    int32 mParameterIndex;
+
     /// @brief Pivot point, used for the "RotateAround" type of Tween.
     FVector mPivotPoint;
 
@@ -388,8 +545,23 @@ protected:
     /// @brief Space where to apply the computations (either world or relative), used for the "RotateAround" type of Tween.
     ETweenSpace mTweenSpace;
 
-    /// @brief Keeps track of the next point of the spline (meaningful only when the relativee delegate is bound), used for the "FollowSpline" type of Tween.
-    int mNextPointIndex; 
+    /// @brief Angle at which the target was in its initial location, used for the "RotateAround" type of Tween.
+    float mOrbitReferenceAngle;
+
+    /// @brief Center of the circle described by the target, used for the "RotateAround" type of Tween.
+    FVector mOrbitCenter;
+
+    /// @brief Offset from the center at the reference angle, used for the "RotateAround" type of Tween.
+    FVector mOrbitAxisU;
+
+    /// @brief Offset from the center at 90 degrees past the reference angle, used for the "RotateAround" type of Tween.
+    FVector mOrbitAxisV;
+
+    /// @brief Additional components moved along with the target, used for the "RotateAround" type of Tween.
+    TArray<FTweenOrbiter> mOrbiters;
+
+    /// @brief Input key of the spline at the previous update (negative until the first update), used to detect the crossed points in the "FollowSpline" type of Tween.
+    float mPreviousSplineInputKey;
 
     /// @brief Spline component, used for the "FollowSpline" type of Tween.
     UPROPERTY()
@@ -403,4 +575,7 @@ protected:
 
     /// @brief Whether to use a constant speed for the animation, used for the "FollowSpline" type of Tween.
     bool bUseConstantSpeed;
+
+    /// @brief Samples of the spline shared with the other Tweens following it (null if caching is disabled), used for the "FollowSpline" type of Tween.
+    TSharedPtr<FTweenSplineCache> mSplineCache;
 };
@@ -9,6 +9,8 @@
 
 class UTweenLinearColorLatentFactory;
 class UMaterialInstanceDynamic;
+class UMaterialParameterCollectionInstance;
+class UPrimitiveComponent;
 
 /**
  * The UTweenLinearColor handles the update of all Tweens that use only FLinearColor.
@@ -18,6 +20,8 @@ class TWEENMAKER_API UTweenLinearColor : public UBaseTween
 {
     GENERATED_BODY()
 
+    friend class FTweenRecorder;
+
 public:
 
     /**
@@ -42,6 +46,19 @@ public:
         return CurrentValue;
     }
 
+    /**
+     * Changes the ending value of the Tween while it's running, e.g. when a warning light must switch to another color.
+     * The Tween starts over from its current value, so there is no jump, and the same Tween (with its container and latent node)
+     * keeps going instead of being deleted and created again. If the Tween hasn't started yet, only its ending value changes.
+     * Spring Tweens (see "SetSpring") keep their velocity and just head to the new value, which can be changed at each frame to follow
+     * a moving target; a spring at rest starts moving again.
+     *
+     * @param NewTo The new ending value.
+     * @param NewDuration The time to reach the new ending value. If negative, the Tween keeps the time it had left.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Retarget Set To Change End Value Spring Follow"), Category = "Tween|Utils|LinearColor")
+    void Retarget(FLinearColor NewTo, float NewDuration = -1.0f);
+
     /*
      **************************************************************************
      * Methods used internally. Should not be called.
@@ -73,6 +90,28 @@ public:
         return mTweenType;
     }
 
+    /**
+     * @brief Overridden from UBaseTween.
+     */
+    virtual bool IsUpdateEventBound() const override;
+    virtual bool IsEndEventBound() const override;
+
+    /**
+     * @brief Overridden from UBaseTween. Any LinearColor Tween can be driven by a spring (the four channels share it).
+     */
+    virtual bool SupportsSpring() const override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Overridden from UBaseTween. A thousandth of a channel, which is below the step of an 8 bit color.
+     */
+    virtual float GetDefaultSpringSettleThreshold() const override
+    {
+        return 0.001f;
+    }
+
     /*
      **************************************************************************
      * Blueprint delegates
@@ -111,6 +150,8 @@ protected:
     // Begin of UBaseTween interface
     virtual bool Update(float pDeltaTime, float pTimeScale) override;
     virtual void Restart(bool pRestartFromEnd) override;
+    virtual void SaveLoopStart() override;
+    virtual void RestoreLoopStart() override;
     virtual void Invert(bool pShouldInvertElapsedTime = true) override;
   virtual void PrepareTween() override;
     virtual void PositionAt(bool pBeginning) override;
@@ -122,6 +163,15 @@ protected:
     virtual void OnTweenDeletedInternal() override;
     // End of UBaseTween interface
 
+    /**
+     * @brief Advances the spring driving the Tween and moves the current value accordingly.
+     *
+     * @param pDeltaTime The time passed since the last update (in seconds).
+     *
+     * @return True if the value has settled on the ending value.
+     */
+    bool UpdateSpring(float pDeltaTime);
+
     /*
      **************************************************************************
      * Helper methods for updating individual classes
@@ -130,6 +180,10 @@ protected:
 
     void UpdateForMaterial(UMaterialInstanceDynamic *pTarget);
 
+    void UpdateForParameterCollection(UMaterialParameterCollectionInstance *pTarget);
+
+    void UpdateForCustomPrimitiveData(UPrimitiveComponent *pTarget);
+
     
     /// @brief Type of this Tween.
     ETweenLinearColorType mTweenType;
@@ -141,12 +195,18 @@ protected:
     /// @brief Name of the material parameter to tween.
     FName mParameterName;
 
+    /// @brief Index of the material parameter in the target material, resolved when the Tween is prepared (INDEX_NONE if not resolved).
+    int32 mParameterIndex;
+
     /// @brief Current value of the Tween.
     FLinearColor CurrentValue;
 
     /// @brief Starting value.
     FLinearColor From;
 
+    /// @brief The starting value of the current loop before it was retargeted (see RetargetClock()).
+    FLinearColor mLoopFrom;
+
     /// @brief Ending value.
     FLinearColor To;
 
@@ -158,4 +218,7 @@ protected:
 
     /// @brief Current value, as a vector (helper variable).
     FVector CurrentValueVector;
+
+    /// @brief Velocity of the current value, while the Tween is driven by a spring.
+    FLinearColor mSpringVelocity;
 };
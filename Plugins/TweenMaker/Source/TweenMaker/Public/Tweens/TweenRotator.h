@@ -19,6 +19,8 @@ class TWEENMAKER_API UTweenRotator : public UBaseTween
 {
     GENERATED_BODY()
 
+    friend class FTweenRecorder;
+
 public:
     
     /**
@@ -43,6 +45,31 @@ public:
         return mCurrentValue.Rotator();
     }
 
+    /**
+     * Makes more components rotate to the ending rotation of this "RotateTo" Tween, each one starting from its own rotation.
+     * The whole group shares the Tween's easing, which is evaluated only once per update, and with the "ShortestPathFast" rotation mode
+     * the rotations of the group are interpolated four at a time, which is much cheaper than one Tween per component (e.g. for many turrets).
+     * The added components are only rotated (they ignore hit/overlap events). It must be called before the Tween starts.
+     *
+     * @param Members The components to add.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Rotate To Group Batch"), Category = "Tween|Utils|Rotator")
+    void AddGroupMembers(const TArray<USceneComponent*>& Members);
+
+    /**
+     * Changes the ending value of the Tween while it's running, e.g. when a turret must face a new direction.
+     * The Tween starts over from its current value, so there is no jump, and the same Tween (with its container and latent node)
+     * keeps going instead of being deleted and created again. If the Tween hasn't started yet, only its ending value changes.
+     * Spring Tweens (see "SetSpring") keep their velocity and just head to the new value, which can be changed at each frame to follow
+     * a moving target; a spring at rest starts moving again.
+     * Only "RotateTo" Tweens can be retargeted; the members of the group start over from their current rotation too.
+     *
+     * @param NewTo The new ending value.
+     * @param NewDuration The time to reach the new ending value. If negative, the Tween keeps the time it had left.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Retarget Set To Change End Value Spring Follow"), Category = "Tween|Utils|Rotator")
+    void Retarget(FRotator NewTo, float NewDuration = -1.0f);
+
     /*
      **************************************************************************
      * Methods used internally. Should not be called.
@@ -72,6 +99,16 @@ public:
               bool pDeleteTweenOnOverlap,
               UTweenRotatorLatentFactory* pTweenLatentProxy);
 
+    /**
+     * @brief Init method for a "LookAtComponent" type of TweenRotator (internal usage only), to call after Init().
+     *        The destination is read again at each update, so the Tween keeps facing the destination even while it moves.
+     *
+     * @param pDestination The component to look at.
+     * @param pSocketName The socket of the component to look at. If none, the component itself is used.
+     * @param pOffset Offset from the destination (or its socket), in its own space.
+     */
+    void InitDestination(USceneComponent* pDestination, FName pSocketName, const FVector& pOffset);
+
     /**
      * @brief Retrieves the Tween type.
      *
@@ -82,6 +119,30 @@ public:
         return mTweenType;
     }
 
+    /**
+     * @brief Overridden from UBaseTween.
+     */
+    virtual bool IsUpdateEventBound() const override;
+    virtual bool IsEndEventBound() const override;
+    virtual bool IsHitEventBound() const override;
+
+    /**
+     * @brief Overridden from UBaseTween. Only "RotateTo" and "LookAtComponent" Tweens can be driven by a spring, which then takes the
+     *        shortest path. The members added with AddGroupMembers() are not moved by the spring.
+     */
+    virtual bool SupportsSpring() const override
+    {
+        return mTweenType == ETweenRotatorType::RotateTo || mTweenType == ETweenRotatorType::LookAtComponent;
+    }
+
+    /**
+     * @brief Overridden from UBaseTween. The spring works on radians: this is about three hundredths of a degree.
+     */
+    virtual float GetDefaultSpringSettleThreshold() const override
+    {
+        return 0.0005f;
+    }
+
     /*
      **************************************************************************
      * Blueprint delegates
@@ -181,6 +242,8 @@ protected:
     // Begin of UBaseTween interface
     virtual bool Update(float pDeltaTime, float pTimeScale) override;
     virtual void Restart(bool pRestartFromEnd) override;
+    virtual void SaveLoopStart() override;
+    virtual void RestoreLoopStart() override;
     virtual void Invert(bool pShouldInvertElapsedTime = true) override;
     virtual void PrepareTween() override;
     virtual void PositionAt(bool pBeginning) override;
@@ -192,6 +255,21 @@ protected:
     virtual void OnTweenResumedInternal() override;
     virtual void OnTweenDeletedInternal() override;
     // End of UBaseTween interface
+
+    /**
+     * @brief Advances the spring driving the Tween and moves the current value accordingly.
+     *
+     * @param pDeltaTime The time passed since the last update (in seconds).
+     *
+     * @return True if the value has settled on the ending value.
+     */
+    bool UpdateSpring(float pDeltaTime);
+
+    /**
+     * @brief Computes the rotation that faces the current location of the destination and updates the ending value (or the starting one, while going backward)
+     *        accordingly. If the destination isn't valid anymore (or is too close), the last rotation is kept.
+     */
+    void UpdateDestination();
     
     /*
      **************************************************************************
@@ -214,6 +292,18 @@ protected:
      */
     void UpdateForSceneComponent(USceneComponent* pTarget);
 
+    /**
+     * @brief Updates the current value for an InstancedStaticMeshComponent instance Tween.
+     */
+    void UpdateForInstance();
+
+    /**
+     * @brief Rotates the additional group members of a "RotateTo" Tween.
+     *
+     * @param pAlpha The interpolation alpha of the Tween (between 0 and 1).
+     */
+    void UpdateGroupMembers(float pAlpha);
+
     /*
      **************************************************************************
      * Helper methods for binding/unbinding hit and overlap delegates
@@ -272,6 +362,18 @@ protected:
     /// @brief Starting value.
     FQuat mFrom;
 
+    /// @brief The starting value of the current loop before it was retargeted (see RetargetClock()).
+    FQuat mLoopFrom;
+
+    /// @brief The starting value of the current loop before it was retargeted, as FRotator.
+    FRotator mLoopFromRotator;
+
+    /// @brief The starting rotations of the group members before the current loop was retargeted.
+    TArray<FQuat> mLoopGroupFrom;
+
+    /// @brief The direction of the group members before the current loop was retargeted.
+    bool bLoopGroupReversed;
+
     /// @brief Ending value.
     FQuat mTo;
 
@@ -281,9 +383,42 @@ protected:
     /// @brief Ending value as FRotator.
     FRotator mToRotator;
 
+    /// @brief Angular velocity of the current value (as an axis scaled by the speed in radians per second), while the Tween is driven by a spring.
+    FVector mSpringVelocity;
+
     /// @brief Offset used to for relative Tweens (i.e. MoveBy, ScaleBy).
     FQuat mBaseOffset;
 
+    /// @brief Axis of the "RotateBy" rotation when it happens around a single axis (zero otherwise), so that it can be computed as an axis-angle.
+    FVector mRotateByAxis;
+
+    /// @brief Additional components rotated along with the target, used for the "RotateTo" type of Tween.
+    TArray<TWeakObjectPtr<USceneComponent>> mGroupMembers;
+
+    /// @brief Starting rotations of the group members.
+    TArray<FQuat> mGroupFrom;
+
+    /// @brief Current rotations of the group members.
+    TArray<FQuat> mGroupCurrent;
+
+    /// @brief Ending rotation of the group members (i.e. the ending value before any inversion).
+    FQuat mGroupTo;
+
+    /// @brief Whether the Tween is currently going from its ending value to its starting one (e.g. in the second half of a yoyo loop).
+    bool bIsGroupReversed;
+
+    /// @brief The component the Tween makes the target look at, used for the "LookAtComponent" type of Tween.
+    TWeakObjectPtr<USceneComponent> mDestination;
+
+    /// @brief The socket of the destination to use. If none, the destination itself is used.
+    FName mDestinationSocket;
+
+    /// @brief Offset from the destination (or its socket), in its own space.
+    FVector mDestinationOffset;
+
+    /// @brief Whether the Tween is currently going from facing the destination to its starting value (e.g. in the second half of a yoyo loop).
+    bool bIsDestinationReversed;
+
     /// @brief Defines in which space the Tween makes its update (i.e. 'world' or 'relative').
     ETweenSpace mTweenSpace;
 
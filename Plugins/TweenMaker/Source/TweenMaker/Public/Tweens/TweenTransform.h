@@ -0,0 +1,296 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tweens/BaseTween.h"
+#include "TweenManagerComponent.h"
+#include "Engine/HitResult.h"
+#include "TweenTransform.generated.h"
+
+class UTweenTransformLatentFactory;
+
+/**
+ * The UTweenTransform handles the update of all Tweens that use a whole FTransform.
+ * Location, rotation and scale share the same clock and the same easing, which is evaluated only once per update, and the target is
+ * moved with a single transform update instead of the three a Move, a Rotate and a Scale Tween joined together would need.
+ */
+UCLASS(BlueprintType)
+class TWEENMAKER_API UTweenTransform : public UBaseTween
+{
+    GENERATED_BODY()
+
+    friend class FTweenRecorder;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    UTweenTransform(const FObjectInitializer& ObjectInitializer);
+
+    /*
+     **************************************************************************
+     * "Tween Info" methods
+     **************************************************************************
+     */
+
+    /**
+      * Returns the current value of the Tween.
+      *
+      * @return The current value.
+      */
+    UFUNCTION(BlueprintPure, meta = (KeyWords="Tween Current Value Info"), Category = "Tween|Info|Transform")
+    FTransform GetCurrentValue() const
+    {
+        return mCurrentValue;
+    }
+
+    /*
+     **************************************************************************
+     * Methods used internally. Should not be called.
+     **************************************************************************
+     */
+
+    /**
+     * @brief Init method for a generic TweenTransform (internal usage only).
+     *
+     * @param pTo Ending value for the Tween.
+     * @param pTweenType The Tween type.
+     * @param pTweenSpace The space where the update takes place (i.e. world or local).
+     * @param pRotationMode The rotation mode to use.
+     * @param pDeleteTweenOnHit If true, the Tween is deleted when an object hits something.
+     * @param pDeleteTweenOnOverlap If true, the Tween is deleted when an object overlaps something.
+     * @param pTweenLatentProxy Proxy for latent Tweens. It's only valid if it's a Latent tween, otherwise it's null.
+     */
+    void Init(const FTransform& pTo,
+              ETweenTransformType pTweenType,
+              ETweenSpace pTweenSpace,
+              ETweenRotationMode pRotationMode,
+              bool pDeleteTweenOnHit,
+              bool pDeleteTweenOnOverlap,
+              UTweenTransformLatentFactory* pTweenLatentProxy);
+
+    /**
+     * @brief Retrieves the Tween type.
+     *
+     * @return The Tween type.
+     */
+    ETweenTransformType GetTweenType() const
+    {
+        return mTweenType;
+    }
+
+    /**
+     * @brief Overridden from UBaseTween.
+     */
+    virtual bool IsUpdateEventBound() const override;
+    virtual bool IsEndEventBound() const override;
+    virtual bool IsHitEventBound() const override;
+
+    /**
+     * @brief Overridden from UBaseTween. The target is moved with sweeps whenever hit/overlap functions are bound, unless the collision mode is
+     *        "OverlapOnly" or "AsyncSweep" (whose moves are never swept, the query being issued afterwards).
+     */
+    virtual bool IsSweeping() const override
+    {
+        return    bHasBoundedFunctions
+               && mCollisionMode != ETweenCollisionMode::OverlapOnly
+               && mCollisionMode != ETweenCollisionMode::AsyncSweep;
+    }
+
+    /*
+     **************************************************************************
+     * Blueprint delegates
+     **************************************************************************
+     */
+
+    /// @brief Delegate called when the Tween starts (if it loops then it's called at each loop begin). Use only in Blueprints.
+    UPROPERTY(BlueprintAssignable)
+    FBP_OnTweenTransformChange OnTweenStart;
+
+    /// @brief Delegate called at each Tween's update. Use only in Blueprints.
+    UPROPERTY(BlueprintAssignable)
+    FBP_OnTweenTransformChange OnTweenUpdate;
+
+    /// @brief Delegate called when the Tween ends (if it loops then it's called at each loop end). Use only in Blueprints.
+    UPROPERTY(BlueprintAssignable)
+    FBP_OnTweenTransformChange OnTweenEnd;
+
+    /**
+     * @brief Delegate called when the Actor tween target is hit by something during the Tween's execution. Only valid if the TweenTarget
+     * actually inherits from AActor.
+     * Use only in Blueprints.
+     */
+    UPROPERTY(BlueprintAssignable)
+    FBP_OnTweenActorHitTransform OnTweenActorHit;
+
+    /**
+     * @brief Delegate called when the Actor tween target overlaps something during the Tween's execution. Only valid if the TweenTarget
+     * actually inherits from AActor.
+     * Use only in Blueprints.
+     */
+    UPROPERTY(BlueprintAssignable)
+    FBP_OnTweenActorBeginOverlapTransform OnTweenActorBeginOverlap;
+
+    /**
+     * @brief Delegate called when the PrimitiveComponent tween target is hit by something during the Tween's execution. Only valid if the TweenTarget
+     * actually inherits from UPrimitiveComponent.
+     * Use only in Blueprints.
+     */
+    UPROPERTY(BlueprintAssignable)
+    FBP_OnTweenPrimitiveComponentHitTransform OnTweenPrimitiveComponentHit;
+
+    /**
+     * @brief Delegate called when the PrimitiveComponent tween target overlaps something during the Tween's execution. Only valid if the TweenTarget
+     * actually inherits from UPrimitiveComponent.
+     * Use only in Blueprints.
+     */
+    UPROPERTY(BlueprintAssignable)
+    FBP_OnTweenPrimitiveComponentBeginOverlapTransform OnTweenPrimitiveComponentBeginOverlap;
+
+    /*
+     **************************************************************************
+     * C++ delegates
+     **************************************************************************
+     */
+
+    /// @brief Delegate called when the Tween starts (if it loops then it's called at each loop begin). Use only in C++.
+    FOnTweenTransformChange OnTweenStartDelegate;
+
+    /// @brief Delegate called at each Tween's update. Use only in C++.
+    FOnTweenTransformChange OnTweenUpdateDelegate;
+
+    /// @brief Delegate called when the Tween ends (if it loops then it's called at each loop end). Use only in C++.
+    FOnTweenTransformChange OnTweenEndDelegate;
+
+    /**
+     * @brief Delegate called when the Actor tween target is hit by something during the Tween's execution. Only valid if the TweenTarget
+     * actually inherits from AActor.
+     * Use only in C++.
+     */
+    FOnTweenActorHitTransform OnTweenActorHitDelegate;
+
+    /**
+     * @brief Delegate called when the Actor tween target overlaps something during the Tween's execution. Only valid if the TweenTarget
+     * actually inherits from AActor.
+     * Use only in C++.
+     */
+    FOnTweenActorBeginOverlapTransform OnTweenActorBeginOverlapDelegate;
+
+    /**
+     * @brief Delegate called when the PrimitiveComponent tween target is hit by something during the Tween's execution. Only valid if the TweenTarget
+     * actually inherits from UPrimitiveComponent.
+     * Use only in C++.
+     */
+    FOnTweenPrimitiveComponentHitTransform OnTweenPrimitiveComponentHitDelegate;
+
+    /**
+     * @brief Delegate called when the PrimitiveComponent tween target overlaps something during the Tween's execution. Only valid if the TweenTarget
+     * actually inherits from UPrimitiveComponent.
+     * Use only in C++.
+     */
+    FOnTweenPrimitiveComponentBeginOverlapTransform OnTweenPrimitiveComponentBeginOverlapDelegate;
+
+protected:
+
+    // Begin of UBaseTween interface
+    virtual bool Update(float pDeltaTime, float pTimeScale) override;
+    virtual void Restart(bool pRestartFromEnd) override;
+    virtual void Invert(bool pShouldInvertElapsedTime = true) override;
+    virtual void PrepareTween() override;
+    virtual void PositionAt(bool pBeginning) override;
+    virtual void PreDelay() override;
+    virtual void BroadcastOnTweenStart() override;
+    virtual void BroadcastOnTweenUpdate() override;
+    virtual void BroadcastOnTweenEnd() override;
+    virtual void OnTweenDeletedInternal() override;
+    // End of UBaseTween interface
+
+    /*
+     **************************************************************************
+     * Helper methods for updating individual classes
+     **************************************************************************
+     */
+
+    /**
+     * @brief Applies the current value to the target, with a single transform update.
+     */
+    void ApplyCurrentValue();
+
+    /*
+     **************************************************************************
+     * Helper methods for binding/unbinding hit and overlap delegates
+     **************************************************************************
+     */
+
+    /**
+     * @brief Helper method that bind the appropriate delegates.
+     */
+    void BindDelegates();
+
+    /**
+     * @brief Helper method that unbind all bounded delegates.
+     */
+    void UnbindDelegates();
+
+    /**
+     * @brief Function called when the tween target overlap something (only used if the
+     *        appropriate delegate is bound and the tween target is an actor).
+     */
+    UFUNCTION()
+    void OnActorBeginOverlap(AActor *pThisActor, AActor *pOtherActor);
+
+    /**
+     * @brief Function called when the tween target hits something (only used if the
+     *        appropriate delegate is bound and the tween target is an actor).
+     */
+    UFUNCTION()
+    void OnActorHit(AActor *pThisActor, AActor *pOtherActor, FVector pNormalImpulse, const FHitResult &pHit);
+
+    /**
+     * @brief Function called when the tween target overlap something (only used if the
+     *        appropriate delegate is bound and the tween target is a primitive component).
+     */
+    UFUNCTION()
+    void OnPrimitiveComponentBeginOverlap(UPrimitiveComponent *pThisComponent, AActor *pOtherActor, UPrimitiveComponent *pOtherComp, int32 pOtherBodyIndex, bool bFromSweep, const FHitResult &pSweepResult);
+
+    /**
+     * @brief Function called when the tween target hits something (only used if the
+     *        appropriate delegate is bound and the tween target is a primitive component).
+     */
+    UFUNCTION()
+    void OnPrimitiveComponentHit(UPrimitiveComponent *pThisComponent, AActor *pOtherActor, UPrimitiveComponent *pOtherComp, FVector pNormalImpulse, const FHitResult &pHitResult);
+
+
+    /// @brief Type of this Tween.
+    ETweenTransformType mTweenType;
+
+    /// @brief Proxy for latent Tweens. It's only valid if it's a Latent tween, otherwise it's null.
+    UPROPERTY()
+    UTweenTransformLatentFactory* mTweenLatentProxy;
+
+    /// @brief Current value of the Tween.
+    FTransform mCurrentValue;
+
+    /// @brief Starting value.
+    FTransform mFrom;
+
+    /// @brief Ending value.
+    FTransform mTo;
+
+    /// @brief Defines in which space the Tween makes its update (i.e. 'world' or 'relative').
+    ETweenSpace mTweenSpace;
+
+    /// @brief The rotation mode to use.
+    ETweenRotationMode mRotationMode;
+
+    /// @brief If true, the Tween will be deleted if the tween target hits something. Only valid of specific objects.
+    bool bDeleteTweenOnHit;
+
+    /// @brief If true, the Tween will be deleted if the tween target overlaps something. Only valid of specific objects.
+    bool bDeleteTweenOnOverlap;
+
+    /// @brief True if the Tween has bounded functions to hit/overlap events (either because the bDeleteTweenOnXYZ was selected or a method was bounded).
+    bool bHasBoundedFunctions;
+};
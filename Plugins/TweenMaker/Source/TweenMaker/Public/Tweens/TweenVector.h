@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Tweens/BaseTween.h"
 #include "TweenManagerComponent.h"
+#include "Utils/TweenPropertyBinding.h"
 #include "Engine/HitResult.h"
 #include "TweenVector.generated.h"
 
@@ -19,6 +20,8 @@ class TWEENMAKER_API UTweenVector : public UBaseTween
 {
     GENERATED_BODY()
 
+    friend class FTweenRecorder;
+
 public:
 
     /**
@@ -43,6 +46,33 @@ public:
         return mCurrentValue;
     }
 
+    /**
+     * Changes the ending value of the Tween while it's running, e.g. when the destination of a move changes.
+     * The Tween starts over from its current value, so there is no jump, and the same Tween (with its container and latent node)
+     * keeps going instead of being deleted and created again. If the Tween hasn't started yet, only its ending value changes.
+     * Spring Tweens (see "SetSpring") keep their velocity and just head to the new value, which can be changed at each frame to follow
+     * a moving target; a spring at rest starts moving again.
+     * Bezier Tweens and the ones following a component can't be retargeted.
+     *
+     * @param NewTo The new ending value.
+     * @param NewDuration The time to reach the new ending value. If negative, the Tween keeps the time it had left.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Retarget Set To Change End Value Spring Follow"), Category = "Tween|Utils|Vector")
+    void Retarget(FVector NewTo, float NewDuration = -1.0f);
+
+    /**
+     * Binds the Tween to a property of its target, which is then set directly at each update: there's no need to copy the value in an
+     * "OnTweenUpdate" event. The path is resolved only once, and can go through the members of structs (e.g. "Settings.Offset").
+     * If the property has a native setter it's called, otherwise the value is written in place (and the render state of a component
+     * target is refreshed, e.g. for the intensity of a light). Only valid for Custom Tweens.
+     *
+     * @param PropertyPath The name of the property (FVector or FVector3f), with the members of nested structs separated by dots.
+     *
+     * @return True if the property was found and can hold the value of the Tween.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Bind Property Path Custom Set"), Category = "Tween|Utils|Vector")
+    bool BindProperty(const FString& PropertyPath);
+
     /*
      **************************************************************************
      * Methods used internally. Should not be called.
@@ -68,6 +98,26 @@ public:
               bool pDeleteTweenOnOverlap,
               UTweenVectorLatentFactory* pTweenLatentProxy);
 
+    /**
+     * @brief Init method for a "MoveAlongBezier" type of TweenVector (internal usage only), to call after Init().
+     *        The curve starts at the target's location, ends at the Tween's ending value and is bent by one (quadratic curve)
+     *        or two (cubic curve) control points, in the same space as the Tween.
+     *
+     * @param pControlPoints The control points of the curve.
+     * @param pUseConstantSpeed If true, the curve is travelled at constant speed through a table of its arc lengths.
+     */
+    void InitBezier(const TArray<FVector>& pControlPoints, bool pUseConstantSpeed);
+
+    /**
+     * @brief Init method for a "MoveToComponent" type of TweenVector (internal usage only), to call after Init().
+     *        The destination is read again at each update, so the Tween reaches the destination even while it moves.
+     *
+     * @param pDestination The component to move to.
+     * @param pSocketName The socket of the component to move to. If none, the component itself is used.
+     * @param pOffset Offset from the destination (or its socket), in its own space.
+     */
+    void InitDestination(USceneComponent* pDestination, FName pSocketName, const FVector& pOffset);
+
     /**
      * @brief Retrieves the Tween type.
      *
@@ -78,6 +128,44 @@ public:
         return mTweenType;
     }
 
+    /**
+     * @brief Overridden from UBaseTween.
+     */
+    virtual bool IsUpdateEventBound() const override;
+    virtual bool IsEndEventBound() const override;
+    virtual bool IsHitEventBound() const override;
+
+    /**
+     * @brief Overridden from UBaseTween. The target is moved with sweeps whenever hit/overlap functions are bound, unless the collision mode is
+     *        "OverlapOnly" or "AsyncSweep" (whose moves are never swept, the query being issued afterwards).
+     */
+    virtual bool IsSweeping() const override
+    {
+        return    bHasBoundedFunctions
+               && mCollisionMode != ETweenCollisionMode::OverlapOnly
+               && mCollisionMode != ETweenCollisionMode::AsyncSweep;
+    }
+
+    /**
+     * @brief Overridden from UBaseTween. All types but "MoveAlongBezier" (whose path is fixed by its curve) can be driven by a spring.
+     */
+    virtual bool SupportsSpring() const override
+    {
+        return mTweenType != ETweenVectorType::MoveAlongBezier;
+    }
+
+    /**
+     * @brief Overridden from UBaseTween. A hundredth of a centimeter for the moves, a thousandth for the scales and Custom Tweens.
+     */
+    virtual float GetDefaultSpringSettleThreshold() const override
+    {
+        return    mTweenType == ETweenVectorType::MoveTo
+               || mTweenType == ETweenVectorType::MoveBy
+               || mTweenType == ETweenVectorType::MoveToComponent
+               ? 0.01f
+               : 0.001f;
+    }
+
     /*
      **************************************************************************
      * Blueprint delegates
@@ -179,6 +267,8 @@ protected:
     // Begin of UBaseTween interface
     virtual bool Update(float pDeltaTime, float pTimeScale) override;
     virtual void Restart(bool pRestartFromEnd) override;
+    virtual void SaveLoopStart() override;
+    virtual void RestoreLoopStart() override;
     virtual void Invert(bool pShouldInvertElapsedTime = true) override;
     virtual void PrepareTween() override;
     virtual void PositionAt(bool pBeginning) override;
@@ -191,6 +281,21 @@ protected:
     virtual void OnTweenDeletedInternal() override;
     // End of UBaseTween interface
 
+    /**
+     * @brief Advances the spring driving the Tween and moves the current value accordingly.
+     *
+     * @param pDeltaTime The time passed since the last update (in seconds).
+     *
+     * @return True if the value has settled on the ending value.
+     */
+    bool UpdateSpring(float pDeltaTime);
+
+    /**
+     * @brief Reads the current location of the destination and updates the ending value (or the starting one, while going backward)
+     *        accordingly. If the destination isn't valid anymore, the last value read is kept.
+     */
+    void UpdateDestination();
+
     /*
      **************************************************************************
      * Helper methods for updating individual classes
@@ -211,6 +316,36 @@ protected:
      */
     void UpdateForSceneComponent(USceneComponent* pTarget);
 
+    /**
+     * @brief Updates the current value for an InstancedStaticMeshComponent instance Tween.
+     */
+    void UpdateForInstance();
+
+    /*
+     **************************************************************************
+     * Helper methods for the "MoveAlongBezier" type of Tween
+     **************************************************************************
+     */
+
+    /**
+     * @brief Evaluates the Bezier curve.
+     *
+     * @param pParameter The curve parameter (0 at the start of the curve, 1 at its end).
+     */
+    FVector EvaluateBezier(float pParameter) const;
+
+    /**
+     * @brief Converts a position along the curve to the curve parameter, through the arc length table if present.
+     *
+     * @param pPosition The fraction of the curve's length (between 0 and 1).
+     */
+    float GetBezierParameter(float pPosition) const;
+
+    /**
+     * @brief Fills the arc length table, used when the curve is travelled at constant speed.
+     */
+    void BuildBezierArcLengths();
+
     /*
      **************************************************************************
      * Helper methods for binding/unbinding hit and overlap delegates
@@ -278,12 +413,57 @@ protected:
     /// @brief Starting value.
     FVector mFrom;
 
+    /// @brief The starting value of the current loop before it was retargeted (see RetargetClock()).
+    FVector mLoopFrom;
+
     /// @brief Ending value.
     FVector mTo;
 
     /// @brief Offset used to for relative Tweens (i.e. MoveBy, ScaleBy).
     FVector mBaseOffset;
 
+    /// @brief Velocity of the current value, while the Tween is driven by a spring.
+    FVector mSpringVelocity;
+
+    /// @brief Property of the target written at each update, for Custom Tweens bound with BindProperty().
+    FTweenPropertyBinding mPropertyBinding;
+
+    /// @brief Starting point of the Bezier curve (i.e. the starting value before any inversion).
+    FVector mBezierStart;
+
+    /// @brief First control point of the Bezier curve.
+    FVector mBezierControlPoint1;
+
+    /// @brief Second control point of the Bezier curve (cubic curves only).
+    FVector mBezierControlPoint2;
+
+    /// @brief Ending point of the Bezier curve (i.e. the ending value before any inversion).
+    FVector mBezierEnd;
+
+    /// @brief Whether the Bezier curve is cubic (two control points) or quadratic (one control point).
+    bool bIsCubicBezier;
+
+    /// @brief If true, the Bezier curve is travelled at constant speed.
+    bool bBezierConstantSpeed;
+
+    /// @brief Whether the Tween is currently going from the end of the Bezier curve to its start (e.g. in the second half of a yoyo loop).
+    bool bIsBezierReversed;
+
+    /// @brief Normalized length of the Bezier curve at regularly spaced parameters. Empty if the curve isn't travelled at constant speed.
+    TArray<float> mBezierArcLengths;
+
+    /// @brief The component the Tween is heading to, used for the "MoveToComponent" type of Tween.
+    TWeakObjectPtr<USceneComponent> mDestination;
+
+    /// @brief The socket of the destination to use. If none, the destination itself is used.
+    FName mDestinationSocket;
+
+    /// @brief Offset from the destination (or its socket), in its own space.
+    FVector mDestinationOffset;
+
+    /// @brief Whether the Tween is currently going from the destination to its starting value (e.g. in the second half of a yoyo loop).
+    bool bIsDestinationReversed;
+
     /// @brief Defines in which space the Tween makes its update (i.e. 'world' or 'relative').
     ETweenSpace mTweenSpace;
 
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Tweens/BaseTween.h"
 #include "TweenManagerComponent.h"
+#include "Utils/TweenPropertyBinding.h"
 #include "TweenVector2D.generated.h"
 
 class UTweenVector2DLatentFactory;
@@ -18,6 +19,8 @@ class TWEENMAKER_API UTweenVector2D : public UBaseTween
 {
     GENERATED_BODY()
 
+    friend class FTweenRecorder;
+
 public:
 
     /**
@@ -42,6 +45,30 @@ public:
         return mCurrentValue;
     }
 
+    /**
+     * Changes the ending value of the Tween while it's running, e.g. when a widget must slide to a new position.
+     * The Tween starts over from its current value, so there is no jump, and the same Tween (with its container and latent node)
+     * keeps going instead of being deleted and created again. If the Tween hasn't started yet, only its ending value changes.
+     *
+     * @param NewTo The new ending value.
+     * @param NewDuration The time to reach the new ending value. If negative, the Tween keeps the time it had left.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Retarget Set To Change End Value"), Category = "Tween|Utils|Vector2D")
+    void Retarget(FVector2D NewTo, float NewDuration = -1.0f);
+
+    /**
+     * Binds the Tween to a property of its target, which is then set directly at each update: there's no need to copy the value in an
+     * "OnTweenUpdate" event. The path is resolved only once, and can go through the members of structs (e.g. "Settings.Size").
+     * If the property has a native setter it's called, otherwise the value is written in place (and the render state of a component
+     * target is refreshed, e.g. for the intensity of a light). Only valid for Custom Tweens.
+     *
+     * @param PropertyPath The name of the property (FVector2D or FVector2f), with the members of nested structs separated by dots.
+     *
+     * @return True if the property was found and can hold the value of the Tween.
+     */
+    UFUNCTION(BlueprintCallable, meta = (KeyWords="Tween Bind Property Path Custom Set"), Category = "Tween|Utils|Vector2D")
+    bool BindProperty(const FString& PropertyPath);
+
     /*
      **************************************************************************
      * Methods used internally. Should not be called.
@@ -68,6 +95,12 @@ public:
         return mTweenType;
     }
 
+    /**
+     * @brief Overridden from UBaseTween.
+     */
+    virtual bool IsUpdateEventBound() const override;
+    virtual bool IsEndEventBound() const override;
+
     /*
      **************************************************************************
      * Blueprint delegates
@@ -107,6 +140,8 @@ protected:
     // Begin of UBaseTween interface
     virtual bool Update(float pDeltaTime, float pTimeScale) override;
     virtual void Restart(bool pRestartFromEnd) override;
+    virtual void SaveLoopStart() override;
+    virtual void RestoreLoopStart() override;
     virtual void Invert(bool pShouldInvertElapsedTime = true) override;
     virtual void PrepareTween() override;
     virtual void PositionAt(bool pBeginning) override;
@@ -145,9 +180,15 @@ protected:
     /// @brief Starting value.
     FVector2D mFrom;
 
+    /// @brief The starting value of the current loop before it was retargeted (see RetargetClock()).
+    FVector2D mLoopFrom;
+
     /// @brief Ending value.
     FVector2D mTo;
 
     /// @brief Offset used to for relative Tweens (i.e. MoveBy, ScaleBy).
     FVector2D mBaseOffset;
+
+    /// @brief Property of the target written at each update, for Custom Tweens bound with BindProperty().
+    FTweenPropertyBinding mPropertyBinding;
 };
@@ -0,0 +1,108 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "CoreMinimal.h"
+#include "GameplayDebuggerCategory.h"
+
+class AActor;
+class APlayerController;
+class UBaseTween;
+class UTweenContainer;
+class UTweenManagerComponent;
+
+/**
+ * @brief Gameplay Debugger category that shows the live state of the TweenMaker: the active TweenContainers (with their sequence index,
+ *        loop counter and per-frame cost) of the selected actor and of the whole world, the Tweens of the selected actor's TweenContainers
+ *        (progress, ease, target and whether they sweep), and the paths of the active "RotateAround" and "FollowSpline" Tweens.
+ *
+ *        While the category is active, the inspected TweenManagers measure the time spent by each TweenContainer.
+ */
+class FGameplayDebuggerCategory_TweenMaker : public FGameplayDebuggerCategory
+{
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    FGameplayDebuggerCategory_TweenMaker();
+
+    /**
+     * @brief Creates an instance of this category, used when registering it.
+     */
+    static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
+
+    // Begin of FGameplayDebuggerCategory interface
+    virtual void CollectData(APlayerController* OwnerPC, AActor* DebugActor) override;
+    virtual void DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext) override;
+    // End of FGameplayDebuggerCategory interface
+
+private:
+
+    /**
+     * @brief Adds the data of a TweenContainer to the data pack.
+     *
+     * @param pTweenContainer The TweenContainer.
+     * @param pDebugActor The actor selected in the Gameplay Debugger (can be null).
+     */
+    void CollectContainerData(const UTweenContainer* pTweenContainer, const AActor* pDebugActor);
+
+    /**
+     * @brief Adds the shapes that draw the path of the given Tween, if it's a "RotateAround" or a "FollowSpline" one.
+     */
+    void AddTweenPathShapes(const UBaseTween* pTween);
+
+    /**
+     * @brief Returns a one-line description of the given Tween.
+     */
+    static FString DescribeTween(const UBaseTween* pTween);
+
+    /**
+     * @brief Returns true if the given Tween animates the given actor or one of its components.
+     */
+    static bool IsTweenTargetingActor(const UBaseTween* pTween, const AActor* pActor);
+
+    /**
+     * @brief Data replicated to the client that draws the category.
+     */
+    struct FRepData
+    {
+        struct FContainerData
+        {
+            FContainerData();
+
+            /// @brief One-line description of the TweenContainer.
+            FString Description;
+
+            /// @brief Time spent by the last update of the TweenContainer (in milliseconds).
+            float CostMs;
+
+            /// @brief True if the TweenContainer belongs to, or animates, the selected actor.
+            bool bIsSelected;
+
+            /// @brief Descriptions of the Tweens, only filled for the selected TweenContainers.
+            TArray<FString> Tweens;
+        };
+
+        FRepData();
+
+        void Serialize(FArchive& Ar);
+
+        int32 NumManagers;
+        int32 NumContainers;
+        int32 NumTweens;
+        float TotalCostMs;
+        float FlushCostMs;
+        TArray<FContainerData> Containers;
+    };
+
+    /// @brief The replicated data.
+    FRepData DataPack;
+
+    /// @brief Number of path shapes added during the current collection.
+    int32 mNumPathShapes;
+};
+
+#endif // WITH_GAMEPLAY_DEBUGGER
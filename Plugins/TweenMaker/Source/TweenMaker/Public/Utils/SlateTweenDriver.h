@@ -0,0 +1,215 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Utils/TweenEnums.h"
+
+class SWidget;
+struct FWidgetTransform;
+
+/**
+ * @brief Executed when a Tween of the FSlateTweenDriver ends. The parameters are the value the Tween ended with and the whole render
+ *        transform the driver wrote in the widget on that tick (which includes the values of the other Tweens still animating it).
+ */
+DECLARE_DELEGATE_TwoParams(FOnSlateTweenEnd, const FVector2D&, const FWidgetTransform&);
+
+/**
+ * @brief The render properties of a Slate widget that the FSlateTweenDriver can animate.
+ *        Float properties (angle and opacity) only use the X component of the values.
+ */
+enum class ESlateTweenProperty : uint8
+{
+    Translation,
+    Scale,
+    Shear,
+    Angle,
+    Opacity
+};
+
+/**
+ * @brief The FSlateTweenDriver class animates the render transform and the opacity of Slate widgets directly, from the core ticker.
+ *        Unlike the Tweens handled by a UTweenManagerComponent, its Tweens don't need an actor, aren't UObjects and keep running
+ *        while the game is paused (the core ticker uses the real time), which makes them a cheap choice for menus.
+ *        They use the same easing equations as the other Tweens.
+ *
+ *        The driver owns the render transform of the widgets it animates: each widget receives at most one render transform and one
+ *        opacity change per tick, however many Tweens animate it. The ticker is only registered while there are Tweens to update.
+ */
+class TWEENMAKER_API FSlateTweenDriver
+{
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    FSlateTweenDriver();
+
+    /**
+     * @brief Destructor.
+     */
+    ~FSlateTweenDriver();
+
+    /**
+     * @brief Returns the driver, creating it if needed.
+     */
+    static FSlateTweenDriver& Get();
+
+    /**
+     * @brief Destroys the driver (and all its Tweens). Called when the module shuts down.
+     */
+    static void Shutdown();
+
+    /**
+     * @brief Adds a Tween that animates a render property of the given widget from its value at the start of the Tween (after the delay)
+     *        to the given one.
+     *
+     * @param pWidget The widget to animate.
+     * @param pProperty The property to animate.
+     * @param pTo The ending value.
+     * @param pDuration The total duration of the Tween (in seconds).
+     * @param pEaseType The easing function to apply.
+     * @param pNumLoops The number of times the Tween should repeat. If <= 0, it will loop indefinitely.
+     * @param pLoopType The type of loop to apply (if "yoyo", it will go backwards when it reached the end; otherwise it will reset).
+     * @param pDelay The initial delay to apply to the Tween (in seconds).
+     * @param pOnTweenEnd (optional) Executed when the Tween ends, i.e. after its last loop.
+     *
+     * @return The id of the Tween, that can be used to stop it.
+     */
+    int32 AddTween(const TSharedRef<SWidget>& pWidget,
+                   ESlateTweenProperty pProperty,
+                   const FVector2D& pTo,
+                   float pDuration,
+                   ETweenEaseType pEaseType     = ETweenEaseType::Linear,
+                   int32 pNumLoops              = 1,
+                   ETweenLoopType pLoopType     = ETweenLoopType::Yoyo,
+                   float pDelay                 = 0.0f,
+                   FOnSlateTweenEnd pOnTweenEnd = FOnSlateTweenEnd());
+
+    /**
+     * @brief Sets the render transform the Tweens on the given widget start from. Slate only stores the resulting matrix, so for a widget
+     *        that is not being animated the driver only knows its translation: scale, shear and angle are assumed to be the identity ones,
+     *        unless they're set with this method. It has no effect on a widget that is already being animated.
+     *
+     * @param pWidget The widget.
+     * @param pTranslation The current translation.
+     * @param pScale The current scale.
+     * @param pShear The current shear.
+     * @param pAngle The current angle (in degrees).
+     */
+    void SetInitialRenderTransform(const TSharedRef<SWidget>& pWidget,
+                                   const FVector2D& pTranslation,
+                                   const FVector2D& pScale,
+                                   const FVector2D& pShear,
+                                   float pAngle);
+
+    /**
+     * @brief Stops the given Tween.
+     *
+     * @param pTweenId The id returned by AddTween.
+     * @param pShouldJumpToEnd If true, the Tween will apply its ending value (on the next tick) and execute its OnTweenEnd.
+     */
+    void StopTween(int32 pTweenId, bool pShouldJumpToEnd = false);
+
+    /**
+     * @brief Stops all the Tweens animating the given widget.
+     *
+     * @param pWidget The widget.
+     * @param pShouldJumpToEnd If true, the Tweens will apply their ending values (on the next tick) and execute their OnTweenEnd.
+     */
+    void StopWidgetTweens(const TSharedRef<SWidget>& pWidget, bool pShouldJumpToEnd = false);
+
+    /**
+     * @brief Returns the number of Tweens currently handled by the driver.
+     */
+    int32 GetNumTweens() const
+    {
+        return mTweens.Num();
+    }
+
+private:
+
+    /**
+     * @brief A Tween handled by the driver.
+     */
+    struct FSlateTween
+    {
+        int32 Id;
+        TWeakPtr<SWidget> Widget;
+        ESlateTweenProperty Property;
+        FVector2D From;
+        FVector2D To;
+        float Duration;
+        float Delay;
+        float ElapsedTime;
+        ETweenEaseType EaseType;
+        int32 NumLoops;
+        int32 LoopsDone;
+        ETweenLoopType LoopType;
+        FOnSlateTweenEnd OnTweenEnd;
+
+        /// @brief True once the delay has elapsed and the starting value has been read.
+        bool bHasStarted;
+
+        /// @brief True if the Tween has been stopped and must be removed on the next tick.
+        bool bIsStopped;
+
+        /// @brief True if the Tween has been stopped and must apply its ending value before being removed.
+        bool bShouldJumpToEnd;
+    };
+
+    /**
+     * @brief The render properties of an animated widget, written in the widget at the end of each tick.
+     */
+    struct FSlateWidgetState
+    {
+        FVector2D Translation;
+        FVector2D Scale;
+        FVector2D Shear;
+        float Angle;
+        float Opacity;
+        bool bTransformChanged;
+        bool bOpacityChanged;
+    };
+
+    /**
+     * @brief Updates all the Tweens and writes the changed properties in their widgets.
+     *
+     * @param pDeltaTime The real time elapsed since the last tick.
+     *
+     * @return False when there are no more Tweens, which unregisters the ticker.
+     */
+    bool Tick(float pDeltaTime);
+
+    /**
+     * @brief Returns the state of the given widget, reading it from the widget if it isn't being animated yet (its render transform is
+     *        split back into translation, scale, shear and angle).
+     */
+    FSlateWidgetState& FindOrAddWidgetState(const TSharedRef<SWidget>& pWidget);
+
+    /**
+     * @brief Returns the current value of the given property.
+     */
+    static FVector2D GetPropertyValue(const FSlateWidgetState& pState, ESlateTweenProperty pProperty);
+
+    /**
+     * @brief Changes the value of the given property, flagging it as changed if it's different.
+     */
+    static void SetPropertyValue(FSlateWidgetState& pState, ESlateTweenProperty pProperty, const FVector2D& pValue);
+
+    /// @brief The Tweens, in creation order.
+    TArray<FSlateTween> mTweens;
+
+    /// @brief The state of the widgets animated by at least one Tween.
+    TMap<TWeakPtr<SWidget>, FSlateWidgetState> mWidgetStates;
+
+    /// @brief The handle of the core ticker delegate. Valid only while there are Tweens.
+    FTSTicker::FDelegateHandle mTickerHandle;
+
+    /// @brief The id given to the next Tween.
+    int32 mNextTweenId;
+
+    /// @brief The driver instance.
+    static TUniquePtr<FSlateTweenDriver> sInstance;
+};
@@ -0,0 +1,293 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "Utils/TweenEnums.h"
+
+class UTweenManagerComponent;
+class UTweenContainer;
+class UBaseTween;
+class USceneComponent;
+class USplineComponent;
+class UWidget;
+
+/// @brief Number of dummy scene components (and of dummy widgets) shared by the Tweens of a harness program.
+#define TWEEN_HARNESS_NUM_TARGETS 4
+
+/**
+ * @brief Kinds of Tweens created by the differential harness.
+ */
+enum class ETweenHarnessTweenKind : uint8
+{
+    CustomFloat,
+    CustomVector,
+    CustomVector2D,
+    RotateTo,
+    MoveBy,
+    RotateAroundPoint,
+    FollowSpline,
+    WidgetMoveTo,
+    WidgetAngleTo
+};
+
+/**
+ * @brief Steps of a differential harness program.
+ */
+enum class ETweenHarnessStepType : uint8
+{
+    CreateContainer,
+    AddTween,
+    Frame,
+    SetTimeScale,
+    Restart,
+    Pause,
+    Resume,
+    Delete
+};
+
+/**
+ * @brief Events written in a differential harness trace.
+ */
+enum class ETweenHarnessEvent : uint8
+{
+    Start,
+    Update,
+    End,
+    TargetLocation,
+    TargetRotation,
+    TargetWidget
+};
+
+/**
+ * @brief Description of a Tween created by a harness program.
+ *        Values of every kind are packed in 4-component vectors (a float only uses X, a FVector2D uses X and Y, a FRotator uses pitch/yaw/roll).
+ *        A "RotateAroundPoint" Tween rotates around From.XYZ, from the angle From.Z to To.Z; a "WidgetAngleTo" one rotates its widget to To.Z.
+ */
+struct TWEENMAKER_API FTweenHarnessTween
+{
+    FTweenHarnessTween();
+
+    ETweenHarnessTweenKind Kind;
+    bool bIsJoin;
+    FVector4f From;
+    FVector4f To;
+    float Duration;
+    ETweenEaseType EaseType;
+    int32 NumLoops;
+    ETweenLoopType LoopType;
+    float Delay;
+    float TimeScale;
+    ETweenRotationMode RotationMode;
+    int32 TargetIndex;
+
+    /// @brief Used by the "FollowSpline" Tweens.
+    bool bUseConstantSpeed;
+
+    /// @brief If true, the first time the Tween ends it appends a new Tween from its end callback (i.e. in the middle of an update).
+    bool bAppendOnEnd;
+};
+
+/**
+ * @brief A single step of a harness program.
+ */
+struct TWEENMAKER_API FTweenHarnessStep
+{
+    FTweenHarnessStep();
+
+    ETweenHarnessStepType Type;
+
+    /// @brief Index (in creation order) of the TweenContainer the step works on. Unused by "CreateContainer" and "Frame".
+    int32 ContainerIndex;
+
+    /// @brief Loop settings of a new TweenContainer.
+    int32 NumLoops;
+    ETweenLoopType LoopType;
+
+    /// @brief The delta time of a frame, or the timescale of a new TweenContainer or of a "SetTimeScale" step.
+    float Value;
+
+    /// @brief The Tween added by an "AddTween" step.
+    FTweenHarnessTween Tween;
+};
+
+/**
+ * @brief A randomized sequence of TweenContainer operations and frames.
+ */
+struct TWEENMAKER_API FTweenHarnessProgram
+{
+    FTweenHarnessProgram();
+
+    /**
+     * @brief Generates a random program. The same seed always generates the same program.
+     *
+     * @param pSeed The seed of the random stream.
+     * @param pNumFrames How many frames the program simulates.
+     */
+    static FTweenHarnessProgram Generate(int32 pSeed, int32 pNumFrames);
+
+    int32 Seed;
+    TArray<FTweenHarnessStep> Steps;
+};
+
+/**
+ * @brief An entry of the trace produced by running a harness program.
+ */
+struct TWEENMAKER_API FTweenHarnessTraceEntry
+{
+    /**
+     * @brief Returns a readable description of the entry.
+     */
+    FString ToString() const;
+
+    int32 Frame;
+    ETweenHarnessEvent Event;
+
+    /// @brief Id of the Tween (in creation order), or index of the target for the "Target*" events.
+    int32 Id;
+
+    FVector4f Value;
+};
+
+/**
+ * @brief An alternate update backend. Enabling it must switch the TweenMaker to the code path under test, disabling it must restore the reference one.
+ */
+struct TWEENMAKER_API FTweenHarnessBackend
+{
+    /**
+     * @brief Builds a backend that is enabled by setting the given console variable to the given value (and disabled by restoring its
+     *        previous value).
+     */
+    static FTweenHarnessBackend FromConsoleVariable(const FString& pConsoleVariableName, const FString& pValue = TEXT("1"));
+
+    FString Name;
+    TFunction<void()> Enable;
+    TFunction<void()> Disable;
+
+    /// @brief (optional) Applied to every Tween of the programs run with the backend, for the paths that are chosen per Tween (e.g. a rotation mode).
+    TFunction<void(FTweenHarnessTween&)> ModifyTween;
+};
+
+/**
+ * @brief The FTweenDifferentialHarness class runs randomized TweenContainer programs through the reference implementation and through
+ *        an alternate backend, and compares the two runs frame by frame: the order of the start/update/end events of every Tween, the values
+ *        they report and the final state of the targets. Programs exercise yoyo and restart loops, negative timescales (which invert the Tweens),
+ *        container restarts, pauses and deletions, and Tweens appended from end callbacks in the middle of an update.
+ *
+ *        Every run happens on a private UTweenManagerComponent without a world, so it can be used from the "TweenMaker.DiffTest" console command
+ *        in any build. Optimized paths should register themselves through RegisterBackend() so that they are tested by default.
+ */
+class TWEENMAKER_API FTweenDifferentialHarness : public FGCObject
+{
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    FTweenDifferentialHarness();
+
+    /**
+     * @brief Registers an alternate backend, tested when the console command is used without explicit console variables.
+     *        A backend with the same name is replaced.
+     */
+    static void RegisterBackend(const FTweenHarnessBackend& pBackend);
+
+    /**
+     * @brief Returns the registered alternate backends.
+     */
+    static const TArray<FTweenHarnessBackend>& GetRegisteredBackends();
+
+    /**
+     * @brief Runs a program on a fresh TweenManager and fresh targets.
+     *
+     * @param pProgram The program to run.
+     * @param pBackend The backend to enable during the run, or nullptr to use the reference implementation.
+     * @param pOutTrace (output) The trace of the run.
+     */
+    void Run(const FTweenHarnessProgram& pProgram, const FTweenHarnessBackend* pBackend, TArray<FTweenHarnessTraceEntry>& pOutTrace);
+
+    /**
+     * @brief Compares two traces.
+     *
+     * @param pReference The trace produced by the reference implementation.
+     * @param pCandidate The trace produced by the alternate backend.
+     * @param pTolerance The maximum (relative, for values greater than 1) difference allowed between two values.
+     * @param pOutReport (output) A description of the first divergence, if any.
+     *
+     * @return True if the traces match.
+     */
+    static bool CompareTraces(const TArray<FTweenHarnessTraceEntry>& pReference,
+                              const TArray<FTweenHarnessTraceEntry>& pCandidate,
+                              float pTolerance,
+                              FString& pOutReport);
+
+    /**
+     * @brief Generates and runs the given number of programs with and without the given backend, stopping at the first divergence.
+     *
+     * @param pNumPrograms How many programs to run.
+     * @param pSeed The seed of the first program (the following ones use consecutive seeds).
+     * @param pBackend The backend under test.
+     * @param pOutReport (output) A description of the first divergence, if any.
+     *
+     * @return True if all programs produced the same traces.
+     */
+    bool RunDifferential(int32 pNumPrograms, int32 pSeed, const FTweenHarnessBackend& pBackend, FString& pOutReport);
+
+    // Begin of FGCObject interface
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+    virtual FString GetReferencerName() const override;
+    // End of FGCObject interface
+
+private:
+
+    /**
+     * @brief Creates the given Tween in the given TweenContainer, and binds the delegates that write the trace.
+     */
+    void AddTween(UTweenContainer* pTweenContainer, const FTweenHarnessTween& pTween);
+
+    /**
+     * @brief Binds the C++ delegates of the given Tween so that its events are written in the trace.
+     */
+    template<typename TweenClass>
+    void BindTraceDelegates(TweenClass* pTween, bool pAppendOnEnd);
+
+    /**
+     * @brief Writes an entry in the trace of the current run.
+     */
+    void AddTraceEntry(ETweenHarnessEvent pEvent, int32 pId, const FVector4f& pValue);
+
+    /**
+     * @brief Writes the location and rotation of each target in the trace of the current run.
+     */
+    void AddTargetStates();
+
+    /**
+     * @brief Releases every object created by the last run.
+     */
+    void Reset();
+
+    /// @brief The TweenManager used for the current run.
+    UTweenManagerComponent* mTweenManager;
+
+    /// @brief The dummy targets of the current run.
+    TArray<USceneComponent*> mTargets;
+
+    /// @brief The dummy widgets of the current run, targets of the widget Tweens.
+    TArray<UWidget*> mWidgets;
+
+    /// @brief The spline followed by the "FollowSpline" Tweens of the current run.
+    USplineComponent* mSpline;
+
+    /// @brief TweenContainers of the current run, in creation order.
+    TArray<TWeakObjectPtr<UTweenContainer>> mContainers;
+
+    /// @brief The trace being written.
+    TArray<FTweenHarnessTraceEntry>* mTrace;
+
+    /// @brief The frame being simulated.
+    int32 mCurrentFrame;
+
+    /// @brief Id of the next Tween that will be created.
+    int32 mNextTweenId;
+};
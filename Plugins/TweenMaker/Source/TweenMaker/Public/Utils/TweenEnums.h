@@ -61,6 +61,17 @@ enum class ETweenLoopType : uint8
     Restart UMETA(ToolTip = "When a Tween reaches the end, it will restart from the beginning")
 };
 
+/// @brief Available collision modes, for the Tweens that move their target while hit or overlap events are bound.
+UENUM()
+enum class ETweenCollisionMode : uint8
+{
+    FullSweep UMETA(ToolTip = "Every move is a collision sweep (the default)"),
+    SweepEveryNFrames UMETA(ToolTip = "Only one move every N frames is a collision sweep, the others teleport the target"),
+    SweepOnDistance UMETA(ToolTip = "A move is a collision sweep only when the target moved more than a given distance since the last sweep"),
+    OverlapOnly UMETA(ToolTip = "Moves never sweep: overlaps are still updated at the new location, but hits are never generated"),
+    AsyncSweep UMETA(ToolTip = "Moves never sweep, but each move issues an asynchronous sweep: hits are reported (and DeleteTweenOnHit applied) one frame late. Overlaps are still updated synchronously, without latency; with only overlap events bound, OverlapOnly is used instead")
+};
+
 /// @brief Available Tween targets.
 UENUM()
 enum class ETweenTargetType : uint8
@@ -69,7 +80,10 @@ enum class ETweenTargetType : uint8
     SceneComponent,
     UMG,
     Material,
-    Custom
+    Custom,
+    InstancedStaticMesh,
+    MaterialParameterCollection,
+    CustomPrimitiveData
 };
 
 /// @brief Available Tweens for a "FVector" type.
@@ -80,7 +94,9 @@ enum class ETweenVectorType : uint8
     MoveBy,
     ScaleTo,
     ScaleBy,
-    Custom
+    Custom,
+    MoveAlongBezier,
+    MoveToComponent
 };
 
 /// @brief Available Tweens for a "FVector2D" type.
@@ -100,7 +116,15 @@ UENUM()
 enum class ETweenRotatorType : uint8
 {
     RotateTo,
-    RotateBy
+    RotateBy,
+    LookAtComponent
+};
+
+/// @brief Available Tweens for a "FTransform" type.
+UENUM()
+enum class ETweenTransformType : uint8
+{
+    TransformTo
 };
 
 /// @brief Available Tweens for a "FLinearColor" type.
@@ -146,7 +170,8 @@ UENUM()
 enum class ETweenRotationMode : uint8
 {
     ShortestPath UMETA(ToolTip = "The rotation occurs by taking the shortest path between the start and the end"),
-    FullPath UMETA(ToolTip = "The rotation occurs by taking the full path between the start and the end")
+    FullPath UMETA(ToolTip = "The rotation occurs by taking the full path between the start and the end"),
+    ShortestPathFast UMETA(ToolTip = "Same as ShortestPath, but with a corrected normalized lerp instead of a slerp: cheaper, with a negligible error")
 };
 
 /// @brief Available snap modes, used when a Tween is manually deleted to choose if it should go to the beginning/end or simply leave it be
@@ -176,6 +201,7 @@ enum class ETweenGenericType : uint8
     CustomVector UMETA(ToolTip = "Custom Vector Tweens."),
     CustomFloat UMETA(ToolTip = "Custom Float Tweens."),
     CustomVector2D UMETA(ToolTip = "Custom Vector2D Tweens."),
+    Transform UMETA(ToolTip = "Tweens that move, rotate and scale together either an Actor or a SceneComponent."),
 };
 
 
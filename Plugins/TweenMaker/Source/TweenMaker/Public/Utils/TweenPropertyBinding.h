@@ -0,0 +1,133 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief The FTweenPropertyBinding class lets a Custom Tween write its value straight into a property of its target, instead of relying on
+ *        an OnTweenUpdate event that copies it at each update.
+ *
+ *        The property path (e.g. "Settings.Speed") is resolved only once when binding, going through the members of nested structs: the
+ *        update then only has to write the value at the cached offset. If the property has a native setter (i.e. it's declared with the
+ *        "Setter" specifier, like the "Percent" of a ProgressBar) the setter is called instead, so that the object can react to the change.
+ *
+ *        Otherwise the render thread is only told about the change when it needs to be: a light gets its color and brightness updated, and
+ *        other rendered components only have their render state marked dirty when the property is a native one (i.e. one that their scene
+ *        proxy can read). The binding remembers the class it was resolved on, and resolves the path again when the target's class changes
+ *        (e.g. when a Blueprint is recompiled), since the cached property and offset belong to the old class. A path that can't be resolved
+ *        is only tried again (and reported again) once the class changes.
+ */
+class TWEENMAKER_API FTweenPropertyBinding
+{
+public:
+
+    /// @brief The kinds of value a Tween can write.
+    enum class EValueType : uint8
+    {
+        Float,
+        Vector,
+        Vector2D
+    };
+
+    /**
+     * @brief Constructor. The binding starts unbound.
+     */
+    FTweenPropertyBinding();
+
+    /**
+     * @brief Resolves the property path on the given object.
+     *
+     * @param pObject The object that owns the property.
+     * @param pPropertyPath The name of the property, with the members of nested structs separated by dots.
+     * @param pValueType The kind of value that will be written in the property.
+     *
+     * @return True if the property was found and can hold the given kind of value. Otherwise the binding is cleared.
+     */
+    bool Bind(UObject* pObject, const FString& pPropertyPath, EValueType pValueType);
+
+    /**
+     * @brief Clears the binding.
+     */
+    void Reset();
+
+    /**
+     * @brief Returns true if a property is bound.
+     */
+    bool IsBound() const
+    {
+        return mProperty != nullptr;
+    }
+
+    /**
+     * @brief Writes a value in the bound property. Does nothing if no property is bound.
+     *
+     * @param pObject The object passed to Bind().
+     * @param pValue The value to write.
+     */
+    void Write(UObject* pObject, float pValue);
+    void Write(UObject* pObject, const FVector& pValue);
+    void Write(UObject* pObject, const FVector2D& pValue);
+
+private:
+
+    /// @brief The types of properties that can be written.
+    enum class EPropertyType : uint8
+    {
+        Float,
+        Double,
+        Vector,
+        Vector3f,
+        Vector2D,
+        Vector2f
+    };
+
+    /// @brief How the render thread is told about a written value.
+    enum class ERenderUpdate : uint8
+    {
+        None,
+        LightColorAndBrightness,
+        RenderState
+    };
+
+    /**
+     * @brief Checks that the bound property still belongs to the class of the object, resolving the path again if it doesn't (or if it
+     *        failed to resolve on a different class).
+     *
+     * @return True if a property is bound and can be written on the object.
+     */
+    bool ValidateBinding(UObject* pObject);
+
+    /**
+     * @brief Writes the value with the setter of the property, or at its offset.
+     */
+    template<typename PropertyValueType>
+    void WriteValue(UObject* pObject, const PropertyValueType& pValue) const;
+
+    /// @brief The path passed to Bind().
+    FString mPropertyPath;
+
+    /// @brief The kind of value passed to Bind().
+    EValueType mValueType;
+
+    /// @brief The class the path was resolved on.
+    TWeakObjectPtr<const UClass> mBoundClass;
+
+    /// @brief The class the path last failed to resolve on, which isn't tried again until the target's class changes.
+    TWeakObjectPtr<const UClass> mFailedClass;
+
+    /// @brief The bound property (i.e. the last one of the path).
+    FProperty* mProperty;
+
+    /// @brief Offset of the bound property from the beginning of the object.
+    int32 mOffset;
+
+    /// @brief Type of the bound property.
+    EPropertyType mPropertyType;
+
+    /// @brief True if the value must be set with the setter of the property.
+    bool bUseSetter;
+
+    /// @brief How the render thread is told about a written value (never needed when the setter is used).
+    ERenderUpdate mRenderUpdate;
+};
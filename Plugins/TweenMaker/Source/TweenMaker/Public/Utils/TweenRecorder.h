@@ -0,0 +1,325 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "Utils/TweenEnums.h"
+
+class FArchive;
+class UBaseTween;
+class UTweenContainer;
+class USplineComponent;
+class USceneComponent;
+
+/// @brief Magic number written at the beginning of each recording ("TWRC").
+#define TWEEN_RECORDING_MAGIC 0x43525754
+
+/// @brief Current version of the recording format. Bump it whenever the layout of a record changes.
+#define TWEEN_RECORDING_VERSION 4
+
+/**
+ * @brief Calls a method of the recorder active on the TweenManager owning the given TweenContainer, if any. The arguments of the call are
+ *        only evaluated while recording, e.g. TWEEN_RECORD(mOwningTweenContainer, RecordTweenOp(ETweenRecordOp::TweenRestart, this)).
+ */
+#define TWEEN_RECORD(pTweenContainer, pRecorderCall)                                   \
+    do                                                                                 \
+    {                                                                                  \
+        if (FTweenRecorder* tweenRecorder = FTweenRecorder::Get(pTweenContainer))      \
+        {                                                                              \
+            tweenRecorder->pRecorderCall;                                              \
+        }                                                                              \
+    } while (false)
+
+/**
+ * @brief Opcodes of the records written in a Tween recording. Each record is made of the opcode followed by its payload.
+ */
+enum class ETweenRecordOp : uint8
+{
+    Frame,
+    CreateContainer,
+    AppendTween,
+    JoinTween,
+    SplineDefinition,
+    ContainerTimeScale,
+    ContainerLoop,
+    ContainerPersistent,
+    ContainerPause,
+    ContainerResume,
+    ContainerTogglePause,
+    ContainerRestart,
+    ContainerDelete,
+    TweenDelete,
+    TweenPause,
+    TweenResume,
+    TweenTogglePause,
+    TweenRestart,
+    TweenTimeScale,
+    TweenDelay,
+    DeleteAllTweens,
+    End,
+    TweenInstanceIndex,
+    TweenCustomPrimitiveDataIndex,
+    TweenSpring,
+    TweenRetarget,
+    TweenAddOrbiters,
+    TweenDestination
+};
+
+/**
+ * @brief The concrete Tween class (and Init flavour) a recorded Tween was created with.
+ */
+enum class ETweenRecordedClass : uint8
+{
+    Vector,
+    Vector2D,
+    Rotator,
+    LinearColor,
+    Float,
+    FloatRotateAround,
+    FloatFollowSpline,
+    Transform
+};
+
+/**
+ * @brief Everything needed to re-create a Tween through the UTweenManagerComponent's Append/Join methods.
+ *        Values of every Tween class are packed in the same 4-component vectors (e.g. a FRotator uses pitch/yaw/roll,
+ *        a FLinearColor uses RGBA, a float only uses X). A FTransform keeps its location in To, and its rotation and scale apart.
+ */
+struct TWEENMAKER_API FTweenRecordedTween
+{
+    /// @brief Flags packed in FTweenRecordedTween::Flags.
+    enum EFlags : uint8
+    {
+        LocalSpace           = 1 << 0,
+        DeleteOnHit          = 1 << 1,
+        DeleteOnOverlap      = 1 << 2,
+        SplineApplyRotation  = 1 << 3,
+        SplineApplyScale     = 1 << 4,
+        SplineConstantSpeed  = 1 << 5,
+        TweenWhileGamePaused = 1 << 6,
+        BezierConstantSpeed  = 1 << 7
+    };
+
+    FTweenRecordedTween();
+
+    ETweenRecordedClass TweenClass;
+    uint8 TweenType;
+    ETweenTargetType TargetType;
+    uint32 ContainerId;
+    uint32 TargetId;
+    int32 SequenceIndex;
+    FVector4f From;
+    FVector4f To;
+    float Duration;
+    ETweenEaseType EaseType;
+    int32 NumLoops;
+    ETweenLoopType LoopType;
+    float Delay;
+    float TimeScale;
+    ETweenSpace TweenSpace;
+    ETweenRotationMode RotationMode;
+    uint8 Flags;
+    FName ParameterName;
+    FVector3f PivotPoint;
+    FVector3f Axis;
+    float Radius;
+    uint32 SplineId;
+    FQuat4f ToRotation;
+    FVector3f ToScale;
+    TArray<FVector3f> BezierControlPoints;
+
+    friend FArchive& operator<<(FArchive& pArchive, FTweenRecordedTween& pRecord);
+};
+
+/**
+ * @brief The FTweenRecorder class writes the workload of a UTweenManagerComponent to a compact binary file: every TweenContainer
+ *        creation, every Append/Join (with its parameters), every pause/restart/delete/timescale change made on TweenContainers and
+ *        Tweens, and the delta time of each frame. The resulting file can be replayed headless by FTweenReplayer.
+ *
+ *        Objects are identified by sequential ids, so the file doesn't depend on the level that produced it. TweenContainers and Tweens
+ *        created before the recording started are unknown to the recorder, and operations on them are not written.
+ *        The ids are mapped from FObjectKeys, so an object created at the address of a destroyed one never inherits its id.
+ */
+class TWEENMAKER_API FTweenRecorder
+{
+public:
+
+    /**
+     * @brief Constructor. Opens the file and writes the header.
+     *
+     * @param pFilePath Full path of the file to write.
+     */
+    explicit FTweenRecorder(const FString& pFilePath);
+
+    /**
+     * @brief Destructor. Writes the end record and closes the file.
+     */
+    ~FTweenRecorder();
+
+    /**
+     * @brief Returns true if the file was successfully opened.
+     */
+    bool IsValid() const;
+
+    /**
+     * @brief Returns the full path of the recording.
+     */
+    const FString& GetFilePath() const;
+
+    /**
+     * @brief Retrieves the recorder currently active on the TweenManager owning the given TweenContainer, if any.
+     *
+     * @param pTweenContainer The TweenContainer (can be null).
+     *
+     * @return The active recorder, or nullptr if the owning TweenManager isn't recording.
+     */
+    static FTweenRecorder* Get(const UTweenContainer* pTweenContainer);
+
+    /**
+     * @brief Builds the full path of a recording from the given file name. Relative names are placed in the profiling directory.
+     *
+     * @param pFileName The file name (with or without extension). If empty, a timestamped name is generated.
+     *
+     * @return The full path.
+     */
+    static FString MakeRecordingPath(const FString& pFileName);
+
+    /**
+     * @brief Records the beginning of a frame.
+     *
+     * @param pDeltaTime The delta time that the TweenManager is about to use.
+     * @param pIsGamePaused True if the game is paused in this frame.
+     */
+    void RecordFrame(float pDeltaTime, bool pIsGamePaused);
+
+    /**
+     * @brief Records the creation of a new TweenContainer.
+     */
+    void RecordCreateContainer(const UTweenContainer* pTweenContainer, int32 pNumLoops, ETweenLoopType pLoopType, float pTimeScale);
+
+    /**
+     * @brief Records a Tween that was just created and initialized, right before it's added to its TweenContainer.
+     *
+     * @param pTweenContainer The TweenContainer the Tween is being added to.
+     * @param pSequenceIndex The sequence index passed to the Append/Join method.
+     * @param pIsJoin True if the Tween is being joined, false if it's being appended.
+     * @param pTween The initialized Tween.
+     */
+    void RecordTween(const UTweenContainer* pTweenContainer, int32 pSequenceIndex, bool pIsJoin, const UBaseTween* pTween);
+
+    /**
+     * @brief Records an operation on a TweenContainer.
+     *
+     * @param pOp The operation.
+     * @param pTweenContainer The involved TweenContainer.
+     * @param pValue Value of the operation (i.e. the new timescale), if any.
+     * @param pIntValue Integer value of the operation (i.e. the persistent flag), if any.
+     */
+    void RecordContainerOp(ETweenRecordOp pOp, const UTweenContainer* pTweenContainer, float pValue = 0.0f, int32 pIntValue = 0);
+
+    /**
+     * @brief Records a change of the loop settings of a TweenContainer.
+     */
+    void RecordContainerLoop(const UTweenContainer* pTweenContainer, int32 pNumLoops, ETweenLoopType pLoopType);
+
+    /**
+     * @brief Records an operation on a single Tween.
+     *
+     * @param pOp The operation.
+     * @param pTween The involved Tween.
+     * @param pValue Value of the operation (i.e. the new timescale or delay), if any.
+     * @param pIntValue Integer value of the operation (i.e. the skip flag, the instance or custom primitive data index, or the fire-end-event
+     *                  flag in bit 0 and the snap mode above it), if any.
+     */
+    void RecordTweenOp(ETweenRecordOp pOp, const UBaseTween* pTween, float pValue = 0.0f, int32 pIntValue = 0);
+
+    /**
+     * @brief Records the spring set on a Tween (see UBaseTween::SetSpring()).
+     */
+    void RecordTweenSpring(const UBaseTween* pTween, float pFrequency, float pDampingRatio, float pSettleThreshold, bool pEndWhenSettled);
+
+    /**
+     * @brief Records a retarget of a Tween.
+     *
+     * @param pTween The involved Tween.
+     * @param pNewTo The new ending value, packed like the values of FTweenRecordedTween.
+     * @param pNewDuration The new duration (negative to keep the current one).
+     */
+    void RecordTweenRetarget(const UBaseTween* pTween, const FVector4f& pNewTo, float pNewDuration);
+
+    /**
+     * @brief Records the components added to a "RotateAroundPoint" Tween (see UTweenFloat::AddOrbiters()).
+     */
+    void RecordTweenOrbiters(const UBaseTween* pTween, const TArray<USceneComponent*>& pOrbiters);
+
+    /**
+     * @brief Records the destination of a "MoveToComponent" or "LookAtComponent" Tween, which is given after the Tween was recorded.
+     *
+     * @param pTween The involved Tween.
+     * @param pDestination The destination component. It shares the ids of the targets.
+     * @param pSocketName The socket of the destination, if any.
+     * @param pOffset The offset from the destination.
+     */
+    void RecordTweenDestination(const UBaseTween* pTween, const USceneComponent* pDestination, FName pSocketName, const FVector& pOffset);
+
+    /**
+     * @brief Records a deletion of all TweenContainers.
+     */
+    void RecordDeleteAllTweens();
+
+    /**
+     * @brief Forgets the id of a TweenContainer that is being destroyed.
+     */
+    void ForgetContainer(const UTweenContainer* pTweenContainer);
+
+    /**
+     * @brief Forgets the id of a Tween that is being destroyed.
+     */
+    void ForgetTween(const UBaseTween* pTween);
+
+private:
+
+    /**
+     * @brief Writes the given spline's points the first time it's referenced, and returns its id.
+     */
+    uint32 RecordSpline(const USplineComponent* pSpline);
+
+    /**
+     * @brief Returns the id of the given object in the given map, optionally adding it.
+     *
+     * @return The id, or 0 if the object is unknown and shouldn't be added.
+     */
+    static uint32 GetObjectId(TMap<FObjectKey, uint32>& pMap, uint32& pNextId, const UObject* pObject, bool pAddIfMissing);
+
+    /**
+     * @brief Removes the entries of the objects that were destroyed from the given map. Their ids are never given again.
+     */
+    static void PruneObjectIds(TMap<FObjectKey, uint32>& pMap);
+
+    /// @brief The file being written.
+    TUniquePtr<FArchive> mWriter;
+
+    /// @brief Full path of the file being written.
+    FString mFilePath;
+
+    /// @brief Ids assigned to the recorded TweenContainers (0 is reserved for "unknown").
+    TMap<FObjectKey, uint32> mContainerIds;
+
+    /// @brief Ids assigned to the recorded Tweens (0 is reserved for "unknown").
+    TMap<FObjectKey, uint32> mTweenIds;
+
+    /// @brief Ids assigned to the Tween targets (0 is reserved for "no target").
+    TMap<FObjectKey, uint32> mTargetIds;
+
+    /// @brief Ids assigned to the splines used by FollowSpline Tweens (0 is reserved for "no spline").
+    TMap<FObjectKey, uint32> mSplineIds;
+
+    uint32 mNextContainerId;
+    uint32 mNextTweenId;
+    uint32 mNextTargetId;
+    uint32 mNextSplineId;
+
+    /// @brief Frames recorded since the maps of the targets and the splines were last pruned.
+    int32 mFramesSincePrune;
+};
@@ -0,0 +1,29 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "TweenReplayCommandlet.generated.h"
+
+/**
+ * The UTweenReplayCommandlet replays a Tween recording (see FTweenRecorder) headless, without loading any level, and logs its timings.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=TweenReplay -File=<FileName> [-Iterations=<N>]
+ */
+UCLASS()
+class TWEENMAKER_API UTweenReplayCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    UTweenReplayCommandlet();
+
+    // Begin of UCommandlet interface
+    virtual int32 Main(const FString& Params) override;
+    // End of UCommandlet interface
+};
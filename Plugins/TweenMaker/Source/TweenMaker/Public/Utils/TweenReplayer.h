@@ -0,0 +1,134 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "Utils/TweenEnums.h"
+
+class UTweenManagerComponent;
+class UTweenContainer;
+class UBaseTween;
+class USplineComponent;
+struct FTweenRecordedTween;
+
+/**
+ * @brief Statistics gathered while replaying a Tween recording.
+ */
+struct TWEENMAKER_API FTweenReplayStats
+{
+    FTweenReplayStats();
+
+    /**
+     * @brief Returns a one-line summary of the statistics.
+     */
+    FString ToString() const;
+
+    /// @brief Number of frames replayed.
+    int32 NumFrames;
+
+    /// @brief Number of TweenContainers created.
+    int32 NumContainers;
+
+    /// @brief Number of Tweens created.
+    int32 NumTweens;
+
+    /// @brief Time spent updating the TweenManager, summed over all frames (in seconds).
+    double TotalUpdateSeconds;
+
+    /// @brief Time spent by the slowest frame (in seconds).
+    double MaxFrameSeconds;
+
+    /// @brief Time spent creating TweenContainers and Tweens, and applying the recorded operations (in seconds).
+    double TotalOpsSeconds;
+};
+
+/**
+ * @brief The FTweenReplayer class replays a file written by FTweenRecorder on a private UTweenManagerComponent, without a world.
+ *        Every recorded target is replaced by a dummy object of a compatible class (actors become scene components, since they need a world),
+ *        so the Tweens run through the same code paths they used during the recorded play session. Hit and overlap events can't happen
+ *        on the dummy targets, but the deletions they caused were recorded and are replayed. Operations that were performed from Tween callbacks
+ *        during an update are applied right after the replayed frame that triggered them.
+ *
+ *        It can be used from the "TweenMaker.Replay" console command or from the headless "TweenReplay" commandlet.
+ */
+class TWEENMAKER_API FTweenReplayer : public FGCObject
+{
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    FTweenReplayer();
+
+    /**
+     * @brief Loads a recording in memory.
+     *
+     * @param pFilePath The file to load.
+     *
+     * @return True if the file exists and has a valid header.
+     */
+    bool Load(const FString& pFilePath);
+
+    /**
+     * @brief Replays the loaded recording from the beginning, on a fresh TweenManager and fresh dummy targets.
+     *
+     * @param pOutStats (output) The statistics of the run.
+     *
+     * @return True if the recording was replayed until its end without errors.
+     */
+    bool Replay(FTweenReplayStats& pOutStats);
+
+    // Begin of FGCObject interface
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+    virtual FString GetReferencerName() const override;
+    // End of FGCObject interface
+
+private:
+
+    /**
+     * @brief Creates the Tween described by the given record.
+     */
+    void ReplayTween(const FTweenRecordedTween& pRecord, bool pIsJoin);
+
+    /**
+     * @brief Retargets the given Tween, unpacking the new ending value according to its class.
+     */
+    void ReplayRetarget(UBaseTween* pTween, const FVector4f& pNewTo, float pNewDuration);
+
+    /**
+     * @brief Reads a spline definition and creates the corresponding dummy spline.
+     */
+    void ReplaySplineDefinition(FArchive& pArchive);
+
+    /**
+     * @brief Returns (creating it if needed) the dummy object that replaces the given recorded target.
+     *
+     * @param pTargetId The recorded target id.
+     * @param pTargetType (input/output) The recorded target type. It's changed if the dummy needs a different one.
+     */
+    UObject* GetDummyTarget(uint32 pTargetId, ETweenTargetType& pTargetType);
+
+    /**
+     * @brief Releases every object created by the last replay.
+     */
+    void Reset();
+
+    /// @brief The content of the recording.
+    TArray<uint8> mData;
+
+    /// @brief The TweenManager used for the replay.
+    UTweenManagerComponent* mTweenManager;
+
+    /// @brief TweenContainers, indexed by recorded id.
+    TArray<TWeakObjectPtr<UTweenContainer>> mContainers;
+
+    /// @brief Tweens, indexed by recorded id.
+    TArray<TWeakObjectPtr<UBaseTween>> mTweens;
+
+    /// @brief Dummy splines, indexed by recorded id.
+    TMap<uint32, USplineComponent*> mSplines;
+
+    /// @brief Dummy targets. Keys are the recorded target id combined with the target type.
+    TMap<uint64, UObject*> mDummyTargets;
+};
@@ -0,0 +1,110 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USplineComponent;
+
+/**
+ * @brief The FTweenSplineCache class samples a spline once, at regular time intervals, so that the FollowSpline Tweens can read their transform
+ *        with an interpolation instead of evaluating the spline (and, with constant speed, its reparameterization table) at each update.
+ *
+ *        Samples are in the spline's local space and are transformed by the spline component's current transform when read, so moving the
+ *        spline doesn't invalidate them. The cache is rebuilt when the spline's points or duration change.
+ *        One cache is shared by all Tweens following the same spline with the same speed mode.
+ *
+ *        The sample spacing is set by the "TweenMaker.SplineCacheSampleDistance" console variable (0 disables the cache).
+ */
+class TWEENMAKER_API FTweenSplineCache
+{
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param pSpline The spline to sample.
+     * @param pUseConstantSpeed Whether the spline is sampled by distance (constant speed) or by input key.
+     */
+    FTweenSplineCache(USplineComponent* pSpline, bool pUseConstantSpeed);
+
+    /**
+     * @brief Returns the cache of the given spline, creating it if no Tween is using it yet.
+     *
+     * @param pSpline The spline.
+     * @param pUseConstantSpeed Whether the spline is followed at constant speed.
+     *
+     * @return The cache, or null if caching is disabled.
+     */
+    static TSharedPtr<FTweenSplineCache> FindOrCreate(USplineComponent* pSpline, bool pUseConstantSpeed);
+
+    /**
+     * @brief Rebuilds the samples if the spline changed since they were taken.
+     *
+     * @return False if the spline isn't valid anymore.
+     */
+    bool Refresh();
+
+    /**
+     * @brief Returns the interpolated world location at the given time.
+     *
+     * @param pTime The time along the spline (between 0 and its duration).
+     */
+    FVector GetLocationAtTime(float pTime) const;
+
+    /**
+     * @brief Returns the interpolated transform at the given time, reading the samples only once. Location and rotation are in world space,
+     *        scale is the one set on the spline points.
+     *
+     * @param pTime The time along the spline (between 0 and its duration).
+     */
+    FTransform GetTransformAtTime(float pTime) const;
+
+    /**
+     * @brief Returns the number of samples.
+     */
+    int32 GetNumSamples() const
+    {
+        return mLocations.Num();
+    }
+
+private:
+
+    /**
+     * @brief Takes the samples.
+     */
+    void Build();
+
+    /**
+     * @brief Finds the samples surrounding the given time.
+     *
+     * @param pTime The time along the spline.
+     * @param pOutIndex (output) Index of the sample before the time.
+     * @param pOutAlpha (output) Position of the time between that sample and the next one, in [0, 1].
+     */
+    void FindSamples(float pTime, int32& pOutIndex, float& pOutAlpha) const;
+
+    /// @brief The sampled spline.
+    TWeakObjectPtr<USplineComponent> mSpline;
+
+    /// @brief Whether the spline is sampled by distance (constant speed) or by input key.
+    bool bUseConstantSpeed;
+
+    /// @brief Version of the spline curves when the samples were taken.
+    uint32 mSplineVersion;
+
+    /// @brief Duration of the spline when the samples were taken.
+    float mSplineDuration;
+
+    /// @brief Locations, in the spline's local space.
+    TArray<FVector> mLocations;
+
+    /// @brief Rotations, in the spline's local space.
+    TArray<FQuat> mRotations;
+
+    /// @brief Scales.
+    TArray<FVector> mScales;
+
+    /// @brief The caches in use, by spline and speed mode. Caches are destroyed when their last Tween releases them.
+    static TMap<TPair<TWeakObjectPtr<USplineComponent>, bool>, TWeakPtr<FTweenSplineCache>> sCaches;
+};
@@ -0,0 +1,134 @@
+// Copyright 2018 Francesco Desogus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief The FTweenSpring class drives a value towards a target with a damped spring, using the closed-form solution of the spring
+ *        equation instead of integrating it. The solution is exact whatever the time step, so the target can be changed at any update:
+ *        the value keeps its position and velocity and just heads towards the new target, without any pop.
+ *
+ *        For a given time step the new displacement and velocity are a linear combination of the old ones, so the four coefficients are
+ *        computed once per update and then shared by all the components of the value (e.g. the three of a vector).
+ *
+ *        The spring is critically damped with a damping ratio of 1, underdamped (i.e. it overshoots and oscillates) below 1 and
+ *        overdamped above 1.
+ */
+class TWEENMAKER_API FTweenSpring
+{
+public:
+
+    /**
+     * @brief Constructor. The spring starts disabled.
+     */
+    FTweenSpring();
+
+    /**
+     * @brief Enables the spring with the given parameters.
+     *
+     * @param pFrequency How fast the spring reacts, in oscillations per second (of the undamped spring).
+     * @param pDampingRatio How much the oscillations are damped (1 is critically damped, less than 1 overshoots).
+     * @param pSettleThreshold The spring is settled when both its distance from the target and its speed are below this value.
+     * @param pEndsWhenSettled True if the Tween ends once the spring settles, false if it stays at rest until it's moved again.
+     */
+    void Init(float pFrequency, float pDampingRatio, float pSettleThreshold, bool pEndsWhenSettled);
+
+    /**
+     * @brief Returns true if the spring was enabled.
+     */
+    bool IsEnabled() const
+    {
+        return bIsEnabled;
+    }
+
+    /**
+     * @brief Returns true if the Tween ends once the spring settles.
+     */
+    bool EndsWhenSettled() const
+    {
+        return bEndsWhenSettled;
+    }
+
+    /**
+     * @brief Computes the coefficients of the solution for the given time step. Must be called before Step().
+     *
+     * @param pDeltaTime The time step (in seconds).
+     */
+    void ComputeCoefficients(float pDeltaTime);
+
+    /**
+     * @brief Advances a value by the time step passed to the last ComputeCoefficients() call.
+     *
+     * @param pDisplacement (input/output) The distance of the value from its target.
+     * @param pVelocity (input/output) The velocity of the value.
+     */
+    template<typename ValueType>
+    void Step(ValueType& pDisplacement, ValueType& pVelocity) const
+    {
+        const ValueType displacement = pDisplacement;
+
+        pDisplacement = displacement * mPositionPosition + pVelocity * mPositionVelocity;
+        pVelocity     = displacement * mVelocityPosition + pVelocity * mVelocityVelocity;
+    }
+
+    /**
+     * @brief Checks if a value has settled on its target.
+     *
+     * @param pDisplacement The distance of the value from its target.
+     * @param pVelocity The velocity of the value.
+     *
+     * @return True if both are below the settle threshold.
+     */
+    template<typename ValueType>
+    bool IsSettled(const ValueType& pDisplacement, const ValueType& pVelocity) const
+    {
+        return    GetSizeSquared(pDisplacement) <= mSettleThresholdSquared
+               && GetSizeSquared(pVelocity) <= mSettleThresholdSquared;
+    }
+
+private:
+
+    /// @brief Squared sizes of the values a spring can drive.
+    static float GetSizeSquared(float pValue)
+    {
+        return pValue * pValue;
+    }
+
+    static float GetSizeSquared(const FVector& pValue)
+    {
+        return static_cast<float>(pValue.SizeSquared());
+    }
+
+    static float GetSizeSquared(const FLinearColor& pValue)
+    {
+        return pValue.R * pValue.R + pValue.G * pValue.G + pValue.B * pValue.B + pValue.A * pValue.A;
+    }
+
+    /// @brief True if the spring was enabled.
+    bool bIsEnabled;
+
+    /// @brief True if the Tween ends once the spring settles.
+    bool bEndsWhenSettled;
+
+    /// @brief Angular frequency of the undamped spring (in radians per second).
+    float mAngularFrequency;
+
+    /// @brief Damping ratio.
+    float mDampingRatio;
+
+    /// @brief Square of the settle threshold.
+    float mSettleThresholdSquared;
+
+    /// @brief Contribution of the old displacement to the new displacement.
+    float mPositionPosition;
+
+    /// @brief Contribution of the old velocity to the new displacement.
+    float mPositionVelocity;
+
+    /// @brief Contribution of the old displacement to the new velocity.
+    float mVelocityPosition;
+
+    /// @brief Contribution of the old velocity to the new velocity.
+    float mVelocityVelocity;
+};
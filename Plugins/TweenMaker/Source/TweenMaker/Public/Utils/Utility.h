@@ -10,6 +10,10 @@ class UBaseTween;
 // Custom log declaration
 TWEENMAKER_API DECLARE_LOG_CATEGORY_EXTERN(LogTweenMaker, Log, All);
 
+// Custom stats ("stat TweenMaker")
+DECLARE_STATS_GROUP(TEXT("TweenMaker"), STATGROUP_TweenMaker, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Collision sweeps"), STAT_TweenMakerSweeps, STATGROUP_TweenMaker, TWEENMAKER_API);
+
 /**
  * @brief The Utility class implements some utility static methods used in some parts of the plugin
  */
@@ -48,6 +52,14 @@ public:
      */
     static ETweenGenericType ConvertTweenTypeEnum(ETweenRotatorType pTweenType);
 
+    /**
+     * @brief Helper methodsthat converts a given tween type to a more
+     *        general tween category (i.e. a "vector scale" tween to a generic "scale" tween).
+     *
+     * @param pTweenType The starting tween type.
+     */
+    static ETweenGenericType ConvertTweenTypeEnum(ETweenTransformType pTweenType);
+
     /**
      * @brief Helper methodsthat converts a given tween type to a more
      *        general tween category (i.e. a "vector scale" tween to a generic "scale" tween).
@@ -108,6 +120,30 @@ public:
                                                 float& pOutRadius);
 
 
+    /**
+     * @brief Cheaper alternative to FQuat::Slerp() (shortest path): a normalized lerp whose alpha is corrected so that the angular speed
+     *        stays close to the one of a slerp. The error is well below a tenth of a degree, and there is no trigonometry involved.
+     *
+     * @param pFrom Starting rotation.
+     * @param pTo Ending rotation.
+     * @param pAlpha Interpolation alpha, between 0 and 1.
+     *
+     * @return The interpolated rotation.
+     */
+    static FQuat FastSlerp(const FQuat& pFrom, const FQuat& pTo, float pAlpha);
+
+    /**
+     * @brief Same as FastSlerp(), for many rotations going towards the same one with the same alpha. Rotations are processed
+     *        four at a time with SIMD instructions.
+     *
+     * @param pFrom Starting rotations.
+     * @param pTo Ending rotation, shared by all of them.
+     * @param pAlpha Interpolation alpha, between 0 and 1, shared by all of them.
+     * @param pOutResults (out) The interpolated rotations. Must have as many elements as pFrom (it can be pFrom itself).
+     * @param pNum Number of rotations.
+     */
+    static void FastSlerpBatch(const FQuat* pFrom, const FQuat& pTo, float pAlpha, FQuat* pOutResults, int32 pNum);
+
     /**
      * @brief Helper method that given a tween it finds the generic tween category it belongs to.
      *
@@ -119,6 +155,15 @@ public:
      */
     static ETweenGenericType FindOutTypeOfTween(UBaseTween* pTween);
 
+    /**
+     * @brief Helper method that returns a readable name of the class and the type of the given tween (i.e. "Vector MoveTo").
+     *
+     * @param pTween The involved tween.
+     *
+     * @return The name.
+     */
+    static FString GetTweenTypeName(const UBaseTween* pTween);
+
     /**
      * @brief Helper function that converts a value from an old range to a new one.
      *
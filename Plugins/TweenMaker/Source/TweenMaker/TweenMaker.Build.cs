@@ -27,5 +27,8 @@ public class TweenMaker : ModuleRules
                 "UMG"
 			}
 			);
+
+		// Adds the GameplayDebugger dependency and defines WITH_GAMEPLAY_DEBUGGER in the builds that support it
+		SetupGameplayDebuggerSupport(Target);
 	}
 }